@@ -21,6 +21,8 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/Memory/HugePages.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -106,6 +108,47 @@ namespace AZ::Internal
         return createCoreMetricsFile;
     }
 
+    static bool ParseHugePageMode(AZ::HugePages::Mode& mode, AZStd::string_view value)
+    {
+        constexpr AZStd::pair<AZStd::string_view, AZ::HugePages::Mode> HugePageModes[] = {
+            { "disabled", AZ::HugePages::Mode::Disabled },
+            { "transparent", AZ::HugePages::Mode::Transparent },
+            { "explicit", AZ::HugePages::Mode::Explicit },
+        };
+        for (const auto& [modeName, modeValue] : HugePageModes)
+        {
+            if (AZ::StringFunc::Equal(value, modeName))
+            {
+                mode = modeValue;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Applies the huge page settings from the settings registry. Settings that aren't in the registry keep the values
+    //! provided through the startup.cfg file, which were applied before the allocators were created.
+    static void ConfigureHugePages(SettingsRegistryInterface& settingsRegistry)
+    {
+        using FixedValueString = SettingsRegistryInterface::FixedValueString;
+        AZ::HugePages::Settings settings = AZ::HugePages::GetSettings();
+
+        if (FixedValueString modeValue;
+            settingsRegistry.Get(modeValue, FixedValueString(AZ::HugePages::SettingsRootKey) + "/Mode"))
+        {
+            AZ_Warning("ComponentApplication", ParseHugePageMode(settings.m_mode, modeValue),
+                "Unknown huge page mode \"%s\", expected \"disabled\", \"transparent\" or \"explicit\".", modeValue.c_str());
+        }
+        settingsRegistry.Get(settings.m_bindToLocalNumaNode, FixedValueString(AZ::HugePages::SettingsRootKey) + "/BindToLocalNumaNode");
+        if (AZ::u64 minimumAllocationSize{};
+            settingsRegistry.Get(minimumAllocationSize, FixedValueString(AZ::HugePages::SettingsRootKey) + "/MinimumAllocationSize"))
+        {
+            settings.m_minimumAllocationSize = aznumeric_cast<size_t>(minimumAllocationSize);
+        }
+
+        AZ::HugePages::SetSettings(settings);
+    }
+
     enum class DevelopmentSettingsOverrides
     {
         None, // 0 = no overrides are allowed
@@ -713,11 +756,32 @@ namespace AZ
             }
 
             auto& allocatorManager = AZ::AllocatorManager::Instance();
+            AZ::HugePages::Settings hugePageSettings = AZ::HugePages::GetSettings();
             // Now parse the config file settings without using heap allocations as well
             Settings::ConfigParserSettings configParserSettings;
             configParserSettings.m_parseConfigEntryFunc =
-                [&allocatorManager](const Settings::ConfigParserSettings::ConfigEntry& configEntry) -> bool
+                [&allocatorManager, &hugePageSettings](const Settings::ConfigParserSettings::ConfigEntry& configEntry) -> bool
             {
+                // The huge page settings need to be known before the allocators request their first arenas from the OS,
+                // so they can be provided here as well as in the settings registry
+                const AZStd::string_view key = configEntry.m_keyValuePair.m_key;
+                const AZStd::string_view value = configEntry.m_keyValuePair.m_value;
+                if (key == "allocator_huge_pages")
+                {
+                    Internal::ParseHugePageMode(hugePageSettings.m_mode, value);
+                    return true;
+                }
+                if (key == "allocator_numa_local")
+                {
+                    AZ::ConsoleTypeHelpers::ToValue(hugePageSettings.m_bindToLocalNumaNode, value);
+                    return true;
+                }
+                if (key == "allocator_huge_pages_min_size")
+                {
+                    AZ::ConsoleTypeHelpers::ToValue(hugePageSettings.m_minimumAllocationSize, value);
+                    return true;
+                }
+
                 // If a key in the config file is of the form with "allocator_tracking_<allocator_name>,
                 // try to convert the value into a boolean. If the value is true
                 // An entry of the allocator name is registered with the AllocatorManager
@@ -748,6 +812,7 @@ namespace AZ
 
             // Now uses the ConfigParser to parse the allocator settings
             AZ::Settings::ParseConfigFile(startupCfgStream, configParserSettings);
+            AZ::HugePages::SetSettings(hugePageSettings);
         }
     }
 
@@ -901,6 +966,8 @@ namespace AZ
 
         MergeSettingsToRegistry(*m_settingsRegistry);
 
+        Internal::ConfigureHugePages(*m_settingsRegistry);
+
         m_systemEntity = AZStd::make_unique<AZ::Entity>(SystemEntityId, "SystemEntity");
         CreateCommon();
         AZ_Assert(m_systemEntity, "SystemEntity failed to initialize!");
@@ -1627,6 +1694,9 @@ namespace AZ
             m_lastTickTime = currentMonotonicTime;
         }
 
+        // Recycle the scratch memory of the frame before the previous one, memory allocated on the last tick stays valid for this tick
+        static_cast<FrameAllocator&>(AllocatorInstance<FrameAllocator>::Get()).ResetFrame();
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -10,8 +10,10 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string_view.h>
 
 namespace AZ
@@ -31,6 +33,19 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Describes a compressed file that is made up of independently compressed blocks.
+        //! Every block decompresses to m_uncompressedBlockSize bytes, except the last block which holds the remainder of the file.
+        //! When available this allows blocks to be read and decompressed separately and in parallel.
+        struct CompressedBlockLayout
+        {
+            //! Size of a single block after it has been decompressed.
+            size_t m_uncompressedBlockSize = 0;
+            //! Alignment of the start of each compressed block relative to the start of the file. Has to be a power of two.
+            size_t m_compressedBlockAlignment = 1;
+            //! On disk size of each compressed block, in file order.
+            AZStd::vector<size_t> m_compressedBlockSizes;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -61,6 +76,11 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Optional layout of the compressed blocks in the file. If not set the file has to be decompressed as a whole.
+            //! When set the decompressor is called once per block with the compressed and uncompressed size of that block.
+            //! The Compression gem's CompressBlocks creates files with such a layout for any of its registered compressors
+            //! and the Archive gem's reader provides it for the compressed files of archives mounted for Streamer.
+            AZStd::shared_ptr<const CompressedBlockLayout> m_blockLayout;
         };
 
         class Compression
@@ -37,10 +37,10 @@ namespace AZ::IO
             break;
         }
 
-        u32 cacheSize = static_cast<AZ::u32>(m_cacheSizeMib * 1_mib);
+        u64 cacheSize = m_cacheSizeMib * 1_mib;
         if (blockSize * 2 > cacheSize)
         {
-            AZ_Warning("Streamer", false, "Size (%u) for BlockCache isn't big enough to hold at least two cache blocks of size (%zu). "
+            AZ_Warning("Streamer", false, "Size (%llu) for BlockCache isn't big enough to hold at least two cache blocks of size (%zu). "
                 "The cache size will be increased to fit 2 cache blocks.", cacheSize, blockSize);
             cacheSize = aznumeric_caster(blockSize * 2);
         }
@@ -71,6 +71,20 @@ namespace AZ::IO
     static constexpr char CacheHitRateName[] = "Cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
 
+    bool BlockCache::BlockKey::operator==(const BlockKey& rhs) const
+    {
+        return m_offset == rhs.m_offset && *m_path == *rhs.m_path;
+    }
+
+    size_t BlockCache::BlockKeyHasher::operator()(const BlockKey& key) const
+    {
+        // Checking for validity resolves the path if needed, which is required for the path hash to be available.
+        key.m_path->IsValid();
+        size_t hash = key.m_path->GetHash();
+        AZStd::hash_combine(hash, key.m_offset);
+        return hash;
+    }
+
     void BlockCache::Section::Prefix(const Section& section)
     {
         AZ_Assert(section.m_used, "Trying to prefix an unused section");
@@ -119,8 +133,9 @@ namespace AZ::IO
             m_cacheSize, alignment));
         m_cachedPaths = AZStd::unique_ptr<RequestPath[]>(new RequestPath[m_numBlocks]);
         m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
-        m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
+        m_blockReferenced = AZStd::unique_ptr<bool[]>(new bool[m_numBlocks]);
         m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+        m_blockIndex.reserve(m_numBlocks);
 
         ResetCache();
     }
@@ -364,6 +379,7 @@ namespace AZ::IO
 
     void BlockCache::FlushCache(const RequestPath& filePath)
     {
+        // Flushing is rare, so a scan over the blocks is preferred over keeping a second index by path.
         for (u32 i = 0; i < m_numBlocks; ++i)
         {
             if (m_cachedPaths[i] == filePath)
@@ -688,51 +704,68 @@ namespace AZ::IO
     void BlockCache::TouchBlock(u32 index)
     {
         AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
-        m_blockLastTouched[index] = AZStd::chrono::steady_clock::now();
+        m_blockReferenced[index] = true;
     }
 
     u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
 
-        // Find the oldest cache block.
-        TimePoint oldest = m_blockLastTouched[0];
-        u32 oldestIndex = 0;
-        for (u32 i = 1; i < m_numBlocks; ++i)
+        // Advance the clock hand until a block is found that isn't in flight and hasn't been referenced since the hand last passed.
+        // Referenced blocks get a second chance by clearing their flag. After two full rotations every block that's not in flight
+        // has had its flag cleared, so if no block was found by then all blocks are in flight.
+        const u32 maxSteps = m_numBlocks * 2;
+        for (u32 step = 0; step < maxSteps; ++step)
         {
-            if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+            const u32 index = m_clockHand;
+            m_clockHand = (m_clockHand + 1 < m_numBlocks) ? m_clockHand + 1 : 0;
+
+            if (IsCacheBlockInFlight(index))
             {
-                oldest = m_blockLastTouched[i];
-                oldestIndex = i;
+                continue;
+            }
+            if (m_blockReferenced[index])
+            {
+                m_blockReferenced[index] = false;
+                continue;
             }
-        }
 
-        if (!IsCacheBlockInFlight(oldestIndex))
-        {
             // Recycle the block.
-            m_cachedPaths[oldestIndex] = filePath;
-            m_cachedOffsets[oldestIndex] = offset;
-            TouchBlock(oldestIndex);
-            return oldestIndex;
-        }
-        else
-        {
-            return s_fileNotCached;
+            AssignCacheEntry(index, filePath, offset);
+            TouchBlock(index);
+            return index;
         }
+        return s_fileNotCached;
     }
 
     u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to find a block in the block cache needs to be a multiple of the block size.");
-        for (u32 i = 0; i < m_numBlocks; ++i)
+        auto it = m_blockIndex.find(BlockKey{ &filePath, offset });
+        return it != m_blockIndex.end() ? it->second : s_fileNotCached;
+    }
+
+    void BlockCache::RemoveFromBlockIndex(u32 index)
+    {
+        if (!m_cachedPaths[index].GetRelativePath().empty())
         {
-            if (m_cachedPaths[i] == filePath && m_cachedOffsets[i] == offset)
+            auto it = m_blockIndex.find(BlockKey{ &m_cachedPaths[index], m_cachedOffsets[index] });
+            if (it != m_blockIndex.end() && it->second == index)
             {
-                return i;
+                m_blockIndex.erase(it);
             }
         }
+    }
 
-        return s_fileNotCached;
+    void BlockCache::AssignCacheEntry(u32 index, const RequestPath& filePath, u64 offset)
+    {
+        RemoveFromBlockIndex(index);
+        m_cachedPaths[index] = filePath;
+        m_cachedOffsets[index] = offset;
+        // Remove a stale entry for the same file and offset first, so the stored key always points to the path of this block.
+        BlockKey key{ &m_cachedPaths[index], offset };
+        m_blockIndex.erase(key);
+        m_blockIndex.emplace(key, index);
     }
 
     bool BlockCache::IsCacheBlockInFlight(u32 index) const
@@ -745,9 +778,10 @@ namespace AZ::IO
     {
         AZ_Assert(index < m_numBlocks, "Index for resetting a cache entry in the BlockCache is out of bounds.");
 
+        RemoveFromBlockIndex(index);
         m_cachedPaths[index].Clear();
         m_cachedOffsets[index] = 0;
-        m_blockLastTouched[index] = TimePoint::min();
+        m_blockReferenced[index] = false;
         m_inFlightRequests[index] = nullptr;
     }
 
@@ -757,6 +791,8 @@ namespace AZ::IO
         {
             ResetCacheEntry(i);
         }
+        m_blockIndex.clear();
+        m_clockHand = 0;
         m_numInFlightRequests = 0;
     }
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -21,7 +22,6 @@
 
 namespace AZ::IO
 {
-    class RequestPath;
     namespace Requests
     {
         struct ReadData;
@@ -114,7 +114,20 @@ namespace AZ::IO
             void Prefix(const Section& section);
         };
 
-        using TimePoint = AZStd::chrono::steady_clock::time_point;
+        //! Key to look up cache blocks by file and offset. The path points to either the path of the request that's searching
+        //! or the path stored in m_cachedPaths for the block, so no copies of paths are needed for the index.
+        struct BlockKey
+        {
+            const RequestPath* m_path{ nullptr };
+            u64 m_offset{ 0 };
+
+            bool operator==(const BlockKey& rhs) const;
+        };
+
+        struct BlockKeyHasher
+        {
+            size_t operator()(const BlockKey& key) const;
+        };
 
         void ReadFile(FileRequest* request, Requests::ReadData& data);
         void ContinueReadFile(FileRequest* request, u64 fileLength);
@@ -129,6 +142,8 @@ namespace AZ::IO
         void TouchBlock(u32 index);
         AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
         u32 FindInCache(const RequestPath& filePath, u64 offset) const;
+        void AssignCacheEntry(u32 index, const RequestPath& filePath, u64 offset);
+        void RemoveFromBlockIndex(u32 index);
         bool IsCacheBlockInFlight(u32 index) const;
         void ResetCacheEntry(u32 index);
         void ResetCache();
@@ -153,10 +168,15 @@ namespace AZ::IO
         AZStd::unique_ptr<RequestPath[]> m_cachedPaths; // Array of m_numBlocks size.
         //! The offset into the file the cache blocks starts at.
         AZStd::unique_ptr<u64[]> m_cachedOffsets; // Array of m_numBlocks size.
-        //! The last time the cache block was read from.
-        AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
+        //! Whether or not the cache block was read from since the clock hand last passed it.
+        AZStd::unique_ptr<bool[]> m_blockReferenced; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
         AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        //! Index from file path and offset to the cache block that holds the data.
+        AZStd::unordered_map<BlockKey, u32, BlockKeyHasher> m_blockIndex;
+        //! The next cache block to consider for eviction. Blocks are evicted with the CLOCK algorithm, which gives recently
+        //! used blocks a second chance so finding a block to recycle doesn't require a scan over all blocks.
+        u32 m_clockHand{ 0 };
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
@@ -18,6 +18,7 @@
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/containers/lock_free_intrusive_stack.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string_view.h>
@@ -426,6 +427,11 @@ namespace AZ::IO
         FileRequest m_request;
         AZStd::atomic_uint64_t m_refCount{ 0 };
         StreamerContext* m_owner;
+        //! Link to the next request in the Scheduler's submission queue. Only used while the request is queued but not yet
+        //! picked up by the scheduling thread.
+        ExternalFileRequest* m_nextPending{ nullptr };
+        //! Hook for the lock-free recycle bin in the owning StreamerContext.
+        AZStd::lock_free_intrusive_stack_node<ExternalFileRequest> m_recycleBinHook;
     };
 
     class FileRequestHandle
@@ -37,7 +37,18 @@ namespace AZ::IO
         m_threadData.m_streamStack = AZStd::move(streamStack);
     }
 
-    Scheduler::~Scheduler() = default;
+    Scheduler::~Scheduler()
+    {
+        // Release requests that were queued but never picked up by the scheduling thread.
+        ExternalFileRequest* pending = m_pendingRequests.exchange(nullptr, AZStd::memory_order_acquire);
+        while (pending)
+        {
+            ExternalFileRequest* next = pending->m_nextPending;
+            pending->m_nextPending = nullptr;
+            pending->release();
+            pending = next;
+        }
+    }
 
     void Scheduler::Start(const AZStd::thread_desc& threadDesc)
     {
@@ -79,10 +90,10 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a request when Streamer's scheduler isn't running.");
 
-        {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            m_pendingRequests.push_back(AZStd::move(request));
-        }
+        // The submission queue keeps its own reference until the scheduling thread picks up the request.
+        ExternalFileRequest* pending = request.get();
+        pending->add_ref();
+        PushPendingRequests(pending, pending);
         m_context.WakeUpSchedulingThread();
     }
 
@@ -90,22 +101,37 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        if (requests.empty())
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            m_pendingRequests.insert(m_pendingRequests.end(), requests.begin(), requests.end());
+            return;
         }
+
+        // Link the batch newest first, the same order the submission queue stores requests in, so it can be pushed at once.
+        ExternalFileRequest* newest = nullptr;
+        for (const FileRequestPtr& request : requests)
+        {
+            ExternalFileRequest* pending = request.get();
+            pending->add_ref();
+            pending->m_nextPending = newest;
+            newest = pending;
+        }
+        PushPendingRequests(newest, requests.front().get());
         m_context.WakeUpSchedulingThread();
     }
 
     void Scheduler::QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests)
     {
-        AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
+        QueueRequestBatch(static_cast<const AZStd::vector<FileRequestPtr>&>(requests));
+        requests.clear();
+    }
 
+    void Scheduler::PushPendingRequests(ExternalFileRequest* newest, ExternalFileRequest* oldest)
+    {
+        ExternalFileRequest* head = m_pendingRequests.load(AZStd::memory_order_relaxed);
+        do
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            AZStd::move(requests.begin(), requests.end(), AZStd::back_inserter(m_pendingRequests));
-        }
-        m_context.WakeUpSchedulingThread();
+            oldest->m_nextPending = head;
+        } while (!m_pendingRequests.compare_exchange_weak(head, newest, AZStd::memory_order_release, AZStd::memory_order_relaxed));
     }
 
     void Scheduler::SuspendProcessing()
@@ -189,7 +215,6 @@ namespace AZ::IO
     void Scheduler::Thread_MainLoop()
     {
         m_threadData.m_streamStack->SetContext(m_context);
-        AZStd::vector<FileRequestPtr> outstandingRequests;
 
         while (m_isRunning)
         {
@@ -237,7 +262,7 @@ namespace AZ::IO
 
                 // Check if there are requests queued from other threads, if so move them to the main Streamer thread by executing them. This then
                 // requires another cycle or scheduling and executing commands.
-                if (!Thread_PrepareRequests(outstandingRequests))
+                if (!Thread_PrepareRequests())
                 {
                     break;
                 }
@@ -377,23 +402,28 @@ namespace AZ::IO
         return m_threadData.m_streamStack->ExecuteRequests();
     }
 
-    bool Scheduler::Thread_PrepareRequests(AZStd::vector<FileRequestPtr>& outstandingRequests)
+    bool Scheduler::Thread_PrepareRequests()
     {
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         TIMED_AVERAGE_WINDOW_SCOPE(m_preparingTimeStat);
 #endif
         AZ_PROFILE_FUNCTION(AzCore);
 
+        // Check before taking the queue so an idle scheduler doesn't keep claiming the cache line producers push to.
+        if (m_pendingRequests.load(AZStd::memory_order_relaxed) == nullptr)
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            if (!m_pendingRequests.empty())
-            {
-                outstandingRequests.swap(m_pendingRequests);
-            }
-            else
-            {
-                return false;
-            }
+            return false;
+        }
+        ExternalFileRequest* pending = m_pendingRequests.exchange(nullptr, AZStd::memory_order_acquire);
+
+        // Requests are pushed to the front of the queue, so reverse it to process them in the order they were queued.
+        ExternalFileRequest* outstandingRequests = nullptr;
+        while (pending)
+        {
+            ExternalFileRequest* next = pending->m_nextPending;
+            pending->m_nextPending = outstandingRequests;
+            outstandingRequests = pending;
+            pending = next;
         }
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -417,20 +447,26 @@ namespace AZ::IO
             }
         };
 
-        for (auto& request : outstandingRequests)
+        for (ExternalFileRequest* request = outstandingRequests; request != nullptr; request = request->m_nextPending)
         {
             AZStd::visit(visitor, request->m_request.GetCommand());
         }
-        for (auto& request : outstandingRequests)
+        while (outstandingRequests)
         {
+            ExternalFileRequest* request = outstandingRequests;
+            outstandingRequests = request->m_nextPending;
+            request->m_nextPending = nullptr;
+
             // Add a link in front of the external request to keep a reference to the FileRequestPtr alive while it's being processed.
+            // The link takes over the reference the submission queue held.
+            FileRequestPtr requestReference(request);
+            request->release();
             FileRequest* requestPtr = &request->m_request;
             FileRequest* linkRequest = m_context.GetNewInternalRequest();
-            linkRequest->CreateRequestLink(AZStd::move(request));
+            linkRequest->CreateRequestLink(AZStd::move(requestReference));
             requestPtr->SetStatus(IStreamerTypes::RequestStatus::Queued);
             m_threadData.m_streamStack->PrepareRequest(requestPtr);
         }
-        outstandingRequests.clear();
         return true;
     }
 
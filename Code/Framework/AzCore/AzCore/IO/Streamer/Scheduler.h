@@ -23,6 +23,7 @@
 
 namespace AZ::IO
 {
+    class ExternalFileRequest;
     class FileRequest;
     class Streamer_SchedulerTest_RequestSorting_Test;
 
@@ -69,10 +70,13 @@ namespace AZ::IO
         friend class Streamer_SchedulerTest_RequestSorting_Test;
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
 
+        //! Pushes a chain of requests linked from newest to oldest onto the submission queue.
+        void PushPendingRequests(ExternalFileRequest* newest, ExternalFileRequest* oldest);
+
         void Thread_MainLoop();
         void Thread_QueueNextRequest();
         bool Thread_ExecuteRequests();
-        bool Thread_PrepareRequests(AZStd::vector<FileRequestPtr>& outstandingRequests);
+        bool Thread_PrepareRequests();
         void Thread_ProcessTillIdle();
         void Thread_ProcessCancelRequest(FileRequest* request, Requests::CancelData& data);
         void Thread_ProcessRescheduleRequest(FileRequest* request, Requests::RescheduleData& data);
@@ -121,8 +125,9 @@ namespace AZ::IO
         AZ::Statistics::RunningStatistic m_immediateReadsPercentageStat;
 #endif
 
-        AZStd::mutex m_pendingRequestsLock;
-        AZStd::vector<FileRequestPtr> m_pendingRequests;
+        //! Lock-free submission queue from any thread to the scheduling thread. Requests are linked through
+        //! ExternalFileRequest::m_nextPending, newest first, and the scheduling thread takes the entire queue at once.
+        AZStd::atomic<ExternalFileRequest*> m_pendingRequests{ nullptr };
 
         AZStd::thread m_mainLoop;
         AZStd::atomic_bool m_isRunning{ false };
@@ -23,7 +23,18 @@ namespace AZ
         static constexpr const char* MissedDeadlinesName = "Missed deadlines";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
-        StreamerContext::StreamerContext() = default;
+        StreamerContext::StreamerContext()
+        {
+            // Create a few requests up front so the engine initialization doesn't
+            // constantly create new instances.
+            for (size_t i = 0; i < s_initialRecycleBinSize; ++i)
+            {
+                auto request = aznew ExternalFileRequest(this);
+                request->m_request.m_inRecycleBin = true;
+                m_externalRecycleBin.push(*request);
+            }
+            m_numExternalRequestsCreated = s_initialRecycleBinSize;
+        }
 
         StreamerContext::~StreamerContext()
         {
@@ -32,8 +43,7 @@ namespace AZ
                 delete entry;
             }
 
-            AZStd::scoped_lock<AZStd::mutex> guard(m_externalRecycleBinGuard);
-            for (ExternalFileRequest* entry : m_externalRecycleBin)
+            while (ExternalFileRequest* entry = m_externalRecycleBin.pop())
             {
                 delete entry;
             }
@@ -73,16 +83,25 @@ namespace AZ
 
         FileRequestPtr StreamerContext::GetNewExternalRequest()
         {
-            AZStd::scoped_lock<AZStd::mutex> guard(m_externalRecycleBinGuard);
-            return GetNewExternalRequestUnguarded();
+            ExternalFileRequest* result = m_externalRecycleBin.pop();
+            if (result == nullptr)
+            {
+                // There are no requests left in the recycle bin so create a new one. This will
+                // eventually end up in the recycle bin again.
+                m_numExternalRequestsCreated.fetch_add(1, AZStd::memory_order_relaxed);
+                return FileRequestPtr(aznew ExternalFileRequest(this));
+            }
+
+            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(result->m_request.m_command), "ExternalFileRequest wasn't properly reset.");
+            result->m_request.m_inRecycleBin = false;
+            return FileRequestPtr(result);
         }
 
         void StreamerContext::GetNewExternalRequestBatch(AZStd::vector<FileRequestPtr>& requests, size_t count)
         {
-            AZStd::scoped_lock<AZStd::mutex> guard(m_externalRecycleBinGuard);
             for (size_t i = 0; i < count; ++i)
             {
-                requests.push_back(GetNewExternalRequestUnguarded());
+                requests.push_back(GetNewExternalRequest());
             }
         }
 
@@ -150,9 +169,7 @@ namespace AZ
             AZ_Assert(!request->m_request.m_inRecycleBin, "External request that's already been recycled is being recycled again.");
             request->m_request.Reset();
             request->m_request.m_inRecycleBin = true;
-
-            AZStd::scoped_lock<AZStd::mutex> guard(m_externalRecycleBinGuard);
-            m_externalRecycleBin.push_back(request);
+            m_externalRecycleBin.push(*request);
         }
 
         bool StreamerContext::FinalizeCompletedRequests()
@@ -324,40 +341,10 @@ namespace AZ
                 "The total number of requests available in the internal recycle bin. Having at least a few available helps avoids memory "
                 "allocations from Streamer for internal management."));
             statistics.push_back(Statistic::CreateInteger(
-                ContextName, "External bucket size", aznumeric_caster(m_externalRecycleBin.size()),
-                "The total number of requests available in the external recycle bin. Having at least a few available helps avoid memory "
-                "allocations from Streamer and speeds up creating new requests to issue to Streamer."));
-        }
-
-        FileRequestPtr StreamerContext::GetNewExternalRequestUnguarded()
-        {
-            if (m_externalRecycleBin.empty())
-            {
-                if (m_externalRecycleBin.capacity() > 0)
-                {
-                    // There are no requests left in the recycle bin so create a new one. This will
-                    // eventually end up in the recycle bin again.
-                    return FileRequestPtr(aznew ExternalFileRequest(this));
-                }
-                else
-                {
-                    // Create a few requests up front so the engine initialization doesn't
-                    // constantly create new instances and resizes the recycle bin.
-                    m_externalRecycleBin.reserve(s_initialRecycleBinSize);
-                    for (size_t i = 0; i < s_initialRecycleBinSize; ++i)
-                    {
-                        auto request = aznew ExternalFileRequest(this);
-                        request->m_request.m_inRecycleBin = true;
-                        m_externalRecycleBin.push_back(request);
-                    }
-                }
-            }
-
-            FileRequestPtr result = m_externalRecycleBin.back();
-            AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(result->m_request.m_command), "ExternalFileRequest wasn't properly reset.");
-            m_externalRecycleBin.pop_back();
-            result->m_request.m_inRecycleBin = false;
-            return result;
+                ContextName, "External requests created", aznumeric_caster(m_numExternalRequestsCreated.load(AZStd::memory_order_relaxed)),
+                "The total number of external requests that have been created. Requests are recycled once released, so if this keeps "
+                "growing more requests are alive at the same time than the recycle bin could provide.",
+                Statistic::GraphType::None));
         }
     } // namespace IO
 } // namespace AZ
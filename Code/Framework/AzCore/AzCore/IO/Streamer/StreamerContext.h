@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext_Platform.h>
@@ -15,6 +16,7 @@
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/containers/lock_free_intrusive_stamped_stack.h>
 
 namespace AZ::IO
 {
@@ -46,8 +48,6 @@ namespace AZ::IO
         //! any system outside the stream stack and is thread safe. The owner
         //! needs to manually recycle these requests once they're done. Requests
         //! with a reference count of zero will automatically be recycled.
-        //! If multiple requests need to be create this is preferable as it only locks the
-        //! recycle bin once.
         void GetNewExternalRequestBatch(AZStd::vector<FileRequestPtr>& requests, size_t count);
 
         //! Gets the number of prepared requests. Prepared requests are requests
@@ -94,15 +94,15 @@ namespace AZ::IO
         void CollectStatistics(AZStd::vector<Statistic>& statistics);
 
     private:
-        //! Gets a new FileRequestPtr. This version is for internal use only and is not thread-safe.
-        //! This will be called by GetNewExternalRequest or GetNewExternalRequestBatch which are responsible
-        //! for managing the lock to the recycle bin.
-        FileRequestPtr GetNewExternalRequestUnguarded();
+        using ExternalRecycleBin = AZStd::lock_free_intrusive_stamped_stack<ExternalFileRequest,
+            AZStd::lock_free_intrusive_stack_member_hook<ExternalFileRequest, &ExternalFileRequest::m_recycleBinHook>>;
 
         inline static constexpr size_t s_initialRecycleBinSize = 64;
 
-        AZStd::mutex m_externalRecycleBinGuard;
-        AZStd::vector<ExternalFileRequest*> m_externalRecycleBin;
+        //! External requests are created and released from any thread, so their recycle bin is lock-free. Requests are only
+        //! deleted when the context is destroyed, which keeps the links of popped requests valid for concurrent pops.
+        ExternalRecycleBin m_externalRecycleBin;
+        AZStd::atomic<size_t> m_numExternalRequestsCreated{ 0 };
         AZStd::vector<FileRequest*> m_internalRecycleBin;
 
         // The completion is guarded so other threads can perform async IO and safely mark requests as completed.
@@ -766,6 +766,21 @@ namespace AZ
 
         AZ_Printf(AZ::Debug::NoWindow, "-,Totals,%.2f,%.2f,%.2f,\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
         AZ_Printf(AZ::Debug::NoWindow, "%d allocators active\n", m_numAllocators);
+
+        const PageUsageStats pageUsage = GetPageUsageStats();
+        if (pageUsage.m_mappingCount > 0 || pageUsage.m_fallbackCount > 0)
+        {
+            AZ_Printf(
+                AZ::Debug::NoWindow,
+                "Page usage: huge page size %.2f KiB, explicit huge pages %.2f KiB, transparent huge pages %.2f KiB, NUMA local %.2f KiB, "
+                "%zu mappings, %zu fallbacks\n",
+                pageUsage.m_hugePageSize / 1024.0f,
+                pageUsage.m_explicitHugePageBytes / 1024.0f,
+                pageUsage.m_transparentHugePageBytes / 1024.0f,
+                pageUsage.m_numaLocalBytes / 1024.0f,
+                pageUsage.m_mappingCount,
+                pageUsage.m_fallbackCount);
+        }
     }
     void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
     {
@@ -795,6 +810,11 @@ namespace AZ
         }
     }
 
+    auto AllocatorManager::GetPageUsageStats() const -> PageUsageStats
+    {
+        return HugePages::GetStatistics();
+    }
+
     //=========================================================================
     // MemoryBreak
     // [2/24/2011]
@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/HugePages.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -122,6 +123,10 @@ namespace AZ
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
 
+        //! Page usage of the memory allocators requested from the OS with huge pages or NUMA placement.
+        using PageUsageStats = HugePages::Statistics;
+        PageUsageStats GetPageUsageStats() const;
+
         //////////////////////////////////////////////////////////////////////////
         // Debug support
         static const int MaxNumMemoryBreaks = 5;
@@ -0,0 +1,530 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameAllocator.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/HugePages.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    AZ_TYPE_INFO_WITH_NAME_IMPL(FrameAllocator, "FrameAllocator", "{8C1A5F1E-3B7D-4E52-9A2C-6F0D4B8E1C73}");
+    AZ_RTTI_NO_TYPE_INFO_IMPL(FrameAllocator, AllocatorBase);
+
+    namespace
+    {
+        // Instance ids guard against a thread reusing its cached arena with a different allocator created at the same address
+        AZStd::atomic<AZ::u64> s_nextFrameAllocatorId{ 1 };
+
+        // Alignment of chunk data, allocations with a larger alignment are padded within the chunk
+        constexpr size_t ChunkAlignment = 16;
+
+        //! Tells the frame allocators whether the thread that owns an arena has exited. Shared by the thread and its arenas,
+        //! so it's allocated independently of any frame allocator and freed once both released it.
+        struct ThreadRecord
+        {
+            AZStd::atomic<bool> m_exited{ false };
+            AZStd::atomic<AZ::u32> m_refCount{ 1 };
+
+            void AddRef()
+            {
+                m_refCount.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+
+            void Release()
+            {
+                if (m_refCount.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+                {
+                    this->~ThreadRecord();
+                    AZStd::stateless_allocator().deallocate(this, sizeof(ThreadRecord), alignof(ThreadRecord));
+                }
+            }
+        };
+
+        //! Caches the arena of the calling thread for the frame allocator it last allocated from.
+        struct ThreadArenaCache
+        {
+            ~ThreadArenaCache()
+            {
+                m_allocatorId = 0;
+                m_arena = nullptr;
+                if (m_threadRecord != nullptr)
+                {
+                    // Lets the frame allocators release the arenas of this thread once their memory is recycled
+                    m_threadRecord->m_exited.store(true, AZStd::memory_order_release);
+                    m_threadRecord->Release();
+                    m_threadRecord = nullptr;
+                }
+            }
+
+            ThreadRecord* GetThreadRecord()
+            {
+                if (m_threadRecord == nullptr)
+                {
+                    void* recordMemory = AZStd::stateless_allocator().allocate(sizeof(ThreadRecord), alignof(ThreadRecord));
+                    m_threadRecord = new (recordMemory) ThreadRecord();
+                }
+                return m_threadRecord;
+            }
+
+            AZ::u64 m_allocatorId = 0;
+            void* m_arena = nullptr;
+            ThreadRecord* m_threadRecord = nullptr;
+        };
+
+        ThreadArenaCache& GetThreadArenaCache()
+        {
+            static thread_local ThreadArenaCache s_threadArenaCache;
+            return s_threadArenaCache;
+        }
+
+        // The size header of an allocation is only aligned to the allocation's alignment, so it's accessed with memcpy
+        FrameAllocator::size_type GetAllocationSize(const void* address)
+        {
+            FrameAllocator::size_type byteSize;
+            memcpy(&byteSize, static_cast<const char*>(address) - FrameAllocator::AllocationHeaderSize, sizeof(byteSize));
+            return byteSize;
+        }
+
+        void SetAllocationSize(void* address, FrameAllocator::size_type byteSize)
+        {
+            memcpy(static_cast<char*>(address) - FrameAllocator::AllocationHeaderSize, &byteSize, sizeof(byteSize));
+        }
+
+        //! Places an allocation behind its size header at the first suitably aligned address from begin.
+        char* PlaceAllocation(char* begin, FrameAllocator::size_type byteSize, FrameAllocator::size_type alignment)
+        {
+            char* address = reinterpret_cast<char*>(AZ::PointerAlignUp(begin + FrameAllocator::AllocationHeaderSize, alignment));
+            SetAllocationSize(address, byteSize);
+            return address;
+        }
+    }
+
+    //! Header placed at the start of every chunk, followed by the chunk data.
+    struct FrameAllocator::Chunk
+    {
+        Chunk* m_next = nullptr;
+        size_type m_dataSize = 0;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this) + AZ::SizeAlignUp(sizeof(Chunk), ChunkAlignment);
+        }
+    };
+
+    //! Allocation state of a single thread. Everything except the counters is only ever accessed by the owning thread.
+    struct FrameAllocator::ThreadArena
+    {
+        ThreadArena* m_next = nullptr; ///< Next arena in the allocator's list of arenas.
+        AZStd::thread_id m_threadId; ///< Thread that owns the arena.
+        ThreadRecord* m_threadRecord = nullptr; ///< Record of the owning thread, tells whether the thread exited.
+
+        char* m_cursor = nullptr; ///< Next free byte in the current chunk.
+        char* m_end = nullptr; ///< End of the current chunk.
+        char* m_lastAllocation = nullptr; ///< Most recent allocation in the current chunk, if it can still be resized or handed back.
+        size_t m_generation = 0; ///< Generation the arena is currently allocating in, the frame index modulo FrameLatency.
+        AZ::u64 m_frameIndex = 0; ///< Frame the arena last allocated in.
+        AZ::u64 m_garbageCollectRequests = 0; ///< Number of garbage collection requests the arena has handled.
+
+        Chunk* m_chunks[FrameLatency] = {}; ///< Chunks in use by each generation, the first chunk is the current one.
+        Chunk* m_freeChunks = nullptr; ///< Recycled chunks ready for reuse.
+
+        AZStd::atomic<AZ::u64> m_lastFrameIndex{ 0 }; ///< Mirror of m_frameIndex that other threads can read.
+        AZStd::atomic<size_type> m_allocatedBytes[FrameLatency] = {}; ///< Bytes allocated by each generation.
+    };
+
+    FrameAllocator::FrameAllocator()
+        : m_instanceId(s_nextFrameAllocatorId.fetch_add(1, AZStd::memory_order_relaxed))
+    {
+        PostCreate();
+    }
+
+    FrameAllocator::~FrameAllocator()
+    {
+        PreDestroy();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        while (m_arenas != nullptr)
+        {
+            ThreadArena* arena = m_arenas;
+            m_arenas = arena->m_next;
+            DestroyThreadArena(arena);
+        }
+    }
+
+    void FrameAllocator::ResetFrame()
+    {
+        const AZ::u64 frameIndex = m_frameIndex.fetch_add(1, AZStd::memory_order_release) + 1;
+        ReleaseExitedThreadArenas(frameIndex);
+    }
+
+    AZ::u64 FrameAllocator::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    AllocatorDebugConfig FrameAllocator::GetDebugConfig()
+    {
+        // Guards would need to be validated on deallocation, which frame allocations don't require
+        return AllocatorDebugConfig()
+            .StackRecordLevels(O3DE_STACK_CAPTURE_DEPTH)
+            .UsesMemoryGuards(false)
+            .MarksUnallocatedMemory(false);
+    }
+
+    AllocateAddress FrameAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        if (byteSize == 0)
+        {
+            return AllocateAddress{};
+        }
+        alignment = AZ::GetMax(alignment, size_type{ 1 });
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be a power of 2!");
+
+        ThreadArena& arena = GetThreadArena();
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        if (arena.m_frameIndex != frameIndex)
+        {
+            BeginArenaFrame(arena, frameIndex);
+        }
+
+        char* address = nullptr;
+        if (arena.m_cursor != nullptr)
+        {
+            address = reinterpret_cast<char*>(AZ::PointerAlignUp(arena.m_cursor + AllocationHeaderSize, alignment));
+        }
+        if (address == nullptr || address + byteSize > arena.m_end)
+        {
+            address = AllocateFromNewChunk(arena, byteSize, alignment);
+            if (address == nullptr)
+            {
+                OnOutOfMemory(byteSize, alignment);
+                return AllocateAddress{};
+            }
+        }
+        else
+        {
+            SetAllocationSize(address, byteSize);
+            arena.m_cursor = address + byteSize;
+            arena.m_lastAllocation = address;
+        }
+
+        // Only the owning thread writes the counters, so there is no need for an atomic read-modify-write
+        AZStd::atomic<size_type>& allocatedBytes = arena.m_allocatedBytes[arena.m_generation];
+        allocatedBytes.store(allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+
+        AZ_MEMORY_PROFILE(ProfileAllocation(address, byteSize, alignment, 1));
+        return AllocateAddress{ address, byteSize };
+    }
+
+    auto FrameAllocator::deallocate(pointer ptr, size_type byteSize, size_type alignment) -> size_type
+    {
+        if (ptr == nullptr)
+        {
+            return 0;
+        }
+
+        AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
+
+        // Memory is recycled with the frame, except for the most recent allocation of this thread which can be handed back right away
+        ThreadArena* arena = FindThreadArena();
+        if (arena != nullptr && arena->m_lastAllocation == ptr && arena->m_frameIndex == m_frameIndex.load(AZStd::memory_order_relaxed))
+        {
+            AZStd::atomic<size_type>& allocatedBytes = arena->m_allocatedBytes[arena->m_generation];
+            allocatedBytes.store(allocatedBytes.load(AZStd::memory_order_relaxed) - GetAllocationSize(ptr), AZStd::memory_order_relaxed);
+            arena->m_cursor = arena->m_lastAllocation - AllocationHeaderSize;
+            arena->m_lastAllocation = nullptr;
+        }
+        return byteSize;
+    }
+
+    AllocateAddress FrameAllocator::reallocate(pointer ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+
+        const size_type oldSize = GetAllocationSize(ptr);
+        if (newSize == 0)
+        {
+            deallocate(ptr, oldSize, newAlignment);
+            return AllocateAddress{};
+        }
+
+        ThreadArena* arena = FindThreadArena();
+        const bool isMostRecent = arena != nullptr && arena->m_lastAllocation == ptr
+            && arena->m_frameIndex == m_frameIndex.load(AZStd::memory_order_relaxed);
+        if (isMostRecent && static_cast<char*>(ptr) + newSize <= arena->m_end)
+        {
+            // Grow or shrink in place
+            AZStd::atomic<size_type>& allocatedBytes = arena->m_allocatedBytes[arena->m_generation];
+            arena->m_cursor = arena->m_lastAllocation + newSize;
+            SetAllocationSize(ptr, newSize);
+            allocatedBytes.store(allocatedBytes.load(AZStd::memory_order_relaxed) + newSize - oldSize, AZStd::memory_order_relaxed);
+            AZ_MEMORY_PROFILE(ProfileReallocation(ptr, ptr, newSize, newAlignment));
+            return AllocateAddress{ ptr, newSize };
+        }
+
+        // The old allocation stays in place until its frame is recycled, it can only be handed back while it's the most recent one
+        const AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (newAddress.GetAddress() != nullptr)
+        {
+            memcpy(newAddress.GetAddress(), ptr, AZ::GetMin(oldSize, newSize));
+            AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, oldSize, newAlignment, nullptr));
+        }
+        return newAddress;
+    }
+
+    auto FrameAllocator::get_allocated_size(pointer ptr, [[maybe_unused]] align_type alignment) const -> size_type
+    {
+        return ptr != nullptr ? GetAllocationSize(ptr) : 0;
+    }
+
+    void FrameAllocator::GarbageCollect()
+    {
+        // Chunks are owned by their thread, so each thread releases its own unused chunks when it starts its next frame
+        m_garbageCollectRequests.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    auto FrameAllocator::NumAllocatedBytes() const -> size_type
+    {
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        size_type numAllocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (const ThreadArena* arena = m_arenas; arena != nullptr; arena = arena->m_next)
+        {
+            // Skip arenas that haven't allocated for long enough that all of their memory will be recycled
+            if (frameIndex - arena->m_lastFrameIndex.load(AZStd::memory_order_relaxed) < FrameLatency)
+            {
+                for (const AZStd::atomic<size_type>& allocatedBytes : arena->m_allocatedBytes)
+                {
+                    numAllocatedBytes += allocatedBytes.load(AZStd::memory_order_relaxed);
+                }
+            }
+        }
+        return numAllocatedBytes;
+    }
+
+    auto FrameAllocator::FindThreadArena() const -> ThreadArena*
+    {
+        // Only the cache is checked, so threads that free memory without ever allocating never take the lock
+        const ThreadArenaCache& cache = GetThreadArenaCache();
+        return cache.m_allocatorId == m_instanceId ? static_cast<ThreadArena*>(cache.m_arena) : nullptr;
+    }
+
+    auto FrameAllocator::GetThreadArena() -> ThreadArena&
+    {
+        if (ThreadArena* arena = FindThreadArena())
+        {
+            return *arena;
+        }
+
+        // The cache only holds a single allocator, search for an arena this thread created before switching allocators.
+        // Arenas of exited threads are skipped, their thread id may have been reused by this thread.
+        ThreadArenaCache& cache = GetThreadArenaCache();
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            for (ThreadArena* arena = m_arenas; arena != nullptr; arena = arena->m_next)
+            {
+                if (arena->m_threadId == threadId && !arena->m_threadRecord->m_exited.load(AZStd::memory_order_relaxed))
+                {
+                    cache.m_allocatorId = m_instanceId;
+                    cache.m_arena = arena;
+                    return *arena;
+                }
+            }
+        }
+
+        void* arenaMemory = AllocatorInstance<SystemAllocator>::Get().allocate(sizeof(ThreadArena), alignof(ThreadArena));
+        ThreadArena* arena = new (arenaMemory) ThreadArena();
+        arena->m_threadId = threadId;
+        arena->m_threadRecord = cache.GetThreadRecord();
+        arena->m_threadRecord->AddRef();
+        arena->m_garbageCollectRequests = m_garbageCollectRequests.load(AZStd::memory_order_relaxed);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            arena->m_next = m_arenas;
+            m_arenas = arena;
+        }
+
+        cache.m_allocatorId = m_instanceId;
+        cache.m_arena = arena;
+
+        // Start the arena one frame behind so its first allocation begins the current frame
+        arena->m_frameIndex = m_frameIndex.load(AZStd::memory_order_acquire) - 1;
+        return *arena;
+    }
+
+    void FrameAllocator::BeginArenaFrame(ThreadArena& arena, AZ::u64 frameIndex)
+    {
+        // Recycle every generation that holds memory allocated FrameLatency or more frames ago
+        const AZ::u64 framesElapsed = frameIndex - arena.m_frameIndex;
+        const AZ::u64 generationsToRecycle = AZ::GetMin(framesElapsed, FrameLatency);
+        for (AZ::u64 i = 0; i < generationsToRecycle; ++i)
+        {
+            RecycleGeneration(arena, static_cast<size_t>((frameIndex - i) % FrameLatency));
+        }
+
+        const AZ::u64 garbageCollectRequests = m_garbageCollectRequests.load(AZStd::memory_order_relaxed);
+        if (arena.m_garbageCollectRequests != garbageCollectRequests)
+        {
+            arena.m_garbageCollectRequests = garbageCollectRequests;
+            while (Chunk* chunk = arena.m_freeChunks)
+            {
+                arena.m_freeChunks = chunk->m_next;
+                DestroyChunk(chunk);
+            }
+        }
+
+        arena.m_generation = static_cast<size_t>(frameIndex % FrameLatency);
+        arena.m_frameIndex = frameIndex;
+        arena.m_lastFrameIndex.store(frameIndex, AZStd::memory_order_relaxed);
+        arena.m_cursor = nullptr;
+        arena.m_end = nullptr;
+        arena.m_lastAllocation = nullptr;
+    }
+
+    void FrameAllocator::ReleaseExitedThreadArenas(AZ::u64 frameIndex)
+    {
+        // The arena of a thread that exited is released once the memory it allocated in its last frame is recycled
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        ThreadArena** link = &m_arenas;
+        while (ThreadArena* arena = *link)
+        {
+            if (arena->m_threadRecord->m_exited.load(AZStd::memory_order_acquire)
+                && frameIndex - arena->m_lastFrameIndex.load(AZStd::memory_order_relaxed) >= FrameLatency)
+            {
+                *link = arena->m_next;
+                DestroyThreadArena(arena);
+            }
+            else
+            {
+                link = &arena->m_next;
+            }
+        }
+    }
+
+    void FrameAllocator::DestroyThreadArena(ThreadArena* arena)
+    {
+        for (size_t generation = 0; generation < FrameLatency; ++generation)
+        {
+            RecycleGeneration(*arena, generation);
+        }
+        while (Chunk* chunk = arena->m_freeChunks)
+        {
+            arena->m_freeChunks = chunk->m_next;
+            DestroyChunk(chunk);
+        }
+        arena->m_threadRecord->Release();
+        arena->~ThreadArena();
+        AllocatorInstance<SystemAllocator>::Get().deallocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+    }
+
+    void FrameAllocator::RecycleGeneration(ThreadArena& arena, size_t generation)
+    {
+        while (Chunk* chunk = arena.m_chunks[generation])
+        {
+            arena.m_chunks[generation] = chunk->m_next;
+            if (chunk->m_dataSize == ChunkSize)
+            {
+                chunk->m_next = arena.m_freeChunks;
+                arena.m_freeChunks = chunk;
+            }
+            else
+            {
+                // Chunks created for large allocations aren't reused
+                DestroyChunk(chunk);
+            }
+        }
+        arena.m_allocatedBytes[generation].store(0, AZStd::memory_order_relaxed);
+    }
+
+    char* FrameAllocator::AllocateFromNewChunk(ThreadArena& arena, size_type byteSize, size_type alignment)
+    {
+        Chunk*& chunks = arena.m_chunks[arena.m_generation];
+        const size_type paddedSize = AllocationHeaderSize + byteSize + alignment - 1;
+        if (paddedSize > ChunkSize / 2)
+        {
+            // Large allocations get a chunk of their own, placed behind the current chunk so allocating can continue from it
+            Chunk* chunk = CreateChunk(paddedSize);
+            if (chunk == nullptr)
+            {
+                return nullptr;
+            }
+            if (arena.m_cursor != nullptr)
+            {
+                chunk->m_next = chunks->m_next;
+                chunks->m_next = chunk;
+            }
+            else
+            {
+                chunk->m_next = chunks;
+                chunks = chunk;
+            }
+            return PlaceAllocation(chunk->GetData(), byteSize, alignment);
+        }
+
+        Chunk* chunk = arena.m_freeChunks;
+        if (chunk != nullptr)
+        {
+            arena.m_freeChunks = chunk->m_next;
+        }
+        else
+        {
+            chunk = CreateChunk(ChunkSize);
+            if (chunk == nullptr)
+            {
+                return nullptr;
+            }
+        }
+        chunk->m_next = chunks;
+        chunks = chunk;
+
+        char* address = PlaceAllocation(chunk->GetData(), byteSize, alignment);
+        arena.m_cursor = address + byteSize;
+        arena.m_end = chunk->GetData() + chunk->m_dataSize;
+        arena.m_lastAllocation = address;
+        return address;
+    }
+
+    auto FrameAllocator::CreateChunk(size_type dataSize) -> Chunk*
+    {
+        const size_type headerSize = AZ::SizeAlignUp(sizeof(Chunk), ChunkAlignment);
+        // Chunks are only allocated from by the thread that created them, so they're bound to its NUMA node when enabled
+        void* memory = HugePages::AllocateThreadArena(headerSize + dataSize, ChunkAlignment);
+        if (memory == nullptr)
+        {
+            memory = AllocatorInstance<SystemAllocator>::Get().allocate(headerSize + dataSize, ChunkAlignment);
+        }
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        Chunk* chunk = new (memory) Chunk();
+        chunk->m_dataSize = dataSize;
+        return chunk;
+    }
+
+    void FrameAllocator::DestroyChunk(Chunk* chunk)
+    {
+        const size_type headerSize = AZ::SizeAlignUp(sizeof(Chunk), ChunkAlignment);
+        const size_type chunkSize = headerSize + chunk->m_dataSize;
+        chunk->~Chunk();
+        if (!HugePages::Free(chunk))
+        {
+            AllocatorInstance<SystemAllocator>::Get().deallocate(chunk, chunkSize, ChunkAlignment);
+        }
+    }
+} // namespace AZ
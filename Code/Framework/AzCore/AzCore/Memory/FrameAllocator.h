@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame allocator
+     * Linear allocator for scratch memory that only needs to live for the tick it was allocated in, such as temporary
+     * containers built while culling, enumerating visibility or gathering replication candidates.
+     * Every thread bump allocates from its own chunks, so allocating never locks and deallocating is free. Memory is not
+     * reused when deallocated (except for the most recent allocation of a thread), instead all memory is recycled at once
+     * when the frame is reset, which the ComponentApplication does at the start of every tick. The chunks of threads that
+     * exited are released by the first frame reset after their memory is recycled.
+     * Memory allocated on a tick stays valid until the end of the following tick, so work that completes asynchronously
+     * one tick later can still read it. Anything that needs to live longer than that must use another allocator.
+     */
+    class FrameAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL(FrameAllocator);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Size of the chunks threads bump allocate from, allocations larger than half a chunk get a chunk of their own.
+        static constexpr size_type ChunkSize = 256 * 1024;
+
+        //! Number of frames memory stays valid for, including the frame it was allocated in.
+        static constexpr AZ::u64 FrameLatency = 2;
+
+        //! Every allocation is preceded by its size, so any allocation can be reallocated.
+        static constexpr size_type AllocationHeaderSize = sizeof(size_type);
+
+        FrameAllocator();
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+        ~FrameAllocator() override;
+
+        //! Starts a new frame, recycling memory allocated FrameLatency frames ago.
+        //! Threads pick up the new frame on their next allocation, so this never waits on other threads' allocations.
+        void ResetFrame();
+
+        //! Returns the number of frames that have been reset since the allocator was created.
+        AZ::u64 GetFrameIndex() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        size_type       deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        //! The most recent allocation of the calling thread is resized in place, which covers growing a container that is being filled.
+        //! Any other allocation is copied to a new allocation and stays in place until its frame is recycled.
+        AllocateAddress reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
+        size_type       get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+        //! Releases chunks that are no longer in use, each thread frees its unused chunks when it starts its next frame.
+        void            GarbageCollect() override;
+        //! Returns the bytes allocated by all threads within the frames that are still valid.
+        size_type       NumAllocatedBytes() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+    private:
+        struct Chunk;
+        struct ThreadArena;
+
+        ThreadArena* FindThreadArena() const;
+        ThreadArena& GetThreadArena();
+        void BeginArenaFrame(ThreadArena& arena, AZ::u64 frameIndex);
+        void RecycleGeneration(ThreadArena& arena, size_t generation);
+        void ReleaseExitedThreadArenas(AZ::u64 frameIndex);
+        void DestroyThreadArena(ThreadArena* arena);
+        char* AllocateFromNewChunk(ThreadArena& arena, size_type byteSize, size_type alignment);
+        Chunk* CreateChunk(size_type dataSize);
+        void DestroyChunk(Chunk* chunk);
+
+        const AZ::u64 m_instanceId;
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        AZStd::atomic<AZ::u64> m_garbageCollectRequests{ 0 };
+
+        mutable AZStd::mutex m_arenasMutex; ///< Only guards m_arenas, taken once per thread, once per frame and when gathering statistics.
+        ThreadArena* m_arenas = nullptr;
+    };
+
+    using FrameStdAllocator = AZStdAlloc<FrameAllocator>;
+}
@@ -11,6 +11,7 @@
 #include <AzCore/std/allocator_stateless.h>
 
 #include <AzCore/Math/Random.h>
+#include <AzCore/Memory/HugePages.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
@@ -414,6 +415,7 @@ namespace AZ
         block_header* tree_extract_aligned(size_t size, size_t alignment);
         block_header* tree_extract_bucket_page();
         block_header* tree_add_block(void* mem, size_t size);
+        size_t tree_grow_size(size_t size) const;
         block_header* tree_grow(size_t size);
         block_header* tree_grow_aligned(size_t size, size_t alignment);
         void tree_attach(block_header* bl);
@@ -1521,12 +1523,22 @@ namespace AZ
         return front;
     }
 
+    template<bool DebugAllocatorEnable>
+    size_t HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_grow_size(size_t size) const
+    {
+        // With huge pages enabled the tree grows in huge page sized arenas, so the arenas can be backed with huge pages
+        if (const size_t arenaSize = AZ::HugePages::GetArenaSize(); arenaSize > m_treePageSize)
+        {
+            return AZ::SizeAlignUp(size, arenaSize);
+        }
+        return (size < m_treePageSize) ? AZ::SizeAlignUp(size, m_treePageSize) : size;
+    }
+
     template<bool DebugAllocatorEnable>
     auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_grow(size_t size) -> block_header*
     {
         const size_t sizeWithBlockHeaders = size + 3 * sizeof(block_header); // two fences plus one fake
-        const size_t newSize =
-            (sizeWithBlockHeaders < m_treePageSize) ? AZ::SizeAlignUp(sizeWithBlockHeaders, m_treePageSize) : sizeWithBlockHeaders;
+        const size_t newSize = tree_grow_size(sizeWithBlockHeaders);
         HPPA_ASSERT(newSize >= sizeWithBlockHeaders);
 
         if (void* mem = tree_system_alloc(newSize))
@@ -1608,10 +1620,7 @@ namespace AZ
             sizeWithBlockHeadersAndAlignmentPadding += alignment - 2 * sizeof(block_header);
         }
 
-        const size_t newSize =
-            (sizeWithBlockHeadersAndAlignmentPadding < m_treePageSize)
-            ? AZ::SizeAlignUp(sizeWithBlockHeadersAndAlignmentPadding, m_treePageSize)
-            : sizeWithBlockHeadersAndAlignmentPadding;
+        const size_t newSize = tree_grow_size(sizeWithBlockHeadersAndAlignmentPadding);
         HPPA_ASSERT(newSize >= sizeWithBlockHeaders);
 
         if (void* mem = tree_system_alloc(newSize))
@@ -2268,6 +2277,10 @@ namespace AZ
     void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::SystemAlloc(size_t size, size_t align)
     {
         AZ_Assert(align % OS_VIRTUAL_PAGE_SIZE == 0, "Invalid allocation/page alignment %d should be a multiple of %d!", size, OS_VIRTUAL_PAGE_SIZE);
+        if (void* ptr = AZ::HugePages::Allocate(size, align))
+        {
+            return ptr;
+        }
         return AZ_OS_MALLOC(size, align);
     }
 
@@ -2278,7 +2291,10 @@ namespace AZ
     template<bool DebugAllocatorEnable>
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::SystemFree(void* ptr)
     {
-        AZ_OS_FREE(ptr);
+        if (!AZ::HugePages::Free(ptr))
+        {
+            AZ_OS_FREE(ptr);
+        }
     }
 
     template<bool DebugAllocatorEnable>
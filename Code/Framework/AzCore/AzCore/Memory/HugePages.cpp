@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/HugePages.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::HugePages
+{
+    namespace
+    {
+        AZStd::atomic<Mode> s_mode{ Mode::Disabled };
+        AZStd::atomic_bool s_bindToLocalNumaNode{ false };
+        AZStd::atomic<size_t> s_minimumAllocationSize{ Settings{}.m_minimumAllocationSize };
+
+        // Allows frees of regular allocations to skip the mapping table while nothing is mapped
+        AZStd::atomic<size_t> s_mappingCount{ 0 };
+
+        //! Mappings sorted by address, so they can be found with a binary search when freed. The table has a fixed
+        //! capacity as it's used underneath the allocators and can't allocate memory itself. Mappings are at least a few
+        //! pages large, so the capacity covers far more memory than a process can map.
+        struct MappingTable
+        {
+            static constexpr size_t Capacity = 8192;
+
+            AZStd::mutex m_mutex;
+            Platform::Mapping m_mappings[Capacity];
+            size_t m_count = 0;
+            Statistics m_statistics;
+        };
+
+        MappingTable& GetMappingTable()
+        {
+            static MappingTable s_mappingTable;
+            return s_mappingTable;
+        }
+
+        //! Returns the index of the first mapping that doesn't start before address. The table must be locked.
+        size_t FindMappingIndex(const MappingTable& table, const void* address)
+        {
+            size_t first = 0;
+            size_t count = table.m_count;
+            while (count > 0)
+            {
+                const size_t step = count / 2;
+                if (table.m_mappings[first + step].m_address < address)
+                {
+                    first += step + 1;
+                    count -= step + 1;
+                }
+                else
+                {
+                    count = step;
+                }
+            }
+            return first;
+        }
+
+        void UpdateStatistics(Statistics& statistics, const Platform::Mapping& mapping, bool isMapped)
+        {
+            auto update = [isMapped, &mapping](size_t& value)
+            {
+                value = isMapped ? value + mapping.m_size : value - mapping.m_size;
+            };
+            if (mapping.m_flags & Platform::MappingFlags_ExplicitHugePages)
+            {
+                update(statistics.m_explicitHugePageBytes);
+            }
+            if (mapping.m_flags & Platform::MappingFlags_TransparentHugePages)
+            {
+                update(statistics.m_transparentHugePageBytes);
+            }
+            if (mapping.m_flags & Platform::MappingFlags_NumaLocal)
+            {
+                update(statistics.m_numaLocalBytes);
+            }
+        }
+
+        void* MapAndTrack(size_t byteSize, size_t alignment, Mode mode, bool bindToLocalNumaNode)
+        {
+            MappingTable& table = GetMappingTable();
+            Platform::Mapping mapping;
+            if (s_mappingCount.load(AZStd::memory_order_relaxed) < MappingTable::Capacity)
+            {
+                mapping = Platform::Map(byteSize, alignment, mode, bindToLocalNumaNode);
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(table.m_mutex);
+                if (mapping.m_address != nullptr && table.m_count < MappingTable::Capacity)
+                {
+                    const size_t index = FindMappingIndex(table, mapping.m_address);
+                    memmove(&table.m_mappings[index + 1], &table.m_mappings[index], (table.m_count - index) * sizeof(Platform::Mapping));
+                    table.m_mappings[index] = mapping;
+                    ++table.m_count;
+                    s_mappingCount.store(table.m_count, AZStd::memory_order_relaxed);
+                    UpdateStatistics(table.m_statistics, mapping, true);
+                    return mapping.m_address;
+                }
+                ++table.m_statistics.m_fallbackCount;
+            }
+
+            // The table filled up while mapping
+            if (mapping.m_address != nullptr)
+            {
+                Platform::Unmap(mapping.m_address, mapping.m_size);
+            }
+            return nullptr;
+        }
+    } // namespace
+
+    void SetSettings(const Settings& settings)
+    {
+        s_minimumAllocationSize.store(settings.m_minimumAllocationSize, AZStd::memory_order_relaxed);
+        s_bindToLocalNumaNode.store(settings.m_bindToLocalNumaNode, AZStd::memory_order_relaxed);
+        s_mode.store(settings.m_mode, AZStd::memory_order_relaxed);
+    }
+
+    Settings GetSettings()
+    {
+        Settings settings;
+        settings.m_mode = s_mode.load(AZStd::memory_order_relaxed);
+        settings.m_bindToLocalNumaNode = s_bindToLocalNumaNode.load(AZStd::memory_order_relaxed);
+        settings.m_minimumAllocationSize = s_minimumAllocationSize.load(AZStd::memory_order_relaxed);
+        return settings;
+    }
+
+    size_t GetHugePageSize()
+    {
+        return Platform::GetHugePageSize();
+    }
+
+    size_t GetArenaSize()
+    {
+        const size_t hugePageSize = GetHugePageSize();
+        if (hugePageSize == 0 || s_mode.load(AZStd::memory_order_relaxed) == Mode::Disabled)
+        {
+            return 0;
+        }
+        return AZ::SizeAlignUp(AZStd::max(s_minimumAllocationSize.load(AZStd::memory_order_relaxed), size_t{ 1 }), hugePageSize);
+    }
+
+    bool UsesHugePages(size_t byteSize)
+    {
+        return s_mode.load(AZStd::memory_order_relaxed) != Mode::Disabled &&
+            byteSize >= s_minimumAllocationSize.load(AZStd::memory_order_relaxed) && GetHugePageSize() != 0;
+    }
+
+    void* Allocate(size_t byteSize, size_t alignment)
+    {
+        if (!UsesHugePages(byteSize))
+        {
+            return nullptr;
+        }
+        return MapAndTrack(byteSize, alignment, s_mode.load(AZStd::memory_order_relaxed), s_bindToLocalNumaNode.load(AZStd::memory_order_relaxed));
+    }
+
+    void* AllocateThreadArena(size_t byteSize, size_t alignment)
+    {
+        const bool bindToLocalNumaNode = s_bindToLocalNumaNode.load(AZStd::memory_order_relaxed);
+        if (UsesHugePages(byteSize))
+        {
+            return MapAndTrack(byteSize, alignment, s_mode.load(AZStd::memory_order_relaxed), bindToLocalNumaNode);
+        }
+        if (!bindToLocalNumaNode)
+        {
+            return nullptr;
+        }
+        return MapAndTrack(byteSize, alignment, Mode::Disabled, true);
+    }
+
+    bool Free(void* address)
+    {
+        if (address == nullptr || s_mappingCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        MappingTable& table = GetMappingTable();
+        Platform::Mapping mapping;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(table.m_mutex);
+            const size_t index = FindMappingIndex(table, address);
+            if (index == table.m_count || table.m_mappings[index].m_address != address)
+            {
+                return false;
+            }
+            mapping = table.m_mappings[index];
+            memmove(&table.m_mappings[index], &table.m_mappings[index + 1], (table.m_count - index - 1) * sizeof(Platform::Mapping));
+            --table.m_count;
+            s_mappingCount.store(table.m_count, AZStd::memory_order_relaxed);
+            UpdateStatistics(table.m_statistics, mapping, false);
+        }
+        Platform::Unmap(mapping.m_address, mapping.m_size);
+        return true;
+    }
+
+    size_t GetAllocationSize(void* address)
+    {
+        if (address == nullptr || s_mappingCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return 0;
+        }
+
+        MappingTable& table = GetMappingTable();
+        AZStd::lock_guard<AZStd::mutex> lock(table.m_mutex);
+        const size_t index = FindMappingIndex(table, address);
+        return (index < table.m_count && table.m_mappings[index].m_address == address) ? table.m_mappings[index].m_size : 0;
+    }
+
+    Statistics GetStatistics()
+    {
+        MappingTable& table = GetMappingTable();
+        AZStd::lock_guard<AZStd::mutex> lock(table.m_mutex);
+        Statistics statistics = table.m_statistics;
+        statistics.m_hugePageSize = GetHugePageSize();
+        statistics.m_mappingCount = table.m_count;
+        return statistics;
+    }
+} // namespace AZ::HugePages
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string_view.h>
+
+//! Huge page and NUMA aware backing for memory that allocators request from the OS.
+//! Large heaps backed by the default page size spend a noticeable amount of time on TLB misses, backing their arenas with
+//! huge pages reduces the number of TLB entries needed by several orders of magnitude. Binding arenas to the NUMA node of
+//! the thread that requests them keeps their memory local to the cores that use it on multi-socket machines.
+//! Everything in here is opt-in and disabled by default. When a mode isn't supported by the platform, or the OS is out of
+//! huge pages, allocations return nullptr and callers fall back to their regular OS allocations.
+namespace AZ::HugePages
+{
+    //! Settings registry key the huge page settings are read from once the registry is available.
+    //! The same settings can be provided through the startup.cfg file with the "allocator_huge_pages",
+    //! "allocator_numa_local" and "allocator_huge_pages_min_size" keys, which applies them before the allocators are created.
+    inline constexpr AZStd::string_view SettingsRootKey = "/O3DE/Memory/HugePages";
+
+    enum class Mode : AZ::u8
+    {
+        Disabled, //!< Allocations use the default page size.
+        Transparent, //!< Large arenas are aligned to the huge page size and the OS is advised to back them with huge pages.
+        Explicit //!< Large arenas are mapped from the reserved huge page pool, falling back to transparent huge pages when it runs out.
+    };
+
+    struct Settings
+    {
+        Mode m_mode = Mode::Disabled;
+        //! Binds arenas to the NUMA node of the thread that requested them. Binding is preferred rather than strict, so
+        //! the OS still uses memory from other nodes when the local node runs out.
+        bool m_bindToLocalNumaNode = false;
+        //! Allocations smaller than this keep using the default page size, as huge pages would mostly be wasted on them.
+        size_t m_minimumAllocationSize = 2 * 1024 * 1024;
+    };
+
+    //! Changes the settings for future allocations, memory that has already been allocated keeps its backing.
+    void SetSettings(const Settings& settings);
+    Settings GetSettings();
+
+    //! Returns the huge page size of the platform, or 0 if huge pages are not supported.
+    size_t GetHugePageSize();
+
+    //! Returns the size allocators should round the growth of their large arenas up to, so the arenas can be backed
+    //! with huge pages. Returns 0 if huge pages are disabled.
+    size_t GetArenaSize();
+
+    //! Returns true if an allocation of the provided size would be backed with huge pages.
+    bool UsesHugePages(size_t byteSize);
+
+    //! Allocates memory for a large arena, backed with huge pages and bound to the local NUMA node as configured.
+    //! Returns nullptr if the allocation is too small for huge pages, huge pages are disabled or the OS can't provide
+    //! them, in which case the caller should use its regular allocation.
+    void* Allocate(size_t byteSize, size_t alignment);
+
+    //! Allocates memory for an arena that is only used by the calling thread. Unlike Allocate this also handles arenas
+    //! that are too small for huge pages so they can still be bound to the local NUMA node.
+    //! Returns nullptr if neither huge pages nor NUMA binding apply, in which case the caller should use its regular allocation.
+    void* AllocateThreadArena(size_t byteSize, size_t alignment);
+
+    //! Frees memory returned by Allocate or AllocateThreadArena.
+    //! @return False if the memory wasn't allocated by HugePages, in which case the caller should free it as usual.
+    bool Free(void* address);
+
+    //! Returns the number of bytes mapped for memory returned by Allocate or AllocateThreadArena, or 0 if the memory
+    //! wasn't allocated by HugePages.
+    size_t GetAllocationSize(void* address);
+
+    //! Page usage of the memory that is currently allocated through HugePages.
+    struct Statistics
+    {
+        size_t m_hugePageSize = 0;
+        //! Bytes mapped from the reserved huge page pool.
+        size_t m_explicitHugePageBytes = 0;
+        //! Bytes the OS was advised to back with transparent huge pages. The OS decides how much of this is actually
+        //! backed by huge pages, which depends on how fragmented physical memory is.
+        size_t m_transparentHugePageBytes = 0;
+        //! Bytes bound to the NUMA node of the thread that allocated them.
+        size_t m_numaLocalBytes = 0;
+        //! Number of mappings currently allocated.
+        size_t m_mappingCount = 0;
+        //! Number of allocations that were requested but had to fall back to the regular allocation of the caller.
+        size_t m_fallbackCount = 0;
+    };
+    Statistics GetStatistics();
+
+    namespace Platform
+    {
+        enum MappingFlags : AZ::u32
+        {
+            MappingFlags_None = 0,
+            MappingFlags_ExplicitHugePages = 1 << 0,
+            MappingFlags_TransparentHugePages = 1 << 1,
+            MappingFlags_NumaLocal = 1 << 2
+        };
+
+        struct Mapping
+        {
+            void* m_address = nullptr;
+            size_t m_size = 0;
+            AZ::u32 m_flags = MappingFlags_None;
+        };
+
+        size_t GetHugePageSize();
+        //! Maps at least byteSize bytes with the requested alignment. Mode::Disabled maps default pages, which is
+        //! used to bind small arenas to the local NUMA node.
+        Mapping Map(size_t byteSize, size_t alignment, Mode mode, bool bindToLocalNumaNode);
+        void Unmap(void* address, size_t byteSize);
+    } // namespace Platform
+} // namespace AZ::HugePages
@@ -9,6 +9,7 @@
 #include <AzCore/Memory/OSAllocator.h>
 
 #include <AzCore/Debug/MemoryProfiler.h>
+#include <AzCore/Memory/HugePages.h>
 
 namespace AZ
 {
@@ -60,7 +61,12 @@ namespace AZ
     //=========================================================================
     AllocateAddress OSAllocator::allocate(size_type byteSize, size_type alignment)
     {
-        pointer address = AZ_OS_MALLOC(byteSize, alignment);
+        // Large blocks are backed by huge pages when enabled, everything else comes from the C heap
+        pointer address = HugePages::Allocate(byteSize, alignment);
+        if (address == nullptr)
+        {
+            address = AZ_OS_MALLOC(byteSize, alignment);
+        }
 
         if (address == nullptr && byteSize > 0)
         {
@@ -98,7 +104,10 @@ namespace AZ
             AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
         }
 #endif
-        AZ_OS_FREE(ptr);
+        if (!HugePages::Free(ptr))
+        {
+            AZ_OS_FREE(ptr);
+        }
         return allocatedSize;
     }
 
@@ -108,7 +117,29 @@ namespace AZ
         const size_type previouslyAllocatedSize = ptr ? get_allocated_size(ptr, 1) : 0;
 #endif
 
-        pointer newPtr = AZ_OS_REALLOC(ptr, newSize, static_cast<AZStd::size_t>(alignment));
+        pointer newPtr = nullptr;
+        if (const size_type hugePageSize = HugePages::GetAllocationSize(ptr); hugePageSize != 0 || HugePages::UsesHugePages(newSize))
+        {
+            // Huge page mappings can't be resized by the C heap, so move the contents between the two kinds of memory
+            newPtr = HugePages::Allocate(newSize, alignment);
+            if (newPtr == nullptr)
+            {
+                newPtr = AZ_OS_MALLOC(newSize, alignment);
+            }
+            if (newPtr != nullptr && ptr != nullptr)
+            {
+                const size_type previousSize = hugePageSize != 0 ? hugePageSize : AZ_OS_MSIZE(ptr, 1);
+                memcpy(newPtr, ptr, AZStd::min(previousSize, static_cast<size_type>(newSize)));
+                if (!HugePages::Free(ptr))
+                {
+                    AZ_OS_FREE(ptr);
+                }
+            }
+        }
+        else
+        {
+            newPtr = AZ_OS_REALLOC(ptr, newSize, static_cast<AZStd::size_t>(alignment));
+        }
 
         const size_type allocatedSize = get_allocated_size(newPtr, 1);
 #if defined(AZ_ENABLE_TRACING)
@@ -122,6 +153,11 @@ namespace AZ
 
     auto OSAllocator::get_allocated_size(pointer ptr, align_type alignment) const -> size_type
     {
-        return ptr ? AZ_OS_MSIZE(ptr, alignment) : 0;
+        if (ptr == nullptr)
+        {
+            return 0;
+        }
+        const size_type hugePageSize = HugePages::GetAllocationSize(ptr);
+        return hugePageSize != 0 ? hugePageSize : AZ_OS_MSIZE(ptr, alignment);
     }
 } // namespace AZ
@@ -18,6 +18,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/intrusive_slist.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -268,9 +269,10 @@ namespace AZ
             struct FakeNode : public AZStd::intrusive_slist_node<FakeNode>
             {
             };
-            // Fake Lock Free node used when we delete an element from another thread.
-            struct FakeNodeLF : public AZStd::lock_free_intrusive_stack_node<FakeNodeLF>
+            // Fake node used to link elements deleted from another thread into the owning thread's remote free list.
+            struct RemoteFreeNode
             {
+                RemoteFreeNode* m_next;
             };
 
             void SetupFreeList(size_t elementSize, size_t pageDataBlockSize);
@@ -381,35 +383,91 @@ namespace AZ
         ThreadPoolSchema::GetThreadPoolData m_threadPoolGetter;
         ThreadPoolSchema::SetThreadPoolData m_threadPoolSetter;
 
-        // Fox X64 we push/pop pages using the m_mutex to sync. Pages are
-        using FreePagesType = Bucket::PageListType;
+        // Empty pages that overflow a thread's page magazine are shared with all threads through a lock free stack.
+        // Pages can be pushed and popped from any thread, so a stamped stack is used to avoid the ABA problem.
+        using FreePagesType = AZStd::lock_free_intrusive_stamped_stack<Page, AZStd::lock_free_intrusive_stack_member_hook<Page, &Page::m_lfStack>>;
         FreePagesType m_freePages;
+        // Number of threads inside m_freePages.pop(). A pop reads the link of the top page before it knows whether it won the
+        // page, so a page taken off the stack can only be freed once every pop that may have seen it has finished.
+        AZStd::atomic<size_t> m_numFreePagePops{ 0 };
         AZStd::vector<ThreadPoolData*, AZStd::stateless_allocator> m_threads; ///< Array with all separate thread data. Used to traverse end free elements.
 
         IAllocator*           m_pageAllocator;
         size_t m_pageSize;
         size_t m_minAllocationSize;
         size_t m_maxAllocationSize;
-        // TODO rbbaklov Changed to recursive_mutex from mutex for Linux support.
-        AZStd::recursive_mutex m_mutex;
+        AZStd::mutex m_mutex; ///< Only guards m_threads and garbage collection, allocations and deallocations never lock.
+
+    private:
+        //! Frees the pages in the shared free page stack, can be called while other threads push and pop pages.
+        void FreeSharedPages();
     };
 
     struct ThreadPoolData
     {
         ThreadPoolData(ThreadPoolSchemaImpl* alloc, size_t pageSize, size_t minAllocationSize, size_t maxAllocationSize);
-        ~ThreadPoolData();
 
         using AllocatorType = PoolAllocation<ThreadPoolSchemaImpl>;
-        /**
-         * Stack with freed elements from other threads. We don't need stamped stack since the ABA problem can not
-         * happen here. We push from many threads and pop from only one (we don't push from it).
-         */
-        using FreedElementsStack = AZStd::lock_free_intrusive_stack<
-            ThreadPoolSchemaImpl::Page::FakeNodeLF,
-            AZStd::lock_free_intrusive_stack_base_hook<ThreadPoolSchemaImpl::Page::FakeNodeLF>>;
+        using RemoteFreeNode = ThreadPoolSchemaImpl::Page::RemoteFreeNode;
+
+        //! Number of empty pages each thread keeps for itself before sharing them with other threads.
+        static constexpr size_t PageMagazineSize = 8;
+
+        //! Pushes an element freed by another thread, can be called from any thread.
+        void PushRemoteFree(void* ptr);
+
+        //! Returns all elements freed by other threads since the last call, in a single atomic exchange.
+        //! We push from many threads but only ever take the whole list at once, so the ABA problem can not happen here.
+        RemoteFreeNode* TakeRemoteFrees();
+
+        //! Returns the elements freed by other threads to this thread's pools.
+        void DeAllocateRemoteFrees();
+
+        //! Frees the empty pages owned by this thread data, must only be called with access to the pools.
+        void GarbageCollect();
+
+        //! Frees every page owned by this thread data before the allocator drops it. Pages that still hold elements
+        //! are leaked allocations and are left alone.
+        void ReleaseAllPages();
+
+        //! Returns true when no page is owned by this thread data anymore, so no element can be freed to it.
+        bool IsEmpty() const;
+
+        //! The owning thread takes access to the pools for each allocation and deallocation. Only a garbage collecting
+        //! thread can hold the access in the meantime, for as long as it takes to collect the pages.
+        void BeginOwnerAccess();
+        void EndAccess();
+
+        //! Takes access to the pools on behalf of another thread if the owning thread isn't using them.
+        bool TryBeginCollectorAccess();
+
+        //! Called by the owning thread when it exits, the allocator can then collect the thread data.
+        void ReleaseOwner();
+
+        //! Drops a reference, the thread data is destroyed once both the owning thread and the allocator released it.
+        void Release();
+
+        enum class Access : uint32_t
+        {
+            None,
+            Owner,
+            Collector
+        };
 
         AllocatorType m_allocator;
-        FreedElementsStack m_freedElements;
+        AZStd::atomic<RemoteFreeNode*> m_remoteFrees{ nullptr };
+        //! Set when another thread garbage collects while the owning thread is using its pools, the owning thread
+        //! then collects its own pages on its next allocation.
+        AZStd::atomic<bool> m_garbageCollectRequested{ false };
+        AZStd::atomic<Access> m_access{ Access::None };
+        AZStd::atomic<bool> m_ownerExited{ false };
+        //! Held by the owning thread and by the allocator.
+        AZStd::atomic<uint32_t> m_refCount{ 2 };
+
+        // Magazine of empty pages only accessed with access to the pools, which saves touching the shared free page stack
+        // when a thread repeatedly fills and drains the same pages.
+        ThreadPoolSchemaImpl::Page* m_pageMagazine[PageMagazineSize] = {};
+        size_t m_numMagazinePages = 0;
     };
 } // namespace AZ
 
@@ -995,11 +1053,16 @@ namespace AZ
     // NumAllocatedBytes
     // [11/1/2010]
     //=========================================================================
+    void ThreadPoolSchema::ReleaseThreadPoolData(ThreadPoolData* threadData)
+    {
+        threadData->ReleaseOwner();
+    }
+
     ThreadPoolSchema::size_type ThreadPoolSchema::NumAllocatedBytes() const
     {
         size_type bytesAllocated = 0;
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_impl->m_mutex);
+            AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
             for (size_t i = 0; i < m_impl->m_threads.size(); ++i)
             {
                 bytesAllocated += m_impl->m_threads[i]->m_allocator.m_numBytesAllocated;
@@ -1036,11 +1099,6 @@ namespace AZ
         , m_minAllocationSize(minAllocationSize)
         , m_maxAllocationSize(maxAllocationSize)
     {
-#if AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
-        // In memory allocation case (usually tools) we might have high contention,
-        // using spin lock will improve performance.
-        SetCriticalSectionSpinCount(m_mutex.native_handle(), 4000);
-#endif
     }
 
     //=========================================================================
@@ -1049,30 +1107,28 @@ namespace AZ
     //=========================================================================
     ThreadPoolSchemaImpl::~ThreadPoolSchemaImpl()
     {
+        // reset the variable for the owner thread, which is done with its thread data.
+        if (ThreadPoolData* callingThreadData = m_threadPoolGetter())
+        {
+            m_threadPoolSetter(nullptr);
+            callingThreadData->ReleaseOwner();
+        }
+
         GarbageCollect();
 
         // clean up all the thread data.
         // IMPORTANT: We assume/rely that all threads (except the calling one) are or will
         // destroyed before you create another instance of the pool allocation.
         // This should generally be ok since the all allocators are singletons.
-        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
-        if (!m_threads.empty())
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (ThreadPoolData* threadData : m_threads)
         {
-            for (ThreadPoolData*& threadData : m_threads)
-            {
-                if (threadData)
-                {
-                    // Force free all pages
-                    threadData->~ThreadPoolData();
-                    AZStd::stateless_allocator().deallocate(
-                        threadData, sizeof(ThreadPoolData), AZStd::alignment_of<ThreadPoolData>::value);
-                    threadData = nullptr;
-                }
-            }
-
-            /// reset the variable for the owner thread.
-            m_threadPoolSetter(nullptr);
+            // Force free all pages, a thread that is still running releases its thread data when it exits
+            threadData->ReleaseAllPages();
+            threadData->Release();
         }
+        m_threads.clear();
+        FreeSharedPages();
     }
 
     //=========================================================================
@@ -1090,21 +1146,25 @@ namespace AZ
             threadData = new (threadPoolData) ThreadPoolData(this, m_pageSize, m_minAllocationSize, m_maxAllocationSize);
             m_threadPoolSetter(threadData);
             {
-                AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
                 m_threads.push_back(threadData);
             }
         }
+
+        threadData->BeginOwnerAccess();
+        if (threadData->m_garbageCollectRequested.load(AZStd::memory_order_relaxed))
+        {
+            threadData->GarbageCollect();
+        }
         else
         {
             // deallocate elements if they were freed from other threads
-            Page::FakeNodeLF* fakeLFNode;
-            while ((fakeLFNode = threadData->m_freedElements.pop()) != nullptr)
-            {
-                threadData->m_allocator.DeAllocate(fakeLFNode);
-            }
+            threadData->DeAllocateRemoteFrees();
         }
 
-        return threadData->m_allocator.Allocate(byteSize, alignment);
+        const AllocateAddress address = threadData->m_allocator.Allocate(byteSize, alignment);
+        threadData->EndAccess();
+        return address;
     }
 
     //=========================================================================
@@ -1124,21 +1184,17 @@ namespace AZ
         if (threadData == page->m_threadData)
         {
             // we can free here
-            return threadData->m_allocator.DeAllocate(ptr);
+            threadData->BeginOwnerAccess();
+            const size_t allocatedSize = threadData->m_allocator.DeAllocate(ptr);
+            threadData->EndAccess();
+            return allocatedSize;
         }
         else
         {
             // push this element to be deleted from it's own thread!
-            // cast the pointer to a fake lock free node
-            Page::FakeNodeLF* fakeLFNode = reinterpret_cast<Page::FakeNodeLF*>(ptr);
-#ifdef AZ_DEBUG_BUILD
-            // we need to reset the fakeLFNode because we share the memory.
-            // otherwise we will assert the node is in the list
-            fakeLFNode->m_next = 0;
-#endif
-            // Query the allocated size of the ptr before pushing it on the freed element stack
+            // Query the allocated size of the ptr before pushing it on the remote free list, as the owner may reuse it right away
             const size_t allocatedSize = page->m_threadData->m_allocator.get_allocated_size(ptr);
-            page->m_threadData->m_freedElements.push(*fakeLFNode);
+            page->m_threadData->PushRemoteFree(ptr);
 
             return allocatedSize;
         }
@@ -1165,18 +1221,19 @@ namespace AZ
     //=========================================================================
     AZ_INLINE ThreadPoolSchemaImpl::Page* ThreadPoolSchemaImpl::PopFreePage()
     {
+        // Pages are only popped when allocating, which always happens on the thread that owns the thread data while it
+        // has access to its pools
+        ThreadPoolData* threadData = m_threadPoolGetter();
         Page* page;
+        if (threadData->m_numMagazinePages > 0)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
-            if (m_freePages.empty())
-            {
-                page = nullptr;
-            }
-            else
-            {
-                page = &m_freePages.front();
-                m_freePages.pop_front();
-            }
+            page = threadData->m_pageMagazine[--threadData->m_numMagazinePages];
+        }
+        else
+        {
+            m_numFreePagePops.fetch_add(1);
+            page = m_freePages.pop();
+            m_numFreePagePops.fetch_sub(1);
         }
         if (page)
         {
@@ -1184,7 +1241,7 @@ namespace AZ
             AZ_Assert(page->m_threadData == 0, "If we stored the free page properly we should have null here!");
 #endif
             // store the current thread data, used when we free elements
-            page->m_threadData = m_threadPoolGetter();
+            page->m_threadData = threadData;
         }
         return page;
     }
@@ -1195,12 +1252,18 @@ namespace AZ
     //=========================================================================
     AZ_INLINE void ThreadPoolSchemaImpl::PushFreePage(Page* page)
     {
+        // Pages are pushed by the allocator of the thread data that owns them, keep them for that thread while there is room
+        ThreadPoolData* threadData = page->m_threadData;
 #ifdef AZ_DEBUG_BUILD
         page->m_threadData = 0;
 #endif
+        if (threadData->m_numMagazinePages < ThreadPoolData::PageMagazineSize)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
-            m_freePages.push_front(*page);
+            threadData->m_pageMagazine[threadData->m_numMagazinePages++] = page;
+        }
+        else
+        {
+            m_freePages.push(*page);
         }
     }
 
@@ -1210,22 +1273,72 @@ namespace AZ
     //=========================================================================
     void ThreadPoolSchemaImpl::GarbageCollect()
     {
-        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
-        for (ThreadPoolData* threadData : m_threads)
+        ThreadPoolData* callingThreadData = m_threadPoolGetter();
         {
-            if (threadData)
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (auto threadIt = m_threads.begin(); threadIt != m_threads.end();)
             {
-                for (auto fakeLFNode = threadData->m_freedElements.pop(); fakeLFNode; fakeLFNode = threadData->m_freedElements.pop())
+                ThreadPoolData* threadData = *threadIt;
+                if (threadData == callingThreadData)
                 {
-                    threadData->m_allocator.DeAllocate(fakeLFNode);
+                    ++threadIt;
+                    continue;
+                }
+
+                // Threads that are idle or have exited get their remote frees drained and their empty pages freed here.
+                // A thread that is using its pools is asked to collect its own pages the next time it allocates.
+                if (!threadData->TryBeginCollectorAccess())
+                {
+                    threadData->m_garbageCollectRequested.store(true, AZStd::memory_order_relaxed);
+                    ++threadIt;
+                    continue;
+                }
+                threadData->GarbageCollect();
+                threadData->EndAccess();
+
+                // Once the owner exited and every element was freed, nothing references the thread data anymore
+                if (threadData->m_ownerExited.load(AZStd::memory_order_acquire) && threadData->IsEmpty())
+                {
+                    threadIt = m_threads.erase(threadIt);
+                    threadData->Release();
+                }
+                else
+                {
+                    ++threadIt;
                 }
-                threadData->m_allocator.GarbageCollect();
             }
         }
-        while (!m_freePages.empty())
+        if (callingThreadData)
         {
-            Page* page = &m_freePages.front();
-            m_freePages.pop_front();
+            callingThreadData->BeginOwnerAccess();
+            callingThreadData->GarbageCollect();
+            callingThreadData->EndAccess();
+        }
+        FreeSharedPages();
+    }
+
+    //=========================================================================
+    // FreeSharedPages
+    //=========================================================================
+    void ThreadPoolSchemaImpl::FreeSharedPages()
+    {
+        Bucket::PageListType pages;
+        for (Page* page = m_freePages.pop(); page; page = m_freePages.pop())
+        {
+            pages.push_front(*page);
+        }
+
+        // A pop that started before the pages were taken may still read their links, wait for those to finish.
+        // Pops that start now can't reach the pages anymore.
+        while (m_numFreePagePops.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        while (!pages.empty())
+        {
+            Page* page = &pages.front();
+            pages.pop_front();
             FreePage(page);
         }
     }
@@ -1257,16 +1370,137 @@ namespace AZ
     {
     }
 
+
     //=========================================================================
-    // ThreadPoolData::~ThreadPoolData
-    // [9/15/2009]
+    // ThreadPoolData::GarbageCollect
+    //=========================================================================
+    void ThreadPoolData::GarbageCollect()
+    {
+        m_garbageCollectRequested.store(false, AZStd::memory_order_relaxed);
+        DeAllocateRemoteFrees();
+        m_allocator.GarbageCollect();
+        while (m_numMagazinePages > 0)
+        {
+            m_allocator.m_allocator->FreePage(m_pageMagazine[--m_numMagazinePages]);
+        }
+    }
+
+    //=========================================================================
+    // ThreadPoolData::ReleaseAllPages
+    //=========================================================================
+    void ThreadPoolData::ReleaseAllPages()
+    {
+        GarbageCollect();
+        if (m_allocator.m_buckets)
+        {
+            for (const auto& bucket : AZStd::span(m_allocator.m_buckets, m_allocator.m_buckets + m_allocator.m_numBuckets))
+            {
+                AZ_Assert(bucket.m_pages.empty(), "Found page for bucket %p", &bucket);
+            }
+            // The thread data can outlive the allocator, make sure it doesn't reference the allocator's memory anymore
+            m_allocator.m_buckets = nullptr;
+        }
+    }
+
+    //=========================================================================
+    // ThreadPoolData::IsEmpty
+    //=========================================================================
+    bool ThreadPoolData::IsEmpty() const
+    {
+        return m_allocator.m_buckets == nullptr && m_numMagazinePages == 0 &&
+            m_remoteFrees.load(AZStd::memory_order_relaxed) == nullptr;
+    }
+
+    //=========================================================================
+    // ThreadPoolData::BeginOwnerAccess
+    //=========================================================================
+    void ThreadPoolData::BeginOwnerAccess()
+    {
+        Access expected = Access::None;
+        while (!m_access.compare_exchange_strong(expected, Access::Owner, AZStd::memory_order_acquire, AZStd::memory_order_relaxed))
+        {
+            expected = Access::None;
+            AZStd::this_thread::yield();
+        }
+    }
+
+    //=========================================================================
+    // ThreadPoolData::TryBeginCollectorAccess
+    //=========================================================================
+    bool ThreadPoolData::TryBeginCollectorAccess()
+    {
+        Access expected = Access::None;
+        return m_access.compare_exchange_strong(expected, Access::Collector, AZStd::memory_order_acquire, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // ThreadPoolData::EndAccess
+    //=========================================================================
+    void ThreadPoolData::EndAccess()
+    {
+        m_access.store(Access::None, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // ThreadPoolData::ReleaseOwner
+    //=========================================================================
+    void ThreadPoolData::ReleaseOwner()
+    {
+        m_ownerExited.store(true, AZStd::memory_order_release);
+        Release();
+    }
+
+    //=========================================================================
+    // ThreadPoolData::Release
+    //=========================================================================
+    void ThreadPoolData::Release()
+    {
+        if (m_refCount.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+        {
+            // The allocator released all pages before dropping its reference, so destroying the data doesn't touch the allocator
+            this->~ThreadPoolData();
+            AZStd::stateless_allocator().deallocate(this, sizeof(ThreadPoolData), AZStd::alignment_of<ThreadPoolData>::value);
+        }
+    }
+
+    //=========================================================================
+    // ThreadPoolData::PushRemoteFree
+    //=========================================================================
+    void ThreadPoolData::PushRemoteFree(void* ptr)
+    {
+        // The element memory is no longer in use, so it's safe to reuse it as the link
+        RemoteFreeNode* node = reinterpret_cast<RemoteFreeNode*>(ptr);
+        node->m_next = m_remoteFrees.load(AZStd::memory_order_relaxed);
+        while (!m_remoteFrees.compare_exchange_weak(node->m_next, node, AZStd::memory_order_release, AZStd::memory_order_relaxed))
+        {
+        }
+    }
+
+    //=========================================================================
+    // ThreadPoolData::TakeRemoteFrees
+    //=========================================================================
+    ThreadPoolData::RemoteFreeNode* ThreadPoolData::TakeRemoteFrees()
+    {
+        // Avoid the exchange, which needs exclusive access to the cache line, in the common case of no remote frees
+        if (m_remoteFrees.load(AZStd::memory_order_relaxed) == nullptr)
+        {
+            return nullptr;
+        }
+        return m_remoteFrees.exchange(nullptr, AZStd::memory_order_acquire);
+    }
+
+    //=========================================================================
+    // ThreadPoolData::DeAllocateRemoteFrees
     //=========================================================================
-    ThreadPoolData::~ThreadPoolData()
+    void ThreadPoolData::DeAllocateRemoteFrees()
     {
-        // deallocate elements if they were freed from other threads
-        for (ThreadPoolSchemaImpl::Page::FakeNodeLF* fakeLFNode = m_freedElements.pop(); fakeLFNode; fakeLFNode = m_freedElements.pop())
+        RemoteFreeNode* node = TakeRemoteFrees();
+        while (node != nullptr)
         {
-            m_allocator.DeAllocate(fakeLFNode);
+            // DeAllocate reuses the element memory for the page free list, read the link first
+            RemoteFreeNode* next = node->m_next;
+            m_allocator.DeAllocate(node);
+            node = next;
         }
     }
 
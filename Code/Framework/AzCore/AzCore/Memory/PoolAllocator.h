@@ -87,6 +87,10 @@ namespace AZ
         ThreadPoolSchema(const ThreadPoolSchema&);
         ThreadPoolSchema& operator=(const ThreadPoolSchema&);
 
+        //! Called when a thread that allocated from the pool exits, the next GarbageCollect frees the thread's pages.
+        //! Doesn't access the allocator, which may have been destroyed before the thread exits.
+        static void ReleaseThreadPoolData(ThreadPoolData* threadData);
+
         GetThreadPoolData m_threadPoolGetter;
         SetThreadPoolData m_threadPoolSetter;
         class ThreadPoolSchemaImpl* m_impl;
@@ -117,9 +121,26 @@ namespace AZ
 
         static void SetThreadPoolData(ThreadPoolData* data)
         {
+            if (data)
+            {
+                // Constructed the first time the thread gets its pool data, so the data is released when the thread exits
+                [[maybe_unused]] static thread_local ThreadExitGuard threadExitGuard;
+            }
             m_threadData = data;
         }
 
+        struct ThreadExitGuard
+        {
+            ~ThreadExitGuard()
+            {
+                if (ThreadPoolData* data = m_threadData)
+                {
+                    m_threadData = nullptr;
+                    ReleaseThreadPoolData(data);
+                }
+            }
+        };
+
         static AZ_THREAD_LOCAL ThreadPoolData*  m_threadData;
     };
 
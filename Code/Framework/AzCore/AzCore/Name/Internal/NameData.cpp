@@ -16,6 +16,31 @@ namespace AZ::Internal
         , m_hash{hash}
     {}
 
+    void NameData::Reset(AZStd::string_view name, Hash hash)
+    {
+        AZ_Assert(m_useCount == -1, "Only released NameData can be recycled");
+        m_name = name;
+        m_hash = hash;
+        m_hashCollision = false;
+        // Bump the incarnation before the use count becomes positive again, so that any lookup cache holding
+        // this NameData from its previous life fails to validate it
+        ++m_incarnation;
+        m_useCount = 0;
+    }
+
+    bool NameData::TryAddRef()
+    {
+        int useCount = m_useCount.load(AZStd::memory_order_relaxed);
+        while (useCount > 0)
+        {
+            if (m_useCount.compare_exchange_weak(useCount, useCount + 1))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     AZStd::string_view NameData::GetName() const
     {
         return m_name;
@@ -39,6 +39,13 @@ namespace AZ
         private:
             NameData(AZStd::string&& name, Hash hash);
 
+            //! Reinitializes released name data so it can be recycled by the NameDictionary for a new name.
+            void Reset(AZStd::string_view name, Hash hash);
+
+            //! Adds a reference only if the name data is still referenced elsewhere.
+            //! Unlike add_ref, this is safe to call on name data that may have been released in the meantime.
+            bool TryAddRef();
+
             void add_ref();
             void release();
 
@@ -54,6 +61,8 @@ namespace AZ
             //! Stores a pointer to the name dictionary that created the NameData
             //! if the the name dictionary is destroyed, set back to nullptr
             NameDictionary* m_nameDictionary{};
+            //! Incremented each time the name data is recycled for a different name
+            AZStd::atomic<uint32_t> m_incarnation{ 0 };
         };
     }
 }
@@ -14,6 +14,7 @@
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
+#include <AzCore/std/time.h>
 #include <cstring>
 
 namespace AZ
@@ -25,6 +26,32 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        //! Small direct mapped cache of the names recently made by a thread.
+        //! Entries don't hold a reference to their NameData, they are validated with NameData::TryAddRef
+        //! and the NameData incarnation instead, so the cache never extends the lifetime of a name.
+        struct ThreadLookupCache
+        {
+            static constexpr size_t EntryCount = 128;
+
+            struct Entry
+            {
+                Internal::NameData* m_nameData = nullptr;
+                uint32_t m_incarnation = 0;
+            };
+
+            AZ::u64 m_instanceId = 0;
+            Entry m_entries[EntryCount];
+        };
+        static thread_local ThreadLookupCache s_threadLookupCache;
+
+        static AZ::u64 GenerateInstanceId()
+        {
+            // Mix in the time so instance ids don't repeat across modules that each have their own counter
+            static AZStd::atomic<AZ::u64> s_instanceCounter{ 0 };
+            const AZ::u64 counter = ++s_instanceCounter;
+            return (static_cast<AZ::u64>(AZStd::GetTimeNowTicks()) << 16) ^ counter;
+        }
     }
 
     void NameDictionary::Create()
@@ -86,6 +113,7 @@ namespace AZ
 
     NameDictionary::NameDictionary(AZ::u64 maxHashSlots)
         : m_deferredHead(Name::FromStringLiteral("-fixed name dictionary deferred head-", nullptr))
+        , m_instanceId(NameDictionaryInternal::GenerateInstanceId())
         , m_maxHashSlots(maxHashSlots != 0 ? maxHashSlots : static_cast<AZ::u64>(AZStd::numeric_limits<Name::Hash>::max()) + 1)
     {
         // Ensure a Name that is valid for the life-cycle of this dictionary is the head of our literal linked list
@@ -106,22 +134,31 @@ namespace AZ
 
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (auto i = m_dictionary.begin(), last = m_dictionary.end(); i != last;)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = i->second.m_nameData;
-            const int useCount = nameData->m_useCount;
-
-            if (useCount == 0)
+            for (auto i = shard.m_dictionary.begin(), last = shard.m_dictionary.end(); i != last;)
             {
-                i = m_dictionary.erase(i);
-                delete nameData;
+                Internal::NameData* nameData = i->second.m_nameData;
+                const int useCount = nameData->m_useCount;
+
+                if (useCount == 0)
+                {
+                    i = shard.m_dictionary.erase(i);
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
+                    ++i;
+                }
             }
-            else
+
+            for (Internal::NameData* nameData : shard.m_freeNameData)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
-                ++i;
+                delete nameData;
             }
+            shard.m_freeNameData.clear();
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
@@ -129,7 +166,8 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
         // The NameData m_useCount check is to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
@@ -138,8 +176,8 @@ namespace AZ
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
         // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        if (auto iter = shard.m_dictionary.find(hash);
+            iter != shard.m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
         {
             return Name(iter->second.m_nameData);
         }
@@ -226,6 +264,37 @@ namespace AZ
 
         Name::Hash hash = CalcHash(nameString);
 
+        // Check the names recently made by this thread first, this path doesn't take any lock.
+        NameDictionaryInternal::ThreadLookupCache& lookupCache = NameDictionaryInternal::s_threadLookupCache;
+        if (lookupCache.m_instanceId != m_instanceId)
+        {
+            // The cache was filled by another dictionary, none of its entries can be trusted
+            lookupCache = {};
+            lookupCache.m_instanceId = m_instanceId;
+        }
+
+        NameDictionaryInternal::ThreadLookupCache::Entry& cacheEntry = lookupCache.m_entries[hash % NameDictionaryInternal::ThreadLookupCache::EntryCount];
+        if (cacheEntry.m_nameData != nullptr && cacheEntry.m_nameData->TryAddRef())
+        {
+            // Holding a reference prevents the NameData from being recycled, so the incarnation and name can now be safely checked
+            Internal::NameData* nameData = cacheEntry.m_nameData;
+            const bool isMatch = nameData->m_incarnation.load() == cacheEntry.m_incarnation && nameData->GetName() == nameString;
+            Name name(nameData);
+            nameData->release();
+            if (isMatch)
+            {
+                return name;
+            }
+        }
+
+        Name name = MakeNameInternal(nameString, hash);
+        cacheEntry.m_nameData = name.m_data.get();
+        cacheEntry.m_incarnation = cacheEntry.m_nameData->m_incarnation.load();
+        return name;
+    }
+
+    Name NameDictionary::MakeNameInternal(AZStd::string_view nameString, Name::Hash hash)
+    {
         // If we find the same name with the same hash, just return it. 
         // This path is faster than the loop below because FindName() takes a shared_lock whereas the
         // loop requires a unique_lock to modify the dictionary.
@@ -235,20 +304,24 @@ namespace AZ
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        // The name doesn't exist in the dictionary, so we have to lock and add it.
+        // Hash collisions are resolved by probing the following hashes, which may belong to another shard.
+        // This is safe without holding the previous shard's lock, because entries involved in a collision
+        // are never removed from the dictionary.
+        Shard* shard = &GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard->m_sharedMutex);
 
-        auto iter = m_dictionary.find(hash);
+        auto iter = shard->m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard->m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                Internal::NameData* nameData = AcquireNameData(*shard, nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
-                m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                shard->m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -262,11 +335,52 @@ namespace AZ
                 collisionDetected = true;
                 iter->second.m_nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
+
+                Shard* nextShard = &GetShard(hash);
+                if (nextShard != shard)
+                {
+                    lock = AZStd::unique_lock<AZStd::shared_mutex>(nextShard->m_sharedMutex);
+                    shard = nextShard;
+                }
+                iter = shard->m_dictionary.find(hash);
             }
         }
     }
 
+    Internal::NameData* NameDictionary::AcquireNameData(Shard& shard, AZStd::string_view nameString, Name::Hash hash)
+    {
+        if (shard.m_freeNameData.empty())
+        {
+            return aznew Internal::NameData(nameString, hash);
+        }
+
+        Internal::NameData* nameData = shard.m_freeNameData.back();
+        shard.m_freeNameData.pop_back();
+        nameData->Reset(nameString, hash);
+        return nameData;
+    }
+
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash >> (AZStd::numeric_limits<Name::Hash>::digits - ShardBits)];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash >> (AZStd::numeric_limits<Name::Hash>::digits - ShardBits)];
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            entryCount += shard.m_dictionary.size();
+        }
+        return entryCount;
+    }
+
     void NameDictionary::TryReleaseName(Name::Hash hash)
     {
         // Note that we don't remove NameData from the dictionary if it has been involved in a collision.
@@ -281,10 +395,11 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Shard& shard = GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        auto dictIt = shard.m_dictionary.find(hash);
+        if (dictIt == shard.m_dictionary.end())
         {
             // This check is to safeguard around the following scenario
             // T1, gets into TryReleaseName
@@ -307,14 +422,16 @@ namespace AZ
         // We need to check the count again in here in case
         // someone was trying to get the name on another thread.
         // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
+        // dictionary and recycle the name.
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            shard.m_dictionary.erase(nameData->GetHash());
+            // Thread lookup caches may still point at this NameData, so it is recycled instead of deleted
+            shard.m_freeNameData.push_back(nameData);
         }
 
+        lock.unlock();
         ReportStats();
     }
 
@@ -333,35 +450,41 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            for (const Shard& shard : m_shards)
             {
-                Internal::NameData* nameData = iter.second.m_nameData;
-                const size_t nameLength = nameData->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
-
-                if (!longestName || longestName->m_name.size() < nameLength)
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+                nameCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = nameData;
-                }
+                    Internal::NameData* nameData = iter.second.m_nameData;
+                    const size_t nameLength = nameData->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = nameData;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = nameData;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = nameData;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = nameData;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/parallel/shared_mutex.h>
@@ -43,6 +45,10 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! The dictionary is split into shards by hash, each with its own lock, so threads interning different
+    //! names rarely contend with each other. Each thread also keeps a small cache of the names it recently
+    //! made, which lets repeated lookups of the same string skip the shard lock entirely.
     class NameDictionary final
     {
     public:
@@ -100,6 +106,9 @@ namespace AZ
 
         //////////////////////////////////////////////////////////////////////////
 
+        //! Makes a Name from the provided raw string and its hash, bypassing the thread lookup cache.
+        Name MakeNameInternal(AZStd::string_view nameString, Name::Hash hash);
+
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
@@ -112,6 +121,19 @@ namespace AZ
         //! Unloads the data with all deferred names registered using LoadDeferredName.
         void UnloadDeferredNames();
 
+        struct Shard;
+
+        //! Acquires a NameData from the shard's free list, or allocates a new one if the free list is empty.
+        //! The shard must be locked for writing.
+        Internal::NameData* AcquireNameData(Shard& shard, AZStd::string_view nameString, Name::Hash hash);
+
+        //! Returns the shard responsible for the provided hash.
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        //! Returns the total number of names in the dictionary across all shards.
+        size_t GetEntryCount() const;
+
         //! Wrapper structure around a NameData pointer
         //! Which sets the Internal::NameData::m_nameDictionary pointer to this name dictionary
         //! instance on construction and to nullptr on destruction
@@ -127,8 +149,28 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
-        AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        //! The number of hash bits used to select a shard. Shards are selected by the high bits of the hash so that
+        //! the linear probing used to resolve hash collisions mostly stays within a single shard.
+        static constexpr uint32_t ShardBits = 6;
+        static constexpr uint32_t ShardCount = 1 << ShardBits;
+
+        //! A slice of the dictionary guarded by its own lock.
+        //! Aligned to avoid false sharing between the locks of neighbouring shards.
+        struct alignas(64) Shard
+        {
+            AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
+            mutable AZStd::shared_mutex m_sharedMutex;
+
+            //! NameData released from this shard.
+            //! Released NameData is recycled rather than deleted for as long as the dictionary exists, which
+            //! guarantees that a NameData pointer held by a thread's lookup cache always points to valid memory.
+            AZStd::vector<Internal::NameData*> m_freeNameData;
+        };
+        AZStd::array<Shard, ShardCount> m_shards;
+
+        //! Identifies this dictionary instance in the per-thread lookup caches, so that cached entries from a
+        //! destroyed dictionary are never used by one later created at the same address.
+        const AZ::u64 m_instanceId;
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
@@ -185,7 +185,7 @@ namespace AZ
                     }
                     else
                     {
-                        Task* task = m_queues[priority][status.head];
+                        Task* task = m_queues[priority][head];
                         if (status.head.compare_exchange_weak(head, head + 1))
                         {
                             return task;
@@ -205,6 +205,7 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -247,16 +248,59 @@ namespace AZ
                 m_thread.join();
             }
 
-            void Enqueue(Task* task)
+            // Returns true if the worker was parked and has been woken up to process the task
+            bool Enqueue(Task* task)
             {
                 m_queue.Enqueue(task);
 
+                bool wasSleeping = m_sleeping.exchange(false);
                 m_semaphore.release();
+                return wasSleeping;
+            }
+
+            // Wakes the worker if it is parked on its semaphore so that it can attempt to steal work from its peers.
+            // Returns false if the worker was already running (or disabled) and no wakeup was issued.
+            bool TryWake()
+            {
+                bool sleeping = true;
+                if (m_enabled && m_sleeping.compare_exchange_strong(sleeping, false))
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
+
+            bool Sleeping() const
+            {
+                return m_sleeping;
             }
 
             const char* GetThreadName() {return m_threadName.c_str();}
 
         private:
+            // Attempt to take a task from the local queue first, falling back to the queues of the other workers.
+            // Peers are visited starting from the neighbor of this worker so that thieves spread out over victims.
+            Task* AcquireTask()
+            {
+                if (Task* task = m_queue.TryDequeue(); task)
+                {
+                    return task;
+                }
+
+                const uint32_t threadCount = m_executor->m_threadCount;
+                for (uint32_t i = 1; i < threadCount; ++i)
+                {
+                    TaskWorker& victim = m_executor->m_workers[(m_id + i) % threadCount];
+                    if (Task* task = victim.m_queue.TryDequeue(); task)
+                    {
+                        ++m_stolenCount;
+                        return task;
+                    }
+                }
+                return nullptr;
+            }
+
             void Run()
             {
                 while (m_active)
@@ -268,11 +312,27 @@ namespace AZ
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                    Task* task = AcquireTask();
+                    while (true)
                     {
+                        if (!task)
+                        {
+                            // Advertise that this worker is about to park before checking the queues one final time.
+                            // A submitter enqueues before inspecting the sleeping flags, so either the submitter sees
+                            // this worker as sleeping and wakes it, or this final check observes the new task.
+                            m_sleeping = true;
+                            task = AcquireTask();
+                            if (!task)
+                            {
+                                break;
+                            }
+                            m_sleeping = false;
+                        }
+
                         task->Invoke();
-                        // Decrement counts for all task successors
+                        // Decrement counts for all task successors. Successors that become ready are pushed onto this
+                        // worker's queue since the data produced by their predecessor is likely still in this core's cache.
+                        // Idle peers are woken by the submission and will steal whatever this worker can't get to.
                         for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
                         {
                             Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
@@ -288,7 +348,7 @@ namespace AZ
                             m_executor->ReleaseGraph();
                         }
 
-                        task = m_queue.TryDequeue();
+                        task = AcquireTask();
                     }
                 }
             }
@@ -296,6 +356,9 @@ namespace AZ
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_sleeping = true;
+            AZStd::atomic<uint64_t> m_stolenCount = 0;
+            uint32_t m_id = 0;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
@@ -412,6 +475,11 @@ namespace AZ
         return nullptr;
     }
 
+    bool TaskExecutor::IsTaskWorkerThread()
+    {
+        return GetTaskWorker() != nullptr;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
 
@@ -451,10 +519,31 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
-        uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
+        // Tasks submitted from one of this executor's workers (i.e. successors of a task that just completed) stay on
+        // that worker's queue to benefit from cache locality with their predecessor. The worker is busy running the
+        // predecessor, so a parked peer is woken to steal the task if the worker doesn't get to it first.
+        Internal::TaskWorker* localWorker = GetTaskWorker();
+        if (localWorker && localWorker->Enabled())
+        {
+            localWorker->Enqueue(&task);
+            WakeIdleTaskWorker(localWorker);
+            return;
+        }
+
+        // Otherwise prefer a worker that is currently parked, falling back to round-robin if every worker is busy.
+        // Busy workers will have the task stolen from them by the first peer to run out of work.
+        uint32_t start = ++m_lastSubmission;
+        uint32_t nextWorker = start % m_threadCount;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            uint32_t candidate = (start + i) % m_threadCount;
+            if (m_workers[candidate].Enabled() && m_workers[candidate].Sleeping())
+            {
+                nextWorker = candidate;
+                break;
+            }
+        }
+
         while (!m_workers[nextWorker].Enabled())
         {
             // Graphs that are waiting for the completion of a task graph cannot enqueue tasks onto
@@ -462,7 +551,33 @@ namespace AZ
             nextWorker = ++m_lastSubmission % m_threadCount;
         }
 
-        m_workers[nextWorker].Enqueue(&task);
+        if (!m_workers[nextWorker].Enqueue(&task))
+        {
+            WakeIdleTaskWorker(&m_workers[nextWorker]);
+        }
+    }
+
+    void TaskExecutor::WakeIdleTaskWorker(Internal::TaskWorker* owner)
+    {
+        uint32_t start = m_lastWake++;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            Internal::TaskWorker& worker = m_workers[(start + i) % m_threadCount];
+            if (&worker != owner && worker.TryWake())
+            {
+                return;
+            }
+        }
+    }
+
+    uint64_t TaskExecutor::GetStolenTaskCount() const
+    {
+        uint64_t stolenCount = 0;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            stolenCount += m_workers[i].m_stolenCount.load(AZStd::memory_order_relaxed);
+        }
+        return stolenCount;
     }
 
     void TaskExecutor::ReleaseGraph()
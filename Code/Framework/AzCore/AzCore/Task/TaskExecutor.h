@@ -138,6 +138,12 @@ namespace AZ
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        // Returns the number of tasks that were executed by a worker other than the one they were submitted to
+        uint64_t GetStolenTaskCount() const;
+
+        // Returns true if the calling thread is one of this executor's workers, which must not wait on a TaskGraphEvent
+        bool IsTaskWorkerThread();
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -146,10 +152,13 @@ namespace AZ
         Internal::TaskWorker* GetTaskWorker();
         void ReleaseGraph();
         void ReactivateTaskWorker();
+        // Wakes a parked worker, other than the owner of the queue a task was just pushed to, so that it can steal work
+        void WakeIdleTaskWorker(Internal::TaskWorker* owner);
 
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_lastWake;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
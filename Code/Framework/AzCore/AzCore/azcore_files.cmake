@@ -419,8 +419,12 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameAllocator.cpp
+    Memory/FrameAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
+    Memory/HugePages.cpp
+    Memory/HugePages.h
     Memory/IAllocator.h
     Memory/Memory_fwd.h
     Memory/Memory.cpp
@@ -107,6 +107,7 @@ namespace AZStd
             m_owns = u.m_owns;
             u.m_mutex = nullptr;
             u.m_owns = false;
+            return *this;
         }
 
         AZ_FORCE_INLINE ~unique_lock()
@@ -49,6 +49,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/HugePages_Unimplemented.cpp
     ../Common/Default/AzCore/Module/Internal/ModuleManagerSearchPathTool_Default.cpp
     AzCore/Math/Internal/MathTypes_Android.h
     AzCore/Math/Random_Platform.h
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/HugePages.h>
+
+namespace AZ::HugePages::Platform
+{
+    size_t GetHugePageSize()
+    {
+        return 0;
+    }
+
+    Mapping Map([[maybe_unused]] size_t byteSize, [[maybe_unused]] size_t alignment, [[maybe_unused]] Mode mode,
+        [[maybe_unused]] bool bindToLocalNumaNode)
+    {
+        return {};
+    }
+
+    void Unmap([[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize)
+    {
+    }
+} // namespace AZ::HugePages::Platform
@@ -0,0 +1,1408 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define AZ_STREAMER_IO_URING_SUPPORTED 1
+#else
+#define AZ_STREAMER_IO_URING_SUPPORTED 0
+#endif
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char QueueDepthName[] = "Queue depth";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    namespace Platform
+    {
+        //! Minimal wrapper around the io_uring system calls. liburing isn't available as a 3rd party library, so the rings are
+        //! mapped and driven directly. Only the functionality needed by StorageDriveLinux is supported: reads are queued in the
+        //! submission ring, submitted in batches and completions are signaled through an eventfd.
+        class IoUring final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(IoUring, SystemAllocator);
+
+            //! Creates a ring with at least the requested number of entries. Returns null if io_uring is not available, in which
+            //! case error is set to the errno of the call that failed.
+            static AZStd::unique_ptr<IoUring> Create(u32 entries, int& error);
+            ~IoUring();
+
+            //! Adds a read to the submission ring. The read won't be started until Submit is called.
+            bool QueueRead(int fileDescriptor, const iovec* buffer, u64 offset, u64 userData);
+            //! Submits all queued reads to the kernel with a single system call. Reads the kernel couldn't accept because it's
+            //! temporarily out of resources stay queued and are submitted by the next call.
+            //! Returns 0, or the errno of the failure if the kernel refused the reads for any other reason. The ring can't be
+            //! used to submit reads after that.
+            int Submit();
+            //! Returns true if there are reads in the submission ring that haven't been accepted by the kernel yet.
+            bool HasUnsubmittedReads() const;
+            //! Removes the reads that haven't been accepted by the kernel from the submission ring and calls the callback with
+            //! the user data of each of them.
+            template<typename Callback>
+            void DiscardUnsubmittedReads(Callback&& callback);
+            //! Calls the callback with the user data and the result for every completed read.
+            template<typename Callback>
+            bool ReapCompletions(Callback&& callback);
+
+            int GetEventFileDescriptor() const;
+
+        private:
+            IoUring() = default;
+
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            io_uring_cqe* m_completionEntries{ nullptr };
+#endif
+            void* m_submissionRing{ nullptr };
+            void* m_completionRing{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            size_t m_completionRingSize{ 0 };
+            size_t m_submissionEntriesSize{ 0 };
+
+            unsigned* m_submissionHead{ nullptr };
+            unsigned* m_submissionTail{ nullptr };
+            unsigned* m_submissionArray{ nullptr };
+            unsigned* m_completionHead{ nullptr };
+            unsigned* m_completionTail{ nullptr };
+            unsigned m_submissionMask{ 0 };
+            unsigned m_completionMask{ 0 };
+            unsigned m_submissionEntryCount{ 0 };
+
+            int m_ringFileDescriptor{ -1 };
+            int m_eventFileDescriptor{ -1 };
+        };
+
+        AZStd::unique_ptr<IoUring> IoUring::Create([[maybe_unused]] u32 entries, int& error)
+        {
+            // The ring's destructor unmaps and closes whatever was created so far, which can overwrite errno, so the error is
+            // captured right after the call that failed.
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            AZStd::unique_ptr<IoUring> ring(aznew IoUring());
+
+            io_uring_params params{};
+            ring->m_ringFileDescriptor = aznumeric_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+            if (ring->m_ringFileDescriptor < 0)
+            {
+                error = errno;
+                return nullptr;
+            }
+
+            ring->m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            ring->m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMap)
+            {
+                ring->m_submissionRingSize = AZStd::max(ring->m_submissionRingSize, ring->m_completionRingSize);
+                ring->m_completionRingSize = ring->m_submissionRingSize;
+            }
+
+            ring->m_submissionRing = mmap(nullptr, ring->m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ring->m_ringFileDescriptor, IORING_OFF_SQ_RING);
+            if (ring->m_submissionRing == MAP_FAILED)
+            {
+                error = errno;
+                ring->m_submissionRing = nullptr;
+                return nullptr;
+            }
+
+            if (singleMap)
+            {
+                ring->m_completionRing = ring->m_submissionRing;
+            }
+            else
+            {
+                ring->m_completionRing = mmap(nullptr, ring->m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    ring->m_ringFileDescriptor, IORING_OFF_CQ_RING);
+                if (ring->m_completionRing == MAP_FAILED)
+                {
+                    error = errno;
+                    ring->m_completionRing = nullptr;
+                    return nullptr;
+                }
+            }
+
+            ring->m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+            void* submissionEntries = mmap(nullptr, ring->m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ring->m_ringFileDescriptor, IORING_OFF_SQES);
+            if (submissionEntries == MAP_FAILED)
+            {
+                error = errno;
+                return nullptr;
+            }
+            ring->m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+            auto submissionRing = reinterpret_cast<u8*>(ring->m_submissionRing);
+            ring->m_submissionHead = reinterpret_cast<unsigned*>(submissionRing + params.sq_off.head);
+            ring->m_submissionTail = reinterpret_cast<unsigned*>(submissionRing + params.sq_off.tail);
+            ring->m_submissionArray = reinterpret_cast<unsigned*>(submissionRing + params.sq_off.array);
+            ring->m_submissionMask = *reinterpret_cast<unsigned*>(submissionRing + params.sq_off.ring_mask);
+            ring->m_submissionEntryCount = params.sq_entries;
+
+            auto completionRing = reinterpret_cast<u8*>(ring->m_completionRing);
+            ring->m_completionHead = reinterpret_cast<unsigned*>(completionRing + params.cq_off.head);
+            ring->m_completionTail = reinterpret_cast<unsigned*>(completionRing + params.cq_off.tail);
+            ring->m_completionMask = *reinterpret_cast<unsigned*>(completionRing + params.cq_off.ring_mask);
+            ring->m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+
+            // Completions are signaled through an eventfd so a thread can block on it without consuming completion entries.
+            ring->m_eventFileDescriptor = eventfd(0, EFD_CLOEXEC);
+            if (ring->m_eventFileDescriptor < 0 ||
+                syscall(__NR_io_uring_register, ring->m_ringFileDescriptor, IORING_REGISTER_EVENTFD, &ring->m_eventFileDescriptor, 1) < 0)
+            {
+                error = errno;
+                return nullptr;
+            }
+
+            return ring;
+#else
+            error = ENOSYS;
+            return nullptr;
+#endif
+        }
+
+        IoUring::~IoUring()
+        {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            if (m_submissionEntries)
+            {
+                munmap(m_submissionEntries, m_submissionEntriesSize);
+            }
+#endif
+            if (m_completionRing && m_completionRing != m_submissionRing)
+            {
+                munmap(m_completionRing, m_completionRingSize);
+            }
+            if (m_submissionRing)
+            {
+                munmap(m_submissionRing, m_submissionRingSize);
+            }
+            if (m_eventFileDescriptor >= 0)
+            {
+                close(m_eventFileDescriptor);
+            }
+            if (m_ringFileDescriptor >= 0)
+            {
+                close(m_ringFileDescriptor);
+            }
+        }
+
+        bool IoUring::QueueRead(
+            [[maybe_unused]] int fileDescriptor, [[maybe_unused]] const iovec* buffer, [[maybe_unused]] u64 offset,
+            [[maybe_unused]] u64 userData)
+        {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            unsigned tail = *m_submissionTail;
+            unsigned head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+            if (tail - head >= m_submissionEntryCount)
+            {
+                return false;
+            }
+
+            unsigned index = tail & m_submissionMask;
+            io_uring_sqe& entry = m_submissionEntries[index];
+            memset(&entry, 0, sizeof(entry));
+            // IORING_OP_READV is used over IORING_OP_READ as it's available on older kernels (5.1+).
+            entry.opcode = IORING_OP_READV;
+            entry.fd = fileDescriptor;
+            entry.addr = reinterpret_cast<u64>(buffer);
+            entry.len = 1;
+            entry.off = offset;
+            entry.user_data = userData;
+            m_submissionArray[index] = index;
+
+            // Publish the entry to the kernel.
+            __atomic_store_n(m_submissionTail, tail + 1, __ATOMIC_RELEASE);
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        int IoUring::Submit()
+        {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            unsigned toSubmit = *m_submissionTail - __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+            while (toSubmit > 0)
+            {
+                long result = syscall(__NR_io_uring_enter, m_ringFileDescriptor, toSubmit, 0, 0, nullptr, _NSIG / 8);
+                const int error = errno;
+                if (result >= 0)
+                {
+                    toSubmit -= aznumeric_cast<unsigned>(result);
+                }
+                else if (error == EAGAIN || error == EBUSY)
+                {
+                    // The kernel is temporarily out of resources or the completion ring needs to be drained first. Entries
+                    // that weren't consumed stay in the submission ring and HasUnsubmittedReads reports them, so the
+                    // drive retries after reaping completions.
+                    return 0;
+                }
+                else if (error != EINTR)
+                {
+                    return error;
+                }
+            }
+#endif
+            return 0;
+        }
+
+        bool IoUring::HasUnsubmittedReads() const
+        {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            return *m_submissionTail != __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+#else
+            return false;
+#endif
+        }
+
+        template<typename Callback>
+        void IoUring::DiscardUnsubmittedReads([[maybe_unused]] Callback&& callback)
+        {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            // The kernel only consumes entries during io_uring_enter, so the unconsumed entries can be taken back by moving the
+            // tail back to the head.
+            const unsigned head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+            for (unsigned index = head; index != *m_submissionTail; ++index)
+            {
+                callback(m_submissionEntries[m_submissionArray[index & m_submissionMask]].user_data);
+            }
+            __atomic_store_n(m_submissionTail, head, __ATOMIC_RELEASE);
+#endif
+        }
+
+        template<typename Callback>
+        bool IoUring::ReapCompletions([[maybe_unused]] Callback&& callback)
+        {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+            unsigned head = *m_completionHead;
+            unsigned tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+            if (head == tail)
+            {
+                return false;
+            }
+
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe& entry = m_completionEntries[head & m_completionMask];
+                callback(entry.user_data, entry.res);
+            }
+            __atomic_store_n(m_completionHead, head, __ATOMIC_RELEASE);
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        int IoUring::GetEventFileDescriptor() const
+        {
+            return m_eventFileDescriptor;
+        }
+    } // namespace Platform
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableIoUring(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, u32 queueDepth, s32 overCommit,
+        u32 fallbackThreadCount, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (Linux)")
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_fallbackThreadCount(fallbackThreadCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_maxFileHandles == 0)
+        {
+            m_maxFileHandles = 1;
+            AZ_Warning("StorageDriveLinux", false, "Received max file handle count of 0 for %s. Picking a count of 1 instead.\n",
+                m_name.c_str());
+        }
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 1;
+            AZ_Warning("StorageDriveLinux", false, "Received queue depth of 0 for %s. Picking a depth of 1 instead.\n", m_name.c_str());
+        }
+        // The number of in-flight reads is tracked per file handle in a u16.
+        m_queueDepth = AZStd::min(m_queueDepth, aznumeric_cast<u32>(std::numeric_limits<u16>::max()));
+        if (m_fallbackThreadCount == 0)
+        {
+            m_fallbackThreadCount = 1;
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        ShutdownReadBackend();
+        for (int file : m_fileCache_handles)
+        {
+            if (file != InvalidFileDescriptor)
+            {
+                close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsUsingIoUring() const
+    {
+        return m_ioUring != nullptr && !m_ioUringFailed;
+    }
+
+    void StorageDriveLinux::InitializeReadBackend()
+    {
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, InvalidFileDescriptor);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+        m_readSlots.resize(m_queueDepth);
+
+        m_isRunning = true;
+        m_ioUringFailed = false;
+        int ioUringError = 0;
+        if (m_constructionOptions.m_enableIoUring)
+        {
+            m_ioUring = Platform::IoUring::Create(m_queueDepth, ioUringError);
+        }
+
+        if (m_ioUring)
+        {
+            AZStd::thread_desc desc;
+            desc.m_name = "Streamer io_uring completions";
+            m_completionThread = AZStd::thread(desc, [this]() { CompletionThread_MainLoop(); });
+        }
+        else
+        {
+            if (m_constructionOptions.m_enableIoUring)
+            {
+                AZ_Warning("StorageDriveLinux", false,
+                    "io_uring is not available for %s (error %i). Falling back to %u read threads.\n",
+                    m_name.c_str(), ioUringError, m_fallbackThreadCount);
+            }
+            StartFallbackThreads();
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s is using %s for reads.\n", m_name.c_str(), m_ioUring ? "io_uring" : "a thread pool");
+        }
+        m_cachesInitialized = true;
+    }
+
+    void StorageDriveLinux::StartFallbackThreads()
+    {
+        m_fallbackThreads.reserve(m_fallbackThreadCount);
+        for (u32 i = 0; i < m_fallbackThreadCount; ++i)
+        {
+            AZStd::thread_desc desc;
+            desc.m_name = "Streamer read";
+            m_fallbackThreads.emplace_back(desc, [this]() { FallbackThread_MainLoop(); });
+        }
+    }
+
+    void StorageDriveLinux::ShutdownReadBackend()
+    {
+        if (!m_isRunning)
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_fallbackMutex);
+            m_isRunning = false;
+        }
+
+        if (m_ioUring)
+        {
+            // Wake up the completion thread so it can observe that the drive is shutting down.
+            u64 value = 1;
+            [[maybe_unused]] ssize_t result = write(m_ioUring->GetEventFileDescriptor(), &value, sizeof(value));
+            m_completionThread.join();
+            m_ioUring.reset();
+        }
+
+        m_fallbackCondition.notify_all();
+        for (AZStd::thread& thread : m_fallbackThreads)
+        {
+            thread.join();
+        }
+        m_fallbackThreads.clear();
+    }
+
+    void StorageDriveLinux::CompletionThread_MainLoop()
+    {
+        const int eventFileDescriptor = m_ioUring->GetEventFileDescriptor();
+        while (m_isRunning)
+        {
+            u64 count = 0;
+            ssize_t result = read(eventFileDescriptor, &count, sizeof(count));
+            const int error = errno;
+            if (result < 0 && error != EINTR)
+            {
+                AZ_Error("StorageDriveLinux", false, "Failed to wait for io_uring completions (error: %i).\n", error);
+                return;
+            }
+            if (m_isRunning)
+            {
+                // Completions are finalized on the Streamer thread.
+                m_context->WakeUpSchedulingThread();
+            }
+        }
+    }
+
+    void StorageDriveLinux::FallbackThread_MainLoop()
+    {
+        while (true)
+        {
+            size_t readSlot;
+            int fileDescriptor;
+            u8* output;
+            u64 size;
+            u64 offset;
+            {
+                AZStd::unique_lock lock(m_fallbackMutex);
+                m_fallbackCondition.wait(lock, [this]() { return !m_isRunning || !m_fallbackSubmitted.empty(); });
+                if (!m_isRunning)
+                {
+                    return;
+                }
+
+                readSlot = m_fallbackSubmitted.front();
+                m_fallbackSubmitted.pop_front();
+
+                const ReadSlot& slot = m_readSlots[readSlot];
+                fileDescriptor = slot.m_fileDescriptor;
+                output = reinterpret_cast<u8*>(slot.m_buffer.iov_base);
+                size = slot.m_buffer.iov_len;
+                offset = slot.m_offset;
+            }
+
+            s64 bytesRead = 0;
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::pread");
+                while (aznumeric_cast<u64>(bytesRead) < size)
+                {
+                    ssize_t result = pread(fileDescriptor, output + bytesRead, size - bytesRead, offset + bytesRead);
+                    if (result > 0)
+                    {
+                        bytesRead += result;
+                    }
+                    else if (result == 0)
+                    {
+                        break; // Reached the end of the file.
+                    }
+                    else if (errno != EINTR)
+                    {
+                        bytesRead = -errno;
+                        break;
+                    }
+                }
+            }
+
+            {
+                AZStd::scoped_lock lock(m_fallbackMutex);
+                m_readSlots[readSlot].m_result = bytesRead;
+                m_fallbackCompleted.push_back(readSlot);
+            }
+            m_context->WakeUpSchedulingThread();
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Queue as many reads as there are free slots, then submit them as a single batch.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request))
+            {
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+        // Also retry reads the kernel refused earlier. FinalizeReads has reaped completions by now, which frees up the
+        // resources io_uring_enter was waiting for.
+        bool hasUnsubmittedReads = IsUsingIoUring() && m_ioUring->HasUnsubmittedReads();
+        if (hasWorked || hasUnsubmittedReads)
+        {
+            SubmitQueuedReads();
+            // Keep the scheduler calling back while reads are still stuck in the submission ring. Without reads in flight
+            // no completion would wake it up again.
+            hasUnsubmittedReads = IsUsingIoUring() && m_ioUring->HasUnsubmittedReads();
+        }
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand()) || hasWorked;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked || hasUnsubmittedReads;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        const u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        const double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        for (const ReadSlot& slot : m_readSlots)
+        {
+            if (slot.m_isActive)
+            {
+                AZStd::chrono::steady_clock::time_point endTime = slot.m_startTime +
+                    Statistic::TimeValue(aznumeric_cast<u64>((slot.m_buffer.iov_len * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                slot.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = InvalidFileDescriptor;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file != InvalidFileDescriptor, "Found the file '%s' in cache, but file handle is invalid.\n",
+                data.m_path.GetRelativePathCStr());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                do
+                {
+                    file = open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC);
+                } while (file == InvalidFileDescriptor && errno == EINTR);
+
+                if (file == InvalidFileDescriptor)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFileHandle(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeReadBackend();
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = InvalidFileDescriptor;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        auto now = AZStd::chrono::steady_clock::now();
+        ReadSlot& slot = m_readSlots[readSlot];
+        slot.m_startTime = now;
+        slot.m_request = request;
+        slot.m_fileHandleIndex = fileCacheSlot;
+        slot.m_fileDescriptor = file;
+        slot.m_buffer.iov_base = data->m_output;
+        slot.m_buffer.iov_len = data->m_size;
+        slot.m_offset = data->m_offset;
+        slot.m_bytesRead = 0;
+        slot.m_result = 0;
+        slot.m_isActive = true;
+        slot.m_isCanceled = false;
+
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        m_queueDepthAverage.PushEntry(m_activeReads_Count);
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        Statistic::PlotImmediate(m_name, QueueDepthName, m_activeReads_Count);
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = data->m_offset + data->m_size;
+
+        QueueRead(readSlot);
+        return true;
+    }
+
+    void StorageDriveLinux::QueueRead(size_t readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        if (IsUsingIoUring())
+        {
+            [[maybe_unused]] bool queued = m_ioUring->QueueRead(slot.m_fileDescriptor, &slot.m_buffer, slot.m_offset, readSlot);
+            AZ_Assert(queued, "The io_uring submission ring for %s is full even though a read slot was available.", m_name.c_str());
+        }
+        else
+        {
+            AZStd::scoped_lock lock(m_fallbackMutex);
+            m_fallbackSubmitted.push_back(readSlot);
+        }
+    }
+
+    void StorageDriveLinux::SubmitQueuedReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        if (IsUsingIoUring())
+        {
+            if (const int error = m_ioUring->Submit(); error != 0)
+            {
+                OnIoUringSubmitFailed(error);
+            }
+        }
+        else
+        {
+            m_fallbackCondition.notify_all();
+        }
+    }
+
+    void StorageDriveLinux::OnIoUringSubmitFailed(int error)
+    {
+        // The kernel won't accept reads from this ring anymore, so retrying would only fail again on every scheduler pass.
+        // Reads that are already in flight still complete through the ring, new reads go to the fallback threads.
+        AZ_Error("StorageDriveLinux", false, "io_uring_enter failed for %s (error %i). Falling back to %u read threads.\n",
+            m_name.c_str(), error, m_fallbackThreadCount);
+        m_ioUringFailed = true;
+
+        m_ioUring->DiscardUnsubmittedReads(
+            [this](u64 userData)
+            {
+                const size_t readSlot = aznumeric_cast<size_t>(userData);
+                m_readSlots[readSlot].m_result = -EIO;
+                FinalizeSingleRequest(readSlot);
+            });
+        StartFallbackThreads();
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Reads that are already in flight can't be recalled as the kernel or a read thread may be writing into the output
+        // buffer. Instead they're flagged so they're reported as canceled once they complete.
+        for (ReadSlot& slot : m_readSlots)
+        {
+            if (slot.m_isActive && slot.m_request->WorksOn(target))
+            {
+                slot.m_isCanceled = true;
+                ownsRequestChain = true;
+            }
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        }
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStat;
+        if (stat(fileExists.m_path.GetAbsolutePathCStr(), &fileStat) == 0 && S_ISREG(fileStat.st_mode))
+        {
+            cacheIndex = GetNextMetaDataCacheSlot();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStat.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStat;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        bool result = cacheIndex != InvalidFileCacheIndex
+            ? fstat(m_fileCache_handles[cacheIndex], &fileStat) == 0
+            : stat(command.m_path.GetAbsolutePathCStr(), &fileStat) == 0;
+        if (!result || !S_ISREG(fileStat.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStat.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] != InvalidFileDescriptor)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePathCStr(), m_fileCache_activeReads[cacheIndex]);
+            close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = InvalidFileDescriptor;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+
+        size_t cacheIndex = FindInMetaDataCache(filePath);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            m_metaDataCache_paths[cacheIndex].Clear();
+            m_metaDataCache_fileSize[cacheIndex] = 0;
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+
+        auto metaDataCacheSize = m_metaDataCache_paths.size();
+        m_metaDataCache_paths.clear();
+        m_metaDataCache_fileSize.clear();
+        m_metaDataCache_front = 0;
+        m_metaDataCache_paths.resize(metaDataCacheSize);
+        m_metaDataCache_fileSize.resize(metaDataCacheSize);
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (m_activeReads_Count == 0)
+        {
+            return false;
+        }
+
+        bool hasWorked = false;
+        // Reads submitted before io_uring failed still complete through the ring
+        if (m_ioUring)
+        {
+            bool hasResubmitted = false;
+            hasWorked = m_ioUring->ReapCompletions(
+                [this, &hasResubmitted](u64 userData, s32 result)
+                {
+                    size_t readSlot = aznumeric_cast<size_t>(userData);
+                    ReadSlot& slot = m_readSlots[readSlot];
+                    if (result > 0 && aznumeric_cast<u64>(result) < slot.m_buffer.iov_len && !slot.m_isCanceled)
+                    {
+                        // Partial read, so queue up a read for the remainder.
+                        slot.m_bytesRead += result;
+                        slot.m_buffer.iov_base = reinterpret_cast<u8*>(slot.m_buffer.iov_base) + result;
+                        slot.m_buffer.iov_len -= result;
+                        slot.m_offset += result;
+                        QueueRead(readSlot);
+                        hasResubmitted = true;
+                    }
+                    else
+                    {
+                        slot.m_result = result < 0 ? result : aznumeric_cast<s64>(slot.m_bytesRead) + result;
+                        FinalizeSingleRequest(readSlot);
+                    }
+                });
+            if (hasResubmitted)
+            {
+                SubmitQueuedReads();
+            }
+        }
+        if (!IsUsingIoUring())
+        {
+            AZStd::vector<size_t> completed;
+            {
+                AZStd::scoped_lock lock(m_fallbackMutex);
+                completed.swap(m_fallbackCompleted);
+            }
+            for (size_t readSlot : completed)
+            {
+                FinalizeSingleRequest(readSlot);
+                hasWorked = true;
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        const u64 bytesTransferred = slot.m_result > 0 ? aznumeric_cast<u64>(slot.m_result) : 0;
+
+        m_activeReads_ByteCount += bytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&slot.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+        AZ_Warning("StorageDriveLinux", slot.m_result >= 0, "Failed to read from '%s' (error: %lli).\n",
+            readCommand->m_path.GetRelativePathCStr(), -slot.m_result);
+
+        const bool isSuccess = readCommand->m_size <= bytesTransferred;
+        slot.m_request->SetStatus(
+            slot.m_isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(slot.m_request);
+
+        m_fileCache_activeReads[slot.m_fileHandleIndex]--;
+        slot = ReadSlot{};
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots.size(); ++i)
+        {
+            if (!m_readSlots[i].m_isActive)
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed this drive achieved while it had reads in flight. If this is lower than expected it may "
+                "indicate that the queue depth is too low to saturate the device, other applications are using the same drive or "
+                "reads are being serviced by the fallback thread pool because io_uring is unavailable."));
+            statistics.push_back(Statistic::CreateFloatRange(
+                m_name, "Queue depth", m_queueDepthAverage.CalculateAverage(), aznumeric_cast<double>(m_queueDepthAverage.GetMinimum()),
+                aznumeric_cast<double>(m_queueDepthAverage.GetMaximum()),
+                "The number of reads that were in flight when a new read was submitted. Fast storage such as NVMe drives need "
+                "several reads in flight to reach their peak throughput. If this is consistently at the configured queue depth, "
+                "increasing the queue depth may improve read speeds."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes."));
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Read backend",
+                m_cachesInitialized ? (IsUsingIoUring() ? "io_uring" : "Thread pool") : "Not initialized",
+                "The mechanism used to keep multiple reads in flight. io_uring is used if available, otherwise reads are serviced by "
+                "a pool of threads. The backend is created when the first read is issued."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max file handles", m_maxFileHandles,
+                "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                "that can be in use at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                "The maximum number of files to keep meta data, such as the file size, to cache."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Queue depth", m_queueDepth, "The maximum number of reads this drive keeps in flight."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Overcommit", m_overCommit,
+                "The number of additional slots that will be reported as available. This makes sure that there are always a few "
+                "requests pending to avoid starvation. An over-commit that is too large can negatively impact the scheduler's ability "
+                "to re-order requests for optimal read order."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Fallback threads", m_fallbackThreadCount,
+                "The number of threads that service reads if io_uring is not available."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                "Whether or not the drive has a cost for seeking, such as happens on platter disks."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != InvalidFileDescriptor)
+                    {
+                        data.m_output.push_back(Statistic::CreatePersistentString(
+                            m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
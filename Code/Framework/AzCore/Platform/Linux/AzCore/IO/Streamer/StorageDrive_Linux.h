@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+#include <sys/uio.h>
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    namespace Platform
+    {
+        class IoUring;
+    }
+
+    //! Storage drive optimized for Linux. Unlike the generic StorageDrive, which blocks the Streamer thread on a single read
+    //! at a time, this drive keeps multiple reads in flight. Reads are submitted to the kernel through io_uring if it's
+    //! available. If io_uring can't be used, for instance because the kernel is too old or it's blocked by a container's
+    //! security policy, the reads are serviced by a small pool of threads issuing blocking reads instead.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Submit reads through io_uring if the kernel supports it. If false, or io_uring is unavailable,
+            //! reads are executed on a pool of threads.
+            u8 m_enableIoUring : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache. Needs
+        //!     to be a power of 2.
+        //! @param queueDepth The maximum number of reads that are kept in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param fallbackThreadCount The number of threads used to service reads if io_uring is not available.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, u32 queueDepth, s32 overCommit,
+            u32 fallbackThreadCount, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Returns true if reads are submitted through io_uring, or false if they're serviced by the fallback thread pool.
+        bool IsUsingIoUring() const;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr int InvalidFileDescriptor = -1;
+
+        struct ReadSlot
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            iovec m_buffer{};
+            FileRequest* m_request{ nullptr };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u64 m_offset{ 0 };
+            //! The total number of bytes read so far. Reads that complete partially are resubmitted for the remainder.
+            u64 m_bytesRead{ 0 };
+            //! Number of bytes read or, if negative, the errno of the failed read. Written by the thread completing the read.
+            s64 m_result{ 0 };
+            int m_fileDescriptor{ InvalidFileDescriptor };
+            bool m_isActive{ false };
+            bool m_isCanceled{ false };
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        void InitializeReadBackend();
+        void ShutdownReadBackend();
+        void StartFallbackThreads();
+        void FallbackThread_MainLoop();
+        void CompletionThread_MainLoop();
+
+        OpenFileResult OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        void QueueRead(size_t readSlot);
+        void SubmitQueuedReads();
+        //! Fails the reads io_uring didn't accept and sends new reads to the fallback threads.
+        void OnIoUringSubmitFailed(int error);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot() const;
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void CloseFileHandle(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot);
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_queueDepthAverage;
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<ReadSlot> m_readSlots;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        //! The io_uring instance reads are submitted to. Null if reads are serviced by the fallback threads.
+        AZStd::unique_ptr<Platform::IoUring> m_ioUring;
+        //! Thread that blocks until io_uring signals completions and wakes up the Streamer thread to finalize them.
+        AZStd::thread m_completionThread;
+
+        //! Set when io_uring stopped accepting reads. The ring is kept to complete the reads that were already submitted.
+        bool m_ioUringFailed{ false };
+
+        //! Threads that service reads when io_uring isn't available.
+        AZStd::vector<AZStd::thread> m_fallbackThreads;
+        AZStd::mutex m_fallbackMutex;
+        AZStd::condition_variable m_fallbackCondition;
+        //! Read slots waiting to be picked up by the fallback threads. Guarded by m_fallbackMutex.
+        AZStd::deque<size_t> m_fallbackSubmitted;
+        //! Read slots that the fallback threads have completed. Guarded by m_fallbackMutex.
+        AZStd::vector<size_t> m_fallbackCompleted;
+
+        AZStd::atomic_bool m_isRunning{ false };
+
+        size_t m_activeReads_ByteCount{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        u32 m_fallbackThreadCount{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/HugePages.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::HugePages::Platform
+{
+    namespace
+    {
+        constexpr size_t DefaultHugePageSize = 2 * 1024 * 1024;
+
+        // Reads the default huge page size from /proc/meminfo. This runs underneath the allocators, so it can't allocate.
+        size_t ReadHugePageSize()
+        {
+            int file = open("/proc/meminfo", O_RDONLY | O_CLOEXEC);
+            if (file == -1)
+            {
+                return DefaultHugePageSize;
+            }
+
+            char buffer[8192];
+            size_t bufferSize = 0;
+            ssize_t bytesRead;
+            while (bufferSize < sizeof(buffer) && (bytesRead = read(file, buffer + bufferSize, sizeof(buffer) - bufferSize)) > 0)
+            {
+                bufferSize += bytesRead;
+            }
+            close(file);
+
+            constexpr AZStd::string_view HugePageSizeKey = "Hugepagesize:";
+            const AZStd::string_view meminfo(buffer, bufferSize);
+            const size_t keyOffset = meminfo.find(HugePageSizeKey);
+            if (keyOffset == AZStd::string_view::npos)
+            {
+                return DefaultHugePageSize;
+            }
+
+            size_t sizeInKib = 0;
+            for (size_t i = keyOffset + HugePageSizeKey.size(); i < meminfo.size() && meminfo[i] != '\n'; ++i)
+            {
+                if (meminfo[i] >= '0' && meminfo[i] <= '9')
+                {
+                    sizeInKib = sizeInKib * 10 + (meminfo[i] - '0');
+                }
+            }
+            const size_t size = sizeInKib * 1024;
+            return (size != 0 && (size & (size - 1)) == 0) ? size : DefaultHugePageSize;
+        }
+
+        //! Maps anonymous memory with an alignment larger than the page size by over-allocating and unmapping the
+        //! unaligned head and tail.
+        void* MapAligned(size_t size, size_t alignment, int flags)
+        {
+            const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            const size_t paddedSize = alignment > pageSize ? size + alignment - pageSize : size;
+            void* mapped = mmap(nullptr, paddedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+            if (mapped == MAP_FAILED)
+            {
+                return nullptr;
+            }
+
+            char* start = static_cast<char*>(mapped);
+            char* aligned = reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<uintptr_t>(start), alignment));
+            if (aligned != start)
+            {
+                munmap(start, aligned - start);
+            }
+            char* end = start + paddedSize;
+            if (aligned + size != end)
+            {
+                munmap(aligned + size, end - (aligned + size));
+            }
+            return aligned;
+        }
+
+        //! Prefers the NUMA node of the calling thread for the pages of the mapping. This needs to happen before the
+        //! memory is first touched. The syscalls are used directly so there's no dependency on libnuma.
+        bool BindToLocalNumaNode(void* address, size_t size)
+        {
+            unsigned int cpu = 0;
+            unsigned int node = 0;
+            if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+            {
+                return false;
+            }
+
+            constexpr int MpolPreferred = 1;
+            constexpr size_t BitsPerWord = sizeof(unsigned long) * 8;
+            constexpr size_t MaxNodes = 1024;
+            unsigned long nodeMask[MaxNodes / BitsPerWord] = {};
+            if (node >= MaxNodes)
+            {
+                return false;
+            }
+            nodeMask[node / BitsPerWord] = 1ul << (node % BitsPerWord);
+            // The kernel expects one more than the number of bits in the node mask
+            return syscall(SYS_mbind, address, size, MpolPreferred, nodeMask, MaxNodes + 1, 0) == 0;
+        }
+    } // namespace
+
+    size_t GetHugePageSize()
+    {
+        static const size_t s_hugePageSize = ReadHugePageSize();
+        return s_hugePageSize;
+    }
+
+    Mapping Map(size_t byteSize, size_t alignment, Mode mode, bool bindToLocalNumaNode)
+    {
+        Mapping mapping;
+        const size_t hugePageSize = GetHugePageSize();
+        if (mode == Mode::Explicit && alignment <= hugePageSize)
+        {
+            // Mappings from the huge page pool are always aligned to the huge page size
+            const size_t size = AZ::SizeAlignUp(byteSize, hugePageSize);
+            void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (address != MAP_FAILED)
+            {
+                mapping = Mapping{ address, size, MappingFlags_ExplicitHugePages };
+            }
+        }
+
+        if (mapping.m_address == nullptr && mode != Mode::Disabled)
+        {
+            // Transparent huge pages are only used for huge page aligned ranges, so align both the start and the size
+            const size_t size = AZ::SizeAlignUp(byteSize, hugePageSize);
+            if (void* address = MapAligned(size, AZStd::max(alignment, hugePageSize), 0))
+            {
+                madvise(address, size, MADV_HUGEPAGE);
+                mapping = Mapping{ address, size, MappingFlags_TransparentHugePages };
+            }
+        }
+        else if (mode == Mode::Disabled)
+        {
+            const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            const size_t size = AZ::SizeAlignUp(byteSize, pageSize);
+            if (void* address = MapAligned(size, AZStd::max(alignment, pageSize), 0))
+            {
+                mapping = Mapping{ address, size, MappingFlags_None };
+            }
+        }
+
+        if (mapping.m_address != nullptr && bindToLocalNumaNode && BindToLocalNumaNode(mapping.m_address, mapping.m_size))
+        {
+            mapping.m_flags |= MappingFlags_NumaLocal;
+        }
+        return mapping;
+    }
+
+    void Unmap(void* address, size_t byteSize)
+    {
+        munmap(address, byteSize);
+    }
+} // namespace AZ::HugePages::Platform
@@ -49,6 +49,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Mac.cpp
     ../Common/Apple/AzCore/Memory/OSAllocator_Apple.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/HugePages_Unimplemented.cpp
     AzCore/Module/Internal/ModuleManagerSearchPathTool_Mac.cpp
     AzCore/Math/Internal/MathTypes_Mac.h
     AzCore/Math/Random_Platform.h
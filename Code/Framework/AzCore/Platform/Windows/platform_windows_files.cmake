@@ -53,6 +53,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Windows.cpp
     ../Common/WinAPI/AzCore/Memory/OSAllocator_WinAPI.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/HugePages_Unimplemented.cpp
     AzCore/Math/Random_Platform.h
     AzCore/Math/Random_Windows.cpp
     AzCore/Math/Random_Windows.h
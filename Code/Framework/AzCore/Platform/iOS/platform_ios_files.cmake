@@ -47,6 +47,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Apple/AzCore/Memory/OSAllocator_Apple.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/HugePages_Unimplemented.cpp
     AzCore/Math/Internal/MathTypes_iOS.h
     ../Common/Default/AzCore/Module/Internal/ModuleManagerSearchPathTool_Default.cpp
     AzCore/Math/Random_Platform.h
@@ -726,6 +726,255 @@ namespace UnitTest
         run();
     }
 
+    // Separate tag so the thread pool used by the remote free tests gets its own thread local storage
+    struct RemoteFreeThreadPoolTag;
+    using RemoteFreeThreadPool = ThreadPoolSchemaHelper<RemoteFreeThreadPoolTag>;
+
+    class ThreadPoolRemoteFreeTest
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t NumAllocations = 4096;
+        static constexpr size_t AllocationSize = 64;
+
+        void AllocateAll(RemoteFreeThreadPool& threadPool, AZStd::vector<void*>& addresses)
+        {
+            addresses.resize(NumAllocations);
+            for (void*& address : addresses)
+            {
+                address = threadPool.allocate(AllocationSize, 8);
+                ASSERT_NE(nullptr, address);
+                memset(address, 1, AllocationSize);
+            }
+        }
+    };
+
+    TEST_F(ThreadPoolRemoteFreeTest, RemoteFrees_AreReturnedToTheOwningThreadOnItsNextAllocation)
+    {
+        RemoteFreeThreadPool threadPool;
+        threadPool.Create();
+
+        AZStd::vector<void*> addresses;
+        AllocateAll(threadPool, addresses);
+        EXPECT_EQ(NumAllocations * AllocationSize, threadPool.NumAllocatedBytes());
+
+        AZStd::thread remoteThread([&threadPool, &addresses]()
+        {
+            for (void* address : addresses)
+            {
+                EXPECT_EQ(AllocationSize, threadPool.deallocate(address, 0, 0));
+            }
+        });
+        remoteThread.join();
+
+        // The elements stay with the owning thread until it allocates again
+        EXPECT_EQ(NumAllocations * AllocationSize, threadPool.NumAllocatedBytes());
+        void* address = threadPool.allocate(AllocationSize, 8);
+        ASSERT_NE(nullptr, address);
+        EXPECT_EQ(AllocationSize, threadPool.NumAllocatedBytes());
+        threadPool.deallocate(address, 0, 0);
+        EXPECT_EQ(0, threadPool.NumAllocatedBytes());
+    }
+
+    TEST_F(ThreadPoolRemoteFreeTest, GarbageCollect_FromAnotherThread_CollectsTheIdleOwnersPages)
+    {
+        RemoteFreeThreadPool threadPool;
+        threadPool.Create();
+
+        AZStd::vector<void*> addresses;
+        AllocateAll(threadPool, addresses);
+
+        // Frees every element and garbage collects from a thread that doesn't own the pages. The owning thread isn't
+        // using its pools while it waits for the join, so the remote frees are returned to its pools right away.
+        AZStd::thread remoteThread([&threadPool, &addresses]()
+        {
+            for (void* address : addresses)
+            {
+                threadPool.deallocate(address, 0, 0);
+            }
+            threadPool.GarbageCollect();
+        });
+        remoteThread.join();
+        EXPECT_EQ(0, threadPool.NumAllocatedBytes());
+
+        void* address = threadPool.allocate(AllocationSize, 8);
+        ASSERT_NE(nullptr, address);
+        EXPECT_EQ(AllocationSize, threadPool.NumAllocatedBytes());
+        threadPool.deallocate(address, 0, 0);
+        EXPECT_EQ(0, threadPool.NumAllocatedBytes());
+    }
+
+    TEST_F(ThreadPoolRemoteFreeTest, GarbageCollect_AfterOwningThreadExited_FreesItsPages)
+    {
+        RemoteFreeThreadPool threadPool;
+        threadPool.Create();
+        AZStd::vector<void*> addresses;
+        addresses.reserve(NumAllocations);
+        threadPool.GarbageCollect();
+        auto& pageAllocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        const size_t pageAllocatorBytes = pageAllocator.NumAllocatedBytes();
+
+        // A short lived thread fills some pages and exits, its elements are freed afterwards from this thread
+        AZStd::thread ownerThread([this, &threadPool, &addresses]()
+        {
+            AllocateAll(threadPool, addresses);
+        });
+        ownerThread.join();
+        EXPECT_EQ(NumAllocations * AllocationSize, threadPool.NumAllocatedBytes());
+        EXPECT_LT(pageAllocatorBytes, pageAllocator.NumAllocatedBytes());
+
+        for (void* address : addresses)
+        {
+            EXPECT_EQ(AllocationSize, threadPool.deallocate(address, 0, 0));
+        }
+        threadPool.GarbageCollect();
+        EXPECT_EQ(0, threadPool.NumAllocatedBytes());
+        EXPECT_EQ(pageAllocatorBytes, pageAllocator.NumAllocatedBytes());
+    }
+
+    TEST_F(ThreadPoolRemoteFreeTest, GarbageCollect_WhileShortLivedThreadsAllocate_FreesThePagesOfExitedThreads)
+    {
+        RemoteFreeThreadPool threadPool;
+        threadPool.Create();
+        threadPool.GarbageCollect();
+        auto& pageAllocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        const size_t pageAllocatorBytes = pageAllocator.NumAllocatedBytes();
+
+        // Threads keep allocating, freeing some of their elements themselves and handing the rest to the next thread
+        // before they exit, while this thread garbage collects.
+        constexpr size_t NumThreads = 32;
+        constexpr size_t BatchSize = 512;
+        AZStd::mutex handoffMutex;
+        AZStd::vector<void*> handoff;
+        AZStd::atomic<bool> threadsDone{ false };
+        AZStd::thread spawnThread([&]()
+        {
+            for (size_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+            {
+                AZStd::thread thread([&, threadIndex]()
+                {
+                    AZStd::vector<void*> batch;
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(handoffMutex);
+                        batch.swap(handoff);
+                    }
+                    for (void* address : batch)
+                    {
+                        threadPool.deallocate(address, 0, 0);
+                    }
+                    batch.clear();
+                    for (size_t allocationIndex = 0; allocationIndex < BatchSize; ++allocationIndex)
+                    {
+                        void* address = threadPool.allocate(AllocationSize, 8);
+                        ASSERT_NE(nullptr, address);
+                        memset(address, static_cast<int>(threadIndex), AllocationSize);
+                        if (allocationIndex % 2)
+                        {
+                            threadPool.deallocate(address, 0, 0);
+                        }
+                        else
+                        {
+                            batch.push_back(address);
+                        }
+                    }
+                    AZStd::lock_guard<AZStd::mutex> lock(handoffMutex);
+                    handoff.swap(batch);
+                });
+                thread.join();
+            }
+            threadsDone = true;
+        });
+
+        while (!threadsDone)
+        {
+            threadPool.GarbageCollect();
+            AZStd::this_thread::yield();
+        }
+        spawnThread.join();
+
+        for (void* address : handoff)
+        {
+            threadPool.deallocate(address, 0, 0);
+        }
+        handoff.clear();
+        handoff.shrink_to_fit();
+        threadPool.GarbageCollect();
+        EXPECT_EQ(0, threadPool.NumAllocatedBytes());
+        EXPECT_EQ(pageAllocatorBytes, pageAllocator.NumAllocatedBytes());
+    }
+
+    TEST_F(ThreadPoolRemoteFreeTest, RemoteFrees_WithConcurrentGarbageCollect_DoNotCorruptThePools)
+    {
+        RemoteFreeThreadPool threadPool;
+        threadPool.Create();
+
+        // Every thread allocates batches that its neighbour frees, so pages constantly drain through the remote free lists
+        // and move between threads through the shared free pages, while another thread keeps garbage collecting.
+        constexpr size_t NumThreads = 4;
+        constexpr size_t NumIterations = 64;
+        constexpr size_t BatchSize = 256;
+        AZStd::mutex batchMutex;
+        AZStd::vector<void*> batches[NumThreads];
+        AZStd::atomic<size_t> numFinishedThreads{ 0 };
+
+        AZStd::thread threads[NumThreads];
+        for (size_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([&, threadIndex]()
+            {
+                for (size_t iteration = 0; iteration < NumIterations; ++iteration)
+                {
+                    AZStd::vector<void*> batch;
+                    for (size_t allocationIndex = 0; allocationIndex < BatchSize; ++allocationIndex)
+                    {
+                        const size_t size = 8 + (allocationIndex % 32) * 8;
+                        void* address = threadPool.allocate(size, 8);
+                        ASSERT_NE(nullptr, address);
+                        memset(address, static_cast<int>(threadIndex), size);
+                        batch.push_back(address);
+                    }
+
+                    {
+                        // Hand the batch to the next thread and take whatever the previous thread handed to this one
+                        AZStd::lock_guard<AZStd::mutex> lock(batchMutex);
+                        AZStd::vector<void*>& nextBatch = batches[(threadIndex + 1) % NumThreads];
+                        nextBatch.insert(nextBatch.end(), batch.begin(), batch.end());
+                        batch.clear();
+                        batch.swap(batches[threadIndex]);
+                    }
+                    for (void* address : batch)
+                    {
+                        threadPool.deallocate(address, 0, 0);
+                    }
+                }
+                ++numFinishedThreads;
+            });
+        }
+
+        AZStd::thread collectThread([&]()
+        {
+            while (numFinishedThreads < NumThreads)
+            {
+                threadPool.GarbageCollect();
+                AZStd::this_thread::yield();
+            }
+        });
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        collectThread.join();
+
+        for (AZStd::vector<void*>& batch : batches)
+        {
+            for (void* address : batch)
+            {
+                threadPool.deallocate(address, 0, 0);
+            }
+        }
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
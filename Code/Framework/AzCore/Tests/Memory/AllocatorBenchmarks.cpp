@@ -11,6 +11,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -18,6 +19,8 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <benchmark/benchmark.h>
@@ -454,6 +457,248 @@ namespace Benchmark
 #undef BM_REGISTER_SIZE_FIXTURES
 #undef BM_REGISTER_TEMPLATE
 
+    // Thread pool allocator used by the cross thread benchmarks, a separate type is needed so it gets its own thread local storage
+    class BenchmarkThreadPoolAllocator
+        : public AZ::ThreadPoolBase<BenchmarkThreadPoolAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BenchmarkThreadPoolAllocator, AZ::SystemAllocator);
+        AZ_TYPE_INFO(BenchmarkThreadPoolAllocator, "{0E3C4E0B-7A2D-4C3B-9F4E-6A1C2B7D9E51}");
+
+        using Base = AZ::ThreadPoolBase<BenchmarkThreadPoolAllocator>;
+    };
+
+    /// Measures allocations that are freed on a different thread than the one that allocated them.
+    /// Every benchmark thread allocates a batch each iteration and hands it to the next thread through a single producer single
+    /// consumer ring, which frees it. With two threads this is a producer/consumer pattern in both directions, with more threads
+    /// every thread frees allocations produced by its neighbour. The argument is the number of allocations per batch.
+    template <typename TAllocator>
+    class CrossThreadFreeBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    protected:
+        using TestAllocatorType = TAllocator;
+
+        struct Ring
+        {
+            AZStd::vector<void*> m_slots;
+            AZStd::atomic<size_t> m_head{ 0 };
+            AZStd::atomic<size_t> m_tail{ 0 };
+
+            void Push(void* ptr)
+            {
+                const size_t tail = m_tail.load(AZStd::memory_order_relaxed);
+                while (tail - m_head.load(AZStd::memory_order_acquire) == m_slots.size())
+                {
+                    AZStd::this_thread::yield();
+                }
+                m_slots[tail % m_slots.size()] = ptr;
+                m_tail.store(tail + 1, AZStd::memory_order_release);
+            }
+
+            void* Pop()
+            {
+                const size_t head = m_head.load(AZStd::memory_order_relaxed);
+                while (m_tail.load(AZStd::memory_order_acquire) == head)
+                {
+                    AZStd::this_thread::yield();
+                }
+                void* ptr = m_slots[head % m_slots.size()];
+                m_head.store(head + 1, AZStd::memory_order_release);
+                return ptr;
+            }
+        };
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            // Only thread 0 sets up the shared state. The other threads run SetUp concurrently, so they must not read it until
+            // the start barrier at the beginning of the benchmark loop.
+            if (state.thread_index() == 0)
+            {
+                m_allocator = AZStd::make_unique<TestAllocatorType>();
+                m_rings.resize(state.threads());
+                for (AZStd::unique_ptr<Ring>& ring : m_rings)
+                {
+                    // Room for several batches, so a thread never blocks on a full ring while its consumer waits on it
+                    ring = AZStd::make_unique<Ring>();
+                    ring->m_slots.resize(aznumeric_cast<size_t>(state.range(0)) * 4);
+                }
+            }
+        }
+
+        void internalTearDown(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                // Free whatever the final iterations left in flight before destroying the allocator
+                for (AZStd::unique_ptr<Ring>& ring : m_rings)
+                {
+                    while (ring->m_head.load() != ring->m_tail.load())
+                    {
+                        m_allocator->deallocate(ring->Pop(), 0, 0);
+                    }
+                }
+                m_rings.clear();
+                m_allocator->GarbageCollect();
+                m_allocator = nullptr;
+            }
+        }
+
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+        void Benchmark(benchmark::State& state)
+        {
+            const size_t batchSize = aznumeric_cast<size_t>(state.range(0));
+            const size_t threadIndex = aznumeric_cast<size_t>(state.thread_index());
+            const AllocationSizeArray& allocationArray = s_allocationSizes[SMALL];
+            Ring* outgoing = nullptr;
+            Ring* incoming = nullptr;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                if (outgoing == nullptr)
+                {
+                    // The rings are created by thread 0 and are only safe to read once the start barrier has been passed
+                    outgoing = m_rings[threadIndex].get();
+                    incoming = m_rings[(threadIndex + m_rings.size() - 1) % m_rings.size()].get();
+                }
+
+                for (size_t allocationIndex = 0; allocationIndex < batchSize; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    outgoing->Push(m_allocator->allocate(allocationSize, 8));
+                }
+                for (size_t allocationIndex = 0; allocationIndex < batchSize; ++allocationIndex)
+                {
+                    m_allocator->deallocate(incoming->Pop(), 0, 0);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * batchSize);
+        }
+
+    private:
+        AZStd::unique_ptr<TestAllocatorType> m_allocator;
+        AZStd::vector<AZStd::unique_ptr<Ring>> m_rings;
+    };
+
+    static void CrossThreadRunRanges(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(64)->Arg(512);
+    }
+
+    BENCHMARK_TEMPLATE_DEFINE_F(CrossThreadFreeBenchmarkFixture, ThreadPoolAllocator, BenchmarkThreadPoolAllocator)(benchmark::State& state)
+    {
+        Benchmark(state);
+    }
+    BENCHMARK_REGISTER_F(CrossThreadFreeBenchmarkFixture, ThreadPoolAllocator)->ThreadRange(2, MaxThreadRange)->Apply(CrossThreadRunRanges)->UseRealTime();
+
+    BENCHMARK_TEMPLATE_DEFINE_F(CrossThreadFreeBenchmarkFixture, SystemAllocator, TestSystemAllocator)(benchmark::State& state)
+    {
+        Benchmark(state);
+    }
+    BENCHMARK_REGISTER_F(CrossThreadFreeBenchmarkFixture, SystemAllocator)->ThreadRange(2, MaxThreadRange)->Apply(CrossThreadRunRanges)->UseRealTime();
+
+    /// Measures the temporary containers built while processing a tick, such as visibility or replication candidate lists.
+    /// Every iteration is one tick filling several short lived vectors, with the frame allocator reset at the end of the tick
+    /// the way the ComponentApplication does it. The argument is the number of containers built per tick.
+    template <typename TAllocator>
+    class ScratchContainerBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    protected:
+        using TestAllocatorType = TAllocator;
+
+        void internalSetUp()
+        {
+            m_allocator = AZStd::make_unique<TestAllocatorType>();
+        }
+
+        void internalTearDown()
+        {
+            m_allocator->GarbageCollect();
+            m_allocator = nullptr;
+        }
+
+    public:
+        void SetUp(const ::benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void Benchmark(benchmark::State& state)
+        {
+            const size_t containersPerTick = aznumeric_cast<size_t>(state.range(0));
+            const AllocationSizeArray& elementCounts = s_allocationSizes[SMALL];
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t containerIndex = 0; containerIndex < containersPerTick; ++containerIndex)
+                {
+                    AZStd::vector<AZ::u64, AZ::AZStdIAllocator> scratch(AZ::AZStdIAllocator(m_allocator.get()));
+                    const size_t elementCount = elementCounts[containerIndex % elementCounts.size()];
+                    for (size_t elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+                    {
+                        scratch.push_back(elementIndex);
+                    }
+                    benchmark::DoNotOptimize(scratch.data());
+                }
+
+                if constexpr (AZStd::is_same_v<TestAllocatorType, AZ::FrameAllocator>)
+                {
+                    m_allocator->ResetFrame();
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * containersPerTick);
+        }
+
+    private:
+        AZStd::unique_ptr<TestAllocatorType> m_allocator;
+    };
+
+    BENCHMARK_TEMPLATE_DEFINE_F(ScratchContainerBenchmarkFixture, FrameAllocator, AZ::FrameAllocator)(benchmark::State& state)
+    {
+        Benchmark(state);
+    }
+    BENCHMARK_REGISTER_F(ScratchContainerBenchmarkFixture, FrameAllocator)->Arg(16)->Arg(256);
+
+    BENCHMARK_TEMPLATE_DEFINE_F(ScratchContainerBenchmarkFixture, SystemAllocator, TestSystemAllocator)(benchmark::State& state)
+    {
+        Benchmark(state);
+    }
+    BENCHMARK_REGISTER_F(ScratchContainerBenchmarkFixture, SystemAllocator)->Arg(16)->Arg(256);
+
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameAllocatorTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FrameAllocatorTest, Allocate_RespectsAlignmentAndDoesNotOverlap)
+    {
+        AZ::FrameAllocator allocator;
+
+        AZStd::vector<AZStd::pair<char*, size_t>> allocations;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            const size_t size = 1 + (i * 37) % 200;
+            const size_t alignment = size_t{ 1 } << (i % 8);
+            char* address = static_cast<char*>(allocator.allocate(size, alignment));
+            ASSERT_NE(address, nullptr);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(address) % alignment, 0);
+            memset(address, static_cast<int>(i), size);
+            allocations.emplace_back(address, size);
+        }
+
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            for (size_t j = 0; j < allocations[i].second; ++j)
+            {
+                ASSERT_EQ(allocations[i].first[j], static_cast<char>(i));
+            }
+        }
+    }
+
+    TEST_F(FrameAllocatorTest, ResetFrame_KeepsMemoryValidForFrameLatency)
+    {
+        AZ::FrameAllocator allocator;
+
+        constexpr size_t AllocationSize = 1024;
+        char* firstFrame = static_cast<char*>(allocator.allocate(AllocationSize, 16));
+        ASSERT_NE(firstFrame, nullptr);
+        memset(firstFrame, 0xA5, AllocationSize);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), AllocationSize);
+
+        // Memory from the previous frame can't be handed out again
+        allocator.ResetFrame();
+        EXPECT_EQ(allocator.GetFrameIndex(), 1);
+        char* secondFrame = static_cast<char*>(allocator.allocate(AllocationSize, 16));
+        ASSERT_NE(secondFrame, nullptr);
+        EXPECT_TRUE(secondFrame + AllocationSize <= firstFrame || firstFrame + AllocationSize <= secondFrame);
+        memset(secondFrame, 0x5A, AllocationSize);
+        for (size_t i = 0; i < AllocationSize; ++i)
+        {
+            ASSERT_EQ(firstFrame[i], static_cast<char>(0xA5));
+        }
+        EXPECT_EQ(allocator.NumAllocatedBytes(), AllocationSize * 2);
+
+        // After FrameLatency frames the first frame's memory is recycled
+        allocator.ResetFrame();
+        char* thirdFrame = static_cast<char*>(allocator.allocate(AllocationSize, 16));
+        EXPECT_EQ(thirdFrame, firstFrame);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), AllocationSize * 2);
+    }
+
+    TEST_F(FrameAllocatorTest, Deallocate_MostRecentAllocationIsReused)
+    {
+        AZ::FrameAllocator allocator;
+
+        void* first = allocator.allocate(64, 8);
+        void* second = allocator.allocate(64, 8);
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+
+        // Only the most recent allocation is handed back
+        allocator.deallocate(first, 64, 8);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 128);
+        allocator.deallocate(second, 64, 8);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 64);
+        EXPECT_EQ(allocator.allocate(64, 8), second);
+    }
+
+    TEST_F(FrameAllocatorTest, Reallocate_GrowsMostRecentAllocationInPlace)
+    {
+        AZ::FrameAllocator allocator;
+
+        char* address = static_cast<char*>(allocator.allocate(16, 8));
+        ASSERT_NE(address, nullptr);
+        memset(address, 0x3C, 16);
+
+        EXPECT_EQ(allocator.reallocate(address, 256, 8), address);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 256);
+
+        // Growing past the end of the chunk moves the allocation and keeps its contents
+        char* moved = static_cast<char*>(allocator.reallocate(address, AZ::FrameAllocator::ChunkSize * 2, 8));
+        ASSERT_NE(moved, nullptr);
+        EXPECT_NE(moved, address);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            ASSERT_EQ(moved[i], static_cast<char>(0x3C));
+        }
+    }
+
+    TEST_F(FrameAllocatorTest, Reallocate_OlderAllocation_CopiesItIntoANewAllocation)
+    {
+        AZ::FrameAllocator allocator;
+
+        char* older = static_cast<char*>(allocator.allocate(64, 8));
+        ASSERT_NE(older, nullptr);
+        memset(older, 0x5A, 64);
+        char* newer = static_cast<char*>(allocator.allocate(32, 8));
+        ASSERT_NE(newer, nullptr);
+        memset(newer, 0x11, 32);
+        EXPECT_EQ(allocator.get_allocated_size(older), 64);
+
+        // Growing copies the whole allocation, the old one stays in place until the frame is recycled
+        char* grown = static_cast<char*>(allocator.reallocate(older, 256, 8));
+        ASSERT_NE(grown, nullptr);
+        EXPECT_NE(grown, older);
+        EXPECT_EQ(allocator.get_allocated_size(grown), 256);
+        for (size_t i = 0; i < 64; ++i)
+        {
+            ASSERT_EQ(grown[i], static_cast<char>(0x5A));
+            ASSERT_EQ(older[i], static_cast<char>(0x5A));
+        }
+        for (size_t i = 0; i < 32; ++i)
+        {
+            ASSERT_EQ(newer[i], static_cast<char>(0x11));
+        }
+
+        // Shrinking only copies what fits in the new size
+        char* shrunk = static_cast<char*>(allocator.reallocate(newer, 16, 8));
+        ASSERT_NE(shrunk, nullptr);
+        EXPECT_NE(shrunk, newer);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            ASSERT_EQ(shrunk[i], static_cast<char>(0x11));
+        }
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 64 + 32 + 256 + 16);
+    }
+
+    TEST_F(FrameAllocatorTest, Reallocate_FromAnotherThread_KeepsContents)
+    {
+        AZ::FrameAllocator allocator;
+
+        constexpr size_t AllocationSize = 100;
+        char* address = static_cast<char*>(allocator.allocate(AllocationSize, 4));
+        ASSERT_NE(address, nullptr);
+        memset(address, 0x42, AllocationSize);
+
+        char* moved = nullptr;
+        AZStd::thread thread([&allocator, &moved, address]()
+        {
+            moved = static_cast<char*>(allocator.reallocate(address, AllocationSize * 2, 4));
+        });
+        thread.join();
+
+        ASSERT_NE(moved, nullptr);
+        EXPECT_NE(moved, address);
+        for (size_t i = 0; i < AllocationSize; ++i)
+        {
+            ASSERT_EQ(moved[i], static_cast<char>(0x42));
+        }
+    }
+
+    TEST_F(FrameAllocatorTest, Allocate_LargeAllocationsGetTheirOwnChunk)
+    {
+        AZ::FrameAllocator allocator;
+
+        void* small = allocator.allocate(32, 8);
+        void* large = allocator.allocate(AZ::FrameAllocator::ChunkSize * 4, 16);
+        ASSERT_NE(large, nullptr);
+        memset(large, 0, AZ::FrameAllocator::ChunkSize * 4);
+
+        // Small allocations keep bumping from the current chunk
+        void* next = allocator.allocate(32, 8);
+        EXPECT_EQ(static_cast<char*>(next), static_cast<char*>(small) + 32 + AZ::FrameAllocator::AllocationHeaderSize);
+
+        allocator.GarbageCollect();
+        for (AZ::u64 i = 0; i < AZ::FrameAllocator::FrameLatency; ++i)
+        {
+            allocator.ResetFrame();
+        }
+        EXPECT_NE(allocator.allocate(32, 8), nullptr);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 32);
+    }
+
+    TEST_F(FrameAllocatorTest, Allocate_FromMultipleThreads_TracksEveryThread)
+    {
+        AZ::FrameAllocator allocator;
+
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationsPerThread = 1000;
+        constexpr size_t AllocationSize = 48;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, threadIndex]()
+            {
+                AZStd::vector<char*> allocations;
+                for (size_t i = 0; i < AllocationsPerThread; ++i)
+                {
+                    char* address = static_cast<char*>(allocator.allocate(AllocationSize, 16));
+                    memset(address, static_cast<int>(threadIndex), AllocationSize);
+                    allocations.push_back(address);
+                }
+                for (char* address : allocations)
+                {
+                    EXPECT_EQ(address[0], static_cast<char>(threadIndex));
+                    EXPECT_EQ(address[AllocationSize - 1], static_cast<char>(threadIndex));
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(allocator.NumAllocatedBytes(), ThreadCount * AllocationsPerThread * AllocationSize);
+
+        // Threads that stop allocating no longer count once their memory is recycled
+        for (AZ::u64 i = 0; i < AZ::FrameAllocator::FrameLatency; ++i)
+        {
+            allocator.ResetFrame();
+        }
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 0);
+    }
+
+    TEST_F(FrameAllocatorTest, ResetFrame_ReleasesTheChunksOfExitedThreads)
+    {
+        AZ::FrameAllocator allocator;
+        auto& systemAllocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        const size_t systemAllocatorBytes = systemAllocator.NumAllocatedBytes();
+
+        constexpr size_t ThreadCount = 8;
+        constexpr size_t AllocationSize = 4096;
+        constexpr size_t AllocationsPerThread = 256;
+        AZStd::atomic<char*> lastAllocations[ThreadCount] = {};
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            AZStd::thread thread([&allocator, &lastAllocations, threadIndex]()
+            {
+                for (size_t i = 0; i < AllocationsPerThread; ++i)
+                {
+                    char* address = static_cast<char*>(allocator.allocate(AllocationSize, 16));
+                    ASSERT_NE(address, nullptr);
+                    memset(address, static_cast<int>(threadIndex), AllocationSize);
+                    lastAllocations[threadIndex] = address;
+                }
+            });
+            thread.join();
+        }
+        EXPECT_LT(systemAllocatorBytes, systemAllocator.NumAllocatedBytes());
+
+        // Memory of the exited threads stays valid for the rest of the frame latency
+        allocator.ResetFrame();
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            char* address = lastAllocations[threadIndex];
+            EXPECT_EQ(address[0], static_cast<char>(threadIndex));
+            EXPECT_EQ(address[AllocationSize - 1], static_cast<char>(threadIndex));
+        }
+
+        for (AZ::u64 i = 1; i < AZ::FrameAllocator::FrameLatency; ++i)
+        {
+            allocator.ResetFrame();
+        }
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 0);
+        EXPECT_EQ(systemAllocatorBytes, systemAllocator.NumAllocatedBytes());
+    }
+}
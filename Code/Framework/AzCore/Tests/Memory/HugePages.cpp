@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/HugePages.h>
+#include <AzCore/Memory/OSAllocator.h>
+
+namespace UnitTest
+{
+    class HugePagesTest
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t LargeAllocationSize = 4 * 1024 * 1024;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_previousSettings = AZ::HugePages::GetSettings();
+        }
+
+        void TearDown() override
+        {
+            AZ::HugePages::SetSettings(m_previousSettings);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        void EnableTransparentHugePages()
+        {
+            AZ::HugePages::Settings settings;
+            settings.m_mode = AZ::HugePages::Mode::Transparent;
+            AZ::HugePages::SetSettings(settings);
+        }
+
+        AZ::HugePages::Settings m_previousSettings;
+    };
+
+    TEST_F(HugePagesTest, Allocate_Disabled_ReturnsNullptr)
+    {
+        AZ::HugePages::SetSettings({});
+
+        EXPECT_EQ(AZ::HugePages::GetArenaSize(), 0);
+        EXPECT_FALSE(AZ::HugePages::UsesHugePages(LargeAllocationSize));
+        EXPECT_EQ(AZ::HugePages::Allocate(LargeAllocationSize, 16), nullptr);
+        EXPECT_EQ(AZ::HugePages::AllocateThreadArena(LargeAllocationSize, 16), nullptr);
+
+        int notMapped = 0;
+        EXPECT_FALSE(AZ::HugePages::Free(&notMapped));
+        EXPECT_EQ(AZ::HugePages::GetAllocationSize(&notMapped), 0);
+    }
+
+    TEST_F(HugePagesTest, Allocate_Transparent_MapsAlignedMemoryAndReportsUsage)
+    {
+        const size_t hugePageSize = AZ::HugePages::GetHugePageSize();
+        if (hugePageSize == 0)
+        {
+            GTEST_SKIP() << "Huge pages are not supported on this platform";
+        }
+        EnableTransparentHugePages();
+
+        // Allocations below the minimum size keep using the regular allocation
+        EXPECT_EQ(AZ::HugePages::Allocate(64 * 1024, 16), nullptr);
+
+        const AZ::HugePages::Statistics before = AZ::AllocatorManager::Instance().GetPageUsageStats();
+        char* address = static_cast<char*>(AZ::HugePages::Allocate(LargeAllocationSize, 64 * 1024));
+        ASSERT_NE(address, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(address) % hugePageSize, 0);
+        EXPECT_GE(AZ::HugePages::GetAllocationSize(address), LargeAllocationSize);
+        memset(address, 0x7E, LargeAllocationSize);
+
+        const AZ::HugePages::Statistics during = AZ::AllocatorManager::Instance().GetPageUsageStats();
+        EXPECT_EQ(during.m_hugePageSize, hugePageSize);
+        EXPECT_EQ(during.m_mappingCount, before.m_mappingCount + 1);
+        EXPECT_EQ(
+            during.m_explicitHugePageBytes + during.m_transparentHugePageBytes,
+            before.m_explicitHugePageBytes + before.m_transparentHugePageBytes + AZ::HugePages::GetAllocationSize(address));
+
+        EXPECT_TRUE(AZ::HugePages::Free(address));
+        const AZ::HugePages::Statistics after = AZ::AllocatorManager::Instance().GetPageUsageStats();
+        EXPECT_EQ(after.m_mappingCount, before.m_mappingCount);
+        EXPECT_EQ(after.m_transparentHugePageBytes, before.m_transparentHugePageBytes);
+    }
+
+    TEST_F(HugePagesTest, OSAllocator_Transparent_ReallocatesBetweenHugePagesAndHeap)
+    {
+        if (AZ::HugePages::GetHugePageSize() == 0)
+        {
+            GTEST_SKIP() << "Huge pages are not supported on this platform";
+        }
+        EnableTransparentHugePages();
+
+        AZ::OSAllocator allocator;
+        constexpr size_t SmallSize = 1024;
+        AllocateAddress small = allocator.allocate(SmallSize, 16);
+        ASSERT_NE(small.GetAddress(), nullptr);
+        EXPECT_EQ(AZ::HugePages::GetAllocationSize(small.GetAddress()), 0);
+        memset(small.GetAddress(), 0x42, SmallSize);
+
+        // Growing past the minimum size moves the allocation to huge pages and keeps its contents
+        AllocateAddress large = allocator.reallocate(small.GetAddress(), LargeAllocationSize, 16);
+        ASSERT_NE(large.GetAddress(), nullptr);
+        EXPECT_NE(AZ::HugePages::GetAllocationSize(large.GetAddress()), 0);
+        EXPECT_EQ(allocator.get_allocated_size(large.GetAddress()), AZ::HugePages::GetAllocationSize(large.GetAddress()));
+        const char* largeData = static_cast<const char*>(large.GetAddress());
+        for (size_t i = 0; i < SmallSize; ++i)
+        {
+            ASSERT_EQ(largeData[i], 0x42);
+        }
+
+        // Shrinking moves it back to the heap
+        AllocateAddress shrunk = allocator.reallocate(large.GetAddress(), SmallSize, 16);
+        ASSERT_NE(shrunk.GetAddress(), nullptr);
+        EXPECT_EQ(AZ::HugePages::GetAllocationSize(shrunk.GetAddress()), 0);
+        EXPECT_EQ(static_cast<const char*>(shrunk.GetAddress())[SmallSize - 1], 0x42);
+        allocator.deallocate(shrunk.GetAddress(), SmallSize, 16);
+        EXPECT_EQ(allocator.NumAllocatedBytes(), 0);
+    }
+
+    TEST_F(HugePagesTest, AllocateThreadArena_NumaLocal_MapsSmallArenas)
+    {
+        AZ::HugePages::Settings settings;
+        settings.m_bindToLocalNumaNode = true;
+        AZ::HugePages::SetSettings(settings);
+
+        constexpr size_t ArenaSize = 256 * 1024;
+        void* arena = AZ::HugePages::AllocateThreadArena(ArenaSize, 16);
+        if (arena == nullptr)
+        {
+            GTEST_SKIP() << "Thread arenas can't be mapped on this platform";
+        }
+        EXPECT_GE(AZ::HugePages::GetAllocationSize(arena), ArenaSize);
+        memset(arena, 0, ArenaSize);
+        EXPECT_TRUE(AZ::HugePages::Free(arena));
+        EXPECT_EQ(AZ::HugePages::GetAllocationSize(arena), 0);
+    }
+}
@@ -10,6 +10,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ::NameBenchmarks
 {
@@ -177,4 +178,77 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    //! Measures contention on the NameDictionary by having several threads make names from a shared pool of strings.
+    //! Each thread walks the pool from its own offset, so the sets of names interned by the threads overlap.
+    class NameContentionBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NamePoolSize = 4096;
+        static constexpr size_t NamesPerIteration = 64;
+
+        void RunBenchmark(::benchmark::State& state, bool keepNamesAlive)
+        {
+            if (state.thread_index() == 0)
+            {
+                AZ::NameDictionary::Create();
+
+                m_nameStrings.reserve(NamePoolSize);
+                for (size_t i = 0; i < NamePoolSize; ++i)
+                {
+                    m_nameStrings.push_back(AZStd::string::format("Materials/Passes/ShaderOption_%zu", i));
+                }
+
+                if (keepNamesAlive)
+                {
+                    // Simulates names that were already interned by previously loaded assets
+                    m_persistentNames.reserve(NamePoolSize);
+                    for (const AZStd::string& nameString : m_nameStrings)
+                    {
+                        m_persistentNames.emplace_back(nameString);
+                    }
+                }
+            }
+
+            // Setup by the first thread is visible to every thread once the benchmark loop starts
+            size_t nameIndex = (state.thread_index() * NamePoolSize) / state.threads();
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t i = 0; i < NamesPerIteration; ++i)
+                {
+                    AZ::Name name(m_nameStrings[nameIndex]);
+                    benchmark::DoNotOptimize(name);
+                    nameIndex = (nameIndex + 1) % NamePoolSize;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * NamesPerIteration);
+
+            if (state.thread_index() == 0)
+            {
+                m_persistentNames = {};
+                m_nameStrings = {};
+                AZ::NameDictionary::Destroy();
+            }
+        }
+
+    protected:
+        AZStd::vector<AZStd::string> m_nameStrings;
+        AZStd::vector<AZ::Name> m_persistentNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MakeExistingNames)(::benchmark::State& state)
+    {
+        RunBenchmark(state, true);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MakeExistingNames)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MakeAndReleaseNames)(::benchmark::State& state)
+    {
+        RunBenchmark(state, false);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MakeAndReleaseNames)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
 } // namespace AZ::NameBenchmarks
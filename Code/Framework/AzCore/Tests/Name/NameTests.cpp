@@ -50,9 +50,20 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const auto& GetDictionary()
+        static bool ContainsName(AZStd::string_view nameString)
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                auto it = AZStd::find_if(shard.m_dictionary.begin(), shard.m_dictionary.end(), [nameString](const auto& entry)
+                {
+                    return entry.second.m_nameData->GetName() == nameString;
+                });
+                if (it != shard.m_dictionary.end())
+                {
+                    return true;
+                }
+            }
+            return false;
         }
         
         static size_t GetEntryCount()
@@ -76,7 +87,7 @@ namespace UnitTest
                     break;
                 }
             }
-            return GetDictionary().size() - staticNameCount;
+            return AZ::NameDictionary::Instance().GetEntryCount() - staticNameCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -297,13 +308,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            // Workaround VS2022 17.3 issue with incorrect detection of unused lambda captures assigning the nameString reference to a same type
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString = nameString](const AZStd::pair<AZ::Name::Hash, AZ::NameDictionary::ScopedNameDataWrapper>& entry)
-            {
-                return entry.second.m_nameData->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -996,5 +1001,32 @@ namespace UnitTest
         EXPECT_FALSE(m_nameDictionary1->FindName(literalRef.GetHash()).IsEmpty());
         EXPECT_FALSE(m_nameDictionary2->FindName(literalRefForDict1.GetHash()).IsEmpty());
     }
-}
 
+    TEST_F(NameTest, RecycledNameData_IsNotReturnedFromThreadCache)
+    {
+        // A single hash slot makes every name compete for the same entry, so releasing a name and making
+        // another one recycles the released NameData
+        AZ::NameDictionary nameDictionary(1);
+
+        const AZ::Internal::NameData* firstNameData = nullptr;
+        {
+            AZ::Name firstName = nameDictionary.MakeName("first");
+            firstNameData = GetNameData(firstName);
+        }
+
+        AZ::Name secondName = nameDictionary.MakeName("second");
+        EXPECT_EQ(firstNameData, GetNameData(secondName)) << "Released NameData should have been recycled";
+
+        // The thread cache still refers to the recycled NameData for "first", it must not be returned
+        AZ::Name firstName = nameDictionary.MakeName("first");
+        EXPECT_EQ("first", firstName.GetStringView());
+        EXPECT_EQ("second", secondName.GetStringView());
+        EXPECT_NE(firstName, secondName);
+
+        // Names made through the thread cache hold their own reference
+        AZ::Name secondNameAgain = nameDictionary.MakeName("second");
+        EXPECT_EQ(secondName, secondNameAgain);
+        secondName = AZ::Name{};
+        EXPECT_EQ("second", secondNameAgain.GetStringView());
+    }
+}
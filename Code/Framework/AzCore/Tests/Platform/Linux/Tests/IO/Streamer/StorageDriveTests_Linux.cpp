@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr AZ::u32 TestQueueDepth = 4;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr AZ::u32 TestFallbackThreadCount = 2;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+            return StorageDriveLinux(
+                TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth, TestOverCommit, TestFallbackThreadCount, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    //! The kernel can't be made to refuse io_uring submissions on demand, so this exposes the handling of a failed submission.
+    class StorageDriveLinuxWithSubmitFailure
+        : public StorageDriveLinux
+    {
+    public:
+        using StorageDriveLinux::StorageDriveLinux;
+
+        void SimulateIoUringSubmitFailure()
+        {
+            OnIoUringSubmitFailed(EBADF);
+        }
+    };
+
+    // The parameter determines if io_uring is requested. If io_uring is not supported by the kernel running the tests, both
+    // variations will run using the fallback thread pool.
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::LeakDetectionFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetUp() override
+        {
+            ASSERT_FALSE(m_dummyFilepath.empty());
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            m_context = new AZ::IO::StreamerContext();
+
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableIoUring = GetParam();
+            options.m_minimalReporting = true;
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(
+                TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth, TestOverCommit, TestFallbackThreadCount, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // The first and last byte of the file are marked with a begin and end character.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            buffer[0] = s_beginCharacter;
+            buffer[fileSize - 1] = s_endCharacter;
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()) && !AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+            {
+                return;
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_DataIsCorrect)
+    {
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllReadsCompleteWithCorrectData)
+    {
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t numChunks = TestQueueDepth * 3;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+        CreateDummyFile(fileSize, chunkSize);
+
+        size_t completedCount = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&completedCount](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    completedCount++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(numChunks, completedCount);
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][1], s_fileCharacter);
+        }
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ReportsFailure)
+    {
+        constexpr size_t fileSize = 4_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize * 2]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize * 2, m_dummyRequestPath, 0, fileSize * 2);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Failed);
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_ReportsFailure)
+    {
+        constexpr size_t fileSize = 4_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+
+        AZ::IO::RequestPath path{ AZ::IO::PathView{ "/invalid/path/to/nothing.bin" } };
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, path, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Failed);
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        constexpr size_t fileSize = 8_kib;
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([fileSize](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                auto& command = AZStd::get<AZ::IO::Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(command.m_found);
+                EXPECT_EQ(command.m_fileSize, fileSize);
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(1_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                EXPECT_TRUE(AZStd::get<AZ::IO::Requests::FileExistsCheckData>(request.GetCommand()).m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        EXPECT_TRUE(statistics.empty());
+
+        constexpr size_t fileSize = 4_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        m_storageDrive->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_AfterIoUringSubmitFails_ReadsCompleteOnFallbackThreads)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_hasSeekPenalty = false;
+        options.m_enableIoUring = GetParam();
+        options.m_minimalReporting = true;
+        auto storageDrive = AZStd::make_shared<StorageDriveLinuxWithSubmitFailure>(
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth, TestOverCommit, TestFallbackThreadCount, options);
+        storageDrive->SetContext(*m_context);
+        m_storageDrive = storageDrive;
+        if (!storageDrive->IsUsingIoUring())
+        {
+            // Only applies when io_uring is requested and supported by the kernel running the tests
+            return;
+        }
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        storageDrive->SimulateIoUringSubmitFailure();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(storageDrive->IsUsingIoUring());
+
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t numChunks = TestQueueDepth * 3;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+        CreateDummyFile(fileSize, chunkSize);
+
+        size_t completedCount = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&completedCount](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    completedCount++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(numChunks, completedCount);
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+    }
+
+    INSTANTIATE_TEST_CASE_P(Streamer_StorageDriveLinux, Streamer_StorageDriveLinuxTestFixture, ::testing::Bool());
+} // namespace AZ::IO
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/FileIOBaseTestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Stream stack entry that immediately completes all reads and meta data requests, so the benchmarks only measure
+    //! the cost of the BlockCache itself.
+    class InstantReadStackEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        explicit InstantReadStackEntry(AZ::u64 fileSize)
+            : AZ::IO::StreamStackEntry("Instant read")
+            , m_fileSize(fileSize)
+        {
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::FileMetaDataRetrievalData>(&request->GetCommand()); data != nullptr)
+            {
+                data->m_found = true;
+                data->m_fileSize = m_fileSize;
+            }
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+    private:
+        AZ::u64 m_fileSize;
+    };
+
+    class BlockCacheBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u64 CacheSize = 64 * 1024 * 1024;
+        static constexpr AZ::u32 BlockSize = 64 * 1024;
+        static constexpr AZ::u64 ReadSize = 4 * 1024;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Reads ReadSize bytes from random, unaligned offsets within the first fileRange bytes of the file. Reads that don't
+        //! start on a block boundary go through the cache, so the fileRange determines the ratio between hits and evictions.
+        void RunBenchmark(benchmark::State& state, AZ::u64 fileRange)
+        {
+            m_cache->SetNext(AZStd::make_shared<InstantReadStackEntry>(fileRange));
+            m_cache->SetContext(*m_context);
+
+            AZ::SimpleLcgRandom random(1234);
+            const AZ::u64 numBlocks = fileRange / BlockSize;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZ::u64 blockOffset = (random.GetRandom() % numBlocks) * BlockSize;
+                const AZ::u64 offset = blockOffset + 1 + (random.GetRandom() % (BlockSize - ReadSize - 1));
+
+                AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+                request->CreateRead(nullptr, m_buffer, ReadSize, m_path, offset, ReadSize);
+                m_cache->QueueRequest(request);
+                while (m_context->FinalizeCompletedRequests() || m_cache->ExecuteRequests())
+                {
+                }
+            }
+
+            AZStd::vector<AZ::IO::Statistic> statistics;
+            m_cache->CollectStatistics(statistics);
+            for (const AZ::IO::Statistic& statistic : statistics)
+            {
+                auto hitRate = AZStd::get_if<AZ::IO::Statistic::Percentage>(&statistic.GetValue());
+                if (hitRate && statistic.GetName() == "Cache hit rate")
+                {
+                    state.counters["HitRate"] = hitRate->m_value;
+                }
+            }
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ReadSize));
+        }
+
+    private:
+        void InternalSetUp()
+        {
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_path = "BlockCacheBenchmark";
+            m_context = new AZ::IO::StreamerContext();
+            m_cache = AZStd::make_shared<AZ::IO::BlockCache>(CacheSize, BlockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, false);
+        }
+
+        void InternalTearDown()
+        {
+            m_cache = nullptr;
+            delete m_context;
+            m_context = nullptr;
+            m_path = AZ::IO::RequestPath();
+
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        UnitTest::TestFileIOBase m_fileIO;
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+        AZ::IO::RequestPath m_path;
+        AZ::IO::StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<AZ::IO::BlockCache> m_cache;
+        AZ::u8 m_buffer[ReadSize];
+    };
+
+    // All reads fall within a quarter of the cache, so after warming up nearly every read is a hit.
+    BENCHMARK_F(BlockCacheBenchmark, HitHeavy)(benchmark::State& state)
+    {
+        RunBenchmark(state, CacheSize / 4);
+    }
+
+    // Reads are spread over four times the size of the cache, so most reads require a block to be evicted.
+    BENCHMARK_F(BlockCacheBenchmark, EvictionHeavy)(benchmark::State& state)
+    {
+        RunBenchmark(state, CacheSize * 4);
+    }
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Tests/FileIOBaseTestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Stream stack entry that immediately completes every request it receives, so the benchmarks only measure the cost
+    //! of creating, submitting, scheduling and completing requests.
+    class InstantCompletionStackEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        InstantCompletionStackEntry()
+            : AZ::IO::StreamStackEntry("Instant completion")
+        {
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+    };
+
+    //! Measures the throughput and latency of small reads going through Streamer's Scheduler. Every benchmark thread
+    //! queues a batch of reads and waits for all of them to complete, so with multiple threads the submission queue into the
+    //! scheduling thread sees contention from several producers. The argument is the number of reads per batch.
+    class SchedulerBenchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t ReadSize = 64;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+        void RunBenchmark(benchmark::State& state, bool useBatch)
+        {
+            const size_t batchSize = aznumeric_cast<size_t>(state.range(0));
+
+            struct Completions
+            {
+                AZStd::atomic<size_t> m_count{ 0 };
+                AZStd::atomic<AZ::s64> m_totalLatencyNs{ 0 };
+            };
+            Completions completions;
+            AZStd::vector<AZ::IO::FileRequestPtr> requests;
+            requests.reserve(batchSize);
+            AZ::u8 buffer[ReadSize];
+
+            size_t expectedCompletions = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                const AZStd::chrono::steady_clock::time_point queueTime = AZStd::chrono::steady_clock::now();
+                for (size_t i = 0; i < batchSize; ++i)
+                {
+                    AZ::IO::FileRequestPtr request = m_streamer->Read("SchedulerBenchmark", buffer, ReadSize, ReadSize);
+                    m_streamer->SetRequestCompleteCallback(request, [&completions, queueTime](AZ::IO::FileRequestHandle)
+                        {
+                            const auto latency = AZStd::chrono::steady_clock::now() - queueTime;
+                            completions.m_totalLatencyNs.fetch_add(
+                                AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(latency).count(), AZStd::memory_order_relaxed);
+                            completions.m_count.fetch_add(1, AZStd::memory_order_release);
+                        });
+                    if (useBatch)
+                    {
+                        requests.push_back(AZStd::move(request));
+                    }
+                    else
+                    {
+                        m_streamer->QueueRequest(request);
+                    }
+                }
+                if (useBatch)
+                {
+                    m_streamer->QueueRequestBatch(AZStd::move(requests));
+                    requests.clear();
+                }
+
+                expectedCompletions += batchSize;
+                while (completions.m_count.load(AZStd::memory_order_acquire) < expectedCompletions)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * batchSize);
+            if (expectedCompletions > 0)
+            {
+                state.counters["LatencyUs"] = benchmark::Counter(
+                    aznumeric_cast<double>(completions.m_totalLatencyNs.load()) / aznumeric_cast<double>(expectedCompletions) / 1000.0,
+                    benchmark::Counter::kAvgThreads);
+            }
+        }
+
+    private:
+        void InternalSetUp(const ::benchmark::State& state)
+        {
+            // Other threads only use the streamer after the benchmark start barrier, which follows SetUp on every thread.
+            if (state.thread_index() == 0)
+            {
+                m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+                AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+                m_streamer = aznew AZ::IO::Streamer(
+                    AZStd::thread_desc{}, AZStd::make_unique<AZ::IO::Scheduler>(AZStd::make_shared<InstantCompletionStackEntry>()));
+            }
+        }
+
+        void InternalTearDown(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                delete m_streamer;
+                m_streamer = nullptr;
+
+                AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+            }
+        }
+
+        UnitTest::TestFileIOBase m_fileIO;
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+        AZ::IO::Streamer* m_streamer{ nullptr };
+    };
+
+    static void SchedulerBatchSizes(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(1)->Arg(64)->Arg(1024);
+    }
+
+    // Every read is queued individually, which is the common pattern when many systems request small assets.
+    BENCHMARK_DEFINE_F(SchedulerBenchmark, QueueRequest)(benchmark::State& state)
+    {
+        RunBenchmark(state, false);
+    }
+    BENCHMARK_REGISTER_F(SchedulerBenchmark, QueueRequest)->Apply(SchedulerBatchSizes)->ThreadRange(1, 4)->UseRealTime();
+
+    // Reads are queued as a single batch.
+    BENCHMARK_DEFINE_F(SchedulerBenchmark, QueueRequestBatch)(benchmark::State& state)
+    {
+        RunBenchmark(state, true);
+    }
+    BENCHMARK_REGISTER_F(SchedulerBenchmark, QueueRequestBatch)->Apply(SchedulerBatchSizes)->ThreadRange(1, 4)->UseRealTime();
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
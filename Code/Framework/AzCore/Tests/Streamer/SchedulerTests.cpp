@@ -12,6 +12,7 @@
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -379,6 +380,115 @@ namespace AZ::IO
         EXPECT_EQ(Iterations + 1, counter);
     }
 
+    TEST_F(Streamer_SchedulerTest, QueueRequest_QueueIndividualAndBatchedRequests_RequestsArePreparedInQueueOrder)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+        using ::testing::Invoke;
+
+        constexpr size_t NumRequests = 16;
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AnyNumber());
+
+        AZStd::vector<u64> preparedOffsets;
+        EXPECT_CALL(*m_mock, PrepareRequest(_))
+            .Times(NumRequests)
+            .WillRepeatedly(Invoke([this, &preparedOffsets](FileRequest* request)
+            {
+                auto* read = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+                ASSERT_NE(nullptr, read);
+                preparedOffsets.push_back(read->m_offset);
+                m_mock->ForwardPrepareRequest(request);
+            }));
+
+        AZStd::atomic_int counter = NumRequests;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        // Half of the requests are queued individually and the other half as a batch.
+        char fakeBuffer[8];
+        AZStd::vector<FileRequestPtr> batch;
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            FileRequestPtr read = m_streamer->Read("TestPath", fakeBuffer, sizeof(fakeBuffer), 1,
+                IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i);
+            m_streamer->SetRequestCompleteCallback(read, wait);
+            if (i < NumRequests / 2)
+            {
+                m_streamer->QueueRequest(read);
+            }
+            else
+            {
+                batch.push_back(AZStd::move(read));
+            }
+        }
+        m_streamer->QueueRequestBatch(AZStd::move(batch));
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        ASSERT_EQ(NumRequests, preparedOffsets.size());
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            EXPECT_EQ(i, preparedOffsets[i]);
+        }
+    }
+
+    TEST_F(Streamer_SchedulerTest, QueueRequest_QueueFromMultipleThreads_AllRequestsComplete)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        constexpr size_t NumThreads = 4;
+        constexpr size_t NumRequestsPerThread = 256;
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, PrepareRequest(_)).Times(NumThreads * NumRequestsPerThread);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(NumThreads * NumRequestsPerThread);
+
+        AZStd::atomic_int counter = NumThreads * NumRequestsPerThread;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, &wait]()
+            {
+                char fakeBuffer[8];
+                for (size_t i = 0; i < NumRequestsPerThread; ++i)
+                {
+                    FileRequestPtr read = m_streamer->Read("TestPath", fakeBuffer, sizeof(fakeBuffer), 8);
+                    m_streamer->SetRequestCompleteCallback(read, wait);
+                    m_streamer->QueueRequest(read);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+    }
+
     TEST_F(Streamer_SchedulerTest, RequestSorting)
     {
         //////////////////////////////////////////////////////////////
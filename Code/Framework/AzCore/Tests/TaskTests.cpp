@@ -9,6 +9,8 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -465,6 +467,47 @@ namespace UnitTest
         EXPECT_EQ(3, x);
     }
 
+    TEST_F(TaskGraphTestFixture, StealFromBusyWorker)
+    {
+        // Successors are queued on the worker that completed their predecessor. Here task b blocks that worker until
+        // task c has run, which can only happen if an idle worker steals c from the busy worker's queue.
+        TaskExecutor executor{ 2 };
+        AZStd::atomic<bool> released = false;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "StealFromBusyWorker" };
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 1;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                while (!released)
+                {
+                    AZStd::this_thread::yield();
+                }
+                x += 2;
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                released = true;
+                x += 4;
+            });
+        a.Precedes(b, c);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(7, x);
+    }
+
     // Waiting inside a task is disallowed , test that it fails correctly
     TEST_F(TaskGraphTestFixture, SpawnSubgraph)
     {
@@ -710,6 +753,54 @@ namespace Benchmark
         }
     }
 
+    // A root task fans out to one long task and many short ones. All successors land on the queue of the worker that
+    // ran the root, so the short tasks complete quickly only if idle workers steal them.
+    BENCHMARK_F(TaskGraphBenchmarkFixture, UnbalancedFanOut)(benchmark::State& state)
+    {
+        auto spin = [](AZStd::chrono::microseconds duration)
+        {
+            const auto end = AZStd::chrono::steady_clock::now() + duration;
+            while (AZStd::chrono::steady_clock::now() < end)
+            {
+            }
+        };
+
+        auto root = graph->AddTask(
+            descriptors[2],
+            []
+            {
+            });
+        auto longTask = graph->AddTask(
+            descriptors[2],
+            [spin]
+            {
+                spin(AZStd::chrono::microseconds(500));
+            });
+        root.Precedes(longTask);
+
+        constexpr int ShortTaskCount = 64;
+        for (int i = 0; i != ShortTaskCount; ++i)
+        {
+            auto shortTask = graph->AddTask(
+                descriptors[2],
+                [spin]
+                {
+                    spin(AZStd::chrono::microseconds(10));
+                });
+            root.Precedes(shortTask);
+        }
+
+        const uint64_t stolenAtStart = executor->GetStolenTaskCount();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.counters["StolenTasks"] = benchmark::Counter(
+            aznumeric_cast<double>(executor->GetStolenTaskCount() - stolenAtStart), benchmark::Counter::kAvgIterations);
+    }
+
     BENCHMARK_F(TaskGraphBenchmarkFixture, FourToOneJoin)(benchmark::State& state)
     {
         auto [a, b, c, d, e] = graph->AddTasks(
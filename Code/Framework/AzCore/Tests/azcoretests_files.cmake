@@ -165,8 +165,10 @@ set(FILES
     Math/VectorNPerformanceTests.cpp
     Math/PackedVectorTest.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
+    Memory/HugePages.cpp
     Memory/LeakDetection.cpp
     Memory.cpp
     Metrics/EventLoggerFactoryTests.cpp
@@ -248,12 +250,14 @@ set(FILES
     StatisticalProfilerBenchmarks.cpp
     StatisticalProfilerHelpers.h
     StatisticalProfilerTests.cpp
+    Streamer/BlockCacheBenchmarks.cpp
     Streamer/BlockCacheTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
     Streamer/ReadSplitterTests.cpp
+    Streamer/SchedulerBenchmarks.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -39,10 +40,13 @@ namespace AzFramework
             TYPE_RPI_VisibleObjectList = 1 << 3 // Culled by the render system, then output to a a list of visible objects
         };
 
+        static constexpr uint32_t InvalidPendingUpdateIndex = 0xFFFFFFFF;
+
         AZ::Aabb m_boundingVolume = AZ::Aabb::CreateNull();
         VisibilityNode* m_internalNode = nullptr;
         void* m_userData = nullptr;
         uint32_t m_internalNodeIndex = 0;
+        uint32_t m_internalPendingUpdateIndex = InvalidPendingUpdateIndex; //< Index into the scene's deferred update list, if the entry has a deferred update queued.
         TypeFlags m_typeFlags = TYPE_None;
     };
 
@@ -63,6 +67,18 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! The maximum number of volumes that can be intersected by a single batched enumeration.
+        static constexpr uint32_t MaxBatchVolumes = 32;
+
+        //! A node returned by a batched enumeration.
+        struct BatchNodeData
+        {
+            AZ::Aabb m_bounds;
+            const AZStd::vector<VisibilityEntry*>* m_entries = nullptr; //< Valid until the visibility scene is next modified.
+            uint32_t m_volumeMask = 0; //< Bit N is set if the node overlaps the Nth volume of the batch.
+        };
+        using BatchResults = AZStd::vector<BatchNodeData>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -115,6 +131,22 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a batch of axis aligned bounding boxes against the visibility system in a single traversal.
+        //! Rather than invoking a callback, every node with entries that overlaps at least one of the volumes is written to results.
+        //! @param aabbs the axis aligned bounding boxes to test against, at most MaxBatchVolumes
+        //! @param results cleared, then filled with the visible nodes and the volumes each of them overlaps
+        virtual void EnumerateBatch(AZStd::span<const AZ::Aabb> aabbs, BatchResults& results) const = 0;
+
+        //! Intersects a batch of spheres against the visibility system in a single traversal.
+        //! @param spheres the spheres to test against, at most MaxBatchVolumes
+        //! @param results cleared, then filled with the visible nodes and the volumes each of them overlaps
+        virtual void EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, BatchResults& results) const = 0;
+
+        //! Intersects a batch of frusta against the visibility system in a single traversal.
+        //! @param frusta the frusta to test against, at most MaxBatchVolumes
+        //! @param results cleared, then filled with the visible nodes and the volumes each of them overlaps
+        virtual void EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, BatchResults& results) const = 0;
+
         //! Return the number of VisibilityEntries that have been added to the system
         virtual uint32_t GetEntryCount() const = 0;
     };
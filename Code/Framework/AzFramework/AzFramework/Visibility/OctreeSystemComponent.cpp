@@ -7,8 +7,15 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/sort.h>
 
 namespace AzFramework
 {
@@ -16,6 +23,8 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(bool,     bg_octreeDeferredUpdates,    false, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, newly created visibility octrees queue entry updates and apply them in a single batched pass once per tick");
+    AZ_CVAR(uint32_t, bg_octreeDeferredTaskEntries, 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of queued entries processed by each task of a deferred update pass, a pass with fewer entries runs serially");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,6 +33,198 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    namespace
+    {
+        using FloatType = AZ::Simd::Vec4::FloatType;
+        using Int32Type = AZ::Simd::Vec4::Int32Type;
+
+        //! The bounds of the children of a node in structure of arrays form, four children per lane batch.
+        //! These are derived from the parent bounds using the same arithmetic as OctreeNode::Split, so they are bit-exact with the child node bounds.
+        struct ChildBoundsSoa
+        {
+            static constexpr uint32_t LaneCount = 4;
+            static constexpr uint32_t MaxBatches = 2;
+
+            explicit ChildBoundsSoa(const AZ::Aabb& parentBounds)
+            {
+                const AZ::Vector3 childExtent = (parentBounds.GetMax() - parentBounds.GetMin()) * 0.5f;
+                const AZ::Vector3 min0 = parentBounds.GetMin();
+                const AZ::Vector3 max0 = parentBounds.GetMin() + childExtent;
+                const AZ::Vector3 min1 = min0 + childExtent;
+                const AZ::Vector3 max1 = max0 + childExtent;
+
+                // Child bit 0 offsets along X, bit 1 along Y and bit 2 along Z, so lanes alternate X, pairs of lanes share Y and batches share Z
+                for (uint32_t batch = 0; batch < MaxBatches; ++batch)
+                {
+                    m_minX[batch] = AZ::Simd::Vec4::LoadImmediate(min0.GetX(), min1.GetX(), min0.GetX(), min1.GetX());
+                    m_maxX[batch] = AZ::Simd::Vec4::LoadImmediate(max0.GetX(), max1.GetX(), max0.GetX(), max1.GetX());
+                    m_minY[batch] = AZ::Simd::Vec4::LoadImmediate(min0.GetY(), min0.GetY(), min1.GetY(), min1.GetY());
+                    m_maxY[batch] = AZ::Simd::Vec4::LoadImmediate(max0.GetY(), max0.GetY(), max1.GetY(), max1.GetY());
+                }
+                m_minZ[0] = AZ::Simd::Vec4::Splat(min0.GetZ());
+                m_maxZ[0] = AZ::Simd::Vec4::Splat(max0.GetZ());
+                m_minZ[1] = AZ::Simd::Vec4::Splat(min1.GetZ());
+                m_maxZ[1] = AZ::Simd::Vec4::Splat(max1.GetZ());
+            }
+
+            FloatType m_minX[MaxBatches];
+            FloatType m_minY[MaxBatches];
+            FloatType m_minZ[MaxBatches];
+            FloatType m_maxX[MaxBatches];
+            FloatType m_maxY[MaxBatches];
+            FloatType m_maxZ[MaxBatches];
+        };
+
+        //! A batch of axis aligned bounding boxes, mirrors AZ::ShapeIntersection::Overlaps(const Aabb&, const Aabb&).
+        class AabbBatch
+        {
+        public:
+            explicit AabbBatch(AZStd::span<const AZ::Aabb> aabbs)
+                : m_aabbs(aabbs)
+            {
+            }
+
+            uint32_t GetVolumeCount() const
+            {
+                return aznumeric_cast<uint32_t>(m_aabbs.size());
+            }
+
+            bool Overlaps(uint32_t volumeIndex, const AZ::Aabb& bounds) const
+            {
+                return AZ::ShapeIntersection::Overlaps(m_aabbs[volumeIndex], bounds);
+            }
+
+            FloatType OverlapsChildren(uint32_t volumeIndex, const ChildBoundsSoa& children, uint32_t batch) const
+            {
+                using AZ::Simd::Vec4;
+                const AZ::Vector3& min = m_aabbs[volumeIndex].GetMin();
+                const AZ::Vector3& max = m_aabbs[volumeIndex].GetMax();
+                const FloatType overlapX = Vec4::And(
+                    Vec4::CmpLtEq(Vec4::Splat(min.GetX()), children.m_maxX[batch]), Vec4::CmpGtEq(Vec4::Splat(max.GetX()), children.m_minX[batch]));
+                const FloatType overlapY = Vec4::And(
+                    Vec4::CmpLtEq(Vec4::Splat(min.GetY()), children.m_maxY[batch]), Vec4::CmpGtEq(Vec4::Splat(max.GetY()), children.m_minY[batch]));
+                const FloatType overlapZ = Vec4::And(
+                    Vec4::CmpLtEq(Vec4::Splat(min.GetZ()), children.m_maxZ[batch]), Vec4::CmpGtEq(Vec4::Splat(max.GetZ()), children.m_minZ[batch]));
+                return Vec4::And(overlapX, Vec4::And(overlapY, overlapZ));
+            }
+
+        private:
+            AZStd::span<const AZ::Aabb> m_aabbs;
+        };
+
+        //! A batch of spheres, mirrors AZ::ShapeIntersection::Overlaps(const Sphere&, const Aabb&).
+        class SphereBatch
+        {
+        public:
+            explicit SphereBatch(AZStd::span<const AZ::Sphere> spheres)
+                : m_spheres(spheres)
+            {
+            }
+
+            uint32_t GetVolumeCount() const
+            {
+                return aznumeric_cast<uint32_t>(m_spheres.size());
+            }
+
+            bool Overlaps(uint32_t volumeIndex, const AZ::Aabb& bounds) const
+            {
+                return AZ::ShapeIntersection::Overlaps(m_spheres[volumeIndex], bounds);
+            }
+
+            FloatType OverlapsChildren(uint32_t volumeIndex, const ChildBoundsSoa& children, uint32_t batch) const
+            {
+                using AZ::Simd::Vec4;
+                const AZ::Sphere& sphere = m_spheres[volumeIndex];
+                const FloatType centerX = Vec4::Splat(sphere.GetCenter().GetX());
+                const FloatType centerY = Vec4::Splat(sphere.GetCenter().GetY());
+                const FloatType centerZ = Vec4::Splat(sphere.GetCenter().GetZ());
+
+                // Distance from the sphere center to the closest point on each child
+                const FloatType deltaX = Vec4::Sub(centerX, Vec4::Clamp(centerX, children.m_minX[batch], children.m_maxX[batch]));
+                const FloatType deltaY = Vec4::Sub(centerY, Vec4::Clamp(centerY, children.m_minY[batch], children.m_maxY[batch]));
+                const FloatType deltaZ = Vec4::Sub(centerZ, Vec4::Clamp(centerZ, children.m_minZ[batch], children.m_maxZ[batch]));
+                const FloatType distSq = Vec4::Madd(deltaZ, deltaZ, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaX, deltaX)));
+                return Vec4::CmpLtEq(distSq, Vec4::Splat(sphere.GetRadius() * sphere.GetRadius()));
+            }
+
+        private:
+            AZStd::span<const AZ::Sphere> m_spheres;
+        };
+
+        //! A batch of frusta, mirrors AZ::ShapeIntersection::Overlaps(const Frustum&, const Aabb&).
+        class FrustumBatch
+        {
+        public:
+            explicit FrustumBatch(AZStd::span<const AZ::Frustum> frusta)
+                : m_frusta(frusta)
+            {
+                // Unpack the planes once up front, so each child batch test only has to splat them
+                for (uint32_t volumeIndex = 0; volumeIndex < m_frusta.size(); ++volumeIndex)
+                {
+                    for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const AZ::Plane plane = m_frusta[volumeIndex].GetPlane(planeId);
+                        const AZ::Vector3 normal = plane.GetNormal();
+                        const AZ::Vector3 normalAbs = normal.GetAbs();
+                        PlaneData& planeData = m_planes[volumeIndex][planeId];
+                        planeData = { normal.GetX(), normal.GetY(), normal.GetZ(), normalAbs.GetX(), normalAbs.GetY(), normalAbs.GetZ(), plane.GetDistance() };
+                    }
+                }
+            }
+
+            uint32_t GetVolumeCount() const
+            {
+                return aznumeric_cast<uint32_t>(m_frusta.size());
+            }
+
+            bool Overlaps(uint32_t volumeIndex, const AZ::Aabb& bounds) const
+            {
+                return AZ::ShapeIntersection::Overlaps(m_frusta[volumeIndex], bounds);
+            }
+
+            FloatType OverlapsChildren(uint32_t volumeIndex, const ChildBoundsSoa& children, uint32_t batch) const
+            {
+                using AZ::Simd::Vec4;
+                const FloatType half = Vec4::Splat(0.5f);
+                const FloatType centerX = Vec4::Mul(half, Vec4::Add(children.m_minX[batch], children.m_maxX[batch]));
+                const FloatType centerY = Vec4::Mul(half, Vec4::Add(children.m_minY[batch], children.m_maxY[batch]));
+                const FloatType centerZ = Vec4::Mul(half, Vec4::Add(children.m_minZ[batch], children.m_maxZ[batch]));
+                const FloatType extentsX = Vec4::Sub(Vec4::Mul(half, children.m_maxX[batch]), Vec4::Mul(half, children.m_minX[batch]));
+                const FloatType extentsY = Vec4::Sub(Vec4::Mul(half, children.m_maxY[batch]), Vec4::Mul(half, children.m_minY[batch]));
+                const FloatType extentsZ = Vec4::Sub(Vec4::Mul(half, children.m_maxZ[batch]), Vec4::Mul(half, children.m_minZ[batch]));
+
+                // A child is outside if it lies entirely behind any of the planes
+                FloatType overlaps = Vec4::CmpEq(half, half);
+                for (const PlaneData& plane : m_planes[volumeIndex])
+                {
+                    FloatType dist = Vec4::Madd(Vec4::Splat(plane.m_normalX), centerX, Vec4::Splat(plane.m_distance));
+                    dist = Vec4::Madd(Vec4::Splat(plane.m_normalY), centerY, dist);
+                    dist = Vec4::Madd(Vec4::Splat(plane.m_normalZ), centerZ, dist);
+                    dist = Vec4::Madd(Vec4::Splat(plane.m_normalAbsX), extentsX, dist);
+                    dist = Vec4::Madd(Vec4::Splat(plane.m_normalAbsY), extentsY, dist);
+                    dist = Vec4::Madd(Vec4::Splat(plane.m_normalAbsZ), extentsZ, dist);
+                    overlaps = Vec4::And(overlaps, Vec4::CmpGt(dist, Vec4::ZeroFloat()));
+                }
+                return overlaps;
+            }
+
+        private:
+            struct PlaneData
+            {
+                float m_normalX;
+                float m_normalY;
+                float m_normalZ;
+                float m_normalAbsX;
+                float m_normalAbsY;
+                float m_normalAbsZ;
+                float m_distance;
+            };
+
+            AZStd::span<const AZ::Frustum> m_frusta;
+            PlaneData m_planes[IVisibilityScene::MaxBatchVolumes][AZ::Frustum::PlaneId::MAX];
+        };
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -87,9 +288,7 @@ namespace AzFramework
         }
         else
         {
-            m_entries.push_back(entry);
-            entry->m_internalNode = this;
-            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+            AttachEntry(entry);
         }
     }
 
@@ -126,18 +325,8 @@ namespace AzFramework
     void OctreeNode::Remove(OctreeScene& octreeScene, VisibilityEntry* entry)
     {
         AZ_Assert(entry->m_internalNode == this, "Remove invoked for an entry bound to a different OctreeNode");
-        AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
 
-        // Swap and pop the removed entry
-        const uint32_t removeIndex = entry->m_internalNodeIndex;
-        m_entries[removeIndex]->m_internalNode = nullptr;
-        m_entries[removeIndex]->m_internalNodeIndex = 0;
-        if (removeIndex < (m_entries.size() - 1))
-        {
-            AZStd::swap(m_entries[removeIndex], m_entries.back());
-            m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
-        }
-        m_entries.pop_back();
+        DetachEntry(entry);
 
         if (m_parent != nullptr)
         {
@@ -226,6 +415,21 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateBatch(AZStd::span<const AZ::Aabb> aabbs, IVisibilityScene::BatchResults& results) const
+    {
+        EnumerateBatchRoot(AabbBatch(aabbs), results);
+    }
+
+    void OctreeNode::EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, IVisibilityScene::BatchResults& results) const
+    {
+        EnumerateBatchRoot(SphereBatch(spheres), results);
+    }
+
+    void OctreeNode::EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, IVisibilityScene::BatchResults& results) const
+    {
+        EnumerateBatchRoot(FrustumBatch(frusta), results);
+    }
+
     const AZStd::vector<VisibilityEntry*>& OctreeNode::GetEntries() const
     {
         return m_entries;
@@ -268,6 +472,55 @@ namespace AzFramework
         }
     }
 
+    OctreeNode* OctreeNode::FindContainingNode(const AZ::Aabb& bounds)
+    {
+        OctreeNode* node = this;
+        while (node->m_children != nullptr)
+        {
+            OctreeNode* containingChild = nullptr;
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (AZ::ShapeIntersection::Contains(node->m_children[child].m_bounds, bounds))
+                {
+                    containingChild = &node->m_children[child];
+                    break;
+                }
+            }
+
+            if (containingChild == nullptr)
+            {
+                // The bounds span multiple child nodes
+                break;
+            }
+            node = containingChild;
+        }
+        return node;
+    }
+
+    void OctreeNode::AttachEntry(VisibilityEntry* entry)
+    {
+        m_entries.push_back(entry);
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+    }
+
+    void OctreeNode::DetachEntry(VisibilityEntry* entry)
+    {
+        AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        const uint32_t removeIndex = entry->m_internalNodeIndex;
+        m_entries[removeIndex]->m_internalNode = nullptr;
+        m_entries[removeIndex]->m_internalNodeIndex = 0;
+        if (removeIndex < (m_entries.size() - 1))
+        {
+            AZStd::swap(m_entries[removeIndex], m_entries.back());
+            m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+        }
+        m_entries.pop_back();
+    }
+
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
@@ -293,6 +546,66 @@ namespace AzFramework
         }
     }
 
+    template <typename T>
+    void OctreeNode::EnumerateBatchRoot(const T& batchVolumes, IVisibilityScene::BatchResults& results) const
+    {
+        // Only the node the batch starts from is tested one volume at a time, its descendants are tested a batch of children at a time
+        uint32_t volumeMask = 0;
+        const uint32_t volumeCount = batchVolumes.GetVolumeCount();
+        for (uint32_t volumeIndex = 0; volumeIndex < volumeCount; ++volumeIndex)
+        {
+            if (batchVolumes.Overlaps(volumeIndex, m_bounds))
+            {
+                volumeMask |= 1u << volumeIndex;
+            }
+        }
+
+        if (volumeMask != 0)
+        {
+            EnumerateBatchHelper(batchVolumes, volumeMask, results);
+        }
+    }
+
+    template <typename T>
+    void OctreeNode::EnumerateBatchHelper(const T& batchVolumes, uint32_t volumeMask, IVisibilityScene::BatchResults& results) const
+    {
+        // Record the current node
+        if (!m_entries.empty())
+        {
+            results.push_back({ m_bounds, &m_entries, volumeMask });
+        }
+
+        if (m_children == nullptr)
+        {
+            return;
+        }
+
+        // Test every child against every volume still overlapping this node, gathering the mask of overlapped volumes per child
+        const ChildBoundsSoa childBounds(m_bounds);
+        const uint32_t childCount = GetChildNodeCount();
+        int32_t childVolumeMasks[ChildBoundsSoa::LaneCount * ChildBoundsSoa::MaxBatches];
+        for (uint32_t batch = 0; batch < childCount / ChildBoundsSoa::LaneCount; ++batch)
+        {
+            Int32Type batchVolumeMasks = AZ::Simd::Vec4::ZeroInt();
+            for (uint32_t remainingMask = volumeMask; remainingMask != 0; remainingMask &= remainingMask - 1)
+            {
+                const uint32_t volumeIndex = az_ctz_u32(remainingMask);
+                const Int32Type overlaps = AZ::Simd::Vec4::CastToInt(batchVolumes.OverlapsChildren(volumeIndex, childBounds, batch));
+                const Int32Type volumeBit = AZ::Simd::Vec4::Splat(static_cast<int32_t>(1u << volumeIndex));
+                batchVolumeMasks = AZ::Simd::Vec4::Or(batchVolumeMasks, AZ::Simd::Vec4::And(overlaps, volumeBit));
+            }
+            AZ::Simd::Vec4::StoreUnaligned(&childVolumeMasks[batch * ChildBoundsSoa::LaneCount], batchVolumeMasks);
+        }
+
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (childVolumeMasks[child] != 0)
+            {
+                m_children[child].EnumerateBatchHelper(batchVolumes, static_cast<uint32_t>(childVolumeMasks[child]), results);
+            }
+        }
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -369,6 +682,7 @@ namespace AzFramework
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        m_deferredUpdatesEnabled = bg_octreeDeferredUpdates;
     }
 
     OctreeScene::~OctreeScene()
@@ -388,7 +702,19 @@ namespace AzFramework
 
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
+        if (m_deferredUpdatesEnabled)
+        {
+            QueueDeferredUpdate(entry);
+            return;
+        }
+
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalPendingUpdateIndex != VisibilityEntry::InvalidPendingUpdateIndex)
+        {
+            // Deferred updates were disabled while this entry was queued
+            CancelDeferredUpdate(entry);
+        }
+
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -403,6 +729,12 @@ namespace AzFramework
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalPendingUpdateIndex != VisibilityEntry::InvalidPendingUpdateIndex)
+        {
+            // The entry is likely about to be destroyed, so it can't stay in the deferred update queue
+            CancelDeferredUpdate(entry);
+        }
+
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -452,11 +784,248 @@ namespace AzFramework
         m_root.EnumerateNoCull(callback);
     }
 
+    void OctreeScene::EnumerateBatch(AZStd::span<const AZ::Aabb> aabbs, IVisibilityScene::BatchResults& results) const
+    {
+        AZ_Assert(aabbs.size() <= MaxBatchVolumes, "EnumerateBatch supports at most %u volumes, the remaining volumes are ignored", MaxBatchVolumes);
+        results.clear();
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateBatch(aabbs.first(AZStd::min<size_t>(aabbs.size(), MaxBatchVolumes)), results);
+    }
+
+    void OctreeScene::EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, IVisibilityScene::BatchResults& results) const
+    {
+        AZ_Assert(spheres.size() <= MaxBatchVolumes, "EnumerateBatch supports at most %u volumes, the remaining volumes are ignored", MaxBatchVolumes);
+        results.clear();
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateBatch(spheres.first(AZStd::min<size_t>(spheres.size(), MaxBatchVolumes)), results);
+    }
+
+    void OctreeScene::EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, IVisibilityScene::BatchResults& results) const
+    {
+        AZ_Assert(frusta.size() <= MaxBatchVolumes, "EnumerateBatch supports at most %u volumes, the remaining volumes are ignored", MaxBatchVolumes);
+        results.clear();
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateBatch(frusta.first(AZStd::min<size_t>(frusta.size(), MaxBatchVolumes)), results);
+    }
+
     uint32_t OctreeScene::GetEntryCount() const
     {
         return m_entryCount;
     }
 
+    void OctreeScene::SetDeferredUpdatesEnabled(bool enabled)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_deferredUpdatesEnabled = enabled;
+        if (!enabled)
+        {
+            // An update racing with this call may still be queued afterwards, it is applied by the next ProcessDeferredUpdates
+            ApplyDeferredUpdates();
+        }
+    }
+
+    bool OctreeScene::IsDeferredUpdatesEnabled() const
+    {
+        return m_deferredUpdatesEnabled;
+    }
+
+    void OctreeScene::ProcessDeferredUpdates()
+    {
+        if (!m_hasDeferredUpdates)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        ApplyDeferredUpdates();
+    }
+
+    void OctreeScene::SetTaskExecutor(AZ::TaskExecutor* executor)
+    {
+        m_taskExecutor = executor;
+    }
+
+    void OctreeScene::QueueDeferredUpdate(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+        if (entry.m_internalPendingUpdateIndex == VisibilityEntry::InvalidPendingUpdateIndex)
+        {
+            entry.m_internalPendingUpdateIndex = aznumeric_cast<uint32_t>(m_deferredEntries.size());
+            m_deferredEntries.push_back(&entry);
+            m_hasDeferredUpdates = true;
+        }
+    }
+
+    void OctreeScene::CancelDeferredUpdate(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+        AZ_Assert(m_deferredEntries[entry.m_internalPendingUpdateIndex] == &entry, "Deferred update queue is corrupt");
+
+        // Swap and pop the cancelled entry
+        const uint32_t removeIndex = entry.m_internalPendingUpdateIndex;
+        entry.m_internalPendingUpdateIndex = VisibilityEntry::InvalidPendingUpdateIndex;
+        if (removeIndex < (m_deferredEntries.size() - 1))
+        {
+            m_deferredEntries[removeIndex] = m_deferredEntries.back();
+            m_deferredEntries[removeIndex]->m_internalPendingUpdateIndex = removeIndex;
+        }
+        m_deferredEntries.pop_back();
+        m_hasDeferredUpdates = !m_deferredEntries.empty();
+    }
+
+    void OctreeScene::ApplyDeferredUpdates()
+    {
+        // Must be invoked with m_sharedMutex exclusively locked
+        AZStd::vector<VisibilityEntry*> entries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+            entries.swap(m_deferredEntries);
+            m_hasDeferredUpdates = false;
+
+            // Entries updated again while this pass runs are queued for the next one
+            for (VisibilityEntry* entry : entries)
+            {
+                entry->m_internalPendingUpdateIndex = VisibilityEntry::InvalidPendingUpdateIndex;
+            }
+        }
+
+        if (entries.empty())
+        {
+            return;
+        }
+
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        const uint32_t startSplitCount = m_splitCount;
+        const uint32_t startMergeCount = m_mergeCount;
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(entries.size());
+
+        // Find the node each entry belongs to, the tree is not modified so this can be spread across the task graph
+        m_deferredTargets.resize_no_construct(entryCount);
+        auto findContainingNodes = [this, &entries](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t index = begin; index < end; ++index)
+            {
+                m_deferredTargets[index] = m_root.FindContainingNode(entries[index]->m_boundingVolume);
+            }
+        };
+
+        AZ::TaskExecutor* taskExecutor = m_taskExecutor;
+        if (taskExecutor == nullptr)
+        {
+            auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+            {
+                taskExecutor = &AZ::TaskExecutor::Instance();
+            }
+        }
+
+        // A task graph event can't be waited on from one of the executor's own workers
+        if (taskExecutor != nullptr && taskExecutor->IsTaskWorkerThread())
+        {
+            taskExecutor = nullptr;
+        }
+
+        const uint32_t entriesPerTask = AZStd::max<uint32_t>(bg_octreeDeferredTaskEntries, 1);
+        const uint32_t taskCount = (entryCount + entriesPerTask - 1) / entriesPerTask;
+        if (taskExecutor != nullptr && taskCount > 1)
+        {
+            static const AZ::TaskDescriptor findNodesDescriptor{ "OctreeScene: FindContainingNodes", "Visibility" };
+            AZ::TaskGraph findNodesGraph{ "OctreeScene Deferred Update" };
+            for (uint32_t begin = 0; begin < entryCount; begin += entriesPerTask)
+            {
+                const uint32_t end = AZStd::min(begin + entriesPerTask, entryCount);
+                findNodesGraph.AddTask(findNodesDescriptor, [&findContainingNodes, begin, end]()
+                {
+                    findContainingNodes(begin, end);
+                });
+            }
+
+            AZ::TaskGraphEvent findNodesFinished{ "OctreeScene Deferred Update Wait" };
+            findNodesGraph.SubmitOnExecutor(*taskExecutor, &findNodesFinished);
+            findNodesFinished.Wait();
+            m_deferredStats.m_taskCount = taskCount;
+        }
+        else
+        {
+            findContainingNodes(0, entryCount);
+            m_deferredStats.m_taskCount = 0;
+        }
+
+        // Move the entries without splitting or merging, remembering which nodes will need to be revisited
+        AZStd::vector<OctreeNode*> splitCandidates;
+        AZStd::vector<OctreeNode*> mergeCandidates;
+        uint32_t movedCount = 0;
+        for (uint32_t index = 0; index < entryCount; ++index)
+        {
+            VisibilityEntry* entry = entries[index];
+            OctreeNode* targetNode = m_deferredTargets[index];
+            OctreeNode* currentNode = static_cast<OctreeNode*>(entry->m_internalNode);
+            if (currentNode == targetNode)
+            {
+                continue;
+            }
+
+            if (currentNode != nullptr)
+            {
+                currentNode->DetachEntry(entry);
+                if (currentNode->m_parent != nullptr)
+                {
+                    mergeCandidates.push_back(currentNode->m_parent);
+                }
+            }
+            else
+            {
+                ++m_entryCount;
+            }
+
+            targetNode->AttachEntry(entry);
+            if (targetNode->IsLeaf() && (targetNode->m_entries.size() > bg_octreeNodeMaxEntries))
+            {
+                splitCandidates.push_back(targetNode);
+            }
+            ++movedCount;
+        }
+
+        // Split every overfilled leaf once, Split redistributes the entries and splits further as needed
+        AZStd::sort(splitCandidates.begin(), splitCandidates.end());
+        splitCandidates.erase(AZStd::unique(splitCandidates.begin(), splitCandidates.end()), splitCandidates.end());
+        for (OctreeNode* node : splitCandidates)
+        {
+            if (node->IsLeaf() && (node->m_entries.size() > bg_octreeNodeMaxEntries))
+            {
+                node->Split(*this);
+            }
+        }
+
+        // Then merge any subtrees that were left underfilled
+        AZStd::sort(mergeCandidates.begin(), mergeCandidates.end());
+        mergeCandidates.erase(AZStd::unique(mergeCandidates.begin(), mergeCandidates.end()), mergeCandidates.end());
+        for (OctreeNode* node : mergeCandidates)
+        {
+            node->TryMerge(*this);
+        }
+
+        // Hand the queue's allocation back for the next tick
+        entries.clear();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+            if (m_deferredEntries.empty())
+            {
+                m_deferredEntries.swap(entries);
+            }
+        }
+
+        ++m_deferredStats.m_passCount;
+        m_deferredStats.m_entryCount = entryCount;
+        m_deferredStats.m_movedCount = movedCount;
+        m_deferredStats.m_splitCount = m_splitCount - startSplitCount;
+        m_deferredStats.m_mergeCount = m_mergeCount - startMergeCount;
+        m_deferredStats.m_durationUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime).count();
+    }
+
     uint32_t OctreeScene::GetNodeCount() const
     {
         return m_nodeCount;
@@ -478,6 +1047,12 @@ namespace AzFramework
         return AzFramework::GetChildNodeCount();
     }
 
+    uint32_t OctreeScene::GetDeferredUpdateCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+        return aznumeric_cast<uint32_t>(m_deferredEntries.size());
+    }
+
     void OctreeScene::DumpStats()
     {
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
@@ -485,6 +1060,12 @@ namespace AzFramework
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::DeferredUpdates = %s", GetName().GetCStr(), m_deferredUpdatesEnabled ? "true" : "false");
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::DeferredUpdateCount = %u", GetName().GetCStr(), GetDeferredUpdateCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::DeferredPassCount = %u", GetName().GetCStr(), m_deferredStats.m_passCount);
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::LastDeferredPass = %u entries, %u moved, %u splits, %u merges, %u tasks, %lld us", GetName().GetCStr(),
+            m_deferredStats.m_entryCount, m_deferredStats.m_movedCount, m_deferredStats.m_splitCount, m_deferredStats.m_mergeCount,
+            m_deferredStats.m_taskCount, static_cast<long long>(m_deferredStats.m_durationUs));
     }
 
     static inline uint32_t CreateNodeIndex(uint32_t page, uint32_t offset)
@@ -503,6 +1084,7 @@ namespace AzFramework
     {
         const uint32_t childCount = GetChildNodeCount();
         m_nodeCount += childCount;
+        ++m_splitCount;
 
         if (m_nodeCache.empty())
         {
@@ -545,6 +1127,7 @@ namespace AzFramework
     void OctreeScene::ReleaseChildNodes(uint32_t nodeIndex)
     {
         m_nodeCount -= GetChildNodeCount();
+        ++m_mergeCount;
         m_freeOctreeNodes.push(nodeIndex);
     }
 
@@ -595,12 +1178,12 @@ namespace AzFramework
 
     void OctreeSystemComponent::Activate()
     {
-        ;
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void OctreeSystemComponent::Deactivate()
     {
-        ;
+        AZ::TickBus::Handler::BusDisconnect();
     }
 
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
@@ -642,6 +1225,20 @@ namespace AzFramework
         return nullptr;
     }
 
+    void OctreeSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_defaultScene->ProcessDeferredUpdates();
+        for (OctreeScene* scene : m_scenes)
+        {
+            scene->ProcessDeferredUpdates();
+        }
+    }
+
+    int OctreeSystemComponent::GetTickOrder()
+    {
+        return AZ::TICK_PRE_RENDER;
+    }
+
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
         for (OctreeScene* scene : m_scenes)
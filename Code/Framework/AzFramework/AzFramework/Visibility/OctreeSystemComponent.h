@@ -11,11 +11,19 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
+namespace AZ
+{
+    class TaskExecutor;
+}
+
 namespace AzFramework
 {
     class OctreeSystemComponent;
@@ -60,6 +68,14 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Enumerates any OctreeNodes and their children that intersect at least one of the provided bounding volumes.
+        //! The children of each node are tested against the volumes together, four at a time, using the SIMD math layer.
+        //! @{
+        void EnumerateBatch(AZStd::span<const AZ::Aabb> aabbs, IVisibilityScene::BatchResults& results) const;
+        void EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, IVisibilityScene::BatchResults& results) const;
+        void EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, IVisibilityScene::BatchResults& results) const;
+        //! @}
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -73,9 +89,24 @@ namespace AzFramework
 
         void TryMerge(OctreeScene& octreeScene);
 
+        //! Returns the deepest node in this subtree that fully contains the provided bounds, or this node if no child does.
+        OctreeNode* FindContainingNode(const AZ::Aabb& bounds);
+
+        //! Binds and unbinds entries without triggering a split or merge.
+        //! @{
+        void AttachEntry(VisibilityEntry* entry);
+        void DetachEntry(VisibilityEntry* entry);
+        //! @}
+
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        template <typename T>
+        void EnumerateBatchRoot(const T& batchVolumes, IVisibilityScene::BatchResults& results) const;
+
+        template <typename T>
+        void EnumerateBatchHelper(const T& batchVolumes, uint32_t volumeMask, IVisibilityScene::BatchResults& results) const;
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
@@ -87,6 +118,8 @@ namespace AzFramework
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+
+        friend class OctreeScene; // For applying deferred updates
     };
 
     //! Implementation of the visibility system interface.
@@ -114,15 +147,38 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateBatch(AZStd::span<const AZ::Aabb> aabbs, IVisibilityScene::BatchResults& results) const override;
+        void EnumerateBatch(AZStd::span<const AZ::Sphere> spheres, IVisibilityScene::BatchResults& results) const override;
+        void EnumerateBatch(AZStd::span<const AZ::Frustum> frusta, IVisibilityScene::BatchResults& results) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
+        //! Enables or disables deferred updates.
+        //! While enabled, InsertOrUpdateEntry only queues the entry. Queued entries are applied together by ProcessDeferredUpdates,
+        //! which the OctreeSystemComponent calls once per tick, queries keep observing the tree as of the last applied pass.
+        //! Disabling deferred updates applies any queued entries immediately.
+        //! Defaults to the value of bg_octreeDeferredUpdates at the time the scene is created.
+        void SetDeferredUpdatesEnabled(bool enabled);
+        bool IsDeferredUpdatesEnabled() const;
+
+        //! Applies all queued entry updates in one pass.
+        //! The containing node of every queued entry is found in parallel, the entries are then moved and every
+        //! resulting split and merge is performed in a single pass over the affected nodes.
+        //! Must not overlap queries on the same scene, so it should be called at a boundary such as the end of simulation.
+        //! When invoked from a task worker thread the containing node search runs serially rather than waiting on the task graph.
+        void ProcessDeferredUpdates();
+
+        //! Overrides the task executor used to process deferred updates in parallel, by default the global task executor is used.
+        //! @param executor the executor to use, or nullptr to restore the default
+        void SetTaskExecutor(AZ::TaskExecutor* executor);
+
         //! Stats
         //! @{
         uint32_t GetNodeCount() const;
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
+        uint32_t GetDeferredUpdateCount() const;
         void DumpStats();
         //! @}
 
@@ -131,8 +187,34 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
+        void QueueDeferredUpdate(VisibilityEntry& entry);
+        void CancelDeferredUpdate(VisibilityEntry& entry);
+        void ApplyDeferredUpdates();
+
+        //! Stats for the most recent ProcessDeferredUpdates pass, reported by DumpStats.
+        struct DeferredUpdateStats
+        {
+            uint32_t m_passCount = 0; //< Total number of deferred update passes applied.
+            uint32_t m_entryCount = 0; //< Number of queued entries processed by the last pass.
+            uint32_t m_movedCount = 0; //< Number of entries bound to a different node by the last pass.
+            uint32_t m_splitCount = 0; //< Number of nodes split by the last pass.
+            uint32_t m_mergeCount = 0; //< Number of nodes merged by the last pass.
+            uint32_t m_taskCount = 0; //< Number of tasks the containing node search was spread over, 0 if it ran serially.
+            int64_t m_durationUs = 0; //< Duration of the last pass in microseconds.
+        };
+
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        mutable AZStd::mutex m_deferredMutex; //< Guards the deferred update queue, always acquired after m_sharedMutex.
+        AZStd::vector<VisibilityEntry*> m_deferredEntries; //< Entries with a queued update, in the order they were first queued.
+        AZStd::vector<OctreeNode*> m_deferredTargets; //< Scratch array of the containing node found for each queued entry.
+        AZStd::atomic_bool m_hasDeferredUpdates{ false };
+        AZStd::atomic_bool m_deferredUpdatesEnabled{ false }; //< Only changed under an exclusive m_sharedMutex lock, read without it by InsertOrUpdateEntry.
+        AZ::TaskExecutor* m_taskExecutor = nullptr;
+        DeferredUpdateStats m_deferredStats;
+        uint32_t m_splitCount = 0; //< Metric tracking the number of node splits since the scene was created.
+        uint32_t m_mergeCount = 0; //< Metric tracking the number of node merges since the scene was created.
+
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
@@ -154,6 +236,7 @@ namespace AzFramework
     class OctreeSystemComponent
         : public AZ::Component
         , public IVisibilitySystemRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
@@ -183,6 +266,13 @@ namespace AzFramework
         void DumpStats(const AZ::ConsoleCommandContainer& arguments) override;
         //! @}
 
+        //! AZ::TickBus overrides.
+        //! Applies the deferred updates of every scene, after gameplay has moved its entries and before they are rendered.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
     private:
         //! The default scene used for most entities (e.g. gameplay, networking)
         OctreeScene* m_defaultScene = nullptr;
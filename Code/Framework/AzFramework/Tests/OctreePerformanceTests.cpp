@@ -62,6 +62,12 @@ namespace Benchmark
                     2.0f * atanf(0.5f), unif(rng) * 10.0f, unif(rng) * 1000.0f));
                 return data;
             });
+
+            m_queryFrusta.reserve(m_queryDataArray.size());
+            for (const QueryData& queryData : m_queryDataArray)
+            {
+                m_queryFrusta.push_back(queryData.frustum);
+            }
         }
 
         void internalTearDown()
@@ -75,6 +81,12 @@ namespace Benchmark
 
             m_queryDataArray.clear();
             m_queryDataArray.shrink_to_fit();
+
+            m_queryFrusta.clear();
+            m_queryFrusta.shrink_to_fit();
+
+            m_batchResults.clear();
+            m_batchResults.shrink_to_fit();
         }
 
     public:
@@ -112,6 +124,37 @@ namespace Benchmark
             }
         }
 
+        // Nudges every entry back and forth by a few units, as with crowds or vegetation moving in place
+        void MoveEntries(uint32_t entryCount, bool deferred)
+        {
+            AzFramework::OctreeScene* octreeScene = azrtti_cast<AzFramework::OctreeScene*>(m_visScene);
+            octreeScene->SetDeferredUpdatesEnabled(deferred);
+
+            m_moveOffset = -m_moveOffset;
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate(AZ::Vector3(m_moveOffset));
+                m_visScene->InsertOrUpdateEntry(m_dataArray[i]);
+            }
+
+            if (deferred)
+            {
+                octreeScene->ProcessDeferredUpdates();
+            }
+        }
+
+        // Runs the frustum queries through EnumerateBatch, MaxBatchVolumes frusta at a time
+        void EnumerateFrustumBatches()
+        {
+            constexpr size_t BatchSize = AzFramework::IVisibilityScene::MaxBatchVolumes;
+            for (size_t first = 0; first < m_queryFrusta.size(); first += BatchSize)
+            {
+                const size_t count = AZStd::min(m_queryFrusta.size() - first, BatchSize);
+                m_visScene->EnumerateBatch(AZStd::span<const AZ::Frustum>(m_queryFrusta.data() + first, count), m_batchResults);
+                benchmark::DoNotOptimize(m_batchResults.data());
+            }
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -121,6 +164,9 @@ namespace Benchmark
 
         AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
         AZStd::vector<QueryData> m_queryDataArray;
+        AZStd::vector<AZ::Frustum> m_queryFrusta;
+        AzFramework::IVisibilityScene::BatchResults m_batchResults;
+        float m_moveOffset = 4.0f;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
         AzFramework::IVisibilityScene* m_visScene = nullptr;
     };
@@ -332,6 +378,94 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumBatch1000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateFrustumBatches();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumBatch10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateFrustumBatches();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumBatch100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateFrustumBatches();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumBatch1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateFrustumBatches();
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, MoveEntriesImmediate10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries(EntryCount, false);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, MoveEntriesDeferred10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries(EntryCount, true);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, MoveEntriesImmediate100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries(EntryCount, false);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, MoveEntriesDeferred100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries(EntryCount, true);
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
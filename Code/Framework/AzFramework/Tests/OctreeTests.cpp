@@ -12,7 +12,11 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/std/sort.h>
 #include <random>
 
 using namespace AzFramework;
@@ -363,6 +367,253 @@ namespace UnitTest
         EnumerateMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
     }
 
+    // Every volume of the batch should gather exactly the entries gathered by enumerating that volume on its own
+    template <typename BoundType>
+    void EnumerateBatchMatchesEnumerateHelper(IVisibilityScene* visScene, const AZStd::vector<BoundType>& bounds)
+    {
+        IVisibilityScene::BatchResults batchResults;
+        visScene->EnumerateBatch(AZStd::span<const BoundType>(bounds.data(), bounds.size()), batchResults);
+
+        for (const IVisibilityScene::BatchNodeData& nodeData : batchResults)
+        {
+            EXPECT_NE(nodeData.m_volumeMask, 0u);
+            EXPECT_FALSE(nodeData.m_entries->empty());
+        }
+
+        for (uint32_t volumeIndex = 0; volumeIndex < bounds.size(); ++volumeIndex)
+        {
+            AZStd::vector<VisibilityEntry*> expectedEntries;
+            visScene->Enumerate(bounds[volumeIndex], [&expectedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(expectedEntries, nodeData); });
+
+            AZStd::vector<VisibilityEntry*> batchedEntries;
+            for (const IVisibilityScene::BatchNodeData& nodeData : batchResults)
+            {
+                if (nodeData.m_volumeMask & (1u << volumeIndex))
+                {
+                    batchedEntries.insert(batchedEntries.end(), nodeData.m_entries->begin(), nodeData.m_entries->end());
+                }
+            }
+
+            AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+            AZStd::sort(batchedEntries.begin(), batchedEntries.end());
+            EXPECT_EQ(expectedEntries.size(), batchedEntries.size());
+            EXPECT_TRUE(expectedEntries == batchedEntries);
+        }
+    }
+
+    TEST_F(OctreeTests, EnumerateBatchMatchesEnumerate)
+    {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unif(0.0f, 1.0f);
+        auto randomPosition = [&unif, &rng]()
+        {
+            return AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 1.8f - AZ::Vector3(0.9f);
+        };
+
+        // With a single entry per node this produces a deep tree, with entries spread across leaf and interior nodes
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(500);
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            const AZ::Vector3 aabbMin = randomPosition();
+            visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 0.1f);
+            m_octreeScene->InsertOrUpdateEntry(visEntry);
+        }
+
+        AZStd::vector<AZ::Aabb> aabbs;
+        AZStd::vector<AZ::Sphere> spheres;
+        AZStd::vector<AZ::Frustum> frusta;
+        for (uint32_t volumeIndex = 0; volumeIndex < IVisibilityScene::MaxBatchVolumes; ++volumeIndex)
+        {
+            const AZ::Vector3 aabbMin = randomPosition();
+            aabbs.push_back(AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 0.5f));
+            spheres.push_back(AZ::Sphere(randomPosition(), unif(rng) * 0.5f));
+
+            const AZ::Quaternion frustumDirection = AZ::Quaternion::CreateRotationZ(unif(rng) * AZ::Constants::TwoPi);
+            const AZ::Vector3 frustumOrigin = frustumDirection.TransformVector(AZ::Vector3(0.0f, -2.0f, 0.0f)) + randomPosition() * 0.5f;
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+            frusta.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.1f + unif(rng) * 0.4f), 1.0f, 1.5f + unif(rng) * 2.0f)));
+        }
+
+        EnumerateBatchMatchesEnumerateHelper(m_octreeScene, aabbs);
+        EnumerateBatchMatchesEnumerateHelper(m_octreeScene, spheres);
+        EnumerateBatchMatchesEnumerateHelper(m_octreeScene, frusta);
+
+        // Partial batches only report the volumes that were provided
+        frusta.resize(3);
+        EnumerateBatchMatchesEnumerateHelper(m_octreeScene, frusta);
+
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(visEntry);
+        }
+    }
+
+    // Only entries whose own bounds overlap the query are compared, as deferred updates may bind entries to different nodes than immediate updates
+    void ValidateEnumerateMatchesBruteForce(const IVisibilityScene* visScene, AZStd::vector<AzFramework::VisibilityEntry>& visEntries, const AZ::Aabb& query)
+    {
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        visScene->Enumerate(query, [&gatheredEntries, &query](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            for (VisibilityEntry* entry : nodeData.m_entries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(query, entry->m_boundingVolume))
+                {
+                    gatheredEntries.push_back(entry);
+                }
+            }
+        });
+
+        AZStd::vector<VisibilityEntry*> expectedEntries;
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            if (visEntry.m_internalNode != nullptr && AZ::ShapeIntersection::Overlaps(query, visEntry.m_boundingVolume))
+            {
+                expectedEntries.push_back(&visEntry);
+            }
+        }
+
+        AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+        AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+        EXPECT_EQ(gatheredEntries.size(), expectedEntries.size());
+        EXPECT_TRUE(gatheredEntries == expectedEntries);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates)
+    {
+        // Spread the containing node search over several tasks
+        uint32_t savedTaskEntries = 0;
+        m_console->GetCvarValue("bg_octreeDeferredTaskEntries", savedTaskEntries);
+        m_console->PerformCommand("bg_octreeDeferredTaskEntries 16");
+        AZ::TaskExecutor taskExecutor;
+        m_octreeScene->SetTaskExecutor(&taskExecutor);
+        m_octreeScene->SetDeferredUpdatesEnabled(true);
+        EXPECT_TRUE(m_octreeScene->IsDeferredUpdatesEnabled());
+
+        std::mt19937 rng(2);
+        std::uniform_real_distribution<float> unif(0.0f, 1.0f);
+        auto randomBounds = [&unif, &rng](float extent)
+        {
+            const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * (2.0f * extent - 0.1f) - AZ::Vector3(extent);
+            return AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 0.1f);
+        };
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(300);
+        auto validateQueries = [this, &visEntries, &randomBounds]()
+        {
+            ValidateEnumerateMatchesBruteForce(m_octreeScene, visEntries, AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f)));
+            for (uint32_t query = 0; query < 16; ++query)
+            {
+                ValidateEnumerateMatchesBruteForce(m_octreeScene, visEntries, randomBounds(1.0f).GetExpanded(AZ::Vector3(0.25f)));
+            }
+        };
+
+        // Inserts are only queued until processed
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            visEntry.m_boundingVolume = randomBounds(1.0f);
+            m_octreeScene->InsertOrUpdateEntry(visEntry);
+        }
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), visEntries.size());
+        EXPECT_EQ(m_octreeScene->GetEntryCount(), 0u);
+        EXPECT_EQ(m_octreeScene->GetNodeCount(), 1u);
+
+        m_octreeScene->ProcessDeferredUpdates();
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), 0u);
+        EXPECT_GT(m_octreeScene->GetNodeCount(), 1u);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
+        validateQueries();
+
+        // Move every entry, some of them more than once, then remove a few entries while their updates are still queued
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            visEntry.m_boundingVolume = randomBounds(1.0f);
+            m_octreeScene->InsertOrUpdateEntry(visEntry);
+        }
+        for (uint32_t index = 0; index < visEntries.size(); index += 3)
+        {
+            visEntries[index].m_boundingVolume = randomBounds(1.0f);
+            m_octreeScene->InsertOrUpdateEntry(visEntries[index]);
+        }
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), visEntries.size());
+
+        for (uint32_t index = 0; index < visEntries.size(); index += 10)
+        {
+            m_octreeScene->RemoveEntry(visEntries[index]);
+            EXPECT_TRUE(visEntries[index].m_internalNode == nullptr);
+        }
+        const uint32_t remainingCount = static_cast<uint32_t>(visEntries.size() - (visEntries.size() + 9) / 10);
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), remainingCount);
+
+        // Queries leave the queue alone and observe the tree as of the last processed pass
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, remainingCount);
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), remainingCount);
+
+        // Processing from one of the executor's own workers must not wait on the task graph
+        AZ::TaskGraph processGraph{ "OctreeTests Deferred Update" };
+        processGraph.AddTask(AZ::TaskDescriptor{ "OctreeTests: ProcessDeferredUpdates", "Visibility" }, [this]()
+        {
+            m_octreeScene->ProcessDeferredUpdates();
+        });
+        AZ::TaskGraphEvent processFinished{ "OctreeTests Deferred Update Wait" };
+        processGraph.SubmitOnExecutor(taskExecutor, &processFinished);
+        processFinished.Wait();
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), 0u);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, remainingCount);
+        validateQueries();
+
+        // Gather every entry into the middle of the world, emptying most of the tree in a single pass
+        for (uint32_t index = 0; index < visEntries.size(); ++index)
+        {
+            if (visEntries[index].m_internalNode != nullptr)
+            {
+                visEntries[index].m_boundingVolume = randomBounds(0.2f);
+                m_octreeScene->InsertOrUpdateEntry(visEntries[index]);
+            }
+        }
+        m_octreeScene->ProcessDeferredUpdates();
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, remainingCount);
+        validateQueries();
+
+        // Disabling deferred updates applies the queue and restores immediate updates
+        visEntries[1].m_boundingVolume = randomBounds(1.0f);
+        m_octreeScene->InsertOrUpdateEntry(visEntries[1]);
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), 1u);
+        m_octreeScene->SetDeferredUpdatesEnabled(false);
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), 0u);
+        visEntries[2].m_boundingVolume = randomBounds(1.0f);
+        m_octreeScene->InsertOrUpdateEntry(visEntries[2]);
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), 0u);
+        validateQueries();
+
+        for (AzFramework::VisibilityEntry& visEntry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(visEntry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+
+        m_octreeScene->SetTaskExecutor(nullptr);
+        AZStd::string commandString;
+        commandString.format("bg_octreeDeferredTaskEntries %u", savedTaskEntries);
+        m_console->PerformCommand(commandString.c_str());
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_AppliedOnTick)
+    {
+        m_octreeScene->SetDeferredUpdatesEnabled(true);
+
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.1f), AZ::Vector3(0.2f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+
+        m_octreeSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+        EXPECT_EQ(m_octreeScene->GetDeferredUpdateCount(), 0u);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 1);
+
+        m_octreeScene->RemoveEntry(visEntry);
+        m_octreeScene->SetDeferredUpdatesEnabled(false);
+    }
+
     TEST_F(OctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
     {
         // Validate that the octree works if you exceed the max entry count with large entries,
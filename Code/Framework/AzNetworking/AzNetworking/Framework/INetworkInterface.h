@@ -93,6 +93,14 @@ namespace AzNetworking
         //! @return boolean true if the packet is confirmed acknowledged, false if the packet number is out of range, lost, or still pending acknowledgment
         virtual bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) = 0;
 
+        //! Starts collecting outgoing packets so they can be handed to the transport in a single batch.
+        //! Batches may be nested, collected packets are transmitted when the outermost batch ends.
+        //! Transports that can't batch sends transmit packets immediately.
+        virtual void BeginSendBatch() = 0;
+
+        //! Ends a batch started by BeginSendBatch, transmitting all collected packets if this ends the outermost batch.
+        virtual void EndSendBatch() = 0;
+
         //! Closes the network interface to stop accepting new incoming connections.
         //! @return boolean true if the operation was successful, false if it failed
         virtual bool StopListening() = 0;
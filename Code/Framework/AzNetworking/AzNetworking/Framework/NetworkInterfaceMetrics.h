@@ -34,6 +34,8 @@ namespace AzNetworking
         int64_t m_sendBytesCompressedDelta = 0;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
+        //! Returns the total number of packets that were reported as sent within a send batch, but failed when the batch was handed to the socket.
+        uint64_t m_sendPacketsFailed = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
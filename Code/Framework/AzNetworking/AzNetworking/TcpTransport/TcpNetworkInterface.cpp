@@ -152,6 +152,17 @@ namespace AzNetworking
         return connection->WasPacketAcked(packetId);
     }
 
+    void TcpNetworkInterface::BeginSendBatch()
+    {
+        // Tcp sends are written to per connection streams, so there is nothing to batch
+        ;
+    }
+
+    void TcpNetworkInterface::EndSendBatch()
+    {
+        ;
+    }
+
     bool TcpNetworkInterface::StopListening()
     {
         m_port = 0;
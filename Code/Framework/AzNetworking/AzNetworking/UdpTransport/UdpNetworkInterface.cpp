@@ -38,6 +38,11 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+#if AZ_TRAIT_USE_UDP_REUSE_PORT
+    AZ_CVAR(uint32_t, net_UdpReaderShards, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Number of reader threads for listening Udp network interfaces, each reading from its own socket bound to the listen port");
+#else
+    static const uint32_t net_UdpReaderShards = 1;
+#endif
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -74,6 +79,7 @@ namespace AzNetworking
     {
         m_heartbeatThread.UnregisterNetworkInterface(this);
         m_readerThread.UnregisterSocket(m_socket.get());
+        StopReaderShards();
     }
 
     AZ::Name UdpNetworkInterface::GetName() const
@@ -116,9 +122,20 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
+
+        // Sharding requires a fixed port, since every shard binds its own socket to it
+        const uint32_t shardCount = (m_port != 0) ? static_cast<uint32_t>(net_UdpReaderShards) : 1;
+        m_socket->SetReusePort(shardCount > 1);
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
-            m_readerThread.RegisterSocket(m_socket.get());
+            if (shardCount > 1)
+            {
+                StartReaderShards(shardCount);
+            }
+            else
+            {
+                m_readerThread.RegisterSocket(m_socket.get());
+            }
             return true;
         }
         else
@@ -138,6 +155,7 @@ namespace AzNetworking
         m_port = localPort;
         if (!m_socket->IsOpen())
         {
+            m_socket->SetReusePort(false);
             if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
             {
                 m_readerThread.RegisterSocket(m_socket.get());
@@ -181,163 +199,48 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
-        if (packets == nullptr)
+        if (m_shardedReading)
         {
-            // Socket is not yet registered with the reader thread and is likely still pending, try again later
-            return;
+            ProcessShardedPackets(startTimeMs);
         }
-
-        for (uint32_t i = 0; i < packets->size(); ++i)
+        else
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
-            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-
-            // Don't exceed our timeslice, even if unprocessed data remains
-            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
-            {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
-                break;
-            }
-
-            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
-            if (connection == nullptr)
-            {
-                AcceptConnection(packet);
-                continue;
-            }
-
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
-                continue;
-            }
-            
-            const ConnectionState connectionState = connection->GetConnectionState();
-            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+            const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+            if (packets == nullptr)
             {
-                // Skip packets from disconnected connections
-                continue;
-            }
-
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
-            {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
-            }
-            else if (decodedPacketSize < 0)
-            {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
-            }
-
-            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
-            {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
-            }
-
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
-            {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+                // Socket is not yet registered with the reader thread and is likely still pending, try again later
+                return;
             }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
-            if (timeoutItem == nullptr)
-            {
-                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
-                continue;
-            }
-            else
+            for (uint32_t i = 0; i < packets->size(); ++i)
             {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
-                {
-                    continue;
-                }
+                const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
+                const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
-                // Note that the serializer passed in here is unused for UDP
-                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+                // Don't exceed our timeslice, even if unprocessed data remains
+                if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
                 {
-                    continue;
+                    AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
+                    GetMetrics().m_discardedPackets += packets->size() - i;
+                    break;
                 }
 
-                timeoutItem->UpdateTimeoutTime(startTimeMs);
-                connection->m_timeoutCounter = 0;
-
-                PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-                {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
-
-                if (handledPacket == PacketDispatchResult::Success)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
-                {
-                    // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
-                    // This will appear as a SerializationError due to the incomplete encryption handshake
-                    // If it's not an expected unencrypted type then skip it for now
-                    continue;
-                }
-                else if (handledPacket == PacketDispatchResult::Skipped)
-                {
-                    // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
-                    continue;
-                }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
+                ProcessReceivedPacket(packet, startTimeMs, currentTimeMs);
             }
         }
         const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
 
+        // Heartbeats and packet resends triggered by the timeout queues are handed to the socket as a single batch
+        m_socket->BeginSendBatch();
+
         // Time out any stale client connections
         m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
 
         // Time out any packets that haven't been acked within our timeout window
         m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
 
+        m_socket->EndSendBatch();
+
         // Delete any connections we've disconnected
         for (RemovedConnection& removedConnection : m_removedConnections)
         {
@@ -349,11 +252,17 @@ namespace AzNetworking
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
+        GetMetrics().m_sendPacketsFailed = m_socket->GetSendFailedPackets();
         GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
         GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
         GetMetrics().m_recvTimeMs += receiveTimeMs;
         GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
         GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        for (const AZStd::unique_ptr<UdpSocket>& shardSocket : m_shardSockets)
+        {
+            GetMetrics().m_recvPackets += shardSocket->GetRecvPackets();
+            GetMetrics().m_recvBytes += shardSocket->GetRecvBytes();
+        }
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
@@ -388,6 +297,16 @@ namespace AzNetworking
         return connection->WasPacketAcked(packetId);
     }
 
+    void UdpNetworkInterface::BeginSendBatch()
+    {
+        m_socket->BeginSendBatch();
+    }
+
+    void UdpNetworkInterface::EndSendBatch()
+    {
+        m_socket->EndSendBatch();
+    }
+
     bool UdpNetworkInterface::StopListening()
     {
         if (!m_socket->IsOpen())
@@ -397,6 +316,7 @@ namespace AzNetworking
 
         m_port = 0;
         m_readerThread.UnregisterSocket(m_socket.get());
+        StopReaderShards();
         m_allowIncomingConnections = false;
         m_socket->Close();
         return true;
@@ -556,6 +476,8 @@ namespace AzNetworking
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
             ChunkBuffer chunkBuffer;
+            // All fragments go to the same address and share a size except for the last, so they batch well
+            m_socket->BeginSendBatch();
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
@@ -568,6 +490,7 @@ namespace AzNetworking
                 bytesRemaining -= nextChunkSize;
                 chunkStart += nextChunkSize;
             }
+            m_socket->EndSendBatch();
             AZ_Assert(bytesRemaining == 0, "Non-zero bytes remaining (%u) after chunking a packet into fragments", bytesRemaining);
 
             return localPacketId;
@@ -638,6 +561,214 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
+    void UdpNetworkInterface::ProcessReceivedPacket(const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs startTimeMs, AZ::TimeMs currentTimeMs)
+    {
+        UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+        if (connection == nullptr)
+        {
+            AcceptConnection(packet);
+            return;
+        }
+
+        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
+        if (disconnectReason != DisconnectReason::MAX)
+        {
+            connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
+            return;
+        }
+        
+        const ConnectionState connectionState = connection->GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+        {
+            // Skip packets from disconnected connections
+            return;
+        }
+
+        int32_t decodedPacketSize = 0;
+        m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
+        m_decryptBuffer.Resize(decodedPacketSize);
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return;
+        }
+
+        connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        UdpPacketHeader header;
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+        }
+
+        if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return;
+            }
+            decodedPacketData = m_decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+        }
+        GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
+
+        TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+        if (timeoutItem == nullptr)
+        {
+            connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+            return;
+        }
+        else
+        {
+            // Deserialize the packet header
+            NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+            ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+            if (!serializer.Serialize(header, "Header"))
+            {
+                return;
+            }
+
+            // Note that the serializer passed in here is unused for UDP
+            if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+            {
+                return;
+            }
+
+            timeoutItem->UpdateTimeoutTime(startTimeMs);
+            connection->m_timeoutCounter = 0;
+
+            PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
+            if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+            {
+                handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
+            }
+            else
+            {
+                handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
+            }
+
+            if (handledPacket == PacketDispatchResult::Success)
+            {
+                connection->UpdateHeartbeat(currentTimeMs);
+                if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
+                {
+                    // Connection is realized once a packet is received and socket handshake is verified complete
+                    connection->m_state = ConnectionState::Connected;
+                }
+            }
+            else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
+                !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
+            {
+                // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
+                // This will appear as a SerializationError due to the incomplete encryption handshake
+                // If it's not an expected unencrypted type then skip it for now
+                return;
+            }
+            else if (handledPacket == PacketDispatchResult::Skipped)
+            {
+                // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
+                return;
+            }
+            else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
+            {
+                connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+            }
+        }
+    }
+
+    void UdpNetworkInterface::ProcessShardedPackets(AZ::TimeMs startTimeMs)
+    {
+        const uint32_t shardCount = aznumeric_cast<uint32_t>(m_readerShards.size());
+        for (uint32_t i = 0; i < shardCount; ++i)
+        {
+            // Start at a different shard every update so no shard is starved when the time slice is exceeded
+            UdpReaderShard& shard = *m_readerShards[(m_firstReaderShard + i) % shardCount];
+            while (const UdpReaderThread::ReceivedPacket* packet = shard.PeekPacket())
+            {
+                const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+
+                // Don't exceed our timeslice, unprocessed packets remain queued on their shard for the next update
+                if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
+                {
+                    m_firstReaderShard = (m_firstReaderShard + 1) % shardCount;
+                    return;
+                }
+
+                ProcessReceivedPacket(*packet, startTimeMs, currentTimeMs);
+                shard.PopPacket();
+
+                if (!m_shardedReading)
+                {
+                    // Packet processing stopped listening
+                    return;
+                }
+            }
+        }
+        m_firstReaderShard = (m_firstReaderShard + 1) % shardCount;
+    }
+
+    void UdpNetworkInterface::StartReaderShards(uint32_t shardCount)
+    {
+        StopReaderShards();
+        m_shardSockets.clear();
+        m_readerShards.clear();
+        m_firstReaderShard = 0;
+
+        m_readerShards.push_back(AZStd::make_unique<UdpReaderShard>(*m_socket));
+        for (uint32_t shardIndex = 1; shardIndex < shardCount; ++shardIndex)
+        {
+            // Additional sockets only receive, all sends and encryption handshakes go through m_socket
+            AZStd::unique_ptr<UdpSocket> shardSocket = AZStd::make_unique<UdpSocket>();
+            shardSocket->SetReusePort(true);
+            if (!shardSocket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open socket for Udp reader shard %u, continuing with %u shards", shardIndex, shardIndex);
+                break;
+            }
+            m_readerShards.push_back(AZStd::make_unique<UdpReaderShard>(*shardSocket));
+            m_shardSockets.push_back(AZStd::move(shardSocket));
+        }
+
+        for (AZStd::unique_ptr<UdpReaderShard>& shard : m_readerShards)
+        {
+            shard->Start();
+        }
+        m_shardedReading = true;
+    }
+
+    void UdpNetworkInterface::StopReaderShards()
+    {
+        // Shards and their sockets are kept alive until the next StartReaderShards, since this may be invoked while
+        // a packet from one of the shards is being processed
+        m_shardedReading = false;
+        for (AZStd::unique_ptr<UdpReaderShard>& shard : m_readerShards)
+        {
+            shard->Stop();
+            shard->Join();
+        }
+        for (AZStd::unique_ptr<UdpSocket>& shardSocket : m_shardSockets)
+        {
+            shardSocket->Close();
+        }
+    }
+
     void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
     {
         if (!m_allowIncomingConnections)
@@ -799,4 +930,9 @@ namespace AzNetworking
     {
         return m_lastSystemTickUpdate.load();
     }
+
+    uint32_t UdpNetworkInterface::GetReaderShardCount() const
+    {
+        return m_shardedReading ? aznumeric_cast<uint32_t>(m_readerShards.size()) : 0;
+    }
 }
@@ -11,6 +11,7 @@
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/UdpTransport/UdpConnectionSet.h>
 #include <AzNetworking/UdpTransport/UdpHeartbeatThread.h>
+#include <AzNetworking/UdpTransport/UdpReaderShard.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
@@ -112,6 +113,8 @@ namespace AzNetworking
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
+        void BeginSendBatch() override;
+        void EndSendBatch() override;
         bool StopListening() override;
         bool Disconnect(ConnectionId connectionId, DisconnectReason reason) override;
         void SetTimeoutMs(AZ::TimeMs timeoutMs) override;
@@ -122,6 +125,10 @@ namespace AzNetworking
 
         AZStd::atomic<AZ::TimeMs> GetLastSystemTickUpdate() const;
 
+        //! Returns the number of reader shards that read from the listen port.
+        //! @return the number of reader shards, 0 if the socket is read by the shared reader thread
+        uint32_t GetReaderShardCount() const;
+
     private:
 
         //! Registers a packet with a timeout queue on the provided connection.
@@ -145,6 +152,23 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Decodes and dispatches a single received packet.
+        //! @param packet        the packet received by the reader thread or one of the reader shards
+        //! @param startTimeMs   the time the current update started
+        //! @param currentTimeMs the time processing of this packet started
+        void ProcessReceivedPacket(const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs startTimeMs, AZ::TimeMs currentTimeMs);
+
+        //! Processes packets queued by the reader shards until they're empty or the packet time slice is exceeded.
+        //! @param startTimeMs the time the current update started
+        void ProcessShardedPackets(AZ::TimeMs startTimeMs);
+
+        //! Opens the additional sockets on the listen port and starts a reader shard for each socket, including m_socket.
+        //! @param shardCount the number of reader shards to start
+        void StartReaderShards(uint32_t shardCount);
+
+        //! Stops all reader shards and closes the additional sockets.
+        void StopReaderShards();
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -199,6 +223,13 @@ namespace AzNetworking
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
 
+        //! Additional sockets bound to the listen port when reading is sharded, m_socket is used by the first shard.
+        AZStd::vector<AZStd::unique_ptr<UdpSocket>> m_shardSockets;
+        //! Declared after the sockets so the shards stop reading before their sockets are destroyed.
+        AZStd::vector<AZStd::unique_ptr<UdpReaderShard>> m_readerShards;
+        uint32_t m_firstReaderShard = 0;
+        bool m_shardedReading = false;
+
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
     };
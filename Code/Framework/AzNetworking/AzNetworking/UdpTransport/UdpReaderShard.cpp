@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReaderShard.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    static constexpr AZ::TimeMs ReaderShardUpdateRateMs{ 10 };
+
+    static_assert((UdpReaderShard::MaxQueuedPackets & (UdpReaderShard::MaxQueuedPackets - 1)) == 0, "MaxQueuedPackets is not a power of 2");
+
+    UdpReaderShard::UdpReaderShard(UdpSocket& socket)
+        : TimedThread("UdpReaderShard", ReaderShardUpdateRateMs)
+        , m_socket(socket)
+        , m_slots(AZStd::make_unique<PacketSlot[]>(MaxQueuedPackets))
+    {
+        ;
+    }
+
+    UdpReaderShard::~UdpReaderShard()
+    {
+        Stop();
+        Join();
+    }
+
+    const UdpReaderThread::ReceivedPacket* UdpReaderShard::PeekPacket()
+    {
+        const uint32_t tail = m_tail.load(AZStd::memory_order_relaxed);
+        if (tail == m_head.load(AZStd::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        const PacketSlot& slot = m_slots[tail & (MaxQueuedPackets - 1)];
+        m_peekedPacket = UdpReaderThread::ReceivedPacket(slot.m_address, slot.m_data, slot.m_receivedBytes);
+        return &m_peekedPacket;
+    }
+
+    void UdpReaderShard::PopPacket()
+    {
+        const uint32_t tail = m_tail.load(AZStd::memory_order_relaxed);
+        AZ_Assert(tail != m_head.load(AZStd::memory_order_acquire), "PopPacket called on an empty UdpReaderShard");
+        m_tail.store(tail + 1, AZStd::memory_order_release);
+    }
+
+    uint32_t UdpReaderShard::GetQueuedPacketCount() const
+    {
+        return m_head.load(AZStd::memory_order_acquire) - m_tail.load(AZStd::memory_order_relaxed);
+    }
+
+    UdpSocket& UdpReaderShard::GetSocket() const
+    {
+        return m_socket;
+    }
+
+    AZ::TimeMs UdpReaderShard::GetUpdateTimeMs() const
+    {
+        return m_updateTimeMs;
+    }
+
+    void UdpReaderShard::OnStart()
+    {
+        ;
+    }
+
+    void UdpReaderShard::OnStop()
+    {
+        ;
+    }
+
+    void UdpReaderShard::OnUpdate(AZ::TimeMs updateRateMs)
+    {
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+
+        for (;;)
+        {
+            const AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+            if (elapsedTimeMs > updateRateMs)
+            {
+                AZLOG_INFO("ReceivePackets bled %d ms", aznumeric_cast<int32_t>(elapsedTimeMs - updateRateMs));
+                break;
+            }
+
+            const uint32_t head = m_head.load(AZStd::memory_order_relaxed);
+            const uint32_t freeSlots = MaxQueuedPackets - (head - m_tail.load(AZStd::memory_order_acquire));
+            if (freeSlots == 0)
+            {
+                // The network interface hasn't caught up yet, leave the remaining data on the socket
+                break;
+            }
+
+            // Only fill contiguous slots so received data can be written in place
+            const uint32_t firstSlot = head & (MaxQueuedPackets - 1);
+            const uint32_t slotCount = AZStd::min(AZStd::min(freeSlots, MaxQueuedPackets - firstSlot), UdpSocket::MaxBatchedDatagrams);
+
+            UdpSocket::ReceiveSlot receiveSlots[UdpSocket::MaxBatchedDatagrams];
+            for (uint32_t i = 0; i < slotCount; ++i)
+            {
+                receiveSlots[i].m_data = m_slots[firstSlot + i].m_data;
+                receiveSlots[i].m_capacity = MaxUdpTransmissionUnit;
+            }
+
+            const uint32_t receivedCount = m_socket.ReceiveBatch(receiveSlots, slotCount);
+            for (uint32_t i = 0; i < receivedCount; ++i)
+            {
+                m_slots[firstSlot + i].m_address = receiveSlots[i].m_address;
+                m_slots[firstSlot + i].m_receivedBytes = receiveSlots[i].m_receivedBytes;
+            }
+            m_head.store(head + receivedCount, AZStd::memory_order_release);
+
+            if (receivedCount < slotCount)
+            {
+                // The socket has been drained
+                break;
+            }
+        }
+
+        m_updateTimeMs = m_updateTimeMs.load() + (AZ::GetElapsedTimeMs() - startTimeMs);
+    }
+}
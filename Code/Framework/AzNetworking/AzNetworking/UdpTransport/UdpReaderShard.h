@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    // Forwards
+    class UdpSocket;
+
+    //! @class UdpReaderShard
+    //! @brief reads data off a single UDP socket on a dedicated thread.
+    //! A network interface can open several sockets on the same port and give each one its own shard, so that
+    //! receiving is spread over multiple threads. Received packets are handed to the thread that owns the
+    //! network interface through a single producer, single consumer queue, so neither side ever waits on a lock.
+    class UdpReaderShard
+        : public TimedThread
+    {
+    public:
+
+        //! Number of packets that can be queued for the network interface. Must be a power of two.
+        static constexpr uint32_t MaxQueuedPackets = UdpReaderThread::MaxUdpReceivePacketCount;
+
+        explicit UdpReaderShard(UdpSocket& socket);
+        ~UdpReaderShard() override;
+
+        //! Returns the oldest received packet that hasn't been consumed yet.
+        //! Only to be called from the thread that owns the network interface.
+        //! @return the oldest unconsumed packet, nullptr if no packets are queued; remains valid until PopPacket is called
+        const UdpReaderThread::ReceivedPacket* PeekPacket();
+
+        //! Releases the packet returned by the last call to PeekPacket.
+        //! Only to be called from the thread that owns the network interface.
+        void PopPacket();
+
+        //! Returns the number of received packets that haven't been consumed yet.
+        //! Only to be called from the thread that owns the network interface.
+        //! @return the number of queued packets, at most MaxQueuedPackets
+        uint32_t GetQueuedPacketCount() const;
+
+        //! Returns the socket this shard reads from.
+        //! @return the socket this shard reads from
+        UdpSocket& GetSocket() const;
+
+        //! Gets the total elapsed time spent updating the shard thread in milliseconds.
+        //! @return the total elapsed time spent updating the shard thread in milliseconds
+        AZ::TimeMs GetUpdateTimeMs() const;
+
+    private:
+
+        void OnStart() override;
+        void OnStop() override;
+        void OnUpdate(AZ::TimeMs updateRateMs) override;
+
+        AZ_DISABLE_COPY_MOVE(UdpReaderShard);
+
+        struct PacketSlot
+        {
+            IpAddress m_address;
+            int32_t m_receivedBytes = 0;
+            uint8_t m_data[MaxUdpTransmissionUnit];
+        };
+
+        UdpSocket& m_socket;
+        AZStd::unique_ptr<PacketSlot[]> m_slots;
+        UdpReaderThread::ReceivedPacket m_peekedPacket;
+        AZStd::atomic<AZ::TimeMs> m_updateTimeMs{ AZ::Time::ZeroTimeMs };
+
+        // Written by the shard thread
+        alignas(64) AZStd::atomic<uint32_t> m_head{ 0 };
+        // Written by the thread that owns the network interface
+        alignas(64) AZStd::atomic<uint32_t> m_tail{ 0 };
+    };
+}
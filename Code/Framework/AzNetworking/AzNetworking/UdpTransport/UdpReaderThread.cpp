@@ -176,27 +176,49 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                const uint32_t freeBufferSlots = static_cast<uint32_t>((receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit);
+                if (freeBufferSlots == 0)
                 {
                     AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
                         aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
                     break;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                const uint32_t freePacketSlots = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t slotCount = AZStd::min(AZStd::min(freeBufferSlots, freePacketSlots), UdpSocket::MaxBatchedDatagrams);
+                if (slotCount == 0)
+                {
+                    break;
+                }
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                // Receive into MTU sized slots at the end of the buffer, then pack the received packets back to back
+                UdpSocket::ReceiveSlot slots[UdpSocket::MaxBatchedDatagrams];
+                uint8_t* slotData = receiveBuffer.GetBufferEnd();
+                receiveBuffer.Resize(bufferHead + slotCount * MaxUdpTransmissionUnit);
+                for (uint32_t i = 0; i < slotCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    slots[i].m_data = slotData + i * MaxUdpTransmissionUnit;
+                    slots[i].m_capacity = MaxUdpTransmissionUnit;
                 }
-                else
+
+                const uint32_t receivedCount = socket->ReceiveBatch(slots, slotCount);
+                uint32_t bufferTail = bufferHead;
+                for (uint32_t i = 0; i < receivedCount; ++i)
+                {
+                    uint8_t* dstData = receiveBuffer.GetBuffer() + bufferTail;
+                    if (dstData != slots[i].m_data)
+                    {
+                        memmove(dstData, slots[i].m_data, slots[i].m_receivedBytes);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(slots[i].m_address, dstData, slots[i].m_receivedBytes));
+                    bufferTail += slots[i].m_receivedBytes;
+                }
+                receiveBuffer.Resize(bufferTail);
+
+                if (receivedCount < slotCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
@@ -18,11 +18,22 @@
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Interface/Interface.h>
 
+#if AZ_TRAIT_USE_UDP_BATCHED_IO && !defined(UDP_SEGMENT)
+#   define UDP_SEGMENT 103
+#endif
+
 namespace AzNetworking
 {
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchedSends, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, packets sent within a send batch are handed to the OS in a single call on supported platforms");
+    AZ_CVAR(bool, net_UdpSegmentationOffload, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched packets of equal size to the same address are sent using UDP generic segmentation offload on supported platforms");
+
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+    // Maximum payload the kernel accepts for a single segmentation offload send, leaving room for the IP and UDP headers
+    static constexpr uint32_t MaxSegmentationOffloadBytes = 65507;
+#endif
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +79,20 @@ namespace AzNetworking
             }
         }
 
+#if AZ_TRAIT_USE_UDP_REUSE_PORT
+        if (m_reusePort)
+        {
+            const int32_t reusePort = 1;
+            if (::setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, &reusePort, sizeof(reusePort)) != 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_WARN("Failed to enable port reuse on UDP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                Close();
+                return false;
+            }
+        }
+#endif
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -96,10 +121,18 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        m_sendBatch.clear();
+        m_sendBatchBuffer.clear();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
 
+    void UdpSocket::SetReusePort(bool reusePort)
+    {
+        AZ_Assert(!IsOpen(), "SetReusePort must be called before the socket is opened");
+        m_reusePort = reusePort;
+    }
+
     int32_t UdpSocket::Send
     (
         const IpAddress& address,
@@ -223,9 +256,217 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    uint32_t UdpSocket::ReceiveBatch(ReceiveSlot* slots, uint32_t slotCount) const
+    {
+        AZ_Assert(slots != nullptr, "NULL slot pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        slotCount = AZStd::min(slotCount, MaxBatchedDatagrams);
+
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        mmsghdr messages[MaxBatchedDatagrams];
+        iovec buffers[MaxBatchedDatagrams];
+        sockaddr_in fromAddresses[MaxBatchedDatagrams];
+        memset(messages, 0, sizeof(mmsghdr) * slotCount);
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            AZ_Assert(slots[i].m_data != nullptr && slots[i].m_capacity > 0, "Invalid receive slot passed to receive");
+            buffers[i].iov_base = slots[i].m_data;
+            buffers[i].iov_len = slots[i].m_capacity;
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+            messages[i].msg_hdr.msg_name = &fromAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        }
+
+        const int32_t receivedCount = static_cast<int32_t>(recvmmsg(static_cast<int32_t>(m_socketFd), messages, slotCount, 0, nullptr));
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (!ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            slots[i].m_address = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+            slots[i].m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+            m_recvPackets++;
+            m_recvBytes += messages[i].msg_len;
+        }
+        return static_cast<uint32_t>(receivedCount);
+#else
+        uint32_t receivedCount = 0;
+        for (; receivedCount < slotCount; ++receivedCount)
+        {
+            ReceiveSlot& slot = slots[receivedCount];
+            slot.m_receivedBytes = Receive(slot.m_address, slot.m_data, slot.m_capacity);
+            if (slot.m_receivedBytes <= 0)
+            {
+                break;
+            }
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::BeginSendBatch() const
+    {
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        if (m_sendBatchBuffer.capacity() == 0)
+        {
+            m_sendBatchBuffer.reserve(MaxBatchedDatagrams * MaxUdpTransmissionUnit);
+        }
+#endif
+        ++m_sendBatchDepth;
+    }
+
+    void UdpSocket::EndSendBatch() const
+    {
+        AZ_Assert(m_sendBatchDepth > 0, "EndSendBatch called without a matching BeginSendBatch");
+        if (--m_sendBatchDepth == 0)
+        {
+            FlushSendBatch();
+        }
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        const uint32_t datagramCount = aznumeric_cast<uint32_t>(m_sendBatch.size());
+        uint32_t firstUnsent = 0;
+        uint32_t failedCount = 0;
+        int32_t lastError = 0;
+        while (firstUnsent < datagramCount && IsOpen())
+        {
+            const bool useSegmentationOffload = net_UdpSegmentationOffload && m_segmentationOffloadSupported;
+
+            mmsghdr messages[MaxBatchedDatagrams];
+            iovec buffers[MaxBatchedDatagrams];
+            sockaddr_in destAddresses[MaxBatchedDatagrams];
+            alignas(cmsghdr) uint8_t controlBuffers[MaxBatchedDatagrams][CMSG_SPACE(sizeof(uint16_t))];
+            uint32_t messageFirstDatagram[MaxBatchedDatagrams];
+            memset(messages, 0, sizeof(messages));
+
+            uint32_t messageCount = 0;
+            for (uint32_t index = firstUnsent; index < datagramCount; ++messageCount)
+            {
+                const BatchedDatagram& first = m_sendBatch[index];
+                uint32_t runEnd = index + 1;
+                uint32_t runBytes = first.m_size;
+
+                // With segmentation offload a run of datagrams to the same address can be sent as a single message,
+                // as long as all segments are of equal size except for the last, which may be smaller
+                if (useSegmentationOffload)
+                {
+                    while (runEnd < datagramCount && m_sendBatch[runEnd].m_address == first.m_address
+                        && m_sendBatch[runEnd].m_size <= first.m_size && runBytes + m_sendBatch[runEnd].m_size <= MaxSegmentationOffloadBytes)
+                    {
+                        runBytes += m_sendBatch[runEnd].m_size;
+                        if (m_sendBatch[runEnd++].m_size < first.m_size)
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                memset(&destAddresses[messageCount], 0, sizeof(sockaddr_in));
+                destAddresses[messageCount].sin_family = AF_INET;
+                destAddresses[messageCount].sin_addr.s_addr = first.m_address.GetAddress(ByteOrder::Network);
+                destAddresses[messageCount].sin_port = first.m_address.GetPort(ByteOrder::Network);
+
+                // Datagrams are stored back to back, so a run is always a single contiguous range of the batch buffer
+                buffers[messageCount].iov_base = m_sendBatchBuffer.data() + first.m_offset;
+                buffers[messageCount].iov_len = runBytes;
+
+                msghdr& header = messages[messageCount].msg_hdr;
+                header.msg_name = &destAddresses[messageCount];
+                header.msg_namelen = sizeof(sockaddr_in);
+                header.msg_iov = &buffers[messageCount];
+                header.msg_iovlen = 1;
+                if (runEnd - index > 1)
+                {
+                    header.msg_control = controlBuffers[messageCount];
+                    header.msg_controllen = sizeof(controlBuffers[messageCount]);
+                    cmsghdr* control = CMSG_FIRSTHDR(&header);
+                    control->cmsg_level = SOL_UDP;
+                    control->cmsg_type = UDP_SEGMENT;
+                    control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                    const uint16_t segmentSize = aznumeric_cast<uint16_t>(first.m_size);
+                    memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+                }
+
+                messageFirstDatagram[messageCount] = index;
+                index = runEnd;
+            }
+
+            const int32_t sentCount = static_cast<int32_t>(sendmmsg(static_cast<int32_t>(m_socketFd), messages, messageCount, 0));
+            if (sentCount < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (useSegmentationOffload && (error == EIO || error == EINVAL || error == ENOPROTOOPT))
+                {
+                    // The kernel or network device doesn't support segmentation offload, retry without it
+                    AZLOG_INFO("UDP segmentation offload is not supported on this socket (%d:%s), disabling it", error, GetNetworkErrorDesc(error));
+                    m_segmentationOffloadSupported = false;
+                    continue;
+                }
+
+                lastError = error;
+                if (ErrorIsWouldBlock(error))
+                {
+                    // The send buffer is full, drop the rest of the batch instead of blocking
+                    failedCount += datagramCount - firstUnsent;
+                    break;
+                }
+
+                // Messages that were sent before the failing one are already accounted for, so the error belongs to the first
+                // message of this call. Skip its datagrams and keep sending the rest of the batch.
+                const uint32_t failedEnd = (messageCount > 1) ? messageFirstDatagram[1] : datagramCount;
+                failedCount += failedEnd - firstUnsent;
+                firstUnsent = failedEnd;
+                continue;
+            }
+
+            firstUnsent = (static_cast<uint32_t>(sentCount) < messageCount) ? messageFirstDatagram[sentCount] : datagramCount;
+        }
+
+        if (failedCount > 0)
+        {
+            m_sendFailedPackets += failedCount;
+            AZLOG_WARN("Failed to write %u of %u batched packets to socket (%d:%s)", failedCount, datagramCount, lastError, GetNetworkErrorDesc(lastError));
+        }
+#endif
+        m_sendBatch.clear();
+        m_sendBatchBuffer.clear();
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        if (m_sendBatchDepth > 0 && net_UdpBatchedSends)
+        {
+            if (m_sendBatch.full())
+            {
+                FlushSendBatch();
+            }
+
+            // Reported as sent, failures are logged and counted once the batch is flushed
+            const uint32_t offset = aznumeric_cast<uint32_t>(m_sendBatchBuffer.size());
+            m_sendBatchBuffer.insert(m_sendBatchBuffer.end(), data, data + size);
+            m_sendBatch.push_back(BatchedDatagram{ address, offset, size });
+            return static_cast<int32_t>(size);
+        }
+#endif
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +43,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of datagrams exchanged with the operating system in a single batched receive or send call.
+        static constexpr uint32_t MaxBatchedDatagrams = 64;
+
+        //! A single datagram slot used by ReceiveBatch.
+        struct ReceiveSlot
+        {
+            uint8_t*  m_data = nullptr;    //!< Buffer to receive the datagram into, provided by the caller
+            uint32_t  m_capacity = 0;      //!< Size of m_data in bytes, provided by the caller
+            IpAddress m_address;           //!< On success, the address of the endpoint that sent the datagram
+            int32_t   m_receivedBytes = 0; //!< On success, number of bytes received into m_data
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -72,6 +85,11 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Allows multiple sockets to bind the same port, in which case the operating system distributes incoming datagrams
+        //! between them by a hash of the sender's address. Must be called before Open and is ignored on platforms without support.
+        //! @param reusePort if true, the socket will be opened in a way that allows other sockets to bind the same port
+        void SetReusePort(bool reusePort);
+
         //! Returns true if the UDP socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
@@ -93,6 +111,21 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param slots     the slots to receive payloads into, filled in order
+        //! @param slotCount number of provided slots, at most MaxBatchedDatagrams slots are filled per call
+        //! @return number of slots filled, 0 if no data was available or on error
+        uint32_t ReceiveBatch(ReceiveSlot* slots, uint32_t slotCount) const;
+
+        //! Starts collecting sent payloads so they can be handed to the operating system in a single call.
+        //! Batches may be nested, collected payloads are sent when the outermost batch ends or when the batch is full.
+        //! Send reports collected payloads as sent, payloads the operating system rejects once the batch is sent are logged
+        //! and counted in GetSendFailedPackets. Has no effect on platforms without batched send support.
+        void BeginSendBatch() const;
+
+        //! Ends a batch started by BeginSendBatch, sending all collected payloads if this ends the outermost batch.
+        void EndSendBatch() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -105,6 +138,10 @@ namespace AzNetworking
         //! @return the total number of bytes sent on this socket
         uint32_t GetSentBytes() const;
 
+        //! Returns the total number of batched packets that failed to send when their batch was handed to the operating system.
+        //! @return the total number of batched packets that failed to send
+        uint32_t GetSendFailedPackets() const;
+
         //! Returns the total number of encrypted packets sent on this socket.
         //! @return the total number of encrypted packets sent on this socket
         uint32_t GetSentPacketsEncrypted() const;
@@ -131,11 +168,29 @@ namespace AzNetworking
     private:
 
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_reusePort = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
+        mutable uint32_t m_sendFailedPackets = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+        //! A payload collected while a send batch is active, stored in m_sendBatchBuffer.
+        struct BatchedDatagram
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        void FlushSendBatch() const;
+
+        mutable uint32_t m_sendBatchDepth = 0;
+        mutable AZStd::fixed_vector<BatchedDatagram, MaxBatchedDatagrams> m_sendBatch;
+        mutable AZStd::vector<uint8_t> m_sendBatchBuffer;
+        //! Cleared if the operating system rejects UDP generic segmentation offload for this socket.
+        mutable bool m_segmentationOffloadSupported = true;
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
@@ -30,6 +30,11 @@ namespace AzNetworking
         return m_sentBytes;
     }
 
+    inline uint32_t UdpSocket::GetSendFailedPackets() const
+    {
+        return m_sendFailedPackets;
+    }
+
     inline uint32_t UdpSocket::GetSentPacketsEncrypted() const
     {
         return m_sentPacketsEncrypted;
@@ -117,6 +117,8 @@ set(FILES
     UdpTransport/UdpPacketTracker.cpp
     UdpTransport/UdpPacketTracker.h
     UdpTransport/UdpPacketTracker.inl
+    UdpTransport/UdpReaderShard.cpp
+    UdpTransport/UdpReaderShard.h
     UdpTransport/UdpReaderThread.cpp
     UdpTransport/UdpReaderThread.h
     UdpTransport/UdpReliableQueue.cpp
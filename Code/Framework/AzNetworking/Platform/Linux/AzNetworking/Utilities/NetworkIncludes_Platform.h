@@ -9,3 +9,4 @@
 #pragma once
 
 #include <UnixLike/AzNetworking/Utilities/NetworkIncludes_UnixLike.h>
+#include <netinet/udp.h>
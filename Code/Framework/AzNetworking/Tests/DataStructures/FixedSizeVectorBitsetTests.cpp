@@ -11,4 +11,21 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        lhs.Resize(70);
+        rhs.Resize(70);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(66, true);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.SetBit(66, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // Bitsets of different sizes are never equal
+        rhs.Resize(71);
+        EXPECT_FALSE(lhs == rhs);
+    }
 }
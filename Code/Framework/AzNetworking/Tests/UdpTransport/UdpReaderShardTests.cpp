@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReaderShard.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    //! Sends datagrams over loopback to a socket read by a UdpReaderShard and consumes them from the shard's queue.
+    class UdpReaderShardTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint16_t SenderPort = 45135;
+        static constexpr uint16_t ReceiverPort = 45136;
+        // Sent before waiting for the shard to read them, kept well below what the socket receive buffer holds
+        static constexpr uint32_t DatagramsPerBurst = 200;
+        static constexpr AZ::TimeMs MaxWaitTimeMs = AZ::TimeMs{ 5000 };
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            SocketLayerInit();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            ASSERT_TRUE(m_sender->Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+            ASSERT_TRUE(m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+            m_shard = AZStd::make_unique<UdpReaderShard>(*m_receiver);
+            m_shard->Start();
+        }
+
+        void TearDown() override
+        {
+            m_shard.reset();
+            m_dtlsEndpoint.reset();
+            m_receiver.reset();
+            m_sender.reset();
+            SocketLayerShutdown();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Every datagram has a distinct size and content, so lost, reordered or overwritten datagrams are detected
+        static uint32_t GetDatagramSize(uint32_t index)
+        {
+            return 16 + (index * 7) % 64;
+        }
+
+        static uint8_t GetDatagramByte(uint32_t index, uint32_t offset)
+        {
+            return static_cast<uint8_t>(index * 31 + offset);
+        }
+
+        void SendDatagrams(uint32_t begin, uint32_t end)
+        {
+            const IpAddress address(127, 0, 0, 1, ReceiverPort);
+            uint8_t data[MaxUdpTransmissionUnit];
+            for (uint32_t index = begin; index < end; ++index)
+            {
+                const uint32_t size = GetDatagramSize(index);
+                for (uint32_t offset = 0; offset < size; ++offset)
+                {
+                    data[offset] = GetDatagramByte(index, offset);
+                }
+                EXPECT_EQ(static_cast<int32_t>(size), m_sender->Send(address, data, size, false, *m_dtlsEndpoint, m_connectionQuality));
+            }
+        }
+
+        //! Waits until the shard has queued the given number of packets.
+        bool WaitForQueuedPackets(uint32_t packetCount)
+        {
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (m_shard->GetQueuedPacketCount() < packetCount)
+            {
+                if (AZ::GetElapsedTimeMs() - startTimeMs > MaxWaitTimeMs)
+                {
+                    return false;
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            return true;
+        }
+
+        //! Consumes the expected datagrams from the shard and checks they match in order.
+        void ExpectConsumed(uint32_t begin, uint32_t end)
+        {
+            for (uint32_t index = begin; index < end; ++index)
+            {
+                ASSERT_TRUE(WaitForQueuedPackets(1)) << "Datagram " << index << " was not received";
+                const UdpReaderThread::ReceivedPacket* packet = m_shard->PeekPacket();
+                ASSERT_NE(nullptr, packet);
+                EXPECT_EQ(SenderPort, packet->m_address.GetPort(ByteOrder::Host));
+                ASSERT_EQ(static_cast<int32_t>(GetDatagramSize(index)), packet->m_receivedBytes);
+                for (int32_t offset = 0; offset < packet->m_receivedBytes; ++offset)
+                {
+                    ASSERT_EQ(GetDatagramByte(index, offset), packet->m_buffer[offset]) << "Datagram " << index;
+                }
+                m_shard->PopPacket();
+            }
+        }
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        AZStd::unique_ptr<UdpReaderShard> m_shard;
+        ConnectionQuality m_connectionQuality;
+    };
+
+    TEST_F(UdpReaderShardTests, ConsumeWhileReceiving_WrapsAroundQueue_KeepsDatagramOrder)
+    {
+        // Several times the queue capacity, so the read and write positions wrap around the queue repeatedly
+        constexpr uint32_t DatagramCount = UdpReaderShard::MaxQueuedPackets * 3 + DatagramsPerBurst / 2;
+        for (uint32_t begin = 0; begin < DatagramCount; begin += DatagramsPerBurst)
+        {
+            const uint32_t end = AZStd::min(begin + DatagramsPerBurst, DatagramCount);
+            SendDatagrams(begin, end);
+            ExpectConsumed(begin, end);
+        }
+        EXPECT_EQ(0, m_shard->GetQueuedPacketCount());
+        EXPECT_EQ(nullptr, m_shard->PeekPacket());
+    }
+
+    TEST_F(UdpReaderShardTests, QueueFull_LeavesDatagramsOnSocket_ReceivesThemOnceConsumed)
+    {
+        // Start part way into the queue, so the full queue wraps around its end
+        constexpr uint32_t Offset = UdpReaderShard::MaxQueuedPackets / 2 + 3;
+        SendDatagrams(0, Offset);
+        ExpectConsumed(0, Offset);
+
+        constexpr uint32_t DatagramCount = Offset + UdpReaderShard::MaxQueuedPackets + DatagramsPerBurst;
+        for (uint32_t begin = Offset; begin < DatagramCount; begin += DatagramsPerBurst)
+        {
+            const uint32_t end = AZStd::min(begin + DatagramsPerBurst, DatagramCount);
+            SendDatagrams(begin, end);
+            ASSERT_TRUE(WaitForQueuedPackets(AZStd::min(end - Offset, UdpReaderShard::MaxQueuedPackets)));
+        }
+
+        // The queue stays full, the datagrams that didn't fit wait on the socket
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(50));
+        EXPECT_EQ(UdpReaderShard::MaxQueuedPackets, m_shard->GetQueuedPacketCount());
+
+        ExpectConsumed(Offset, DatagramCount);
+        EXPECT_EQ(0, m_shard->GetQueuedPacketCount());
+    }
+
+    TEST_F(UdpReaderShardTests, StopAndJoin_WithQueuedPackets_KeepsThemForTheConsumer)
+    {
+        SendDatagrams(0, DatagramsPerBurst);
+        ASSERT_TRUE(WaitForQueuedPackets(DatagramsPerBurst));
+
+        m_shard->Stop();
+        m_shard->Join();
+        EXPECT_FALSE(m_shard->IsRunning());
+
+        // Packets queued before stopping remain available to the consumer
+        ExpectConsumed(0, DatagramsPerBurst);
+    }
+}
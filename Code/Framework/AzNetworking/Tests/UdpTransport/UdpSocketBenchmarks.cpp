@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Sends bursts of datagrams over loopback and reads them back, either one system call per datagram
+    //! or through the batched send and receive paths of the UdpSocket.
+    //! The benchmark argument selects whether the batched paths are used.
+    class UdpSocketBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t SenderPort = 45123;
+        static constexpr uint16_t ReceiverPort = 45124;
+        static constexpr uint32_t PacketsPerBurst = UdpSocket::MaxBatchedDatagrams;
+        static constexpr uint32_t PacketSize = 256;
+        // Bounds the number of empty reads while waiting for loopback datagrams so dropped datagrams can't stall the benchmark
+        static constexpr uint32_t MaxEmptyReceives = 1024;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            SocketLayerInit();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_sender->Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+        }
+
+        void InternalTearDown()
+        {
+            m_dtlsEndpoint.reset();
+            m_receiver.reset();
+            m_sender.reset();
+            SocketLayerShutdown();
+        }
+
+        void SendBurst(bool batched)
+        {
+            const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+            if (batched)
+            {
+                m_sender->BeginSendBatch();
+            }
+            for (uint32_t i = 0; i < PacketsPerBurst; ++i)
+            {
+                m_sender->Send(receiverAddress, m_sendBuffer, PacketSize, false, *m_dtlsEndpoint, m_connectionQuality);
+            }
+            if (batched)
+            {
+                m_sender->EndSendBatch();
+            }
+        }
+
+        uint32_t ReceiveBurst(bool batched)
+        {
+            uint32_t receivedCount = 0;
+            uint32_t emptyReceives = 0;
+            while (receivedCount < PacketsPerBurst && emptyReceives < MaxEmptyReceives)
+            {
+                uint32_t received = 0;
+                if (batched)
+                {
+                    UdpSocket::ReceiveSlot slots[PacketsPerBurst];
+                    for (uint32_t i = 0; i < PacketsPerBurst; ++i)
+                    {
+                        slots[i].m_data = m_receiveBuffers[i];
+                        slots[i].m_capacity = MaxUdpTransmissionUnit;
+                    }
+                    received = m_receiver->ReceiveBatch(slots, PacketsPerBurst - receivedCount);
+                }
+                else
+                {
+                    IpAddress address;
+                    received = (m_receiver->Receive(address, m_receiveBuffers[0], MaxUdpTransmissionUnit) > 0) ? 1 : 0;
+                }
+                receivedCount += received;
+                emptyReceives = (received > 0) ? 0 : emptyReceives + 1;
+            }
+            return receivedCount;
+        }
+
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        uint8_t m_sendBuffer[PacketSize] = {};
+        uint8_t m_receiveBuffers[PacketsPerBurst][MaxUdpTransmissionUnit];
+    };
+
+    BENCHMARK_DEFINE_F(UdpSocketBenchmark, LoopbackBurst)(benchmark::State& state)
+    {
+        const bool batched = state.range(0) != 0;
+        int64_t receivedPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SendBurst(batched);
+            receivedPackets += ReceiveBurst(batched);
+        }
+
+        // Rates are relative to the CPU time of the benchmark thread, so the inverted rate is the CPU time spent per packet
+        state.counters["PacketsPerSecond"] = benchmark::Counter(static_cast<double>(receivedPackets), benchmark::Counter::kIsRate);
+        state.counters["CpuSecondsPerPacket"] = benchmark::Counter(static_cast<double>(receivedPackets),
+            benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+        state.counters["LostPackets"] = static_cast<double>(state.iterations() * PacketsPerBurst - receivedPackets);
+    }
+
+    BENCHMARK_REGISTER_F(UdpSocketBenchmark, LoopbackBurst)
+        ->ArgName("Batched")
+        ->Arg(0)
+        ->Arg(1);
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
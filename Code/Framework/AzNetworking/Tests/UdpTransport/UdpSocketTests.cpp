@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    //! Exchanges datagrams between two sockets over loopback to verify the batched receive and send paths.
+    class UdpSocketTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint16_t SenderPort = 45133;
+        static constexpr uint16_t ReceiverPort = 45134;
+        // Bounds the number of empty reads while waiting for loopback datagrams so a lost datagram fails the test instead of stalling it
+        static constexpr uint32_t MaxEmptyReceives = 1024;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            SocketLayerInit();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            ASSERT_TRUE(m_sender->Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+            ASSERT_TRUE(m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+        }
+
+        void TearDown() override
+        {
+            m_dtlsEndpoint.reset();
+            m_receiver.reset();
+            m_sender.reset();
+            SocketLayerShutdown();
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Every datagram has a distinct size and content, so lost, reordered or truncated datagrams are detected
+        static uint32_t GetDatagramSize(uint32_t index)
+        {
+            return 16 + (index * 7) % 1000;
+        }
+
+        static uint8_t GetDatagramByte(uint32_t index, uint32_t offset)
+        {
+            return static_cast<uint8_t>(index * 31 + offset);
+        }
+
+        void SendDatagram(uint32_t index, const IpAddress& address)
+        {
+            uint8_t data[MaxUdpTransmissionUnit];
+            const uint32_t size = GetDatagramSize(index);
+            for (uint32_t offset = 0; offset < size; ++offset)
+            {
+                data[offset] = GetDatagramByte(index, offset);
+            }
+            EXPECT_EQ(static_cast<int32_t>(size), m_sender->Send(address, data, size, false, *m_dtlsEndpoint, m_connectionQuality));
+        }
+
+        void SendDatagram(uint32_t index)
+        {
+            SendDatagram(index, IpAddress(127, 0, 0, 1, ReceiverPort));
+        }
+
+        //! Receives datagrams with ReceiveBatch and checks they match the expected indices in order.
+        void ExpectReceived(const AZStd::vector<uint32_t>& expectedIndices)
+        {
+            constexpr uint32_t SlotCount = UdpSocket::MaxBatchedDatagrams;
+            UdpSocket::ReceiveSlot slots[SlotCount];
+            for (uint32_t i = 0; i < SlotCount; ++i)
+            {
+                slots[i].m_data = m_receiveBuffers[i];
+                slots[i].m_capacity = MaxUdpTransmissionUnit;
+            }
+
+            size_t receivedCount = 0;
+            uint32_t emptyReceives = 0;
+            while (receivedCount < expectedIndices.size() && emptyReceives < MaxEmptyReceives)
+            {
+                const uint32_t received = m_receiver->ReceiveBatch(slots, SlotCount);
+                ASSERT_LE(received, SlotCount);
+                for (uint32_t slotIndex = 0; slotIndex < received && receivedCount < expectedIndices.size(); ++slotIndex, ++receivedCount)
+                {
+                    const UdpSocket::ReceiveSlot& slot = slots[slotIndex];
+                    const uint32_t index = expectedIndices[receivedCount];
+                    EXPECT_EQ(SenderPort, slot.m_address.GetPort(ByteOrder::Host));
+                    ASSERT_EQ(static_cast<int32_t>(GetDatagramSize(index)), slot.m_receivedBytes);
+                    for (int32_t offset = 0; offset < slot.m_receivedBytes; ++offset)
+                    {
+                        ASSERT_EQ(GetDatagramByte(index, offset), slot.m_data[offset]);
+                    }
+                }
+                emptyReceives = (received > 0) ? 0 : emptyReceives + 1;
+            }
+            EXPECT_EQ(expectedIndices.size(), receivedCount);
+        }
+
+        static AZStd::vector<uint32_t> MakeIndices(uint32_t begin, uint32_t end)
+        {
+            AZStd::vector<uint32_t> indices;
+            for (uint32_t index = begin; index < end; ++index)
+            {
+                indices.push_back(index);
+            }
+            return indices;
+        }
+
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        uint8_t m_receiveBuffers[UdpSocket::MaxBatchedDatagrams][MaxUdpTransmissionUnit];
+    };
+
+    TEST_F(UdpSocketTests, ReceiveBatch_MoreDatagramsThanSlots_ReceivesAllInOrder)
+    {
+        constexpr uint32_t DatagramCount = UdpSocket::MaxBatchedDatagrams * 2 + 5;
+        for (uint32_t index = 0; index < DatagramCount; ++index)
+        {
+            SendDatagram(index);
+        }
+
+        ExpectReceived(MakeIndices(0, DatagramCount));
+        EXPECT_EQ(DatagramCount, m_receiver->GetRecvPackets());
+    }
+
+    TEST_F(UdpSocketTests, ReceiveBatch_NoPendingDatagrams_ReturnsZero)
+    {
+        UdpSocket::ReceiveSlot slot;
+        slot.m_data = m_receiveBuffers[0];
+        slot.m_capacity = MaxUdpTransmissionUnit;
+        EXPECT_EQ(0, m_receiver->ReceiveBatch(&slot, 1));
+    }
+
+    TEST_F(UdpSocketTests, SendBatch_FullBatch_FlushesBeforeTheBatchEnds)
+    {
+        constexpr uint32_t DatagramCount = UdpSocket::MaxBatchedDatagrams * 2 + 5;
+
+        m_sender->BeginSendBatch();
+        m_sender->BeginSendBatch(); // Nested batches only flush when the outermost one ends
+        for (uint32_t index = 0; index <= UdpSocket::MaxBatchedDatagrams; ++index)
+        {
+            SendDatagram(index);
+        }
+        m_sender->EndSendBatch();
+
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        // Adding a datagram to a full batch sends the batch, the datagram that didn't fit stays queued
+        ExpectReceived(MakeIndices(0, UdpSocket::MaxBatchedDatagrams));
+#endif
+
+        for (uint32_t index = UdpSocket::MaxBatchedDatagrams + 1; index < DatagramCount; ++index)
+        {
+            SendDatagram(index);
+        }
+        m_sender->EndSendBatch();
+
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        ExpectReceived(MakeIndices(UdpSocket::MaxBatchedDatagrams, DatagramCount));
+#else
+        ExpectReceived(MakeIndices(0, DatagramCount));
+#endif
+        EXPECT_EQ(DatagramCount, m_sender->GetSentPackets());
+        EXPECT_EQ(0, m_sender->GetSendFailedPackets());
+    }
+
+    TEST_F(UdpSocketTests, SendBatch_RejectedDatagram_IsCountedAndTheRestIsSent)
+    {
+#if AZ_TRAIT_USE_UDP_BATCHED_IO
+        // The socket doesn't enable broadcasts, so the operating system rejects the datagram in the middle of the batch after
+        // the ones before it were sent. The batch has to resume after the rejected datagram instead of dropping the rest.
+        const IpAddress broadcastAddress(255, 255, 255, 255, ReceiverPort);
+
+        m_sender->BeginSendBatch();
+        for (uint32_t index = 0; index < 3; ++index)
+        {
+            SendDatagram(index);
+        }
+        SendDatagram(3, broadcastAddress);
+        for (uint32_t index = 4; index < 8; ++index)
+        {
+            SendDatagram(index);
+        }
+        m_sender->EndSendBatch();
+
+        ExpectReceived({ 0, 1, 2, 4, 5, 6, 7 });
+        EXPECT_EQ(1, m_sender->GetSendFailedPackets());
+#else
+        GTEST_SKIP() << "Batched sends are not supported on this platform";
+#endif
+    }
+} // namespace UnitTest
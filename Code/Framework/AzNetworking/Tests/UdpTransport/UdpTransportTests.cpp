@@ -9,15 +9,24 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#if AZ_TRAIT_USE_UDP_REUSE_PORT
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(uint32_t, net_UdpReaderShards);
+}
+#endif
+
 namespace UnitTest
 {
     using namespace AzNetworking;
@@ -101,6 +110,31 @@ namespace UnitTest
     {
     public:
 
+        //! Ticks the network interfaces until the server has the expected number of connections and every client is connected.
+        bool WaitForConnections(const TestUdpServer& testServer, uint32_t serverConnectionCount, const TestUdpClient* testClients, uint32_t clientCount)
+        {
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnSystemTick();
+                bool connected = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() >= serverConnectionCount;
+                for (uint32_t i = 0; i < clientCount; ++i)
+                {
+                    connected &= testClients[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+                }
+                if (connected)
+                {
+                    return true;
+                }
+                if (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs)
+                {
+                    return false;
+                }
+            }
+        }
+
         void SetUp() override
         {
             AZ::NameDictionary::Create();
@@ -320,4 +354,68 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+#if AZ_TRAIT_USE_UDP_REUSE_PORT
+    //! Sets the number of reader shards used by listening network interfaces, and restores the default when it goes out of scope.
+    class ScopedUdpReaderShards
+    {
+    public:
+        explicit ScopedUdpReaderShards(uint32_t shardCount)
+        {
+            net_UdpReaderShards = shardCount;
+        }
+
+        ~ScopedUdpReaderShards()
+        {
+            net_UdpReaderShards = 1;
+        }
+    };
+
+    TEST_F(UdpTransportTests, TestMultipleClientsShardedReaders)
+    {
+        constexpr uint32_t NumReaderShards = 4;
+        constexpr uint32_t NumTestClients = 50;
+        ScopedUdpReaderShards readerShards(NumReaderShards);
+
+        TestUdpServer testServer;
+        EXPECT_EQ(dynamic_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface)->GetReaderShardCount(), NumReaderShards);
+
+        // The kernel spreads the clients over the shard sockets by their address, every handshake has to reach the server
+        TestUdpClient testClient[NumTestClients];
+        EXPECT_TRUE(WaitForConnections(testServer, NumTestClients, testClient, NumTestClients));
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+    }
+
+    TEST_F(UdpTransportTests, TestShardedReadersListenAgainAfterStopListening)
+    {
+        constexpr uint32_t NumReaderShards = 4;
+        constexpr uint32_t NumTestClients = 10;
+        ScopedUdpReaderShards readerShards(NumReaderShards);
+
+        TestUdpServer testServer;
+        UdpNetworkInterface* serverNetworkInterface = dynamic_cast<UdpNetworkInterface*>(testServer.m_serverNetworkInterface);
+        {
+            TestUdpClient testClient[NumTestClients];
+            EXPECT_TRUE(WaitForConnections(testServer, NumTestClients, testClient, NumTestClients));
+        }
+
+        // Stopping joins the shard threads and closes every shard socket, so the port can be bound again without SO_REUSEPORT
+        EXPECT_TRUE(serverNetworkInterface->StopListening());
+        EXPECT_EQ(serverNetworkInterface->GetReaderShardCount(), 0);
+        {
+            UdpSocket exclusiveSocket;
+            EXPECT_TRUE(exclusiveSocket.Open(12345, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+            exclusiveSocket.Close();
+        }
+
+        // Listening again starts a new set of shards on the same port, which receive the handshakes of new clients
+        EXPECT_TRUE(serverNetworkInterface->Listen(12345));
+        EXPECT_EQ(serverNetworkInterface->GetReaderShardCount(), NumReaderShards);
+        TestUdpClient testClient[NumTestClients];
+        EXPECT_TRUE(WaitForConnections(testServer, NumTestClients, testClient, NumTestClients));
+
+        EXPECT_TRUE(serverNetworkInterface->StopListening());
+        EXPECT_EQ(serverNetworkInterface->GetReaderShardCount(), 0);
+    }
+#endif
 }
@@ -22,6 +22,9 @@ set(FILES
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpReaderShardTests.cpp
+    UdpTransport/UdpSocketBenchmarks.cpp
+    UdpTransport/UdpSocketTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
@@ -81,6 +81,25 @@ namespace Archive
         //! Configures the maximum number of read task that can run in parallel
         //! For a value of 0 maps to a single read task
         AZ::u32 m_maxReadTasks{ 1 };
+
+        //! Memory maps the archive when it is mounted from a file path
+        //! When the archive is mapped, the table of contents is viewed directly within the mapping,
+        //! uncompressed files can be viewed in place using IArchiveReader::ViewFileInArchive
+        //! and compressed blocks are decompressed straight from the mapping into the caller's buffer
+        //! If the archive cannot be mapped, the reader falls back to reading through the file stream
+        //! NOTE: Archives mounted from an ArchiveStreamPtr are never memory mapped
+        bool m_useMemoryMapping{ false };
+
+        //! Makes the files of the archive readable through AZ::IO::Streamer when it is mounted from a file path
+        //! The reader answers AZ::IO::CompressionBus lookups for paths made of m_streamerMountPoint
+        //! followed by the relative path of a file within the archive
+        //! Compressed files are described by their 2 MiB blocks, so Streamer only reads and decompresses
+        //! the blocks that overlap a request and decompresses them in parallel
+        //! NOTE: Archives mounted from an ArchiveStreamPtr are never made available to Streamer
+        bool m_mountForStreamer{ false };
+        //! Path that Streamer requests have to start with to be looked up in the archive
+        //! When empty, Streamer request paths are looked up in the archive as is
+        AZ::IO::Path m_streamerMountPoint;
     };
 
     //! Settings for controlling how an individual file is extracted from an archive.
@@ -144,6 +163,38 @@ namespace Archive
         ResultOutcome m_resultOutcome;
     };
 
+    //! Returns result data around viewing a file's content in place
+    //! within a memory mapped archive
+    struct ArchiveViewFileResult
+    {
+        //! returns if viewing the file within the archive has succeeded
+        //! it does by checking that the ArchiveFileToken != InvalidArchiveFileToken
+        explicit operator bool() const;
+
+        //! The file path of the viewed file
+        AZ::IO::Path m_relativeFilePath;
+        //! Identifier token that allows for quicker lookup of the file in the mounted
+        //! archive TOC for the ArchiveReader instance the file was viewed from
+        ArchiveFileToken m_filePathToken{ InvalidArchiveFileToken };
+        //! The compression algorithm ID representing the compression algorithm used to store the file
+        Compression::CompressionAlgorithmId m_compressionAlgorithm{ Compression::Uncompressed };
+        //! The uncompressed size of the viewed file
+        AZ::u64 m_uncompressedSize{};
+        //! the compressed size of the viewed file
+        AZ::u64 m_compressedSize{};
+        //! The raw offset of the file in the archive
+        ArchiveHeader::TocOffsetU64 m_offset{};
+        //! CRC32 checksum of the uncompressed file data
+        AZ::Crc32 m_crc32{};
+        //! Read-only span which views the file data directly within the archive mapping
+        //! The view is valid until the archive is unmounted
+        //! If the file is compressed, the view contains the raw compressed content
+        AZStd::span<const AZStd::byte> m_fileView;
+
+        //! Stores any error messages related to viewing the file within the archive
+        ResultOutcome m_resultOutcome;
+    };
+
     //! Returns a result structure that indicates if removal of a content file from the
     //! archive was successful
     //! Metadata about the file is returned, such as its file path, compressed algorithm ID
@@ -248,6 +299,22 @@ namespace Archive
         virtual ArchiveExtractFileResult ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
             const ArchiveReaderFileSettings& fileSettings) = 0;
 
+        //! Returns a view of the content of the file specified in the ArchiveReaderFileSettings
+        //! directly within the memory mapped archive, without copying it
+        //! This is only available when the archive is memory mapped(see ArchiveReaderSettings::m_useMemoryMapping)
+        //! Compressed files can only be viewed in their compressed form,
+        //! so the `m_decompressFile` setting must be false to view them
+        //!
+        //! @param fileSettings settings which specify the file to view, the start offset within the file
+        //! and how many bytes to view from that offset
+        //! @return ArchiveViewFileResult structure which on success contains a read-only
+        //! view of the file data within the mapped archive
+        //! On failure, the result outcome member contains the error that occurred
+        virtual ArchiveViewFileResult ViewFileInArchive(const ArchiveReaderFileSettings& fileSettings) const = 0;
+
+        //! Returns true if the mounted archive is memory mapped
+        virtual bool IsMemoryMapped() const = 0;
+
         //! List the file metadata from the archive using the ArchiveFileToken
         //! @param filePathToken identifier token that can be used to quickly lookup
         //! metadata about the file
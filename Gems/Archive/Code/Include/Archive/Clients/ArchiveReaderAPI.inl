@@ -30,6 +30,12 @@ namespace Archive
             && m_resultOutcome.has_value();
     }
 
+    inline ArchiveViewFileResult::operator bool() const
+    {
+        return m_filePathToken != InvalidArchiveFileToken
+            && m_resultOutcome.has_value();
+    }
+
     // As for the case with ther ArchiveExtractFileResult
     // a valid file path token is used to indicate success of the result
     inline ArchiveListFileResult::operator bool() const
@@ -10,4 +10,5 @@
 #      ../Include/Android/ArchiveAndroid.h
 
 set(FILES
+    ../Common/UnixLike/Clients/ArchiveFileMapping_UnixLike.cpp
 )
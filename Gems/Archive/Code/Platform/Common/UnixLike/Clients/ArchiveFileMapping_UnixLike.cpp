@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Clients/ArchiveFileMapping.h>
+
+#include <AzCore/IO/Path/Path.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Archive
+{
+    AZStd::span<const AZStd::byte> ArchiveFileMapping::MapFileImpl(AZ::IO::PathView filePath)
+    {
+        AZ::IO::FixedMaxPath mapPath{ filePath };
+        int fileDescriptor = open(mapPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            return {};
+        }
+
+        AZStd::span<const AZStd::byte> mappedSpan;
+        if (struct stat fileStat; fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            const auto fileSize = static_cast<size_t>(fileStat.st_size);
+            if (void* mappedAddress = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                mappedAddress != MAP_FAILED)
+            {
+                mappedSpan = AZStd::span(static_cast<const AZStd::byte*>(mappedAddress), fileSize);
+            }
+        }
+
+        // The mapping keeps its own reference to the file, so the descriptor can be closed right away
+        close(fileDescriptor);
+        return mappedSpan;
+    }
+
+    void ArchiveFileMapping::UnmapFileImpl(AZStd::span<const AZStd::byte> mappedSpan)
+    {
+        munmap(const_cast<AZStd::byte*>(mappedSpan.data()), mappedSpan.size());
+    }
+} // namespace Archive
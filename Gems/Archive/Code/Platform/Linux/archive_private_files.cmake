@@ -10,4 +10,5 @@
 #      ../Include/Linux/ArchiveLinux.h
 
 set(FILES
+    ../Common/UnixLike/Clients/ArchiveFileMapping_UnixLike.cpp
 )
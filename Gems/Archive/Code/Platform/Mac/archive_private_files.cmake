@@ -10,4 +10,5 @@
 #      ../Include/Mac/ArchiveMac.h
 
 set(FILES
+    ../Common/UnixLike/Clients/ArchiveFileMapping_UnixLike.cpp
 )
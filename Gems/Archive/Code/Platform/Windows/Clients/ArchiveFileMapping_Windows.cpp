@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Clients/ArchiveFileMapping.h>
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace Archive
+{
+    AZStd::span<const AZStd::byte> ArchiveFileMapping::MapFileImpl(AZ::IO::PathView filePath)
+    {
+        AZStd::fixed_wstring<AZ::IO::MaxPathLength> mapPathW;
+        AZStd::to_wstring(mapPathW, filePath.Native());
+        HANDLE fileHandle = CreateFileW(mapPathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return {};
+        }
+
+        AZStd::span<const AZStd::byte> mappedSpan;
+        if (LARGE_INTEGER fileSize; GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+        {
+            if (HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                mappingHandle != nullptr)
+            {
+                if (void* mappedAddress = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+                    mappedAddress != nullptr)
+                {
+                    mappedSpan = AZStd::span(static_cast<const AZStd::byte*>(mappedAddress),
+                        static_cast<size_t>(fileSize.QuadPart));
+                }
+
+                // The mapped view keeps the file mapping object alive, so its handle can be closed right away
+                CloseHandle(mappingHandle);
+            }
+        }
+
+        CloseHandle(fileHandle);
+        return mappedSpan;
+    }
+
+    void ArchiveFileMapping::UnmapFileImpl(AZStd::span<const AZStd::byte> mappedSpan)
+    {
+        UnmapViewOfFile(mappedSpan.data());
+    }
+} // namespace Archive
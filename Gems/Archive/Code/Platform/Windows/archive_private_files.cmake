@@ -10,4 +10,5 @@
 #      ../Include/Windows/ArchiveWindows.h
 
 set(FILES
+    Clients/ArchiveFileMapping_Windows.cpp
 )
@@ -10,4 +10,5 @@
 #      ../Include/iOS/ArchiveiOS.h
 
 set(FILES
+    ../Common/UnixLike/Clients/ArchiveFileMapping_UnixLike.cpp
 )
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ArchiveFileMapping.h"
+
+#include <AzCore/IO/Path/Path.h>
+
+namespace Archive
+{
+    ArchiveFileMapping::ArchiveFileMapping() = default;
+
+    ArchiveFileMapping::~ArchiveFileMapping()
+    {
+        Unmap();
+    }
+
+    bool ArchiveFileMapping::Map(AZ::IO::PathView filePath)
+    {
+        Unmap();
+        m_mappedSpan = MapFileImpl(filePath);
+        return IsMapped();
+    }
+
+    void ArchiveFileMapping::Unmap()
+    {
+        if (IsMapped())
+        {
+            UnmapFileImpl(m_mappedSpan);
+            m_mappedSpan = {};
+        }
+    }
+
+    bool ArchiveFileMapping::IsMapped() const
+    {
+        return !m_mappedSpan.empty();
+    }
+
+    AZStd::span<const AZStd::byte> ArchiveFileMapping::GetMappedSpan() const
+    {
+        return m_mappedSpan;
+    }
+} // namespace Archive
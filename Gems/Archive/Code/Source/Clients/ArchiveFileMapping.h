@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/containers/span.h>
+
+namespace Archive
+{
+    //! Read-only memory mapping of an entire archive file
+    //! The ArchiveReader uses the mapping to view the table of contents and file data
+    //! directly in the mapped pages instead of copying it through an AZ::IO::GenericStream
+    class ArchiveFileMapping
+    {
+    public:
+        ArchiveFileMapping();
+        ~ArchiveFileMapping();
+
+        ArchiveFileMapping(const ArchiveFileMapping&) = delete;
+        ArchiveFileMapping& operator=(const ArchiveFileMapping&) = delete;
+
+        //! Maps the file at the specified path into memory for reading
+        //! Any previously mapped file is unmapped first
+        //! @param filePath path to the file to map
+        //! @return true if the file was mapped. Empty files are never mapped
+        bool Map(AZ::IO::PathView filePath);
+
+        //! Unmaps the currently mapped file
+        //! Any span previously returned from GetMappedSpan() is invalidated
+        void Unmap();
+
+        //! Returns true if a file is currently mapped
+        bool IsMapped() const;
+
+        //! Returns a read-only view over the entire mapped file
+        //! The view is empty if there is no file mapped
+        AZStd::span<const AZStd::byte> GetMappedSpan() const;
+
+    private:
+        //! Platform specific implementation of Map and Unmap
+        //! The functions are implemented in the Platform folder for each supported platform
+        AZStd::span<const AZStd::byte> MapFileImpl(AZ::IO::PathView filePath);
+        void UnmapFileImpl(AZStd::span<const AZStd::byte> mappedSpan);
+
+        AZStd::span<const AZStd::byte> m_mappedSpan;
+    };
+} // namespace Archive
@@ -12,10 +12,12 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/OpenMode.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Task/TaskGraph.h>
 
 #include <Archive/ArchiveTypeIds.h>
 
+#include <Compression/CompressedBlocks.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 
 namespace Archive
@@ -101,10 +103,30 @@ namespace Archive
         }
 
         // Buffer which stores the raw table of contents data from the archive file
+        // It is left empty if the uncompressed table of contents can be viewed within the archive mapping
         AZStd::vector<AZStd::byte> tocBuffer;
+        // View of the table of contents data as stored in the archive
+        AZStd::span<const AZStd::byte> storedTocSpan;
 
-        // Seek to the location of the Table of Contents
+        if (m_archiveMapping.IsMapped())
         {
+            // The Table of Contents is viewed directly within the mapping
+            if (auto mappedTocOutcome = ViewMappedRange(archiveHeader.m_tocOffset, archiveHeader.GetTocStoredSize());
+                mappedTocOutcome)
+            {
+                storedTocSpan = mappedTocOutcome.value();
+            }
+            else
+            {
+                m_settings.m_errorCallback({ ArchiveReaderErrorCode::ErrorReadingTableOfContents,
+                    ArchiveReaderErrorString::format("Unable to view the TOC within the archive mapping: %s",
+                        mappedTocOutcome.error().c_str()) });
+                return false;
+            }
+        }
+        else
+        {
+            // Seek to the location of the Table of Contents
             AZStd::scoped_lock archiveLock(m_archiveStreamMutex);
             // Make sure the archive offset is reset to 0 on return
             SeekStreamToBeginRAII seekToBeginScope{ archiveStream };
@@ -120,8 +142,13 @@ namespace Archive
                         tocBuffer.size(), bytesRead) });
                 return false;
             }
+
+            storedTocSpan = tocBuffer;
         }
 
+        // View of the uncompressed table of contents data
+        AZStd::span<const AZStd::byte> tocSpan = storedTocSpan;
+
         // Check if the archive table of contents is compressed
         if (archiveHeader.m_tocCompressionAlgoIndex < UncompressedAlgorithmIndex)
         {
@@ -156,12 +183,13 @@ namespace Archive
 
             // Run the compressed toc data through the decompressor
             if (Compression::DecompressionResultData decompressionResultData =
-                decompressionInterface->DecompressBlock(uncompressedTocBuffer, tocBuffer, Compression::DecompressionOptions{});
+                decompressionInterface->DecompressBlock(uncompressedTocBuffer, storedTocSpan, Compression::DecompressionOptions{});
                 decompressionResultData)
             {
 
                 // If decompression succeed, move the uncompressed buffer to the tocBuffer variable
                 tocBuffer = AZStd::move(uncompressedTocBuffer);
+                tocSpan = tocBuffer;
                 if (decompressionResultData.GetUncompressedByteCount() != tocBuffer.size())
                 {
                     // The size of uncompressed size of the data does not match the total uncompressed
@@ -177,7 +205,8 @@ namespace Archive
 
         // Wrap the table of contents in an reader structure that encapsulates the raw tocBuffer data on disk
         // and a view into the Table of Contents memory
-        if (auto tocView = ArchiveTableOfContentsView::CreateFromArchiveHeaderAndBuffer(archiveHeader, tocBuffer);
+        // For an uncompressed TOC in a memory mapped archive, the view points into the mapping instead
+        if (auto tocView = ArchiveTableOfContentsView::CreateFromArchiveHeaderAndBuffer(archiveHeader, tocSpan);
             tocView)
         {
             archiveToc = ArchiveTableOfContentsReader{ AZStd::move(tocBuffer), AZStd::move(tocView).value() };
@@ -227,6 +256,13 @@ namespace Archive
             return false;
         }
 
+        // Map the archive when requested so that the TOC and file data can be viewed directly within the mapping
+        // If mapping fails, the archive is still read through the file stream
+        if (m_settings.m_useMemoryMapping)
+        {
+            m_archiveMapping.Map(mountPath);
+        }
+
         // If the Archive header and TOC could not be read
         // then unmount the archive and return false
         if (!ReadArchiveHeaderAndToc())
@@ -236,6 +272,13 @@ namespace Archive
             UnmountArchive();
             return false;
         }
+
+        // Streamer opens the archive by path, so only archives mounted from a file path can be made available to it
+        m_archivePath = mountPath;
+        if (m_settings.m_mountForStreamer)
+        {
+            m_streamerHandler.BusConnect();
+        }
         return true;
     }
 
@@ -277,6 +320,12 @@ namespace Archive
 
     void ArchiveReader::UnmountArchive()
     {
+        // Disconnecting waits for any Streamer lookup in progress,
+        // so the TOC can be cleared afterwards
+        m_streamerHandler.BusDisconnect();
+        m_streamerBlockLayouts.clear();
+        m_archivePath.clear();
+
         if (m_archiveStream != nullptr && m_archiveStream->IsOpen())
         {
             // Clear the path mount on unmount as it has pointers
@@ -288,6 +337,8 @@ namespace Archive
             m_archiveHeader = {};
         }
 
+        // The TOC view and path map no longer point into the mapping, so it can be unmapped
+        m_archiveMapping.Unmap();
         m_archiveStream.reset();
     }
 
@@ -296,24 +347,49 @@ namespace Archive
         return m_archiveStream != nullptr && m_archiveStream->IsOpen();
     }
 
-    ArchiveExtractFileResult ArchiveReader::ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
-        const ArchiveReaderFileSettings& fileSettings)
+    bool ArchiveReader::IsMemoryMapped() const
+    {
+        return m_archiveMapping.IsMapped();
+    }
+
+    ArchiveListFileResult ArchiveReader::ListFileFromSettings(const ArchiveReaderFileSettings& fileSettings) const
     {
-        ArchiveListFileResult listResult;
         if (auto filePathString = AZStd::get_if<AZ::IO::PathView>(&fileSettings.m_filePathIdentifier);
             filePathString != nullptr)
         {
-            listResult = ListFileInArchive(*filePathString);
+            return ListFileInArchive(*filePathString);
         }
-        else
+
+        // The only remaining alternative is the ArchiveFileToken
+        // so use AZStd::get is used on a reference to the variant
+        // Make sure the filePathToken points to file within the TOC
+        const ArchiveFileToken archiveFileToken = AZStd::get<ArchiveFileToken>(fileSettings.m_filePathIdentifier);
+        return ListFileInArchive(archiveFileToken);
+    }
+
+    auto ArchiveReader::ViewMappedRange(AZ::u64 offset, AZ::u64 size) const -> ViewMappedRangeOutcome
+    {
+        AZStd::span<const AZStd::byte> mappedSpan = m_archiveMapping.GetMappedSpan();
+        if (mappedSpan.empty())
+        {
+            return AZStd::unexpected(ResultString("The archive is not memory mapped"));
+        }
+
+        // Validate the range using subtraction to avoid overflowing offset + size
+        if (offset > mappedSpan.size() || size > mappedSpan.size() - offset)
         {
-            // The only remaining alternative is the ArchiveFileToken
-            // so use AZStd::get is used on a reference to the variant
-            // Make sure the filePathToken points to file within the TOC
-            const ArchiveFileToken archiveFileToken = AZStd::get<ArchiveFileToken>(fileSettings.m_filePathIdentifier);
-            listResult = ListFileInArchive(archiveFileToken);
+            return AZStd::unexpected(ResultString::format("The range [%llu, %llu + %llu) is outside of the"
+                " memory mapped archive of size %zu", offset, offset, size, mappedSpan.size()));
         }
 
+        return mappedSpan.subspan(offset, size);
+    }
+
+    ArchiveExtractFileResult ArchiveReader::ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
+        const ArchiveReaderFileSettings& fileSettings)
+    {
+        ArchiveListFileResult listResult = ListFileFromSettings(fileSettings);
+
         // Copy the result of listing the file in the archive to the extract result structure
         ArchiveExtractFileResult extractResult;
         extractResult.m_relativeFilePath = listResult.m_relativeFilePath;
@@ -386,6 +462,55 @@ namespace Archive
         return extractResult;
     }
 
+    ArchiveViewFileResult ArchiveReader::ViewFileInArchive(const ArchiveReaderFileSettings& fileSettings) const
+    {
+        ArchiveListFileResult listResult = ListFileFromSettings(fileSettings);
+
+        // Copy the result of listing the file in the archive to the view result structure
+        ArchiveViewFileResult viewResult;
+        viewResult.m_relativeFilePath = listResult.m_relativeFilePath;
+        viewResult.m_filePathToken = listResult.m_filePathToken;
+        viewResult.m_compressionAlgorithm = listResult.m_compressionAlgorithm;
+        viewResult.m_uncompressedSize = listResult.m_uncompressedSize;
+        viewResult.m_compressedSize = listResult.m_compressedSize;
+        viewResult.m_offset = listResult.m_offset;
+        viewResult.m_crc32 = listResult.m_crc32;
+        viewResult.m_resultOutcome = listResult.m_resultOutcome;
+
+        if (!viewResult)
+        {
+            return viewResult;
+        }
+
+        const bool isFileCompressed = viewResult.m_compressionAlgorithm != Compression::Uncompressed
+            && viewResult.m_compressionAlgorithm != Compression::Invalid;
+        if (isFileCompressed && fileSettings.m_decompressFile)
+        {
+            // Decompressed content does not exist within the archive, so it cannot be viewed
+            viewResult.m_resultOutcome = AZStd::unexpected(ResultString::format("File %s is compressed and can only be"
+                " viewed in its compressed form. Set the m_decompressFile setting to false to view it or"
+                " use ExtractFileFromArchive to decompress it.", viewResult.m_relativeFilePath.c_str()));
+            return viewResult;
+        }
+
+        // Clamp the view to the range of [startOffset, startOffset + bytesToRead) within the file
+        const AZ::u64 fileSize = isFileCompressed ? viewResult.m_compressedSize : viewResult.m_uncompressedSize;
+        const AZ::u64 startOffset = AZStd::min(fileSettings.m_startOffset, fileSize);
+        const AZ::u64 bytesToView = AZStd::min(fileSize - startOffset, fileSettings.m_bytesToRead);
+
+        if (ViewMappedRangeOutcome viewOutcome = ViewMappedRange(viewResult.m_offset + startOffset, bytesToView);
+            viewOutcome)
+        {
+            viewResult.m_fileView = viewOutcome.value();
+        }
+        else
+        {
+            viewResult.m_resultOutcome = AZStd::unexpected(AZStd::move(viewOutcome.error()));
+        }
+
+        return viewResult;
+    }
+
     auto ArchiveReader::ReadRawFileIntoBuffer(AZStd::span<AZStd::byte> fileBuffer, AZ::u64 offset,
         AZ::u64 fileSize,
         const ArchiveReaderFileSettings& fileSettings)
@@ -406,6 +531,19 @@ namespace Archive
                 " Buffer size is %zu, while %llu is required.", readOffset, fileBuffer.size(), bytesToRead));
         }
 
+        if (m_archiveMapping.IsMapped())
+        {
+            // Copy directly out of the mapping, which doesn't require locking the archive stream
+            ViewMappedRangeOutcome viewOutcome = ViewMappedRange(readOffset, bytesToRead);
+            if (!viewOutcome)
+            {
+                return AZStd::unexpected(AZStd::move(viewOutcome.error()));
+            }
+
+            ::memcpy(fileBuffer.data(), viewOutcome.value().data(), bytesToRead);
+            return fileBuffer.first(bytesToRead);
+        }
+
         AZStd::scoped_lock archiveReadLock(m_archiveStreamMutex);
         if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(bytesToRead, fileBuffer.data(), readOffset);
             bytesRead < bytesToRead)
@@ -553,15 +691,39 @@ namespace Archive
             }
         }
 
-        // Stores the list of compressed blocks to decompress
+        // Stores a view of each compressed block to decompress
+        // When the archive is memory mapped, the views point directly into the mapping
+        // Otherwise the compressed blocks are read into the compressedBlocks buffer
+        AZStd::vector<AZStd::span<const AZStd::byte>> compressedBlockSpans;
+        compressedBlockSpans.reserve(blockRange.second - blockRange.first);
+
+        const bool isArchiveMapped = m_archiveMapping.IsMapped();
         AZStd::vector<AZStd::byte> compressedBlocks;
-        compressedBlocks.resize_no_construct((blockRange.second - blockRange.first) * ArchiveBlockSizeForCompression);
+        if (!isArchiveMapped)
+        {
+            compressedBlocks.resize_no_construct((blockRange.second - blockRange.first) * ArchiveBlockSizeForCompression);
+        }
         AZStd::span<AZStd::byte> compressedBlockRemainingSpan = compressedBlocks;
 
         AZ::IO::SizeType fileRelativeSeekOffset = alignedFirstSeekOffset;
         for (AZ::u64 blockIndex = blockRange.first; blockIndex != blockRange.second; ++blockIndex)
         {
             const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
+            const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
+            if (isArchiveMapped)
+            {
+                ViewMappedRangeOutcome viewOutcome = ViewMappedRange(absoluteSeekOffset, blockCompressedSize);
+                if (!viewOutcome)
+                {
+                    return AZStd::unexpected(ResultString::format("Cannot view compressed block %llu within the"
+                        " memory mapped archive. %s", blockIndex, viewOutcome.error().c_str()));
+                }
+
+                compressedBlockSpans.push_back(viewOutcome.value());
+                fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
+                continue;
+            }
+
             // Get the next 2 MiB block (or less if in the final block) of memory to store the compressed block data
             const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
                 ArchiveBlockSizeForCompression);
@@ -569,7 +731,6 @@ namespace Archive
                 availableBytesInCompressedBlock);
             // Slide the compressed block remaining span view ahead by the 2 MiB that is being used for the read span
             compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
-            const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
             if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(blockCompressedSize,
                 compressedBlockToReadInto.data(), absoluteSeekOffset);
                 bytesRead != blockCompressedSize)
@@ -579,13 +740,13 @@ namespace Archive
                     blockIndex, blockCompressedSize, bytesRead));
             }
 
+            compressedBlockSpans.push_back(compressedBlockToReadInto.first(blockCompressedSize));
+
             // As the read was successful add the aligned compressed size to the fileRelativeSeekOffset
             // The value is the read offset where the next block data starts
             fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
         }
 
-        // Reset the compressed block remaining to the start of the compressedBlocks vector
-        compressedBlockRemainingSpan = compressedBlocks;
         // The span below is used to slide a 2 MiB window for storing decompressed file contents
         AZStd::span<AZStd::byte> decompressionRemainingSpan = decompressionResultSpan;
 
@@ -617,15 +778,8 @@ namespace Archive
             for (AZ::u32 decompressTaskSlot = 0; decompressTaskSlot < decompressTaskCount; ++decompressTaskSlot,
                 ++blockIndex)
             {
-                const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
-                // Downsize the 2 MiB span that was used to read the compressed data to the exact compressed size
-                const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
-                    ArchiveBlockSizeForCompression);
-                AZStd::span<const AZStd::byte> compressedDataForBlock = compressedBlockRemainingSpan
-                    .first(availableBytesInCompressedBlock)
-                    .first(blockCompressedSize);
-                // Slide the compressed block remaining span by 2 MiB
-                compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
+                // The view of the compressed data is exactly the compressed size of the block
+                AZStd::span<const AZStd::byte> compressedDataForBlock = compressedBlockSpans[blockIndex - blockRange.first];
 
                 // Get the block span for storing the decompressed block
                 // As the uncompressed size is 2 MiB for all blocks except the last
@@ -676,6 +830,133 @@ namespace Archive
         return decompressionResultSpan.subspan(startOffset, endOffset);
     }
 
+    ArchiveReader::StreamerCompressionHandler::StreamerCompressionHandler(ArchiveReader& archiveReader)
+        : m_archiveReader(archiveReader)
+    {}
+
+    void ArchiveReader::StreamerCompressionHandler::FindCompressionInfo(bool& found, AZ::IO::CompressionInfo& info,
+        const AZ::IO::PathView filePath)
+    {
+        m_archiveReader.FindStreamerCompressionInfo(found, info, filePath);
+    }
+
+    void ArchiveReader::FindStreamerCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, AZ::IO::PathView filePath)
+    {
+        if (found)
+        {
+            return;
+        }
+
+        // Convert the Streamer request path into a path relative to the root of the archive
+        AZ::IO::PathView relativePath = filePath;
+        AZ::IO::FixedMaxPath mountRelativePath;
+        if (!m_settings.m_streamerMountPoint.empty())
+        {
+            if (!filePath.IsRelativeTo(m_settings.m_streamerMountPoint))
+            {
+                return;
+            }
+            mountRelativePath = filePath.LexicallyRelative(m_settings.m_streamerMountPoint);
+            relativePath = mountRelativePath;
+        }
+
+        // Files that aren't in the archive are left for other handlers to find
+        if (relativePath.empty() || m_pathMap.find(relativePath) == m_pathMap.end())
+        {
+            return;
+        }
+
+        const ArchiveListFileResult listFileResult = ListFileInArchive(relativePath);
+        if (!listFileResult)
+        {
+            return;
+        }
+
+        const bool isFileCompressed = listFileResult.m_compressionAlgorithm != Compression::Uncompressed
+            && listFileResult.m_compressionAlgorithm != Compression::Invalid;
+        if (isFileCompressed)
+        {
+            auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+            Compression::IDecompressionInterface* decompressionInterface = decompressionRegistrar != nullptr
+                ? decompressionRegistrar->FindDecompressionInterface(listFileResult.m_compressionAlgorithm)
+                : nullptr;
+            if (decompressionInterface == nullptr)
+            {
+                AZ_Warning("Archive", false, R"(File "%.*s" in archive "%s" can't be streamed as its compression algorithm %u)"
+                    " is not registered with the decompression registrar.", AZ_PATH_ARG(relativePath), m_archivePath.c_str(),
+                    static_cast<AZ::u32>(listFileResult.m_compressionAlgorithm));
+                return;
+            }
+
+            AZStd::shared_ptr<const AZ::IO::CompressedBlockLayout> blockLayout = GetCompressedBlockLayout(listFileResult);
+            if (blockLayout == nullptr)
+            {
+                return;
+            }
+
+            // The compressed file spans from the start of its first block to the end of its last block
+            const AZStd::vector<size_t>& compressedBlockSizes = blockLayout->m_compressedBlockSizes;
+            size_t compressedSize = compressedBlockSizes.empty() ? 0 : compressedBlockSizes.back();
+            for (size_t blockIndex = 0; blockIndex + 1 < compressedBlockSizes.size(); ++blockIndex)
+            {
+                compressedSize += AZ_SIZE_ALIGN_UP(compressedBlockSizes[blockIndex], ArchiveDefaultBlockAlignment);
+            }
+
+            info.m_decompressor = Compression::CreateBlockDecompressor(*decompressionInterface);
+            info.m_blockLayout = AZStd::move(blockLayout);
+            info.m_compressedSize = compressedSize;
+        }
+        else
+        {
+            info.m_compressedSize = listFileResult.m_uncompressedSize;
+        }
+
+        found = true;
+        info.m_archiveFilename = m_archivePath;
+        info.m_offset = static_cast<AZ::u64>(listFileResult.m_offset);
+        info.m_uncompressedSize = listFileResult.m_uncompressedSize;
+        info.m_isCompressed = isFileCompressed;
+        // The archive is kept open by this reader, so Streamer has to share it
+        info.m_isSharedPak = true;
+        info.m_conflictResolution = AZ::IO::ConflictResolution::PreferArchive;
+    }
+
+    auto ArchiveReader::GetCompressedBlockLayout(const ArchiveListFileResult& listFileResult)
+        -> AZStd::shared_ptr<const AZ::IO::CompressedBlockLayout>
+    {
+        // The file path token doubles as the index into the table of contents FileMetadataTable
+        const auto fileMetadataTableIndex = static_cast<size_t>(listFileResult.m_filePathToken);
+        if (auto layoutIt = m_streamerBlockLayouts.find(fileMetadataTableIndex); layoutIt != m_streamerBlockLayouts.end())
+        {
+            return layoutIt->second;
+        }
+
+        auto blockLineSpanOutcome = GetBlockLineSpanForFile(m_archiveToc.m_tocView, fileMetadataTableIndex);
+        if (!blockLineSpanOutcome)
+        {
+            AZ_Warning("Archive", false, R"(File "%.*s" in archive "%s" can't be streamed. %s)",
+                AZ_PATH_ARG(listFileResult.m_relativeFilePath), m_archivePath.c_str(), blockLineSpanOutcome.error().c_str());
+            return nullptr;
+        }
+
+        // Every block of a compressed file decompresses to 2 MiB except the last one
+        // and each compressed block starts 512-byte aligned to the start of the file
+        auto blockLayout = AZStd::make_shared<AZ::IO::CompressedBlockLayout>();
+        blockLayout->m_uncompressedBlockSize = ArchiveBlockSizeForCompression;
+        blockLayout->m_compressedBlockAlignment = ArchiveDefaultBlockAlignment;
+
+        const AZ::u32 blockCount = GetBlockCountIfCompressed(listFileResult.m_uncompressedSize);
+        blockLayout->m_compressedBlockSizes.reserve(blockCount);
+        for (AZ::u64 blockIndex{}; blockIndex < blockCount; ++blockIndex)
+        {
+            blockLayout->m_compressedBlockSizes.push_back(
+                GetCompressedSizeForBlock(blockLineSpanOutcome.value(), blockCount, blockIndex));
+        }
+
+        m_streamerBlockLayouts.emplace(fileMetadataTableIndex, blockLayout);
+        return blockLayout;
+    }
+
     ArchiveListFileResult ArchiveReader::ListFileInArchive(ArchiveFileToken archiveFileToken) const
     {
         if (static_cast<AZ::u64>(archiveFileToken) > m_archiveToc.m_tocView.m_filePathIndexTable.size())
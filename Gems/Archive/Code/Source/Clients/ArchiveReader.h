@@ -11,11 +11,15 @@
 #include <Archive/Clients/ArchiveBaseAPI.h>
 #include <Archive/Clients/ArchiveReaderAPI.h>
 
+#include <Clients/ArchiveFileMapping.h>
 #include <Clients/ArchiveTOCView.h>
 
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/utility/to_underlying.h>
 #include <AzCore/Task/TaskExecutor.h>
@@ -54,6 +58,7 @@ namespace Archive
 
         //! Opens the archive path and returns true if successful
         //! Will unmount any previously mounted archive
+        //! If the ArchiveReaderSettings::m_useMemoryMapping setting is true, the archive is also memory mapped
         bool MountArchive(AZ::IO::PathView archivePath) override;
         bool MountArchive(ArchiveStreamPtr archiveStream) override;
 
@@ -81,6 +86,21 @@ namespace Archive
         ArchiveExtractFileResult ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
             const ArchiveReaderFileSettings& fileSettings) override;
 
+        //! Returns a view of the content of the file specified in the ArchiveReaderFileSettings
+        //! directly within the memory mapped archive, without copying it
+        //! Compressed files can only be viewed in their compressed form,
+        //! so the `m_decompressFile` setting must be false to view them
+        //!
+        //! @param fileSettings settings which specify the file to view, the start offset within the file
+        //! and how many bytes to view from that offset
+        //! @return ArchiveViewFileResult structure which on success contains a read-only
+        //! view of the file data within the mapped archive
+        //! On failure, the result outcome member contains the error that occurred
+        ArchiveViewFileResult ViewFileInArchive(const ArchiveReaderFileSettings& fileSettings) const override;
+
+        //! Returns true if the mounted archive is memory mapped
+        bool IsMemoryMapped() const override;
+
         //! List the file metadata from the archive using the ArchiveFileToken
         //! @param filePathToken identifier token that can be used to quickly lookup
         //! metadata about the file
@@ -135,6 +155,17 @@ namespace Archive
         //! ArchiveTocFilePathIndex, ArchiveTocFileMetadata and ArchiveFilePath vector structures
         bool BuildFilePathMap(const ArchiveTableOfContentsView& archiveToc);
 
+        //! Lists the file metadata using the path or file token identifier stored in the file settings
+        ArchiveListFileResult ListFileFromSettings(const ArchiveReaderFileSettings& fileSettings) const;
+
+        //! Returns a view of a range of bytes within the memory mapped archive
+        //! @param offset absolute offset within the mounted archive where the range starts
+        //! @param size the amount of bytes within the range
+        //! @return result outcome with a span viewing the range within the mapping
+        //! or an error message if the archive isn't mapped or the range is outside of the mapping
+        using ViewMappedRangeOutcome = AZStd::expected<AZStd::span<const AZStd::byte>, ResultString>;
+        ViewMappedRangeOutcome ViewMappedRange(AZ::u64 offset, AZ::u64 size) const;
+
         //! Read data from offset within archive directly to span
         //! @param fileBuffer pre-allocated span to populate buffer with data
         //! @param offset absolute file within mounted archive to start reading data from
@@ -167,6 +198,16 @@ namespace Archive
             const ArchiveExtractFileResult& extractFileResult);
 
 
+        //! Provides Streamer with the location of a file within the archive
+        //! Invoked through the m_streamerHandler when the ArchiveReaderSettings::m_mountForStreamer setting is true
+        void FindStreamerCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, AZ::IO::PathView filePath);
+
+        //! Returns the layout of the compressed blocks of a file for use by Streamer
+        //! @param listFileResult metadata of a compressed file within the mounted archive
+        //! @return layout of the 2 MiB blocks of the file or nullptr if the block lines of the file can't be read
+        AZStd::shared_ptr<const AZ::IO::CompressedBlockLayout> GetCompressedBlockLayout(
+            const ArchiveListFileResult& listFileResult);
+
         // Private Member variables section
 
         //! Archive Reader specific settings
@@ -180,6 +221,8 @@ namespace Archive
         //! View of the Archive TOC within the supplied archive stream
         //! Since the ArchiveReader doesn't mutate the archive, a Table of Contents View is used
         //! and paired with a raw buffer of the Table of Contents
+        //! When the archive is memory mapped and the TOC is uncompressed, the buffer is empty
+        //! and the view points directly into the mapping
         struct ArchiveTableOfContentsReader
         {
             // Default a table of contents reader that has an empty vector
@@ -208,8 +251,37 @@ namespace Archive
         //! Protects reads within the archive stream
         //! NOTE: This does restrict read jobs to be done on one thread at a time
         //! if done using the AZ::IO::GenericStream API as it maintains a single seek position
+        //! Reads from a memory mapped archive do not go through the stream and don't need the lock
         AZStd::mutex m_archiveStreamMutex;
 
+        //! Read-only memory mapping of the archive
+        //! Only populated when the archive is mounted from a file path with memory mapping enabled
+        //! IMPORTANT: The m_archiveToc view and m_pathMap can point into the mapping
+        //! and therefore they must be cleared before the archive is unmapped
+        ArchiveFileMapping m_archiveMapping;
+
+        //! Path of the archive when it is mounted from a file path
+        //! It is used by Streamer to read the files within the archive
+        AZ::IO::Path m_archivePath;
+
+        //! Answers Streamer lookups of files within the archive
+        //! The handler is a separate object as the AZ::IO::Compression bus interface name
+        //! would otherwise hide the Compression gem namespace within the reader
+        struct StreamerCompressionHandler
+            : public AZ::IO::CompressionBus::Handler
+        {
+            explicit StreamerCompressionHandler(ArchiveReader& archiveReader);
+            void FindCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, const AZ::IO::PathView filePath) override;
+
+            ArchiveReader& m_archiveReader;
+        };
+        StreamerCompressionHandler m_streamerHandler{ *this };
+
+        //! Layouts of the compressed blocks of the files which Streamer has looked up
+        //! Keyed by the index of the file within the table of contents
+        //! Only accessed from CompressionBus handlers, which are serialized by the bus mutex
+        AZStd::unordered_map<size_t, AZStd::shared_ptr<const AZ::IO::CompressedBlockLayout>> m_streamerBlockLayouts;
+
         //! Task Executor used to decompress blocks of a file in parallel
         AZ::TaskExecutor m_taskExecutor;
     };
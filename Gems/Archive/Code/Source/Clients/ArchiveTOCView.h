@@ -48,7 +48,7 @@ namespace Archive
         //! and a buffer containing the uncompressed table of contents data from storage
         using CreateTOCViewOutcome = AZStd::expected<ArchiveTableOfContentsView, ArchiveTocValidationResult>;
         static CreateTOCViewOutcome CreateFromArchiveHeaderAndBuffer(const ArchiveHeader& archiveHeader,
-            AZStd::span<AZStd::byte> tocBuffer);
+            AZStd::span<const AZStd::byte> tocBuffer);
 
         //! 8-byte magic bytes entry used to indicate that the read table of contents is valid
         AZ::u64 m_magicBytes = ArchiveTocMagicBytes;
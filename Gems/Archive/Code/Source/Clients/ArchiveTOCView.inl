@@ -16,7 +16,7 @@ namespace Archive
     inline ArchiveTableOfContentsView::ArchiveTableOfContentsView() = default;
 
     inline auto ArchiveTableOfContentsView::CreateFromArchiveHeaderAndBuffer(const ArchiveHeader& archiveHeader,
-        AZStd::span<AZStd::byte> tocBuffer) -> CreateTOCViewOutcome
+        AZStd::span<const AZStd::byte> tocBuffer) -> CreateTOCViewOutcome
     {
         // A valid table of contents must have at least 8 bytes to store the Magic Bytes
         if (tocBuffer.size() < sizeof(ArchiveTocMagicBytes))
@@ -56,7 +56,7 @@ namespace Archive
             sizeof(ArchiveBlockLineUnion));
 
         // Cast the first 8 of the TOC buffer
-        tocView.m_magicBytes = *reinterpret_cast<decltype(tocView.m_magicBytes)*>(tocBuffer.data() + MagicBytesOffset);
+        tocView.m_magicBytes = *reinterpret_cast<const decltype(tocView.m_magicBytes)*>(tocBuffer.data() + MagicBytesOffset);
         // create a span to the file metadata entries
         tocView.m_fileMetadataTable = AZStd::span(
             reinterpret_cast<const ArchiveTocFileMetadata*>(tocBuffer.data() + FileMetadataTableOffset),
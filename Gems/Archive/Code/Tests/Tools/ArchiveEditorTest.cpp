@@ -25,4 +25,24 @@ public:
     }
 };
 
-AZ_UNIT_TEST_HOOK(new ArchiveEditorTestEnvironment);
+#if defined(HAVE_BENCHMARK)
+//! The Benchmark environment loads the same gems as the test environment
+//! once for all of the benchmarks
+class ArchiveEditorBenchmarkEnvironment
+    : public AZ::Test::BenchmarkEnvironmentBase
+    , public ArchiveEditorTestEnvironment
+{
+protected:
+    void SetUpBenchmark() override
+    {
+        SetupEnvironment();
+    }
+
+    void TearDownBenchmark() override
+    {
+        TeardownEnvironment();
+    }
+};
+#endif
+
+AZ_UNIT_TEST_HOOK(new ArchiveEditorTestEnvironment, ArchiveEditorBenchmarkEnvironment);
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzTest/Utils.h>
+
+#include <Archive/Clients/ArchiveReaderAPI.h>
+#include <Archive/Tools/ArchiveWriterAPI.h>
+
+#include <Compression/CompressionLZ4API.h>
+
+// Archive Gem private implementation includes
+#include <Clients/ArchiveReaderFactory.h>
+#include <Tools/ArchiveWriterFactory.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Archive::Benchmark
+{
+    //! Measures the read throughput of extracting files from an archive on disk
+    //! through the file stream compared to reading them from a memory mapping of the archive
+    //! The first benchmark argument selects whether the files are LZ4 compressed
+    //! The second benchmark argument selects whether the archive is memory mapped
+    class ArchiveReaderBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t FileCount = 32;
+        static constexpr size_t FileSize = 4_mib;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+    protected:
+        void InternalSetUp(const ::benchmark::State& state)
+        {
+            m_archiveReaderFactory = AZStd::make_unique<ArchiveReaderFactory>();
+            AZ::Interface<IArchiveReaderFactory>::Register(m_archiveReaderFactory.get());
+            m_archiveWriterFactory = AZStd::make_unique<ArchiveWriterFactory>();
+            AZ::Interface<IArchiveWriterFactory>::Register(m_archiveWriterFactory.get());
+
+            const bool compressFiles = state.range(0) != 0;
+            const bool useMemoryMapping = state.range(1) != 0;
+
+            // Fill the files with a small alphabet of values so that compressing them has work to do
+            AZ::SimpleLcgRandom random(1234);
+            AZStd::vector<AZStd::byte> fileData;
+            fileData.resize_no_construct(FileSize);
+            for (AZStd::byte& fileByte : fileData)
+            {
+                fileByte = static_cast<AZStd::byte>(random.GetRandom() % 16);
+            }
+
+            AZStd::vector<AZStd::byte> archiveBuffer;
+            AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+            {
+                IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+                auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+                AZ_Assert(createArchiveWriterResult, "Failed to create the archive writer for the benchmark");
+                AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+                ArchiveWriterFileSettings fileSettings;
+                fileSettings.m_compressionAlgorithm = compressFiles
+                    ? CompressionLZ4::GetLZ4CompressionAlgorithmId()
+                    : Compression::Uncompressed;
+                for (size_t fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+                {
+                    fileSettings.m_relativeFilePath = AZ::IO::Path(AZStd::string::format("file%zu.bin", fileIndex));
+                    // Vary the first byte so that each file has different content
+                    fileData[0] = static_cast<AZStd::byte>(fileIndex);
+                    [[maybe_unused]] auto addResult = archiveWriter->AddFileToArchive(fileData, fileSettings);
+                    AZ_Assert(addResult, "Failed to add file to the benchmark archive");
+                }
+                [[maybe_unused]] auto commitResult = archiveWriter->Commit();
+                AZ_Assert(commitResult, "Failed to commit the benchmark archive");
+            }
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            auto archivePath = AZ::Test::CreateTestFile(*m_tempDirectory, "benchmark.o3ar",
+                AZStd::span<const AZStd::byte>(archiveBuffer));
+            AZ_Assert(archivePath, "Failed to write the benchmark archive to the temp directory");
+
+            ArchiveReaderSettings readerSettings;
+            readerSettings.m_useMemoryMapping = useMemoryMapping;
+            auto createArchiveReaderResult = CreateArchiveReader(*archivePath, readerSettings);
+            AZ_Assert(createArchiveReaderResult, "Failed to create the archive reader for the benchmark");
+            m_archiveReader = AZStd::move(createArchiveReaderResult.value());
+
+            m_fileTokens.reserve(FileCount);
+            m_archiveReader->EnumerateFilesInArchive([this](ArchiveListFileResult listFileResult)
+            {
+                m_fileTokens.push_back(listFileResult.m_filePathToken);
+                return true;
+            });
+            m_fileBuffer.resize_no_construct(FileSize);
+        }
+
+        void InternalTearDown()
+        {
+            m_fileBuffer = {};
+            m_fileTokens = {};
+            m_archiveReader.reset();
+            m_tempDirectory.reset();
+
+            AZ::Interface<IArchiveWriterFactory>::Unregister(m_archiveWriterFactory.get());
+            AZ::Interface<IArchiveReaderFactory>::Unregister(m_archiveReaderFactory.get());
+            m_archiveWriterFactory.reset();
+            m_archiveReaderFactory.reset();
+        }
+
+        AZStd::unique_ptr<IArchiveReaderFactory> m_archiveReaderFactory;
+        AZStd::unique_ptr<IArchiveWriterFactory> m_archiveWriterFactory;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZStd::unique_ptr<IArchiveReader> m_archiveReader;
+        AZStd::vector<ArchiveFileToken> m_fileTokens;
+        AZStd::vector<AZStd::byte> m_fileBuffer;
+    };
+
+    // Extracts every file in the archive into a caller supplied buffer, decompressing it if needed
+    BENCHMARK_DEFINE_F(ArchiveReaderBenchmarkFixture, ExtractFiles)(::benchmark::State& state)
+    {
+        ArchiveReaderFileSettings fileSettings;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (ArchiveFileToken fileToken : m_fileTokens)
+            {
+                fileSettings.m_filePathIdentifier = fileToken;
+                ArchiveExtractFileResult extractResult = m_archiveReader->ExtractFileFromArchive(m_fileBuffer, fileSettings);
+                ::benchmark::DoNotOptimize(extractResult.m_fileSpan.data());
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * m_fileTokens.size() * FileSize));
+    }
+
+    // Views every uncompressed file in place within the memory mapped archive
+    // Each view is summed so that the mapped pages are actually read
+    BENCHMARK_DEFINE_F(ArchiveReaderBenchmarkFixture, ViewFiles)(::benchmark::State& state)
+    {
+        ArchiveReaderFileSettings fileSettings;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (ArchiveFileToken fileToken : m_fileTokens)
+            {
+                fileSettings.m_filePathIdentifier = fileToken;
+                ArchiveViewFileResult viewResult = m_archiveReader->ViewFileInArchive(fileSettings);
+                AZ::u64 byteSum{};
+                for (AZStd::byte fileByte : viewResult.m_fileView)
+                {
+                    byteSum += static_cast<AZ::u8>(fileByte);
+                }
+                ::benchmark::DoNotOptimize(byteSum);
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * m_fileTokens.size() * FileSize));
+    }
+
+    // Arguments are {compressFiles, useMemoryMapping}
+    BENCHMARK_REGISTER_F(ArchiveReaderBenchmarkFixture, ExtractFiles)
+        ->ArgNames({ "Compressed", "MemoryMapped" })
+        ->Args({ 0, 0 })
+        ->Args({ 0, 1 })
+        ->Args({ 1, 0 })
+        ->Args({ 1, 1 })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(ArchiveReaderBenchmarkFixture, ViewFiles)
+        ->ArgNames({ "Compressed", "MemoryMapped" })
+        ->Args({ 0, 1 })
+        ->Unit(::benchmark::kMillisecond);
+} // namespace Archive::Benchmark
+
+#endif
@@ -9,8 +9,11 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 
+#include <AzTest/Utils.h>
+
 #include <Archive/Clients/ArchiveReaderAPI.h>
 #include <Archive/Tools/ArchiveWriterAPI.h>
 
@@ -970,4 +973,213 @@ namespace Archive::Test
             EXPECT_TRUE(AZStd::ranges::equal(requestedFileData, expectedResultData));
         }
     }
+
+    //! Validates that an archive mounted from a file path with memory mapping enabled
+    //! extracts the same content as the stream path and can view uncompressed files in place
+    TEST_F(ArchiveReaderFixture, MountArchive_WithMemoryMapping_ExtractsAndViewsFiles_Succeeds)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        constexpr AZStd::string_view fooFileData = "Hello World";
+        constexpr AZStd::string_view levelPrefabFileData = "My Prefab Data in an Archive";
+
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            // Write an uncompressed file and a compressed file
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_relativeFilePath = "foo.txt";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fooFileData)), fileSettings));
+
+            fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileSettings.m_relativeFilePath = "level.prefab";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(levelPrefabFileData)), fileSettings));
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        // Memory mapping is only available for archives mounted from a file path
+        // so write the archive to a temporary directory
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        auto archivePath = AZ::Test::CreateTestFile(tempDirectory, "test.o3ar", AZStd::span<const AZStd::byte>(archiveBuffer));
+        ASSERT_TRUE(archivePath);
+
+        ArchiveReaderSettings readerSettings;
+        readerSettings.m_useMemoryMapping = true;
+        auto createArchiveReaderResult = CreateArchiveReader(*archivePath, readerSettings);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+        EXPECT_TRUE(archiveReader->IsMemoryMapped());
+
+        {
+            // The uncompressed file can be extracted and viewed in place
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = AZ::IO::PathView("foo.txt");
+
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(fooFileData.size());
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(AZStd::as_bytes(AZStd::span(fooFileData)), archiveExtractFileResult.m_fileSpan));
+
+            const ArchiveViewFileResult archiveViewFileResult = archiveReader->ViewFileInArchive(fileSettings);
+            ASSERT_TRUE(archiveViewFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(AZStd::as_bytes(AZStd::span(fooFileData)), archiveViewFileResult.m_fileView));
+            EXPECT_EQ(archiveViewFileResult.m_crc32, AZ::Crc32(archiveViewFileResult.m_fileView));
+
+            // A partial view only contains the requested range
+            fileSettings.m_startOffset = 6;
+            fileSettings.m_bytesToRead = 3;
+            const ArchiveViewFileResult partialViewFileResult = archiveReader->ViewFileInArchive(fileSettings);
+            ASSERT_TRUE(partialViewFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(AZStd::as_bytes(AZStd::span(fooFileData.substr(6, 3))),
+                partialViewFileResult.m_fileView));
+        }
+
+        {
+            // The compressed file is decompressed straight from the mapping
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = AZ::IO::PathView("level.prefab");
+
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(levelPrefabFileData.size());
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(AZStd::as_bytes(AZStd::span(levelPrefabFileData)),
+                archiveExtractFileResult.m_fileSpan));
+
+            // The decompressed content cannot be viewed in place
+            EXPECT_FALSE(archiveReader->ViewFileInArchive(fileSettings));
+
+            // but the raw compressed content can and it matches the raw extracted content
+            fileSettings.m_decompressFile = false;
+            AZStd::vector<AZStd::byte> compressedBuffer;
+            compressedBuffer.resize_no_construct(archiveExtractFileResult.m_compressedSize);
+            const ArchiveExtractFileResult rawExtractFileResult = archiveReader->ExtractFileFromArchive(
+                compressedBuffer, fileSettings);
+            ASSERT_TRUE(rawExtractFileResult);
+            const ArchiveViewFileResult rawViewFileResult = archiveReader->ViewFileInArchive(fileSettings);
+            ASSERT_TRUE(rawViewFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(rawExtractFileResult.m_fileSpan, rawViewFileResult.m_fileView));
+        }
+
+        // Archives mounted without memory mapping cannot view files
+        auto createStreamReaderResult = CreateArchiveReader(*archivePath);
+        ASSERT_TRUE(createStreamReaderResult);
+        AZStd::unique_ptr<IArchiveReader> streamArchiveReader = AZStd::move(createStreamReaderResult.value());
+        ASSERT_TRUE(streamArchiveReader->IsMounted());
+        EXPECT_FALSE(streamArchiveReader->IsMemoryMapped());
+
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView("foo.txt");
+        EXPECT_FALSE(streamArchiveReader->ViewFileInArchive(fileSettings));
+    }
+
+    TEST_F(ArchiveReaderFixture, MountArchive_ForStreamer_ProvidesTheBlockLayoutOfCompressedFiles)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        constexpr AZStd::string_view fooFileData = "Hello World";
+        // Spans three 2 MiB blocks with a distinct pattern per block
+        AZStd::vector<AZStd::byte> levelFileData;
+        levelFileData.resize_no_construct(ArchiveBlockSizeForCompression * 2 + 1000);
+        for (size_t i = 0; i < levelFileData.size(); ++i)
+        {
+            levelFileData[i] = static_cast<AZStd::byte>((i / ArchiveBlockSizeForCompression) * 64 + i % 61);
+        }
+
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_relativeFilePath = "foo.txt";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fooFileData)), fileSettings));
+
+            fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileSettings.m_relativeFilePath = "levels/level.prefab";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(levelFileData, fileSettings));
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        // Streamer opens the archive by path, so write it to a temporary directory
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        auto archivePath = AZ::Test::CreateTestFile(tempDirectory, "test.o3ar", AZStd::span<const AZStd::byte>(archiveBuffer));
+        ASSERT_TRUE(archivePath);
+
+        ArchiveReaderSettings readerSettings;
+        readerSettings.m_mountForStreamer = true;
+        readerSettings.m_streamerMountPoint = "archive";
+        auto createArchiveReaderResult = CreateArchiveReader(*archivePath, readerSettings);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        // Only paths within the mount point are found
+        AZ::IO::CompressionInfo info;
+        EXPECT_FALSE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "foo.txt"));
+        EXPECT_FALSE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "archive/bar.txt"));
+
+        // Uncompressed files are read from the archive as is
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "archive/foo.txt"));
+        EXPECT_EQ(AZ::IO::PathView(*archivePath), info.m_archiveFilename.GetRelativePath());
+        EXPECT_FALSE(info.m_isCompressed);
+        EXPECT_EQ(fooFileData.size(), info.m_uncompressedSize);
+        EXPECT_EQ(fooFileData.size(), info.m_compressedSize);
+        EXPECT_EQ(nullptr, info.m_blockLayout);
+        EXPECT_TRUE(AZStd::ranges::equal(AZStd::as_bytes(AZStd::span(fooFileData)),
+            AZStd::span(archiveBuffer).subspan(info.m_offset, info.m_compressedSize)));
+
+        // Compressed files are described per block
+        AZ::IO::CompressionInfo levelInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(levelInfo, "archive/levels/level.prefab"));
+        EXPECT_TRUE(levelInfo.m_isCompressed);
+        EXPECT_EQ(levelFileData.size(), levelInfo.m_uncompressedSize);
+        ASSERT_TRUE(levelInfo.m_decompressor);
+        ASSERT_NE(nullptr, levelInfo.m_blockLayout);
+        const AZ::IO::CompressedBlockLayout& layout = *levelInfo.m_blockLayout;
+        EXPECT_EQ(ArchiveBlockSizeForCompression, layout.m_uncompressedBlockSize);
+        EXPECT_EQ(ArchiveDefaultBlockAlignment, layout.m_compressedBlockAlignment);
+        ASSERT_EQ(3, layout.m_compressedBlockSizes.size());
+
+        // Every block decompresses on its own
+        const AZStd::span<const AZStd::byte> compressedFile =
+            AZStd::span<const AZStd::byte>(archiveBuffer).subspan(levelInfo.m_offset, levelInfo.m_compressedSize);
+        AZStd::vector<AZStd::byte> decompressedFile;
+        decompressedFile.resize_no_construct(levelFileData.size());
+        size_t compressedBlockOffset = 0;
+        for (size_t blockIndex = 0; blockIndex < layout.m_compressedBlockSizes.size(); ++blockIndex)
+        {
+            const size_t uncompressedBlockOffset = blockIndex * layout.m_uncompressedBlockSize;
+            const size_t uncompressedBlockSize =
+                AZStd::min(layout.m_uncompressedBlockSize, levelFileData.size() - uncompressedBlockOffset);
+            EXPECT_TRUE(levelInfo.m_decompressor(levelInfo, compressedFile.data() + compressedBlockOffset,
+                layout.m_compressedBlockSizes[blockIndex], decompressedFile.data() + uncompressedBlockOffset, uncompressedBlockSize));
+            compressedBlockOffset += AZ_SIZE_ALIGN_UP(layout.m_compressedBlockSizes[blockIndex], layout.m_compressedBlockAlignment);
+        }
+        EXPECT_TRUE(AZStd::ranges::equal(levelFileData, decompressedFile));
+
+        // and the whole file can be decompressed at once by readers that don't stream per block
+        AZStd::fill(decompressedFile.begin(), decompressedFile.end(), AZStd::byte{});
+        EXPECT_TRUE(levelInfo.m_decompressor(levelInfo, compressedFile.data(), compressedFile.size(),
+            decompressedFile.data(), decompressedFile.size()));
+        EXPECT_TRUE(AZStd::ranges::equal(levelFileData, decompressedFile));
+
+        // Unmounted archives are no longer found
+        archiveReader->UnmountArchive();
+        EXPECT_FALSE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "archive/foo.txt"));
+    }
 }
@@ -6,6 +6,7 @@
 
 set(FILES
     Tests/Tools/ArchiveEditorTest.cpp
+    Tests/Tools/ArchiveReaderBenchmarks.cpp
     Tests/Tools/ArchiveReaderTest.cpp
     Tests/Tools/ArchiveWriterTest.cpp
 )
@@ -7,6 +7,8 @@
 set(FILES
     Source/ArchiveModuleInterface.cpp
     Source/ArchiveModuleInterface.h
+    Source/Clients/ArchiveFileMapping.cpp
+    Source/Clients/ArchiveFileMapping.h
     Source/Clients/ArchiveReader.cpp
     Source/Clients/ArchiveReader.h
     Source/Clients/ArchiveReaderFactory.cpp
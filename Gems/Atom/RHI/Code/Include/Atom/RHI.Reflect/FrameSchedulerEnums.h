@@ -52,7 +52,10 @@ namespace AZ::RHI
         IntraGroupAliasing = AZ_BIT(4),
 
         /// Disables optimizing load store actions of transient attachmetns
-        DisableLoadStoreActionOptimization = AZ_BIT(5)
+        DisableLoadStoreActionOptimization = AZ_BIT(5),
+
+        /// Disables reusing the compile results of the previous frame when the frame graph structure is unchanged.
+        DisableCompileReuse = AZ_BIT(6)
     };
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::FrameSchedulerCompileFlags)
 
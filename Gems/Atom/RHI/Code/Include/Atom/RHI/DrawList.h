@@ -15,6 +15,11 @@
 
 #include <AzCore/std/containers/bitset.h>
 
+namespace AZ
+{
+    class TaskExecutor;
+}
+
 namespace AZ::RHI
 {
     //! Draw list tags are unique ids identifying a unique list of draw items. The draw packet
@@ -40,5 +45,12 @@ namespace AZ::RHI
     /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
     DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+    /// Sorts the draw list in the order of the sort type, items that compare equal are ordered by their draw item.
+    /// Large lists are radix sorted, and split across tasks when the task graph is active. The radix sort storage is kept
+    /// per thread and reused, so sorting only allocates when a thread sorts a larger list than it did before.
     void SortDrawList(DrawList& drawList, DrawListSortType sortType);
+
+    /// Sorts the draw list like above, splitting large lists across tasks on the task executor. The calling thread
+    /// takes part in the sort, so it's safe to call from within a task. A null task executor sorts on the calling thread.
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType, TaskExecutor* taskExecutor);
 }
@@ -43,6 +43,9 @@ namespace AZ::RHI
         /// The depth value here is the depth of the object from the perspective of the view.
         void AddDrawPacket(const DrawPacket* drawPacket, float depth = 0.0f);
 
+        /// Filters the draw items of multiple draw packets at the same depth into draw lists.
+        void AddDrawPackets(AZStd::span<const DrawPacket* const> drawPackets, float depth = 0.0f);
+
         /// Adds an individual draw item to the draw list associated with the provided tag. This will
         /// no-op if the tag is not present in the internal draw list mask.
         void AddDrawItem(DrawListTag drawListTag, DrawItemProperties drawItemProperties);
@@ -59,6 +62,8 @@ namespace AZ::RHI
         DrawListsByTag& GetMergedDrawListsByTag();
 
     private:
+        void AddDrawPacketToLists(DrawListsByTag& threadListsByTag, const DrawPacket& drawPacket, float depth) const;
+
         ThreadLocalContext<DrawListsByTag> m_threadListsByTag;
         DrawListsByTag m_mergedListsByTag;
         DrawListMask m_drawListMask = 0;
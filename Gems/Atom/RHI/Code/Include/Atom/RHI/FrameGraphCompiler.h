@@ -8,10 +8,12 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/Buffer.h>
+#include <AzCore/std/chrono/chrono.h>
 
 //! Struct used as a key for m_imageReverseLookupHash map below. The reason for using a struct instead of a hash directly is
 //! so that the map can handle hash collision correctly by using the == operator. This struct contains
@@ -107,6 +109,29 @@ namespace AZ::RHI
         FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
     };
 
+    //! Counts how often FrameGraphCompiler reused the compile results of the previous frame.
+    struct FrameGraphCompileStatistics
+    {
+        //! Returns the fraction of compiles that reused the results of the previous frame.
+        float GetReuseRate() const
+        {
+            const uint64_t compileCount = m_reusedCompileCount + m_fullCompileCount;
+            return compileCount ? static_cast<float>(m_reusedCompileCount) / static_cast<float>(compileCount) : 0.0f;
+        }
+
+        //! Number of compiles that reused the results of the previous frame.
+        uint64_t m_reusedCompileCount = 0;
+
+        //! Number of compiles that ran every phase, because the frame graph structure changed or reuse was disabled.
+        uint64_t m_fullCompileCount = 0;
+
+        //! Whether the last compile reused the results of the previous frame.
+        bool m_lastCompileReused = false;
+
+        //! CPU time saved by reuse, estimated against the duration of the last full compile.
+        AZStd::chrono::microseconds m_timeSaved{ 0 };
+    };
+
     //! FrameGraphCompiler controls compilation of FrameGraph each frame. FrameScheduler owns
     //! and drives an instance of this class, so end-users should never need to interact with it directly.
     //! Platform implementations, on the other hand, are required to override this class in order to perform
@@ -168,6 +193,16 @@ namespace AZ::RHI
     //! 
     //!  1) Derive transition barriers by walking the scope attachment chain on each frame attachment.
     //!  2) Derive queue fence values by walking the queue-centric scope graph.
+    //!
+    //!      == Reuse Across Frames ==
+    //!
+    //! The scopes and attachments of a frame graph rarely change from one frame to the next. The compiler hashes
+    //! the structure of the graph (scope order, queues, dependencies, transient attachment descriptors and usage
+    //! intervals) along with the compile flags. When the hash matches the previous frame, the queue-centric links,
+    //! the extended transient lifetimes, the sorted transient pool commands and the memory hints of the pool are
+    //! applied from the previous compile instead of being computed again. Any change falls back to a full compile.
+    //! Resources are still activated on the transient attachment pool every frame. Since the pool receives the
+    //! same commands, it places them the same way it did on the previous frame.
     class FrameGraphCompiler
         : public Object
     {
@@ -183,10 +218,49 @@ namespace AZ::RHI
         //! method is invoked.
         MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+        //! Returns how often compiles reused the results of the previous frame.
+        const FrameGraphCompileStatistics& GetStatistics() const;
+
     protected:
         FrameGraphCompiler() = default;
 
     private:
+        //! First and last scope index of a transient attachment on one device.
+        struct TransientLifetime
+        {
+            uint32_t m_attachmentIndex = 0;
+            int m_deviceIndex = 0;
+            uint32_t m_firstScopeIndex = 0;
+            uint32_t m_lastScopeIndex = 0;
+        };
+
+        //! Results of the last full compile which only depend on the structure of the frame graph.
+        struct CompiledStructure
+        {
+            HashValue64 m_hash = HashValue64{ 0 };
+            bool m_isValid = false;
+
+            //! Producer and consumer scope indices, in the order the queue-centric scope graph linked them.
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_queueLinks;
+
+            //! Lifetimes of the transient attachments after they were extended over async intervals and graph groups.
+            AZStd::vector<TransientLifetime> m_transientBufferLifetimes;
+            AZStd::vector<TransientLifetime> m_transientImageLifetimes;
+
+            //! Sorted activation and deactivation commands submitted to the transient attachment pool.
+            AZStd::vector<uint32_t> m_transientCommands;
+
+            //! Device and attachment index of transient attachments that are not used by any scope on that device.
+            AZStd::vector<AZStd::pair<int, uint32_t>> m_unusedTransientBuffers;
+            AZStd::vector<AZStd::pair<int, uint32_t>> m_unusedTransientImages;
+
+            //! Memory gathered by the sizing pass of pools using HeapAllocationStrategy::MemoryHint.
+            AZStd::unordered_map<int, TransientAttachmentStatistics::MemoryUsage> m_memoryHints;
+
+            //! Time spent in the phases that reuse skips, measured on the last full compile.
+            AZStd::chrono::microseconds m_compileTime{ 0 };
+        };
+
         //////////////////////////////////////////////////////////////////////////
         // Platform API
 
@@ -204,10 +278,21 @@ namespace AZ::RHI
 
         MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
 
+        //! Hashes everything the queue-centric scope graph and transient attachment phases depend on.
+        HashValue64 HashFrameGraphStructure(const FrameGraphCompileRequest& request) const;
+
         void CompileQueueCentricScopeGraph(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
 
+        //! Links the scopes the same way the last full compile of the queue-centric scope graph did.
+        void ReuseQueueCentricScopeGraph(
+            FrameGraph& frameGraph,
+            FrameSchedulerCompileFlags compileFlags);
+
+        //! Records the queue link between two scopes so following frames with the same structure can reuse it.
+        void LinkProducerConsumerByQueues(Scope* producer, Scope* consumer);
+
         void ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
@@ -237,7 +322,19 @@ namespace AZ::RHI
             FrameGraph& frameGraph,
             AZ::RHI::TransientAttachmentPool& transientAttachmentPool,
             FrameSchedulerCompileFlags compileFlags,
-            FrameSchedulerStatisticsFlags statisticsFlags);
+            FrameSchedulerStatisticsFlags statisticsFlags,
+            bool reuseCompiledStructure);
+
+        //! Stores the first and last scope of each transient attachment after lifetime extension.
+        template<class T>
+        void StoreTransientAttachmentLifetimes(const AZStd::vector<T*>& frameAttachments, AZStd::vector<TransientLifetime>& lifetimes);
+
+        //! Applies the first and last scopes stored by the last full compile.
+        template<class T>
+        void ReuseTransientAttachmentLifetimes(
+            const AZStd::vector<Scope*>& scopes,
+            const AZStd::vector<T*>& frameAttachments,
+            const AZStd::vector<TransientLifetime>& lifetimes);
 
         void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
@@ -260,5 +357,8 @@ namespace AZ::RHI
         // once they have been replaced with a new view instance. 
         AZStd::unordered_map<ImageResourceViewData, HashValue64> m_imageReverseLookupHash;
         AZStd::unordered_map<BufferResourceViewData, HashValue64> m_bufferReverseLookupHash;
+
+        CompiledStructure m_compiledStructure;
+        FrameGraphCompileStatistics m_statistics;
     };
 }
@@ -12,12 +12,17 @@
 namespace AZ::RHI
 {
     class FrameGraph;
+    struct FrameGraphCompileStatistics;
 
     class FrameGraphLogger
     {
     public:
         //! Logs the graph to the output console, with the specified verbosity.
-        static void Log(const FrameGraph& frameGraph, FrameSchedulerLogVerbosity logVerbosity);
+        //! When compile statistics are provided, the reuse of compile results across frames is logged as well.
+        static void Log(
+            const FrameGraph& frameGraph,
+            FrameSchedulerLogVerbosity logVerbosity,
+            const FrameGraphCompileStatistics* compileStatistics = nullptr);
         
         //! Dumps a graph-vis file of the current frame graph to the logs folder.
         static void DumpGraphVis(const FrameGraph& frameGraph);
@@ -168,6 +168,9 @@ namespace AZ::RHI
         //! Returns the timing statistics for the previous frame.
         AZStd::unordered_map<int, TransientAttachmentStatistics> GetTransientAttachmentStatistics() const;
 
+        //! Returns how often the frame graph compiler reused the compile results of the previous frame.
+        const FrameGraphCompileStatistics& GetFrameGraphCompileStatistics() const;
+
         //! Returns current CPU frame to frame time in milliseconds.
         double GetCpuFrameTime() const;
 
@@ -7,90 +7,564 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
 {
-    DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
+    namespace
     {
-        if (drawList.empty())
+        // Below this size a comparison sort is faster than the passes of the radix sort
+        constexpr size_t RadixSortMinItemCount = 256;
+        // Lists are only split across tasks when every task gets at least this many items
+        constexpr size_t ParallelSortMinItemsPerTask = 8192;
+        constexpr size_t ParallelSortMaxTaskCount = 16;
+
+        //! The sort key and depth of a draw item packed into a 96 bit unsigned integer, which orders the same way as the
+        //! sort type, followed by the index of the draw item in the unsorted list.
+        struct SortEntry
         {
-            return DrawListView{};
+            uint64_t m_low;
+            uint32_t m_high;
+            uint32_t m_index;
+        };
+
+        constexpr size_t SortEntryDigitCount = 12;
+        constexpr size_t RadixBucketCount = 256;
+
+        //! The number of entries per digit value, for every digit of the sort entries.
+        struct RadixHistograms
+        {
+            uint32_t m_counts[SortEntryDigitCount][RadixBucketCount];
+        };
+
+        //! Storage used by the radix sorts, kept per thread so sorting only allocates when a list is larger than any list the
+        //! thread sorted before. It uses the OS allocator because it lives until the thread exits, past the module allocators.
+        struct RadixSortBuffer
+        {
+            AZStd::vector<SortEntry, AZStd::stateless_allocator> m_entries;
+            AZStd::vector<SortEntry, AZStd::stateless_allocator> m_scratch;
+            AZStd::vector<RadixHistograms, AZStd::stateless_allocator> m_histograms;
+
+            void Reserve(size_t entryCount, size_t histogramCount)
+            {
+                if (m_entries.size() < entryCount)
+                {
+                    m_entries.resize_no_construct(entryCount);
+                    m_scratch.resize_no_construct(entryCount);
+                }
+                if (m_histograms.size() < histogramCount)
+                {
+                    m_histograms.resize_no_construct(histogramCount);
+                }
+            }
+        };
+
+        RadixSortBuffer& GetRadixSortBuffer()
+        {
+            thread_local RadixSortBuffer buffer;
+            return buffer;
         }
 
-        const size_t itemsPerPartition = AZ::DivideAndRoundUp(drawList.size(), partitionCount);
-        const size_t itemOffset = partitionIndex * itemsPerPartition;
-        const size_t itemCount = AZStd::min(drawList.size() - itemOffset, itemsPerPartition);
-        return DrawListView(&drawList[itemOffset], itemCount);
-    }
+        uint64_t ToOrderedBits(DrawItemSortKey sortKey)
+        {
+            // Flipping the sign bit orders signed values correctly as unsigned values
+            return static_cast<uint64_t>(sortKey) ^ (uint64_t{ 1 } << 63);
+        }
 
-    void SortDrawList(DrawList& drawList, DrawListSortType sortType)
-    {
-        switch (sortType)
+        uint32_t ToOrderedBits(float depth)
+        {
+            // -0 and +0 compare equal, so they need to have the same bits
+            uint32_t bits = 0;
+            if (depth != 0.0f)
+            {
+                memcpy(&bits, &depth, sizeof(bits));
+            }
+            // Negative values are ordered in reverse by their bits, so flip them all, otherwise only flip the sign bit
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+
+        SortEntry MakeSortEntry(const DrawItemProperties& item, uint32_t index, DrawListSortType sortType)
+        {
+            const uint64_t sortKey = ToOrderedBits(item.m_sortKey);
+            uint32_t depth = ToOrderedBits(item.m_depth);
+            if (sortType == DrawListSortType::KeyThenReverseDepth || sortType == DrawListSortType::ReverseDepthThenKey)
+            {
+                depth = ~depth;
+            }
+
+            if (sortType == DrawListSortType::KeyThenDepth || sortType == DrawListSortType::KeyThenReverseDepth)
+            {
+                return SortEntry{ (sortKey << 32) | depth, static_cast<uint32_t>(sortKey >> 32), index };
+            }
+            return SortEntry{ sortKey, depth, index };
+        }
+
+        uint32_t GetDigit(const SortEntry& entry, size_t digitIndex)
+        {
+            return digitIndex < 8 ? static_cast<uint32_t>(entry.m_low >> (digitIndex * 8)) & 0xFF
+                                  : (entry.m_high >> ((digitIndex - 8) * 8)) & 0xFF;
+        }
+
+        bool HasEqualKey(const SortEntry& a, const SortEntry& b)
+        {
+            return a.m_high == b.m_high && a.m_low == b.m_low;
+        }
+
+        //! Orders entries by their key and then by their draw item, which is the same order as the comparison sort.
+        struct SortEntryLess
         {
-        case DrawListSortType::KeyThenDepth:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+            bool operator()(const SortEntry& a, const SortEntry& b) const
+            {
+                if (a.m_high != b.m_high)
                 {
-                    if (a.m_sortKey != b.m_sortKey)
+                    return a.m_high < b.m_high;
+                }
+                if (a.m_low != b.m_low)
+                {
+                    return a.m_low < b.m_low;
+                }
+                return m_items[a.m_index].m_item < m_items[b.m_index].m_item;
+            }
+
+            const DrawItemProperties* m_items;
+        };
+
+        //! Sorts the entries with a least significant digit radix sort, skipping digits that are the same for all entries.
+        //! Most lists only use part of the sort key or depth range, so usually only a few of the 12 digits need a pass.
+        void RadixSortEntries(SortEntry* entries, SortEntry* scratch, RadixHistograms& histograms, size_t count, const DrawItemProperties* items)
+        {
+            AZ_Assert(count <= AZStd::numeric_limits<uint32_t>::max(), "Draw list is too large to sort.");
+            if (count == 0)
+            {
+                return;
+            }
+
+            // The number of entries per digit value doesn't depend on the order, so all histograms are built in one pass
+            memset(histograms.m_counts, 0, sizeof(histograms.m_counts));
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (size_t digitIndex = 0; digitIndex < SortEntryDigitCount; ++digitIndex)
+                {
+                    ++histograms.m_counts[digitIndex][GetDigit(entries[i], digitIndex)];
+                }
+            }
+
+            SortEntry* source = entries;
+            SortEntry* destination = scratch;
+            for (size_t digitIndex = 0; digitIndex < SortEntryDigitCount; ++digitIndex)
+            {
+                uint32_t* histogram = histograms.m_counts[digitIndex];
+                if (histogram[GetDigit(source[0], digitIndex)] == count)
+                {
+                    continue;
+                }
+
+                uint32_t offset = 0;
+                for (size_t bucket = 0; bucket < RadixBucketCount; ++bucket)
+                {
+                    const uint32_t bucketCount = histogram[bucket];
+                    histogram[bucket] = offset;
+                    offset += bucketCount;
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    destination[histogram[GetDigit(source[i], digitIndex)]++] = source[i];
+                }
+                AZStd::swap(source, destination);
+            }
+            if (source != entries)
+            {
+                memcpy(entries, source, count * sizeof(SortEntry));
+            }
+
+            // Entries with equal keys are ordered by their draw item, these runs are rare and short
+            const SortEntryLess less{ items };
+            for (size_t runBegin = 0; runBegin < count;)
+            {
+                size_t runEnd = runBegin + 1;
+                while (runEnd < count && HasEqualKey(entries[runBegin], entries[runEnd]))
+                {
+                    ++runEnd;
+                }
+                if (runEnd - runBegin > 1)
+                {
+                    AZStd::sort(entries + runBegin, entries + runEnd, less);
+                }
+                runBegin = runEnd;
+            }
+        }
+
+        //! Moves the draw items into the order of the sorted entries. The permutation is applied by following its cycles,
+        //! so no copy of the draw list is needed. The entries are used to mark the items that are in place.
+        void ApplySortOrder(DrawList& drawList, SortEntry* entries)
+        {
+            const uint32_t itemCount = static_cast<uint32_t>(drawList.size());
+            for (uint32_t cycleBegin = 0; cycleBegin < itemCount; ++cycleBegin)
+            {
+                if (entries[cycleBegin].m_index == cycleBegin)
+                {
+                    continue;
+                }
+
+                const DrawItemProperties cycleBeginItem = drawList[cycleBegin];
+                uint32_t index = cycleBegin;
+                while (true)
+                {
+                    const uint32_t sourceIndex = entries[index].m_index;
+                    entries[index].m_index = index;
+                    if (sourceIndex == cycleBegin)
                     {
-                        return a.m_sortKey < b.m_sortKey;
+                        drawList[index] = cycleBeginItem;
+                        break;
                     }
-                    if (a.m_depth != b.m_depth)
+                    drawList[index] = drawList[sourceIndex];
+                    index = sourceIndex;
+                }
+            }
+        }
+
+        struct SortRun
+        {
+            size_t m_offset;
+            size_t m_count;
+        };
+        using SortRuns = AZStd::fixed_vector<SortRun, ParallelSortMaxTaskCount>;
+
+        //! Returns how many entries of the first run are within the first outputIndex entries of the merge of both runs.
+        size_t FindMergeSplit(const SortEntry* first, size_t firstCount, const SortEntry* second, size_t secondCount,
+            size_t outputIndex, const SortEntryLess& less)
+        {
+            size_t low = outputIndex > secondCount ? outputIndex - secondCount : 0;
+            size_t high = AZStd::min(outputIndex, firstCount);
+            while (low < high)
+            {
+                const size_t firstIndex = (low + high) / 2;
+                if (less(second[outputIndex - firstIndex - 1], first[firstIndex]))
+                {
+                    high = firstIndex;
+                }
+                else
+                {
+                    low = firstIndex + 1;
+                }
+            }
+            return low;
+        }
+
+        //! Writes the entries [outputBegin, outputEnd) of the merge of both runs. Splitting the output of a merge this way
+        //! allows multiple tasks to merge the same runs without synchronizing.
+        template<class OutputFunction>
+        void MergeRuns(const SortEntry* first, size_t firstCount, const SortEntry* second, size_t secondCount,
+            size_t outputBegin, size_t outputEnd, const SortEntryLess& less, const OutputFunction& output)
+        {
+            size_t firstIndex = FindMergeSplit(first, firstCount, second, secondCount, outputBegin, less);
+            size_t secondIndex = outputBegin - firstIndex;
+            for (size_t outputIndex = outputBegin; outputIndex < outputEnd; ++outputIndex)
+            {
+                if (secondIndex == secondCount || (firstIndex < firstCount && !less(second[secondIndex], first[firstIndex])))
+                {
+                    output(outputIndex, first[firstIndex++]);
+                }
+                else
+                {
+                    output(outputIndex, second[secondIndex++]);
+                }
+            }
+        }
+
+        //! Runs the work items on the calling thread as well as on tasks. The calling thread claims work items like the tasks
+        //! do and only waits for work items and tasks that already started, so it never waits for tasks to be scheduled.
+        //! Draw lists are sorted from within tasks, which could otherwise wait on each other.
+        template<class WorkFunction>
+        void RunWorkItems(TaskExecutor& taskExecutor, size_t workItemCount, const WorkFunction& work)
+        {
+            struct WorkState
+            {
+                WorkState(size_t workItemCount, const WorkFunction& work)
+                    : m_workItemCount(workItemCount)
+                    , m_work(&work)
+                {
+                }
+
+                void Run()
+                {
+                    for (size_t workItem = m_nextWorkItem.fetch_add(1); workItem < m_workItemCount; workItem = m_nextWorkItem.fetch_add(1))
                     {
-                        return a.m_depth < b.m_depth;
+                        (*m_work)(workItem);
+                        m_completedWorkItemCount.fetch_add(1, AZStd::memory_order_release);
                     }
-                    return a.m_item < b.m_item;
                 }
-            );
-            break;
 
-        case DrawListSortType::KeyThenReverseDepth:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                //! Tasks register before checking whether the caller is done with the work function. The caller closes the state
+                //! before waiting for the registered tasks, so a task either sees the state closed or is waited for.
+                void RunTask()
                 {
-                    if (a.m_sortKey != b.m_sortKey)
+                    m_runningTaskCount.fetch_add(1);
+                    if (!m_isClosed.load())
                     {
-                        return a.m_sortKey < b.m_sortKey;
+                        Run();
                     }
-                    if (a.m_depth != b.m_depth)
+                    m_runningTaskCount.fetch_sub(1, AZStd::memory_order_release);
+                }
+
+                void Close()
+                {
+                    m_isClosed.store(true);
+                    while (m_runningTaskCount.load(AZStd::memory_order_acquire) != 0)
                     {
-                        return a.m_depth > b.m_depth;
+                        AZStd::this_thread::yield();
                     }
-                    return a.m_item < b.m_item;
                 }
-            );
-            break;
 
-        case DrawListSortType::DepthThenKey:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                const size_t m_workItemCount;
+                const WorkFunction* m_work;
+                AZStd::atomic<size_t> m_nextWorkItem{ 0 };
+                AZStd::atomic<size_t> m_completedWorkItemCount{ 0 };
+                AZStd::atomic<size_t> m_runningTaskCount{ 0 };
+                AZStd::atomic<bool> m_isClosed{ false };
+            };
+
+            // Tasks that only start after the caller returned touch nothing but this state, which they keep alive
+            auto state = AZStd::make_shared<WorkState>(workItemCount, work);
+
+            static const AZ::TaskDescriptor sortTaskDescriptor{ "RHI_SortDrawList", "Graphics" };
+            AZ::TaskGraph taskGraph{ "DrawList Sort" };
+            for (size_t i = 1; i < workItemCount; ++i)
+            {
+                taskGraph.AddTask(sortTaskDescriptor, [state]()
+                    {
+                        state->RunTask();
+                    });
+            }
+            if (!taskGraph.IsEmpty())
+            {
+                taskGraph.Detach();
+                taskGraph.SubmitOnExecutor(taskExecutor);
+            }
+
+            state->Run();
+            while (state->m_completedWorkItemCount.load(AZStd::memory_order_acquire) < workItemCount)
+            {
+                AZStd::this_thread::yield();
+            }
+            state->Close();
+        }
+
+        //! Sorts the chunks of the list in parallel and then merges them in rounds, with every round split evenly over the tasks.
+        void ParallelRadixSortDrawList(DrawList& drawList, DrawListSortType sortType, TaskExecutor& taskExecutor, size_t taskCount)
+        {
+            const size_t itemCount = drawList.size();
+            RadixSortBuffer& buffer = GetRadixSortBuffer();
+            buffer.Reserve(itemCount, taskCount);
+            SortEntry* entries = buffer.m_entries.data();
+            SortEntry* scratch = buffer.m_scratch.data();
+            RadixHistograms* histograms = buffer.m_histograms.data();
+            // The items keep their unsorted order until all entries are sorted, so the tie break can look them up by index
+            const DrawItemProperties* items = drawList.data();
+            const SortEntryLess less{ items };
+
+            SortRuns runs(taskCount);
+            const size_t itemsPerChunk = AZ::DivideAndRoundUp(itemCount, taskCount);
+            for (size_t chunk = 0; chunk < taskCount; ++chunk)
+            {
+                runs[chunk].m_offset = AZStd::min(chunk * itemsPerChunk, itemCount);
+                runs[chunk].m_count = AZStd::min(itemsPerChunk, itemCount - runs[chunk].m_offset);
+            }
+
+            RunWorkItems(taskExecutor, taskCount, [&](size_t chunk)
                 {
-                    if (a.m_depth != b.m_depth)
+                    const SortRun& run = runs[chunk];
+                    for (size_t i = run.m_offset; i < run.m_offset + run.m_count; ++i)
                     {
-                        return a.m_depth < b.m_depth;
+                        entries[i] = MakeSortEntry(items[i], static_cast<uint32_t>(i), sortType);
                     }
-                    if (a.m_sortKey != b.m_sortKey)
+                    RadixSortEntries(entries + run.m_offset, scratch + run.m_offset, histograms[chunk], run.m_count, items);
+                });
+
+            // Merge pairs of runs until one is left
+            SortEntry* source = entries;
+            SortEntry* destination = scratch;
+            while (runs.size() > 1)
+            {
+                const size_t itemsPerTask = AZ::DivideAndRoundUp(itemCount, taskCount);
+                RunWorkItems(taskExecutor, taskCount, [&](size_t task)
                     {
-                        return a.m_sortKey < b.m_sortKey;
-                    }
-                    return a.m_item < b.m_item;
-                }
-            );
-            break;
+                        const size_t taskBegin = AZStd::min(task * itemsPerTask, itemCount);
+                        const size_t taskEnd = AZStd::min(taskBegin + itemsPerTask, itemCount);
+                        for (size_t runIndex = 0; runIndex < runs.size(); runIndex += 2)
+                        {
+                            const SortRun& first = runs[runIndex];
+                            const SortRun second = runIndex + 1 < runs.size() ? runs[runIndex + 1] : SortRun{ first.m_offset + first.m_count, 0 };
+                            const size_t mergeBegin = AZStd::max(first.m_offset, taskBegin);
+                            const size_t mergeEnd = AZStd::min(second.m_offset + second.m_count, taskEnd);
+                            if (mergeBegin >= mergeEnd)
+                            {
+                                continue;
+                            }
+
+                            SortEntry* mergeDestination = destination + first.m_offset;
+                            MergeRuns(source + first.m_offset, first.m_count, source + second.m_offset, second.m_count,
+                                mergeBegin - first.m_offset, mergeEnd - first.m_offset, less,
+                                [mergeDestination](size_t index, const SortEntry& entry)
+                                {
+                                    mergeDestination[index] = entry;
+                                });
+                        }
+                    });
 
-        case DrawListSortType::ReverseDepthThenKey:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                SortRuns mergedRuns;
+                for (size_t runIndex = 0; runIndex < runs.size(); runIndex += 2)
                 {
-                    if (a.m_depth != b.m_depth)
+                    const size_t secondCount = runIndex + 1 < runs.size() ? runs[runIndex + 1].m_count : 0;
+                    mergedRuns.push_back(SortRun{ runs[runIndex].m_offset, runs[runIndex].m_count + secondCount });
+                }
+                runs = mergedRuns;
+                AZStd::swap(source, destination);
+            }
+
+            ApplySortOrder(drawList, source);
+        }
+
+        void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+        {
+            const size_t itemCount = drawList.size();
+            RadixSortBuffer& buffer = GetRadixSortBuffer();
+            buffer.Reserve(itemCount, 1);
+            SortEntry* entries = buffer.m_entries.data();
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                entries[i] = MakeSortEntry(drawList[i], static_cast<uint32_t>(i), sortType);
+            }
+
+            RadixSortEntries(entries, buffer.m_scratch.data(), buffer.m_histograms[0], itemCount, drawList.data());
+            ApplySortOrder(drawList, entries);
+        }
+
+        void ComparisonSortDrawList(DrawList& drawList, DrawListSortType sortType)
+        {
+            switch (sortType)
+            {
+            case DrawListSortType::KeyThenDepth:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
                     {
-                        return a.m_depth > b.m_depth;
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth < b.m_depth;
+                        }
+                        return a.m_item < b.m_item;
                     }
-                    if (a.m_sortKey != b.m_sortKey)
+                );
+                break;
+
+            case DrawListSortType::KeyThenReverseDepth:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
                     {
-                        return a.m_sortKey < b.m_sortKey;
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth > b.m_depth;
+                        }
+                        return a.m_item < b.m_item;
                     }
-                    return a.m_item < b.m_item;
-                }
-            );
-            break;
+                );
+                break;
+
+            case DrawListSortType::DepthThenKey:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                    {
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth < b.m_depth;
+                        }
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        return a.m_item < b.m_item;
+                    }
+                );
+                break;
+
+            case DrawListSortType::ReverseDepthThenKey:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                    {
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth > b.m_depth;
+                        }
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        return a.m_item < b.m_item;
+                    }
+                );
+                break;
+            }
+        }
+    } // namespace
+
+    DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
+    {
+        if (drawList.empty())
+        {
+            return DrawListView{};
+        }
+
+        const size_t itemsPerPartition = AZ::DivideAndRoundUp(drawList.size(), partitionCount);
+        const size_t itemOffset = partitionIndex * itemsPerPartition;
+        const size_t itemCount = AZStd::min(drawList.size() - itemOffset, itemsPerPartition);
+        return DrawListView(&drawList[itemOffset], itemCount);
+    }
+
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+    {
+        TaskExecutor* taskExecutor = nullptr;
+        if (drawList.size() >= ParallelSortMinItemsPerTask * 2)
+        {
+            if (auto* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+                taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive())
+            {
+                taskExecutor = &TaskExecutor::Instance();
+            }
+        }
+        SortDrawList(drawList, sortType, taskExecutor);
+    }
+
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType, TaskExecutor* taskExecutor)
+    {
+        const size_t itemCount = drawList.size();
+        if (itemCount < RadixSortMinItemCount)
+        {
+            ComparisonSortDrawList(drawList, sortType);
+            return;
+        }
+
+        const size_t taskCount = AZStd::min(
+            AZStd::min(itemCount / ParallelSortMinItemsPerTask, ParallelSortMaxTaskCount), size_t{ AZStd::thread::hardware_concurrency() });
+        if (taskExecutor != nullptr && taskCount > 1)
+        {
+            ParallelRadixSortDrawList(drawList, sortType, *taskExecutor, taskCount);
+        }
+        else
+        {
+            RadixSortDrawList(drawList, sortType);
         }
     }
 }
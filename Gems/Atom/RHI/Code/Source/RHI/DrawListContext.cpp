@@ -43,22 +43,7 @@ namespace AZ::RHI
     {
         if (drawPacket)
         {
-            DrawListsByTag& threadListsByTag = m_threadListsByTag.GetStorage();
-
-            for (size_t i = 0; i < drawPacket->GetDrawItemCount(); ++i)
-            {
-                const DrawListTag drawListTag = drawPacket->GetDrawListTag(i);
-
-                if (m_drawListMask[drawListTag.GetIndex()])
-                {
-                    DrawItemProperties drawItem = drawPacket->GetDrawItemProperties(i);
-                    if (drawItem.m_item->GetEnabled())
-                    {
-                        drawItem.m_depth = depth;
-                        threadListsByTag[drawListTag.GetIndex()].push_back(drawItem);
-                    }
-                }
-            }
+            AddDrawPacketToLists(m_threadListsByTag.GetStorage(), *drawPacket, depth);
         }
         else
         {
@@ -69,6 +54,43 @@ namespace AZ::RHI
         }
     }
 
+    void DrawListContext::AddDrawPackets(AZStd::span<const DrawPacket* const> drawPackets, float depth)
+    {
+        DrawListsByTag& threadListsByTag = m_threadListsByTag.GetStorage();
+        for (const DrawPacket* drawPacket : drawPackets)
+        {
+            if (drawPacket)
+            {
+                AddDrawPacketToLists(threadListsByTag, *drawPacket, depth);
+            }
+            else
+            {
+                AZ_Error(
+                    "DrawListContext",
+                    false,
+                    "Null draw packet was added to a draw list context. Visible object will be ignored.");
+            }
+        }
+    }
+
+    void DrawListContext::AddDrawPacketToLists(DrawListsByTag& threadListsByTag, const DrawPacket& drawPacket, float depth) const
+    {
+        for (size_t i = 0; i < drawPacket.GetDrawItemCount(); ++i)
+        {
+            const DrawListTag drawListTag = drawPacket.GetDrawListTag(i);
+
+            if (m_drawListMask[drawListTag.GetIndex()])
+            {
+                DrawItemProperties drawItem = drawPacket.GetDrawItemProperties(i);
+                if (drawItem.m_item->GetEnabled())
+                {
+                    drawItem.m_depth = depth;
+                    threadListsByTag[drawListTag.GetIndex()].push_back(drawItem);
+                }
+            }
+        }
+    }
+
     void DrawListContext::AddDrawItem(DrawListTag drawListTag, DrawItemProperties drawItemProperties)
     {
         if (!drawItemProperties.m_item->GetEnabled())
@@ -18,11 +18,32 @@
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
 namespace AZ::RHI
 {
+    namespace
+    {
+        // Hashes what the compile phases read from a transient attachment, besides its descriptor.
+        HashValue64 HashTransientAttachmentUsage(const FrameAttachment& attachment, int deviceCount, HashValue64 seed)
+        {
+            const uint32_t attachmentKey[] = { attachment.GetId().GetHash(), static_cast<uint32_t>(attachment.GetSupportedQueueMask()) };
+            seed = TypeHash64(attachmentKey, seed);
+
+            for (int deviceIndex = 0; deviceIndex < deviceCount; ++deviceIndex)
+            {
+                const Scope* firstScope = attachment.GetFirstScope(deviceIndex);
+                const Scope* lastScope = attachment.GetLastScope(deviceIndex);
+                const uint32_t scopeIndices[] = { firstScope ? firstScope->GetIndex() : static_cast<uint32_t>(-1),
+                                                  lastScope ? lastScope->GetIndex() : static_cast<uint32_t>(-1) };
+                seed = TypeHash64(scopeIndices, seed);
+            }
+            return seed;
+        }
+    }
+
     ResultCode FrameGraphCompiler::Init()
     {
         const ResultCode resultCode = InitInternal();
@@ -46,10 +67,16 @@ namespace AZ::RHI
         m_bufferViewCache.Clear();
         m_imageReverseLookupHash.clear();
         m_bufferReverseLookupHash.clear();
+        m_compiledStructure = {};
 
         ShutdownInternal();
     }
 
+    const FrameGraphCompileStatistics& FrameGraphCompiler::GetStatistics() const
+    {
+        return m_statistics;
+    }
+
     MessageOutcome FrameGraphCompiler::ValidateCompileRequest(const FrameGraphCompileRequest& request) const
     {
         if (Validation::IsEnabled())
@@ -99,6 +126,9 @@ namespace AZ::RHI
     //
     //          The final phase is to compile the platform specific scopes and hand-off compilation to the platform-specific
     //          implementation, which may introduce more phases specific to the platform API.
+    //
+    // When the frame graph has the same structure as the one compiled on the previous frame, phases 1 and 2 apply the results
+    // of the previous compile instead of computing them again.
     MessageOutcome FrameGraphCompiler::Compile(const FrameGraphCompileRequest& request)
     {
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Compile");
@@ -111,15 +141,57 @@ namespace AZ::RHI
 
         FrameGraph& frameGraph = *request.m_frameGraph;
 
+        const bool isReuseEnabled = !CheckBitsAny(request.m_compileFlags, FrameSchedulerCompileFlags::DisableCompileReuse);
+        const HashValue64 structureHash = isReuseEnabled ? HashFrameGraphStructure(request) : HashValue64{ 0 };
+        const bool reuseCompiledStructure = isReuseEnabled && m_compiledStructure.m_isValid && m_compiledStructure.m_hash == structureHash;
+        if (!reuseCompiledStructure)
+        {
+            // Rebuilt by the phases below.
+            m_compiledStructure = {};
+            m_compiledStructure.m_hash = structureHash;
+        }
+
+        const AZStd::chrono::steady_clock::time_point compileStartTime = AZStd::chrono::steady_clock::now();
+
         /// [Phase 1] Compiles the cross-queue scope graph.
-        CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+        if (reuseCompiledStructure)
+        {
+            ReuseQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+        }
+        else
+        {
+            CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+        }
 
         /// [Phase 2] Compile transient attachments across all scopes.
         CompileTransientAttachments(
             frameGraph,
             *request.m_transientAttachmentPool,
             request.m_compileFlags,
-            request.m_statisticsFlags);
+            request.m_statisticsFlags,
+            reuseCompiledStructure);
+
+        const AZStd::chrono::microseconds compileTime =
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - compileStartTime);
+        if (reuseCompiledStructure)
+        {
+            ++m_statistics.m_reusedCompileCount;
+            if (m_compiledStructure.m_compileTime > compileTime)
+            {
+                m_statistics.m_timeSaved += m_compiledStructure.m_compileTime - compileTime;
+            }
+        }
+        else
+        {
+            ++m_statistics.m_fullCompileCount;
+            m_compiledStructure.m_compileTime = compileTime;
+            m_compiledStructure.m_isValid = isReuseEnabled;
+        }
+        m_statistics.m_lastCompileReused = reuseCompiledStructure;
+
+        [[maybe_unused]] const double timeSavedMs = AZStd::chrono::duration<double, AZStd::milli>(m_statistics.m_timeSaved).count();
+        AZ_PROFILE_DATAPOINT(RHI, m_statistics.GetReuseRate() * 100.0f, L"FrameGraphCompiler: Compile Reuse Rate (percent)");
+        AZ_PROFILE_DATAPOINT(RHI, timeSavedMs, L"FrameGraphCompiler: Compile Time Saved (ms)");
 
         /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
         CompileResourceViews(frameGraph.GetAttachmentDatabase());
@@ -138,6 +210,96 @@ namespace AZ::RHI
         return CompileInternal(request);
     }
 
+    HashValue64 FrameGraphCompiler::HashFrameGraphStructure(const FrameGraphCompileRequest& request) const
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: HashFrameGraphStructure");
+
+        const FrameGraph& frameGraph = *request.m_frameGraph;
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        const int deviceCount = RHISystemInterface::Get()->GetDeviceCount();
+
+        const uint64_t graphKey[] = { static_cast<uint64_t>(request.m_compileFlags),
+                                      static_cast<uint64_t>(deviceCount),
+                                      reinterpret_cast<uintptr_t>(request.m_transientAttachmentPool),
+                                      frameGraph.GetScopes().size(),
+                                      attachmentDatabase.GetTransientBufferAttachments().size(),
+                                      attachmentDatabase.GetTransientImageAttachments().size() };
+        HashValue64 hash = TypeHash64(graphKey);
+
+        if (request.m_transientAttachmentPool)
+        {
+            // The budgets bound the placement and the memory hint of the transient attachments, and a pool can be initialized
+            // again with different budgets at the same address.
+            for (const auto& [deviceIndex, descriptor] : request.m_transientAttachmentPool->GetDescriptor())
+            {
+                const uint64_t poolKey[] = { static_cast<uint64_t>(deviceIndex),
+                                             static_cast<uint64_t>(descriptor.m_heapParameters.m_type),
+                                             static_cast<uint64_t>(descriptor.m_bufferBudgetInBytes),
+                                             static_cast<uint64_t>(descriptor.m_imageBudgetInBytes),
+                                             static_cast<uint64_t>(descriptor.m_renderTargetBudgetInBytes) };
+                hash = TypeHash64(poolKey, hash);
+            }
+        }
+
+        for (const Scope* scope : frameGraph.GetScopes())
+        {
+            const AZStd::vector<Scope*>& consumers = frameGraph.GetConsumers(*scope);
+            const uint32_t scopeKey[] = { scope->GetId().GetHash(),
+                                          static_cast<uint32_t>(scope->GetHardwareQueueClass()),
+                                          static_cast<uint32_t>(scope->GetDeviceIndex()),
+                                          scope->GetFrameGraphGroupId().GetIndex(),
+                                          static_cast<uint32_t>(scope->GetTransientAttachments().size()),
+                                          static_cast<uint32_t>(consumers.size()) };
+            hash = TypeHash64(scopeKey, hash);
+
+            for (const Scope* consumer : consumers)
+            {
+                hash = TypeHash64(consumer->GetIndex(), hash);
+            }
+        }
+
+        for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+        {
+            hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+            hash = HashTransientAttachmentUsage(*transientBuffer, deviceCount, hash);
+        }
+
+        for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+        {
+            hash = transientImage->GetImageDescriptor().GetHash(hash);
+            hash = HashTransientAttachmentUsage(*transientImage, deviceCount, hash);
+        }
+
+        return hash;
+    }
+
+    void FrameGraphCompiler::LinkProducerConsumerByQueues(Scope* producer, Scope* consumer)
+    {
+        Scope::LinkProducerConsumerByQueues(producer, consumer);
+        m_compiledStructure.m_queueLinks.emplace_back(producer->GetIndex(), consumer->GetIndex());
+    }
+
+    void FrameGraphCompiler::ReuseQueueCentricScopeGraph(
+        FrameGraph& frameGraph,
+        FrameSchedulerCompileFlags compileFlags)
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: ReuseQueueCentricScopeGraph");
+
+        if (CheckBitsAll(compileFlags, FrameSchedulerCompileFlags::DisableAsyncQueues))
+        {
+            for (Scope* scope : frameGraph.GetScopes())
+            {
+                scope->m_hardwareQueueClass = HardwareQueueClass::Graphics;
+            }
+        }
+
+        const auto& scopes = frameGraph.GetScopes();
+        for (const auto& [producerIndex, consumerIndex] : m_compiledStructure.m_queueLinks)
+        {
+            Scope::LinkProducerConsumerByQueues(scopes[producerIndex], scopes[consumerIndex]);
+        }
+    }
+
     void FrameGraphCompiler::CompileQueueCentricScopeGraph(
         FrameGraph& frameGraph,
         FrameSchedulerCompileFlags compileFlags)
@@ -164,7 +326,7 @@ namespace AZ::RHI
                 {
                     if (producer[hardwareQueueClassIdx]->GetDeviceIndex() == consumer->GetDeviceIndex())
                     {
-                        Scope::LinkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
+                        LinkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
                     }
                 }
                 producer[hardwareQueueClassIdx] = consumer;
@@ -216,7 +378,7 @@ namespace AZ::RHI
                     {
                         if (producerScopeLast->GetDeviceIndex() == currentScope->GetDeviceIndex())
                         {
-                            Scope::LinkProducerConsumerByQueues(producerScopeLast, currentScope);
+                            LinkProducerConsumerByQueues(producerScopeLast, currentScope);
                         }
                     }
                 }
@@ -537,11 +699,41 @@ namespace AZ::RHI
         }
     }
 
+    template<class T>
+    void FrameGraphCompiler::StoreTransientAttachmentLifetimes(
+        const AZStd::vector<T*>& frameAttachments, AZStd::vector<TransientLifetime>& lifetimes)
+    {
+        for (uint32_t attachmentIndex = 0; attachmentIndex < static_cast<uint32_t>(frameAttachments.size()); ++attachmentIndex)
+        {
+            for (const auto& [deviceIndex, scopeInfo] : frameAttachments[attachmentIndex]->m_scopeInfos)
+            {
+                if (scopeInfo.m_firstScope && scopeInfo.m_lastScope)
+                {
+                    lifetimes.push_back(
+                        TransientLifetime{ attachmentIndex, deviceIndex, scopeInfo.m_firstScope->GetIndex(), scopeInfo.m_lastScope->GetIndex() });
+                }
+            }
+        }
+    }
+
+    template<class T>
+    void FrameGraphCompiler::ReuseTransientAttachmentLifetimes(
+        const AZStd::vector<Scope*>& scopes, const AZStd::vector<T*>& frameAttachments, const AZStd::vector<TransientLifetime>& lifetimes)
+    {
+        for (const TransientLifetime& lifetime : lifetimes)
+        {
+            auto& scopeInfo = frameAttachments[lifetime.m_attachmentIndex]->m_scopeInfos[lifetime.m_deviceIndex];
+            scopeInfo.m_firstScope = scopes[lifetime.m_firstScopeIndex];
+            scopeInfo.m_lastScope = scopes[lifetime.m_lastScopeIndex];
+        }
+    }
+
     void FrameGraphCompiler::CompileTransientAttachments(
         FrameGraph& frameGraph,
         TransientAttachmentPool& transientAttachmentPool,
         FrameSchedulerCompileFlags compileFlags,
-        FrameSchedulerStatisticsFlags statisticsFlags)
+        FrameSchedulerStatisticsFlags statisticsFlags,
+        bool reuseCompiledStructure)
     {
         const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
         if (attachmentDatabase.GetTransientBufferAttachments().empty() && attachmentDatabase.GetTransientImageAttachments().empty())
@@ -551,9 +743,26 @@ namespace AZ::RHI
 
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-        ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-        ExtendTransientAttachmentGroupLifetimes(frameGraph, compileFlags);
+        const auto& scopes = frameGraph.GetScopes();
+        const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+        const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+
+        if (reuseCompiledStructure)
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: ReuseTransientAttachmentLifetimes");
+            ReuseTransientAttachmentLifetimes(scopes, transientBufferGraphAttachments, m_compiledStructure.m_transientBufferLifetimes);
+            ReuseTransientAttachmentLifetimes(scopes, transientImageGraphAttachments, m_compiledStructure.m_transientImageLifetimes);
+        }
+        else
+        {
+            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+            ExtendTransientAttachmentGroupLifetimes(frameGraph, compileFlags);
+
+            StoreTransientAttachmentLifetimes(transientBufferGraphAttachments, m_compiledStructure.m_transientBufferLifetimes);
+            StoreTransientAttachmentLifetimes(transientImageGraphAttachments, m_compiledStructure.m_transientImageLifetimes);
+        }
 
+        // The load store actions belong to this frame's scope attachments, so they are always optimized.
         OptimizeTransientLoadStoreActions(frameGraph, compileFlags);
 
         // Builds a sortable key. It iterates each scope and performs deactivations
@@ -578,9 +787,9 @@ namespace AZ::RHI
                 m_bits.m_attachmentIndex = attachmentIndex;
             }
 
-            bool operator < (Command rhs) const
+            explicit Command(uint32_t command)
+                : m_command(command)
             {
-                return m_command < rhs.m_command;
             }
 
             struct Bits
@@ -603,10 +812,6 @@ namespace AZ::RHI
             };
         };
 
-        const auto& scopes = frameGraph.GetScopes();
-        const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
-        const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
-
         AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
             "Exceeded maximum number of allowed scopes");
 
@@ -616,77 +821,83 @@ namespace AZ::RHI
 
         AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
         AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
-        AZStd::vector<Command> commands;
-        commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
-        AZStd::vector<AZStd::pair<int, uint32_t>> removeBuffers;
-        AZStd::vector<AZStd::pair<int, uint32_t>> removeImages;
 
-        if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+        // The commands only depend on the lifetimes, so they are kept when the next frame graph has the same structure.
+        AZStd::vector<uint32_t>& commands = m_compiledStructure.m_transientCommands;
+        AZStd::vector<AZStd::pair<int, uint32_t>>& removeBuffers = m_compiledStructure.m_unusedTransientBuffers;
+        AZStd::vector<AZStd::pair<int, uint32_t>>& removeImages = m_compiledStructure.m_unusedTransientImages;
+
+        if (!reuseCompiledStructure)
         {
-            const uint32_t ScopeIndexFirst = 0;
-            const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+            commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            // Generate commands for each transient buffer: one for activation, and one for deactivation.
-            for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
             {
-                commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
-            }
+                const uint32_t ScopeIndexFirst = 0;
+                const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
 
-            // Generate commands for each transient image: one for activation, and one for deactivation.
-            for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
-            {
-                commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
-            }
-        }
-        else
-        {
-            for (int deviceIndex{ 0 }; deviceIndex < RHISystemInterface::Get()->GetDeviceCount(); ++deviceIndex)
-            {
                 // Generate commands for each transient buffer: one for activation, and one for deactivation.
                 for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
                 {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const auto* firstScope = transientBuffer->GetFirstScope(deviceIndex);
-                    const auto* lastScope = transientBuffer->GetLastScope(deviceIndex);
-                    if (firstScope == nullptr || lastScope == nullptr)
-                    {
-                        removeBuffers.emplace_back(deviceIndex, attachmentIndex);
-                        // If the attachment is owned by a pass that isn't a scope-producer (e.g. Parent-Pass), and is not connected to
-                        // anything, the first and last scope will be empty. We will get a warning its unused in ValidateEnd(), but we don't
-                        // want to crash here
-                        continue;
-                    }
-                    const uint32_t scopeIndexFirst = firstScope->GetIndex();
-                    const uint32_t scopeIndexLast = lastScope->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    commands.push_back(Command(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex).m_command);
+                    commands.push_back(Command(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex).m_command);
                 }
 
                 // Generate commands for each transient image: one for activation, and one for deactivation.
                 for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const auto* firstScope = transientImage->GetFirstScope(deviceIndex);
-                    const auto* lastScope = transientImage->GetLastScope(deviceIndex);
-                    if (firstScope == nullptr || lastScope == nullptr)
+                    commands.push_back(Command(ScopeIndexFirst, Action::ActivateImage, attachmentIndex).m_command);
+                    commands.push_back(Command(ScopeIndexLast, Action::DeactivateImage, attachmentIndex).m_command);
+                }
+            }
+            else
+            {
+                for (int deviceIndex{ 0 }; deviceIndex < RHISystemInterface::Get()->GetDeviceCount(); ++deviceIndex)
+                {
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
                     {
-                        removeImages.emplace_back(deviceIndex, attachmentIndex);
-                        // If the attachment is owned by a pass that isn't a scope-producer (e.g. Parent-Pass), and is not connected to
-                        // anything, the first and last scope will be empty. We will get a warning its unused in ValidateEnd(), but we don't
-                        // want to crash here
-                        continue;
+                        BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                        const auto* firstScope = transientBuffer->GetFirstScope(deviceIndex);
+                        const auto* lastScope = transientBuffer->GetLastScope(deviceIndex);
+                        if (firstScope == nullptr || lastScope == nullptr)
+                        {
+                            removeBuffers.emplace_back(deviceIndex, attachmentIndex);
+                            // If the attachment is owned by a pass that isn't a scope-producer (e.g. Parent-Pass), and is not connected to
+                            // anything, the first and last scope will be empty. We will get a warning its unused in ValidateEnd(), but we don't
+                            // want to crash here
+                            continue;
+                        }
+                        const uint32_t scopeIndexFirst = firstScope->GetIndex();
+                        const uint32_t scopeIndexLast = lastScope->GetIndex();
+                        commands.push_back(Command(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex).m_command);
+                        commands.push_back(Command(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex).m_command);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                        const auto* firstScope = transientImage->GetFirstScope(deviceIndex);
+                        const auto* lastScope = transientImage->GetLastScope(deviceIndex);
+                        if (firstScope == nullptr || lastScope == nullptr)
+                        {
+                            removeImages.emplace_back(deviceIndex, attachmentIndex);
+                            // If the attachment is owned by a pass that isn't a scope-producer (e.g. Parent-Pass), and is not connected to
+                            // anything, the first and last scope will be empty. We will get a warning its unused in ValidateEnd(), but we don't
+                            // want to crash here
+                            continue;
+                        }
+                        const uint32_t scopeIndexFirst = firstScope->GetIndex();
+                        const uint32_t scopeIndexLast = lastScope->GetIndex();
+                        commands.push_back(Command(scopeIndexFirst, Action::ActivateImage, attachmentIndex).m_command);
+                        commands.push_back(Command(scopeIndexLast, Action::DeactivateImage, attachmentIndex).m_command);
                     }
-                    const uint32_t scopeIndexFirst = firstScope->GetIndex();
-                    const uint32_t scopeIndexLast = lastScope->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
                 }
             }
-        }
 
-        AZStd::sort(commands.begin(), commands.end());
+            AZStd::sort(commands.begin(), commands.end());
+        }
 
         auto processCommands = [&](int deviceIndex,
                                    TransientAttachmentPoolCompileFlags compileFlags,
@@ -699,8 +910,9 @@ namespace AZ::RHI
             bool allocateResources = !CheckBitsAny(compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources);
             bool beganScope = false;
 
-            for (Command command : commands)
+            for (uint32_t packedCommand : commands)
             {
+                const Command command(packedCommand);
                 const uint32_t scopeIndex = command.m_bits.m_scopeIndex;
                 const uint32_t attachmentIndex = command.m_bits.m_attachmentIndex;
                 const Action action = (Action)command.m_bits.m_action;
@@ -831,12 +1043,18 @@ namespace AZ::RHI
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (descriptor.m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(
-                    deviceIndex,
-                    TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                auto statistics = transientAttachmentPool.GetDeviceTransientAttachmentPool(deviceIndex)->GetStatistics();
-                memoryUsage = statistics.m_reservedMemory;
+                // The size only depends on the commands, so the first pass is skipped when they were reused.
+                auto memoryHintIt = m_compiledStructure.m_memoryHints.find(deviceIndex);
+                if (memoryHintIt == m_compiledStructure.m_memoryHints.end())
+                {
+                    // First pass to calculate size needed.
+                    processCommands(
+                        deviceIndex,
+                        TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    auto statistics = transientAttachmentPool.GetDeviceTransientAttachmentPool(deviceIndex)->GetStatistics();
+                    memoryHintIt = m_compiledStructure.m_memoryHints.emplace(deviceIndex, statistics.m_reservedMemory).first;
+                }
+                memoryUsage = memoryHintIt->second;
             }
 
             // Second pass uses the information about memory usage
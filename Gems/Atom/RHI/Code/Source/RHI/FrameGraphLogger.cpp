@@ -8,6 +8,7 @@
 
 #include <Atom/RHI/FrameGraphLogger.h>
 #include <Atom/RHI/FrameGraph.h>
+#include <Atom/RHI/FrameGraphCompiler.h>
 #include <Atom/RHI/FrameGraphAttachmentDatabase.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
@@ -18,7 +19,8 @@ namespace AZ::RHI
 {
     void FrameGraphLogger::Log(
         const FrameGraph& frameGraph,
-        FrameSchedulerLogVerbosity logVerbosity)
+        FrameSchedulerLogVerbosity logVerbosity,
+        const FrameGraphCompileStatistics* compileStatistics)
     {
         if (logVerbosity == FrameSchedulerLogVerbosity::None)
         {
@@ -45,6 +47,20 @@ namespace AZ::RHI
         AZ_Printf("FrameGraph", "\t\tImported Swapchains: %d\n", attachmentDatabase.GetSwapChainAttachments().size());
         AZ_Printf("FrameGraph", "\tScope Attachment Count: %d\n", scopeAttachmentCount);
 
+        if (compileStatistics)
+        {
+            AZ_Printf("FrameGraph", "\tCompile Reuse:\n");
+            AZ_Printf("FrameGraph", "\t\tLast Compile: %s\n", compileStatistics->m_lastCompileReused ? "Reused" : "Full");
+            AZ_Printf(
+                "FrameGraph", "\t\tReused: %llu / %llu (%.1f%%)\n",
+                static_cast<unsigned long long>(compileStatistics->m_reusedCompileCount),
+                static_cast<unsigned long long>(compileStatistics->m_reusedCompileCount + compileStatistics->m_fullCompileCount),
+                compileStatistics->GetReuseRate() * 100.0f);
+            AZ_Printf(
+                "FrameGraph", "\t\tTime Saved: %.3f ms\n",
+                AZStd::chrono::duration<double, AZStd::milli>(compileStatistics->m_timeSaved).count());
+        }
+
         if (logVerbosity != FrameSchedulerLogVerbosity::Detail)
         {
             return;
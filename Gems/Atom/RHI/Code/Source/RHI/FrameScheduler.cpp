@@ -227,7 +227,7 @@ namespace AZ::RHI
                 FrameEventBus::Broadcast(&FrameEventBus::Events::OnFrameCompileEnd, *m_frameGraph);
             }
 
-            FrameGraphLogger::Log(*m_frameGraph, compileRequest.m_logVerbosity);
+            FrameGraphLogger::Log(*m_frameGraph, compileRequest.m_logVerbosity, &m_frameGraphCompiler->GetStatistics());
 
             // Builds the scope execution schedule using the compiled graph.
             m_frameGraphExecuter->Begin(*m_frameGraph);
@@ -690,6 +690,11 @@ namespace AZ::RHI
             : AZStd::unordered_map<int, TransientAttachmentStatistics>();
     }
 
+    const FrameGraphCompileStatistics& FrameScheduler::GetFrameGraphCompileStatistics() const
+    {
+        return m_frameGraphCompiler->GetStatistics();
+    }
+
     double FrameScheduler::GetCpuFrameTime() const
     {
         if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+#include <Atom/RHI/DrawList.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/sort.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    /*
+     * Sorts synthetic draw lists, without a device or any draw items. The draw item pointers are only used for ordering,
+     * so they are fake addresses. The sort keys use a handful of values like most passes do, and depths are spread over
+     * the view range. The argument is the number of draw items in the list.
+     */
+    class DrawListSortBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(aznumeric_cast<size_t>(state.range(0)));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp(size_t itemCount)
+        {
+            m_taskExecutor = AZStd::make_unique<TaskExecutor>();
+
+            AZ::SimpleLcgRandom random(1234);
+            m_unsortedList.resize(itemCount);
+            for (RHI::DrawItemProperties& item : m_unsortedList)
+            {
+                item.m_item = reinterpret_cast<const RHI::DrawItem*>(uintptr_t{ 64 } * (1 + random.GetRandom() % itemCount));
+                item.m_sortKey = random.GetRandom() % 8;
+                item.m_depth = random.GetRandomFloat() * 1000.0f;
+                item.m_drawFilterMask = RHI::DrawFilterMaskDefaultValue;
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_unsortedList = {};
+            m_sortedList = {};
+            m_taskExecutor.reset();
+        }
+
+        //! The sort that was used for all draw lists before the radix sort, as a baseline
+        static void ComparisonSort(RHI::DrawList& drawList)
+        {
+            AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                {
+                    if (a.m_sortKey != b.m_sortKey)
+                    {
+                        return a.m_sortKey < b.m_sortKey;
+                    }
+                    if (a.m_depth != b.m_depth)
+                    {
+                        return a.m_depth < b.m_depth;
+                    }
+                    return a.m_item < b.m_item;
+                });
+        }
+
+        template<class SortFunction>
+        void RunSort(benchmark::State& state, const SortFunction& sort)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                m_sortedList = m_unsortedList;
+                state.ResumeTiming();
+
+                sort(m_sortedList);
+                benchmark::DoNotOptimize(m_sortedList.data());
+            }
+            state.SetItemsProcessed(state.iterations() * m_unsortedList.size());
+        }
+
+        AZStd::unique_ptr<TaskExecutor> m_taskExecutor;
+        RHI::DrawList m_unsortedList;
+        RHI::DrawList m_sortedList;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, ComparisonSort)(benchmark::State& state)
+    {
+        RunSort(state, [](RHI::DrawList& drawList) { ComparisonSort(drawList); });
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, SerialRadixSort)(benchmark::State& state)
+    {
+        RunSort(state, [](RHI::DrawList& drawList) { RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth, nullptr); });
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, ParallelRadixSort)(benchmark::State& state)
+    {
+        TaskExecutor* taskExecutor = m_taskExecutor.get();
+        RunSort(state, [taskExecutor](RHI::DrawList& drawList)
+            {
+                RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth, taskExecutor);
+            });
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, ComparisonSort)
+        ->ArgName("Items")->Arg(1024)->Arg(16384)->Arg(65536)->Arg(262144)
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, SerialRadixSort)
+        ->ArgName("Items")->Arg(1024)->Arg(16384)->Arg(65536)->Arg(262144)
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, ParallelRadixSort)
+        ->ArgName("Items")->Arg(1024)->Arg(16384)->Arg(65536)->Arg(262144)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace UnitTest
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Atom/RHI/DrawList.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class DrawListTests
+        : public RHITestFixture
+        , public ::testing::WithParamInterface<RHI::DrawListSortType>
+    {
+    protected:
+        //! Builds a list with few distinct keys and depths, so that the tie breaking on the draw item is covered too.
+        RHI::DrawList BuildDrawList(size_t itemCount, uint32_t seed)
+        {
+            AZ::SimpleLcgRandom random(seed);
+            const float depths[] = { -100.0f, -1.5f, -0.0f, 0.0f, 0.25f, 1.5f, 1000.0f };
+            const RHI::DrawItemSortKey sortKeys[] = { AZStd::numeric_limits<RHI::DrawItemSortKey>::min(), -1, 0, 1, 0x100000000ll,
+                                                      AZStd::numeric_limits<RHI::DrawItemSortKey>::max() };
+
+            RHI::DrawList drawList(itemCount);
+            for (RHI::DrawItemProperties& item : drawList)
+            {
+                // The draw items are never dereferenced, so only their addresses matter
+                item.m_item = reinterpret_cast<const RHI::DrawItem*>(uintptr_t{ 16 } * (1 + random.GetRandom() % 512));
+                item.m_sortKey = sortKeys[random.GetRandom() % AZStd::size(sortKeys)];
+                item.m_depth = (random.GetRandom() % 4 == 0) ? random.GetRandomFloat() * 200.0f - 100.0f
+                                                              : depths[random.GetRandom() % AZStd::size(depths)];
+                item.m_drawFilterMask = random.GetRandom();
+            }
+            return drawList;
+        }
+
+        static bool IsOrdered(const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b, RHI::DrawListSortType sortType)
+        {
+            const bool reverseDepth =
+                sortType == RHI::DrawListSortType::KeyThenReverseDepth || sortType == RHI::DrawListSortType::ReverseDepthThenKey;
+            const bool depthFirst =
+                sortType == RHI::DrawListSortType::DepthThenKey || sortType == RHI::DrawListSortType::ReverseDepthThenKey;
+            const bool depthLess = reverseDepth ? a.m_depth > b.m_depth : a.m_depth < b.m_depth;
+            const bool depthEqual = a.m_depth == b.m_depth;
+
+            if (!depthFirst && a.m_sortKey != b.m_sortKey)
+            {
+                return a.m_sortKey < b.m_sortKey;
+            }
+            if (!depthEqual)
+            {
+                return depthLess;
+            }
+            if (a.m_sortKey != b.m_sortKey)
+            {
+                return a.m_sortKey < b.m_sortKey;
+            }
+            return a.m_item <= b.m_item;
+        }
+
+        void ValidateSort(const RHI::DrawList& unsorted, const RHI::DrawList& sorted, RHI::DrawListSortType sortType)
+        {
+            ASSERT_EQ(unsorted.size(), sorted.size());
+            for (size_t i = 1; i < sorted.size(); ++i)
+            {
+                ASSERT_TRUE(IsOrdered(sorted[i - 1], sorted[i], sortType)) << "Draw items " << i - 1 << " and " << i << " are out of order";
+            }
+
+            // Every item must still be in the list exactly once
+            AZStd::vector<uint32_t> unsortedMasks, sortedMasks;
+            for (size_t i = 0; i < sorted.size(); ++i)
+            {
+                unsortedMasks.push_back(unsorted[i].m_drawFilterMask);
+                sortedMasks.push_back(sorted[i].m_drawFilterMask);
+            }
+            AZStd::sort(unsortedMasks.begin(), unsortedMasks.end());
+            AZStd::sort(sortedMasks.begin(), sortedMasks.end());
+            EXPECT_EQ(unsortedMasks, sortedMasks);
+        }
+    };
+
+    TEST_P(DrawListTests, SortDrawList_Serial_OrdersBySortType)
+    {
+        for (size_t itemCount : { 0, 1, 17, 255, 256, 1000, 40000 })
+        {
+            const RHI::DrawList unsorted = BuildDrawList(itemCount, static_cast<uint32_t>(itemCount) + 1);
+            RHI::DrawList sorted = unsorted;
+            RHI::SortDrawList(sorted, GetParam(), nullptr);
+            ValidateSort(unsorted, sorted, GetParam());
+        }
+    }
+
+    TEST_P(DrawListTests, SortDrawList_SmallerListAfterLargerList_ReusesSortStorage)
+    {
+        // The sort storage is kept between sorts, so later lists must not pick up entries left behind by larger lists
+        for (size_t itemCount : { 40000, 300, 5000, 256 })
+        {
+            const RHI::DrawList unsorted = BuildDrawList(itemCount, static_cast<uint32_t>(itemCount) * 3);
+            RHI::DrawList sorted = unsorted;
+            RHI::SortDrawList(sorted, GetParam(), nullptr);
+            ValidateSort(unsorted, sorted, GetParam());
+        }
+    }
+
+    TEST_P(DrawListTests, SortDrawList_Parallel_MatchesSerial)
+    {
+        TaskExecutor taskExecutor{ 4 };
+        for (size_t itemCount : { 16384, 50001, 200000 })
+        {
+            const RHI::DrawList unsorted = BuildDrawList(itemCount, static_cast<uint32_t>(itemCount));
+            RHI::DrawList serial = unsorted;
+            RHI::SortDrawList(serial, GetParam(), nullptr);
+
+            RHI::DrawList parallel = unsorted;
+            RHI::SortDrawList(parallel, GetParam(), &taskExecutor);
+            ValidateSort(unsorted, parallel, GetParam());
+
+            // Ties are broken on the draw item, so only items that are identical in every sorted member may swap places
+            for (size_t i = 0; i < serial.size(); ++i)
+            {
+                ASSERT_EQ(serial[i].m_item, parallel[i].m_item);
+                ASSERT_EQ(serial[i].m_sortKey, parallel[i].m_sortKey);
+                ASSERT_TRUE(serial[i].m_depth == parallel[i].m_depth);
+            }
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        DrawList,
+        DrawListTests,
+        ::testing::Values(
+            RHI::DrawListSortType::KeyThenDepth,
+            RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey,
+            RHI::DrawListSortType::ReverseDepthThenKey));
+}
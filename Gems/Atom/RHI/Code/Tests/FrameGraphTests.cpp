@@ -16,6 +16,7 @@
 #include <Atom/RHI/BufferFrameAttachment.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
+#include <Atom/RHI/TransientAttachmentPool.h>
 #include <AzCore/Math/Random.h>
 
 namespace UnitTest
@@ -623,6 +624,67 @@ namespace UnitTest
             }
         }
 
+        void TestCompileReuseInvalidation()
+        {
+            AZStd::unordered_map<int, RHI::TransientAttachmentPoolDescriptor> poolDescriptors;
+            poolDescriptors[RHI::MultiDevice::DefaultDeviceIndex].m_bufferBudgetInBytes = 16 * 1024 * 1024;
+            RHI::Ptr<RHI::TransientAttachmentPool> transientAttachmentPool = aznew RHI::TransientAttachmentPool;
+            ASSERT_EQ(transientAttachmentPool->Init(RHI::MultiDevice::DefaultDevice, poolDescriptors), RHI::ResultCode::Success);
+
+            RHI::FrameGraph frameGraph;
+            const RHI::AttachmentId transientBufferId{ "TransientBuffer" };
+
+            // Every scope uses a transient buffer created by the first scope. Returns whether the compile reused the results
+            // of the previous one.
+            const auto compileFrame = [&](uint32_t scopeCount)
+            {
+                frameGraph.Begin();
+                for (uint32_t scopeIndex = 0; scopeIndex < scopeCount; ++scopeIndex)
+                {
+                    frameGraph.BeginScope(*m_state->m_scopes[scopeIndex]);
+                    frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+
+                    if (scopeIndex == 0)
+                    {
+                        RHI::BufferDescriptor bufferDescriptor;
+                        bufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite;
+                        bufferDescriptor.m_byteCount = BufferSize;
+                        frameGraph.GetAttachmentDatabase().CreateTransientBuffer(RHI::TransientBufferDescriptor{ transientBufferId, bufferDescriptor });
+                    }
+
+                    RHI::BufferScopeAttachmentDescriptor desc;
+                    desc.m_attachmentId = transientBufferId;
+                    desc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+                    frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::ReadWrite, RHI::ScopeAttachmentStage::AnyGraphics);
+
+                    frameGraph.EndScope();
+                }
+                frameGraph.End();
+
+                RHI::FrameGraphCompileRequest request;
+                request.m_frameGraph = &frameGraph;
+                request.m_transientAttachmentPool = transientAttachmentPool.get();
+                m_state->m_frameGraphCompiler->Compile(request);
+                return m_state->m_frameGraphCompiler->GetStatistics().m_lastCompileReused;
+            };
+
+            EXPECT_FALSE(compileFrame(2));
+            EXPECT_TRUE(compileFrame(2));
+
+            // An extra scope changes the structure and the lifetime of the transient buffer
+            EXPECT_FALSE(compileFrame(3));
+            EXPECT_TRUE(compileFrame(3));
+
+            // The same pool with a different budget invalidates the memory hint of the previous compile
+            transientAttachmentPool->Shutdown();
+            poolDescriptors[RHI::MultiDevice::DefaultDeviceIndex].m_bufferBudgetInBytes = 32 * 1024 * 1024;
+            ASSERT_EQ(transientAttachmentPool->Init(RHI::MultiDevice::DefaultDevice, poolDescriptors), RHI::ResultCode::Success);
+            EXPECT_FALSE(compileFrame(3));
+            EXPECT_TRUE(compileFrame(3));
+
+            transientAttachmentPool->Shutdown();
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -687,4 +749,9 @@ namespace UnitTest
     {
         TestOverlappingAttachments();
     }
+
+    TEST_F(FrameGraphTests, TestCompileReuseInvalidation)
+    {
+        TestCompileReuseInvalidation();
+    }
 }
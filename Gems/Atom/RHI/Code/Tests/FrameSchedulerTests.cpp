@@ -10,7 +10,10 @@
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
 #include <Atom/RHI/ScopeProducer.h>
+#include <Atom/RHI/BufferFrameAttachment.h>
+#include <Atom/RHI/FrameEventBus.h>
 #include <Atom/RHI/FrameScheduler.h>
+#include <Atom/RHI/ImageFrameAttachment.h>
 #include <AzCore/Math/Random.h>
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RHI/ImagePool.h>
@@ -143,6 +146,50 @@ namespace UnitTest
         AZStd::vector<BufferUsage> m_bufferUsages;
     };
 
+    //! Records the queue links and transient attachment lifetimes of every compiled frame graph.
+    class CompiledFrameGraphRecorder
+        : public RHI::FrameEventBus::Handler
+    {
+    public:
+        void OnFrameCompileEnd(RHI::FrameGraph& frameGraph) override
+        {
+            AZStd::vector<RHI::ScopeId> compiledFrame;
+            for (const RHI::Scope* scope : frameGraph.GetScopes())
+            {
+                for (uint32_t queueIdx = 0; queueIdx < RHI::HardwareQueueClassCount; ++queueIdx)
+                {
+                    const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(queueIdx);
+                    const RHI::Scope* producer = scope->GetProducerByQueue(hardwareQueueClass);
+                    const RHI::Scope* consumer = scope->GetConsumerByQueue(hardwareQueueClass);
+                    compiledFrame.push_back(producer ? producer->GetId() : RHI::ScopeId{});
+                    compiledFrame.push_back(consumer ? consumer->GetId() : RHI::ScopeId{});
+                }
+            }
+
+            const auto recordLifetime = [&compiledFrame](const RHI::FrameAttachment& attachment)
+            {
+                const RHI::Scope* firstScope = attachment.GetFirstScope(RHI::MultiDevice::DefaultDeviceIndex);
+                const RHI::Scope* lastScope = attachment.GetLastScope(RHI::MultiDevice::DefaultDeviceIndex);
+                compiledFrame.push_back(firstScope ? firstScope->GetId() : RHI::ScopeId{});
+                compiledFrame.push_back(lastScope ? lastScope->GetId() : RHI::ScopeId{});
+            };
+
+            const RHI::FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            for (const RHI::BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                recordLifetime(*transientBuffer);
+            }
+            for (const RHI::ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                recordLifetime(*transientImage);
+            }
+
+            m_compiledFrames.push_back(AZStd::move(compiledFrame));
+        }
+
+        AZStd::vector<AZStd::vector<RHI::ScopeId>> m_compiledFrames;
+    };
+
     class FrameSchedulerTests
         : public RHITestFixture
     {
@@ -237,14 +284,9 @@ namespace UnitTest
             RHITestFixture::TearDown();
         }
 
-        void Test()
+        //! Declares usages of imported and transient attachments over random scope intervals.
+        void SetupScopeProducerUsages()
         {
-            RHI::FrameScheduler frameScheduler;
-
-            RHI::FrameSchedulerDescriptor descriptor;
-            descriptor.m_transientAttachmentPoolDescriptors[RHI::MultiDevice::DefaultDeviceIndex].m_bufferBudgetInBytes = 80 * 1024 * 1024;
-            frameScheduler.Init(RHI::MultiDevice::DefaultDevice, descriptor);
-
             RHI::ImageScopeAttachmentDescriptor imageBindingDescs[2];
             imageBindingDescs[0].m_imageViewDescriptor = RHI::ImageViewDescriptor();
             imageBindingDescs[0].m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Clear;
@@ -385,6 +427,17 @@ namespace UnitTest
                     }
                 }
             }
+        }
+
+        void Test()
+        {
+            RHI::FrameScheduler frameScheduler;
+
+            RHI::FrameSchedulerDescriptor descriptor;
+            descriptor.m_transientAttachmentPoolDescriptors[RHI::MultiDevice::DefaultDeviceIndex].m_bufferBudgetInBytes = 80 * 1024 * 1024;
+            frameScheduler.Init(RHI::MultiDevice::DefaultDevice, descriptor);
+
+            SetupScopeProducerUsages();
 
             for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
             {
@@ -407,6 +460,74 @@ namespace UnitTest
             frameScheduler.Shutdown();
         }
 
+        void TestCompileReuse()
+        {
+            RHI::FrameScheduler frameScheduler;
+
+            RHI::FrameSchedulerDescriptor descriptor;
+            descriptor.m_transientAttachmentPoolDescriptors[RHI::MultiDevice::DefaultDeviceIndex].m_bufferBudgetInBytes = 80 * 1024 * 1024;
+            frameScheduler.Init(RHI::MultiDevice::DefaultDevice, descriptor);
+
+            SetupScopeProducerUsages();
+
+            CompiledFrameGraphRecorder recorder;
+            recorder.BusConnect(m_device.get());
+
+            // Returns whether the frame reused the compile results of the previous frame.
+            const auto runFrame = [&](RHI::FrameSchedulerCompileFlags compileFlags)
+            {
+                frameScheduler.BeginFrame();
+
+                for (AZStd::unique_ptr<ScopeProducer>& producer : m_state->m_producers)
+                {
+                    frameScheduler.ImportScopeProducer(*producer);
+                }
+
+                RHI::FrameSchedulerCompileRequest compileRequest;
+                compileRequest.m_jobPolicy = RHI::JobPolicy::Serial;
+                compileRequest.m_compileFlags = compileFlags;
+                frameScheduler.Compile(compileRequest);
+
+                frameScheduler.Execute(RHI::JobPolicy::Serial);
+
+                frameScheduler.EndFrame();
+
+                return frameScheduler.GetFrameGraphCompileStatistics().m_lastCompileReused;
+            };
+
+            // Only the first frame is compiled in full, the structure of the following frames is the same.
+            EXPECT_FALSE(runFrame(RHI::FrameSchedulerCompileFlags::None));
+            for (uint32_t frameIdx = 1; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                EXPECT_TRUE(runFrame(RHI::FrameSchedulerCompileFlags::None));
+            }
+
+            // Reused compile results match the full compile.
+            ASSERT_EQ(recorder.m_compiledFrames.size(), size_t{ FrameIterationCount });
+            for (uint32_t frameIdx = 1; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                EXPECT_TRUE(recorder.m_compiledFrames[frameIdx] == recorder.m_compiledFrames[0]);
+            }
+
+            // Different compile flags fall back to a full compile, which is then reused.
+            EXPECT_FALSE(runFrame(RHI::FrameSchedulerCompileFlags::DisableAttachmentAliasing));
+            EXPECT_TRUE(runFrame(RHI::FrameSchedulerCompileFlags::DisableAttachmentAliasing));
+            EXPECT_FALSE(runFrame(RHI::FrameSchedulerCompileFlags::None));
+            EXPECT_TRUE(recorder.m_compiledFrames.back() == recorder.m_compiledFrames[0]);
+
+            // Every frame is compiled in full when reuse is disabled.
+            EXPECT_FALSE(runFrame(RHI::FrameSchedulerCompileFlags::DisableCompileReuse));
+            EXPECT_FALSE(runFrame(RHI::FrameSchedulerCompileFlags::DisableCompileReuse));
+            EXPECT_TRUE(recorder.m_compiledFrames.back() == recorder.m_compiledFrames[0]);
+
+            const RHI::FrameGraphCompileStatistics& statistics = frameScheduler.GetFrameGraphCompileStatistics();
+            EXPECT_EQ(statistics.m_fullCompileCount, 5u);
+            EXPECT_EQ(statistics.m_reusedCompileCount, uint64_t{ FrameIterationCount });
+
+            recorder.BusDisconnect();
+            frameScheduler.Shutdown();
+        }
+
     private:
         static const uint32_t FrameIterationCount = 128;
         static const uint32_t ImportedImageCount = 16;
@@ -439,4 +560,9 @@ namespace UnitTest
     {
         Test();
     }
+
+    TEST_F(FrameSchedulerTests, CompileReuse)
+    {
+        TestCompileReuse();
+    }
 }
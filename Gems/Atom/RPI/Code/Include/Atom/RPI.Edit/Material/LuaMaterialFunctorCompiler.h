@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Edit/Configuration.h>
+#include <Atom/RPI.Reflect/Material/LuaMaterialFunctorProgram.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class ShaderResourceGroupLayout;
+    }
+
+    namespace RPI
+    {
+        class MaterialPropertiesLayout;
+        class MaterialNameContext;
+
+        namespace LuaMaterialFunctorCompiler
+        {
+            //! Compiles the Process(context) function of a lua material functor script into a LuaMaterialFunctorProgram.
+            //! Names are resolved against the layouts the functor will run with, after applying @materialNameContext
+            //! the same way LuaMaterialFunctorAPI does.
+            //!
+            //! Only the subset of Lua used by common material functors can be compiled:
+            //! - Constants assigned at the top level of the script, like "OpacityMode_Blended = 2".
+            //! - Locals, assignments, if/elseif/else, and/or/not, comparisons, and arithmetic on numbers.
+            //! - Globals assigned at the top level of Process() before they are read.
+            //! - Context functions that read bool, int, uint, enum, float and Image properties, set shader options, shader constants
+            //!   and internal properties, and enable shaders by tag. Names must be string literals, or parameters bound to string literals.
+            //! - Error(), Warning() and Print() with a string literal.
+            //! - Calls to other functions of the script, which are inlined.
+            //! Anything else fails the compilation, and the functor keeps running its script.
+            //!
+            //! @param script the source of the script, not its compiled bytecode
+            //! @param shaderResourceGroupLayout may be null, in which case scripts that set shader constants can't be compiled
+            //! @return the program, or the reason the script could not be compiled
+            ATOM_RPI_EDIT_API Outcome<LuaMaterialFunctorProgram, AZStd::string> Compile(
+                AZStd::string_view script,
+                const MaterialPropertiesLayout* materialPropertiesLayout,
+                const RHI::ShaderResourceGroupLayout* shaderResourceGroupLayout,
+                const MaterialNameContext& materialNameContext);
+        } // namespace LuaMaterialFunctorCompiler
+    } // namespace RPI
+} // namespace AZ
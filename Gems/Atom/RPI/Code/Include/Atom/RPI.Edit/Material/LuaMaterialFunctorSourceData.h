@@ -14,18 +14,22 @@
 namespace UnitTest
 {
     class LuaMaterialFunctorTests;
+    class LuaMaterialFunctorBenchmark;
 }
 
 namespace AZ
 {
     namespace RPI
     {
+        class LuaMaterialFunctor;
+
         //! Builds a LuaMaterialFunctor.
         //! Materials can use this functor to create custom scripted operations.
         class ATOM_RPI_EDIT_API LuaMaterialFunctorSourceData final
             : public AZ::RPI::MaterialFunctorSourceData
         {
             friend class UnitTest::LuaMaterialFunctorTests;
+            friend class UnitTest::LuaMaterialFunctorBenchmark;
         public:
             AZ_CLASS_ALLOCATOR(LuaMaterialFunctorSourceData, AZ::SystemAllocator)
             AZ_RTTI(AZ::RPI::LuaMaterialFunctorSourceData, "{E6F6D022-340C-47E3-A0BA-4EFE79C0CD1A}", RPI::MaterialFunctorSourceData);
@@ -48,6 +52,13 @@ namespace AZ
                 const MaterialPropertiesLayout* propertiesLayout,
                 const MaterialNameContext* materialNameContext) const;
 
+            // Compiles the Process() function of the script, so the functor can run it without lua. Scripts that can't be compiled keep running in lua.
+            void CompileProcessFunction(
+                LuaMaterialFunctor& functor,
+                const AZStd::string& materialTypeSourceFilePath,
+                const MaterialPropertiesLayout* propertiesLayout,
+                const RHI::ShaderResourceGroupLayout* shaderResourceGroupLayout) const;
+
             // Only one of these should have data
             AZStd::string m_luaSourceFile;
             AZStd::string m_luaScript;
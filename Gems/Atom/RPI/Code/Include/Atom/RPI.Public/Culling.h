@@ -14,6 +14,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 
@@ -129,6 +130,9 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! Index of the cullable in the bounds storage of the CullingScene it's registered with. Managed by the CullingScene.
+            uint32_t m_cullingBoundsIndex = AZStd::numeric_limits<uint32_t>::max();
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -159,6 +163,7 @@ namespace AZ
             bool m_enableStats = false;
             bool m_enableFrustumCulling = true;
             bool m_parallelOctreeTraversal = true;
+            bool m_useCullableBounds = true;
             bool m_freezeFrustums = false;
             bool m_debugDraw = false;
             bool m_drawViewFrustum = false;
@@ -229,6 +234,43 @@ namespace AZ
         //! Selects an lod (based on size-in-screen-space) and adds the appropriate DrawPackets to the view.
         ATOM_RPI_PUBLIC_API uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, AzFramework::VisibilityEntry::TypeFlags typeFlags);
 
+        //! Bounding spheres and lod selection radii of all cullables registered with a CullingScene. They're stored as structure
+        //! of arrays in blocks of four, so the frustum and lod tests can process four cullables at a time with SIMD instructions
+        //! while walking the blocks linearly.
+        //! Inserting and removing is thread-safe. Reading the blocks is only allowed between CullingScene::BeginCulling() and
+        //! CullingScene::EndCulling(), when cullables can't be registered.
+        class ATOM_RPI_PUBLIC_API CullableBoundsStorage
+        {
+        public:
+            static constexpr uint32_t BlockSize = 4;
+            static constexpr uint32_t InvalidIndex = AZStd::numeric_limits<uint32_t>::max();
+
+            struct alignas(16) Block
+            {
+                float m_centerX[BlockSize] = {};
+                float m_centerY[BlockSize] = {};
+                float m_centerZ[BlockSize] = {};
+                float m_radius[BlockSize] = {};
+                float m_lodSelectionRadius[BlockSize] = {};
+                //! Null for the unused lanes of the last block
+                Cullable* m_cullables[BlockSize] = {};
+            };
+
+            //! Adds the cullable, or updates its bounds if it was added already.
+            void InsertOrUpdate(Cullable& cullable);
+
+            //! Removes the cullable. The last cullable is moved into its place to keep the blocks packed.
+            void Remove(Cullable& cullable);
+
+            uint32_t GetCount() const;
+            AZStd::span<const Block> GetBlocks() const;
+
+        private:
+            AZStd::mutex m_mutex;
+            AZStd::vector<Block> m_blocks;
+            uint32_t m_count = 0;
+        };
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
@@ -299,6 +341,9 @@ namespace AZ
             //! Returns the visibility scene
             const AzFramework::IVisibilityScene* GetVisibilityScene() const;
 
+            //! Returns the bounds of the registered cullables
+            const CullableBoundsStorage& GetCullableBounds() const;
+
         protected:
             size_t CountObjectsInScene();
 
@@ -309,6 +354,7 @@ namespace AZ
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
+            CullableBoundsStorage m_cullableBounds;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
@@ -9,6 +9,7 @@
 
 #include <Atom/RPI.Public/Configuration.h>
 #include <Atom/RPI.Public/Shader/ShaderVariant.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
@@ -86,6 +87,7 @@ namespace AZ
             //! variant is loaded and available or if a variant changes, etc.
             //! This function should be your one stop shop to get a ShaderVariant from a ShaderVariantId.
             //! Alternatively: You can call FindVariantStableId() followed by GetVariant(shaderVariantStableId).
+            //! Ids that were resolved before are looked up without taking a lock.
             const ShaderVariant& GetVariant(const ShaderVariantId& shaderVariantId);
 
             //! Finds the best matching shader variant asset and returns its StableId.
@@ -181,7 +183,7 @@ namespace AZ
             void OnAssetReloaded(Data::Asset<Data::AssetData> asset) override;
 
             // ShaderVariantFinderNotificationBus overrides...
-            void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> /*shaderVariantTreeAsset*/, bool /*isError*/) override {};
+            void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset, bool isError) override;
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool IsError) override;
 
             //! A strong reference to the shader asset.
@@ -215,7 +217,7 @@ namespace AZ
             //! A handle to the pipeline library in the pipeline state cache.
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
-            //! Used for thread safety for FindVariantStableId() and GetVariant().
+            //! Used for thread safety for GetVariant(). Guards m_shaderVariants and the writes to m_variantLookupCache.
             AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
@@ -224,6 +226,10 @@ namespace AZ
             //! Local cache of ShaderVariants (except for the root variant), searchable by StableId.
             //! Gets populated when GetVariant() is called.
             AZStd::unordered_map<ShaderVariantStableId, ShaderVariant> m_shaderVariants;
+
+            //! Lock-free cache of the variants returned by GetVariant(ShaderVariantId), which point to m_rootVariant or into m_shaderVariants.
+            //! Ids whose variant is still loading are pending, and are resolved by OnShaderVariantAssetReady().
+            ShaderVariantLookupCache m_variantLookupCache;
             
             //! DrawListTag associated with this shader.
             RHI::DrawListTag m_drawListTag;
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Configuration.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class ShaderVariant;
+
+        //! An open addressed hash table mapping ShaderVariantIds to the ShaderVariants a Shader resolved them to.
+        //! Find() and Contains() are lock-free and can run concurrently with each other and with one writer.
+        //! All other functions are writers, and the owner must serialize them.
+        //!
+        //! Entries are never removed. An entry either holds a variant or is pending, which means the id was requested
+        //! before its variant was available. Reset() turns every entry back to pending and starts a new generation.
+        //! A writer that resolved a variant without holding the owner's lock must capture GetGeneration() before resolving it,
+        //! and only insert it if the generation is unchanged, otherwise it may cache a variant that a Reset() invalidated.
+        //! When the table grows, the previous table is retired instead of freed, because lookups may still be reading it.
+        //! Retired tables are freed with the cache.
+        class ATOM_RPI_PUBLIC_API ShaderVariantLookupCache final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(ShaderVariantLookupCache, SystemAllocator);
+
+            ShaderVariantLookupCache() = default;
+            AZ_DISABLE_COPY_MOVE(ShaderVariantLookupCache);
+
+            //! Returns the variant cached for the id, or null if the id has no entry or its entry is pending.
+            const ShaderVariant* Find(const ShaderVariantId& shaderVariantId) const;
+
+            //! Returns whether the id has an entry, pending or not.
+            bool Contains(const ShaderVariantId& shaderVariantId) const;
+
+            //! Sets the variant of the id, adding an entry if there is none. A null variant makes the entry pending.
+            void Insert(const ShaderVariantId& shaderVariantId, const ShaderVariant* shaderVariant);
+
+            //! Calls resolveFunction(const ShaderVariantId&) for every pending entry,
+            //! and stores the variant it returns unless it returns null.
+            template<typename ResolveFunction>
+            void ResolvePending(ResolveFunction&& resolveFunction);
+
+            //! Makes every entry pending and increments the generation.
+            void Reset();
+
+            //! Returns the number of times Reset() was called.
+            uint64_t GetGeneration() const;
+
+            //! Returns the number of entries, pending or not.
+            size_t GetEntryCount() const;
+
+        private:
+            struct Entry
+            {
+                //! Zero while the entry is empty. It is published after m_shaderVariantId, which never changes afterwards.
+                AZStd::atomic<size_t> m_hash{ 0 };
+                ShaderVariantId m_shaderVariantId;
+                AZStd::atomic<const ShaderVariant*> m_shaderVariant{ nullptr };
+            };
+
+            struct Table
+            {
+                AZ_CLASS_ALLOCATOR(Table, SystemAllocator);
+
+                AZStd::unique_ptr<Entry[]> m_entries;
+                size_t m_capacity = 0;
+            };
+
+            static constexpr size_t InitialCapacity = 64;
+
+            //! Returns a non-zero hash of the id.
+            static size_t GetHash(const ShaderVariantId& shaderVariantId);
+
+            static Entry* FindEntry(const Table& table, const ShaderVariantId& shaderVariantId, size_t hash);
+
+            //! Publishes the id in the first empty entry of its probe sequence.
+            static void AddEntry(Table& table, const ShaderVariantId& shaderVariantId, size_t hash, const ShaderVariant* shaderVariant);
+
+            //! Publishes a table with twice the capacity holding the current entries, and returns it.
+            Table& Grow();
+
+            //! The table used by lookups.
+            AZStd::atomic<Table*> m_table{ nullptr };
+
+            //! Every table created by this cache. The last one is m_table, the others are retired.
+            AZStd::vector<AZStd::unique_ptr<Table>> m_tables;
+
+            AZStd::atomic<size_t> m_entryCount{ 0 };
+
+            AZStd::atomic<uint64_t> m_generation{ 0 };
+        };
+
+        template<typename ResolveFunction>
+        void ShaderVariantLookupCache::ResolvePending(ResolveFunction&& resolveFunction)
+        {
+            Table* table = m_table.load(AZStd::memory_order_relaxed);
+            if (!table)
+            {
+                return;
+            }
+
+            for (size_t index = 0; index < table->m_capacity; ++index)
+            {
+                Entry& entry = table->m_entries[index];
+                if (entry.m_hash.load(AZStd::memory_order_relaxed) == 0 || entry.m_shaderVariant.load(AZStd::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                if (const ShaderVariant* shaderVariant = resolveFunction(entry.m_shaderVariantId))
+                {
+                    entry.m_shaderVariant.store(shaderVariant, AZStd::memory_order_release);
+                }
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -80,6 +80,9 @@ namespace AZ
 
             //! Similar to previous AddDrawPacket() but calculates depth from packet position
             void AddDrawPacket(const RHI::DrawPacket* drawPacket, const Vector3& worldPosition);
+
+            //! Adds multiple draw packets of an object at the same depth, which only looks up the draw lists of the calling thread once.
+            void AddDrawPackets(AZStd::span<const RHI::DrawPacket* const> drawPackets, float depth = 0.0f);
             
             //! Similar to AddDrawPacket, but the view will not submit any draw items for rendering. It will just
             //! maintain a list of visible objects for the current frame, and the caller must get that list, reinterpret the
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Configuration.h>
+#include <Atom/RPI.Reflect/Material/LuaMaterialFunctorProgram.h>
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <Atom/RPI.Reflect/Material/MaterialPropertyDescriptor.h>
 #include <Atom/RPI.Reflect/Material/MaterialNameContext.h>
@@ -17,6 +18,7 @@
 namespace UnitTest
 {
     class LuaMaterialFunctorTests;
+    class LuaMaterialFunctorBenchmark;
 }
 
 namespace AZ
@@ -405,6 +407,7 @@ namespace AZ
         {
             friend class LuaMaterialFunctorSourceData;
             friend class UnitTest::LuaMaterialFunctorTests;
+            friend class UnitTest::LuaMaterialFunctorBenchmark;
         public:
             AZ_RTTI(AZ::RPI::LuaMaterialFunctor, "{1EBDFEC1-FC45-4506-9B0F-AE05FA3779E1}", RPI::MaterialFunctor);
             AZ_CLASS_ALLOCATOR(AZ::RPI::LuaMaterialFunctor, SystemAllocator);
@@ -434,6 +437,9 @@ namespace AZ
             AZStd::vector<char> m_scriptBuffer;
             
             MaterialNameContext m_materialNameContext;
+
+            //! Process() compiled ahead of time. When valid, it runs instead of the script in the runtime contexts.
+            LuaMaterialFunctorProgram m_compiledProgram;
             
             enum class ScriptStatus
             {
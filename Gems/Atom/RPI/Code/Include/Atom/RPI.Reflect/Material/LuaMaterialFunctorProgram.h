@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Configuration.h>
+#include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertyDescriptor.h>
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayoutDescriptor.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace RPI
+    {
+        //! The Process() function of a LuaMaterialFunctor script, compiled ahead of time by LuaMaterialFunctorCompiler.
+        //! Only a subset of Lua can be compiled, so a LuaMaterialFunctor falls back to running its script when it has no program.
+        //!
+        //! A program is a list of instructions for a small register machine. Values are nil, bool, number, image or shader item,
+        //! and live in a fixed size register file on the stack. Material property indexes and shader input indexes are resolved
+        //! when the program is compiled, so Execute() does not need a Lua state and does not allocate. Shader options, internal
+        //! material properties and shader tags are still passed to the context by Name, because they are resolved against each
+        //! shader and material pipeline the functor runs with; those lookups are hashes of the precomputed Names.
+        //! Execute() only reads the program, so one program can run for many materials at the same time.
+        //!
+        //! Programs are loaded from material type assets, so a program is only executed after Validate() has checked its
+        //! registers, operands and jump targets. This is done when the program is compiled and after it is deserialized.
+        class ATOM_RPI_REFLECT_API LuaMaterialFunctorProgram
+        {
+        public:
+            AZ_TYPE_INFO(AZ::RPI::LuaMaterialFunctorProgram, "{9DB8C967-D416-4053-AA37-E0FD9936F78F}");
+            AZ_CLASS_ALLOCATOR(LuaMaterialFunctorProgram, SystemAllocator);
+
+            static void Reflect(ReflectContext* context);
+
+            //! The number of registers a program may use.
+            static constexpr uint32_t MaxRegisterCount = 64;
+
+            //! In the descriptions below, R[x] is a register, and "operand" indexes one of the constant lists of the program.
+            enum class OpCode : uint8_t
+            {
+                LoadNil,                    //!< R[target] = nil
+                LoadBool,                   //!< R[target] = operand != 0
+                LoadNumber,                 //!< R[target] = m_numbers[operand]
+                Move,                       //!< R[target] = R[a]
+
+                GetPropertyBool,            //!< R[target] = value of the property m_propertyIndexes[operand]
+                GetPropertyInt,
+                GetPropertyUInt,
+                GetPropertyFloat,
+                GetPropertyImage,           //!< Null images are loaded as nil
+
+                Not,                        //!< R[target] = not R[a]
+                Negate,                     //!< R[target] = -R[a]
+                Add,                        //!< R[target] = R[a] + R[b]
+                Subtract,
+                Multiply,
+                Divide,
+                Equal,                      //!< R[target] = R[a] == R[b]
+                NotEqual,
+                Less,
+                LessEqual,
+
+                Jump,                       //!< Continues at instruction operand
+                JumpIfFalse,                //!< Continues at instruction operand if R[a] is nil or false
+                JumpIfTrue,                 //!< Continues at instruction operand unless R[a] is nil or false
+
+                SetShaderOptionBool,        //!< Sets the shader option m_names[operand] to R[a]
+                SetShaderOptionUInt,
+                SetShaderOptionEnum,        //!< Sets the shader option m_names[operand] to the value m_names[operand + 1]
+
+                SetShaderConstantBool,      //!< Sets the material SRG constant m_shaderInputIndexes[operand] to R[a]
+                SetShaderConstantInt,
+                SetShaderConstantUInt,
+                SetShaderConstantFloat,
+
+                SetInternalPropertyBool,    //!< Sets the internal material property m_names[operand] to R[a]
+                SetInternalPropertyInt,
+                SetInternalPropertyUInt,
+                SetInternalPropertyFloat,
+
+                HasShaderWithTag,           //!< R[target] = whether the shader collection has a shader tagged m_names[operand]
+                GetShaderByTag,             //!< R[target] = the shader tagged m_names[operand]
+                SetShaderEnabled,           //!< Enables the shader R[a] if R[b] is not nil or false
+
+                Error,                      //!< Reports m_messages[operand] the way the Lua Error() function does
+                Warning,
+                Print,
+
+                Return
+            };
+
+            struct Instruction
+            {
+                AZ_TYPE_INFO(AZ::RPI::LuaMaterialFunctorProgram::Instruction, "{6312ACD9-E084-476A-9D5B-F3F54B22489F}");
+
+                uint8_t m_opCode = 0;       //!< An OpCode
+                uint8_t m_target = 0;
+                uint8_t m_a = 0;
+                uint8_t m_b = 0;
+                uint32_t m_operand = 0;
+            };
+
+            //! Returns whether there is a program to execute, and it passed Validate().
+            bool IsValid() const;
+
+            //! Checks that the opcodes, registers, constant list operands and jump targets of every instruction are in range,
+            //! and caches the result for IsValid(). Material property and shader input indexes depend on the layouts the program
+            //! runs with, so those are checked when they are used instead.
+            //! @return the reason the program can't be executed, if any
+            Outcome<void, AZStd::string> Validate();
+
+            //! Returns whether the program calls functions that are only available in MaterialFunctorAPI::RuntimeContext.
+            bool UsesRuntimeContextFunctions() const;
+
+            void Execute(MaterialFunctorAPI::RuntimeContext& context) const;
+            //! The program must not use runtime context functions.
+            void Execute(MaterialFunctorAPI::PipelineRuntimeContext& context) const;
+
+            AZStd::vector<Instruction> m_instructions;
+            AZStd::vector<double> m_numbers;
+            //! Shader option names and values, internal material property names and shader tags.
+            AZStd::vector<Name> m_names;
+            AZStd::vector<AZStd::string> m_messages;
+            AZStd::vector<MaterialPropertyIndex> m_propertyIndexes;
+            AZStd::vector<RHI::ShaderInputConstantIndex> m_shaderInputIndexes;
+            bool m_usesRuntimeContextFunctions = false;
+
+        private:
+            template<typename ContextType>
+            void ExecuteInternal(ContextType& context) const;
+
+            //! Not serialized, set by Validate().
+            bool m_isValid = false;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -48,6 +48,8 @@ namespace AZ
             Allowed
         };
 
+        class LuaMaterialFunctorProgram;
+
         namespace LuaMaterialFunctorAPI
         {
             class ConfigureShaders;
@@ -104,6 +106,7 @@ namespace AZ
             class ATOM_RPI_REFLECT_API ConfigureShaders
             {
                 friend LuaMaterialFunctorAPI::ConfigureShaders;
+                friend LuaMaterialFunctorProgram;
 
             public:
                 virtual ~ConfigureShaders() = default;
@@ -0,0 +1,2008 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Edit/Material/LuaMaterialFunctorCompiler.h>
+#include <Atom/RPI.Reflect/Material/MaterialNameContext.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayout.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace LuaMaterialFunctorCompiler
+        {
+            namespace
+            {
+                using OpCode = LuaMaterialFunctorProgram::OpCode;
+
+                enum class TokenType : uint8_t
+                {
+                    Name,
+                    Number,
+                    String,
+                    Symbol,
+                    End
+                };
+
+                struct Token
+                {
+                    TokenType m_type = TokenType::End;
+                    //! The name, the symbol, or the value of a string literal
+                    AZStd::string m_text;
+                    double m_number = 0.0;
+                    uint32_t m_line = 0;
+                };
+
+                bool IsNameStart(char c)
+                {
+                    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+                }
+
+                bool IsDigit(char c)
+                {
+                    return c >= '0' && c <= '9';
+                }
+
+                bool IsHexDigit(char c)
+                {
+                    return IsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+                }
+
+                //! Returns the level of the long bracket "[==[" that starts at @position, or -1 if there is none.
+                int GetLongBracketLevel(AZStd::string_view script, size_t position)
+                {
+                    if (position >= script.size() || script[position] != '[')
+                    {
+                        return -1;
+                    }
+
+                    int level = 0;
+                    for (++position; position < script.size() && script[position] == '='; ++position)
+                    {
+                        ++level;
+                    }
+
+                    return (position < script.size() && script[position] == '[') ? level : -1;
+                }
+
+                Outcome<AZStd::vector<Token>, AZStd::string> Tokenize(AZStd::string_view script)
+                {
+                    AZStd::vector<Token> tokens;
+                    uint32_t line = 1;
+                    size_t position = 0;
+
+                    auto failure = [&line](const char* message)
+                    {
+                        return Failure(AZStd::string::format("line %u: %s", line, message));
+                    };
+
+                    while (position < script.size())
+                    {
+                        const char c = script[position];
+
+                        if (c == '\n')
+                        {
+                            ++line;
+                            ++position;
+                            continue;
+                        }
+
+                        if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v')
+                        {
+                            ++position;
+                            continue;
+                        }
+
+                        if (script.substr(position, 2) == "--")
+                        {
+                            position += 2;
+                            const int level = GetLongBracketLevel(script, position);
+                            if (level >= 0)
+                            {
+                                const AZStd::string closingBracket = "]" + AZStd::string(level, '=') + "]";
+                                const size_t end = script.find(closingBracket, position);
+                                if (end == AZStd::string_view::npos)
+                                {
+                                    return failure("unfinished long comment");
+                                }
+                                for (; position < end; ++position)
+                                {
+                                    line += script[position] == '\n' ? 1 : 0;
+                                }
+                                position = end + closingBracket.size();
+                            }
+                            else
+                            {
+                                while (position < script.size() && script[position] != '\n')
+                                {
+                                    ++position;
+                                }
+                            }
+                            continue;
+                        }
+
+                        Token token;
+                        token.m_line = line;
+
+                        if (IsNameStart(c))
+                        {
+                            const size_t start = position;
+                            while (position < script.size() && (IsNameStart(script[position]) || IsDigit(script[position])))
+                            {
+                                ++position;
+                            }
+                            token.m_type = TokenType::Name;
+                            token.m_text = script.substr(start, position - start);
+                        }
+                        else if (IsDigit(c) || (c == '.' && position + 1 < script.size() && IsDigit(script[position + 1])))
+                        {
+                            const size_t start = position;
+                            if (script.substr(position, 2) == "0x" || script.substr(position, 2) == "0X")
+                            {
+                                for (position += 2; position < script.size() && IsHexDigit(script[position]); ++position)
+                                {
+                                    const char digit = script[position];
+                                    const int digitValue = IsDigit(digit) ? digit - '0' : (digit | 0x20) - 'a' + 10;
+                                    token.m_number = token.m_number * 16.0 + digitValue;
+                                }
+                            }
+                            else
+                            {
+                                while (position < script.size() && (IsDigit(script[position]) || script[position] == '.'))
+                                {
+                                    ++position;
+                                }
+                                if (position < script.size() && (script[position] == 'e' || script[position] == 'E'))
+                                {
+                                    ++position;
+                                    if (position < script.size() && (script[position] == '+' || script[position] == '-'))
+                                    {
+                                        ++position;
+                                    }
+                                    while (position < script.size() && IsDigit(script[position]))
+                                    {
+                                        ++position;
+                                    }
+                                }
+
+                                const AZStd::string text{ script.substr(start, position - start) };
+                                size_t parsedLength = 0;
+                                token.m_number = AZStd::stod(text, &parsedLength);
+                                if (parsedLength != text.size())
+                                {
+                                    return failure("malformed number");
+                                }
+                            }
+
+                            if (position < script.size() && IsNameStart(script[position]))
+                            {
+                                return failure("malformed number");
+                            }
+                            token.m_type = TokenType::Number;
+                        }
+                        else if (c == '"' || c == '\'')
+                        {
+                            for (++position;; ++position)
+                            {
+                                if (position >= script.size() || script[position] == '\n')
+                                {
+                                    return failure("unfinished string");
+                                }
+
+                                char character = script[position];
+                                if (character == c)
+                                {
+                                    ++position;
+                                    break;
+                                }
+
+                                if (character == '\\')
+                                {
+                                    if (++position >= script.size())
+                                    {
+                                        return failure("unfinished string");
+                                    }
+
+                                    switch (script[position])
+                                    {
+                                    case 'n':
+                                        character = '\n';
+                                        break;
+                                    case 't':
+                                        character = '\t';
+                                        break;
+                                    case '\\':
+                                    case '"':
+                                    case '\'':
+                                        character = script[position];
+                                        break;
+                                    default:
+                                        return failure("unsupported escape sequence");
+                                    }
+                                }
+
+                                token.m_text.push_back(character);
+                            }
+                            token.m_type = TokenType::String;
+                        }
+                        else if (GetLongBracketLevel(script, position) >= 0)
+                        {
+                            return failure("long strings are not supported");
+                        }
+                        else
+                        {
+                            static constexpr const char* LongSymbols[] = { "...", "==", "~=", "<=", ">=", "..", "::", "//", "<<", ">>" };
+                            static constexpr AZStd::string_view ShortSymbols = "+-*/%^#&~|<>=(){}[];:,.";
+
+                            for (const char* symbol : LongSymbols)
+                            {
+                                if (script.substr(position).starts_with(symbol))
+                                {
+                                    token.m_text = symbol;
+                                    break;
+                                }
+                            }
+
+                            if (token.m_text.empty())
+                            {
+                                if (ShortSymbols.find(c) == AZStd::string_view::npos)
+                                {
+                                    return failure("unexpected character");
+                                }
+                                token.m_text = AZStd::string(1, c);
+                            }
+
+                            position += token.m_text.size();
+                            token.m_type = TokenType::Symbol;
+                        }
+
+                        tokens.push_back(AZStd::move(token));
+                    }
+
+                    Token endToken;
+                    endToken.m_line = line;
+                    tokens.push_back(AZStd::move(endToken));
+
+                    return Success(AZStd::move(tokens));
+                }
+
+                //! The static types of a value, as a mask because a variable may hold values of different types.
+                using TypeMask = uint8_t;
+                constexpr TypeMask NilType = 1 << 0;
+                constexpr TypeMask BoolType = 1 << 1;
+                constexpr TypeMask NumberType = 1 << 2;
+                constexpr TypeMask ImageType = 1 << 3;
+                constexpr TypeMask ShaderItemType = 1 << 4;
+                //! Strings only exist at compile time, as the names passed to functions.
+                constexpr TypeMask StringType = 1 << 5;
+
+                struct Constant
+                {
+                    TypeMask m_type = NilType;
+                    bool m_bool = false;
+                    double m_number = 0.0;
+                    AZStd::string m_string;
+                };
+
+                Constant MakeBoolConstant(bool value)
+                {
+                    Constant constant;
+                    constant.m_type = BoolType;
+                    constant.m_bool = value;
+                    return constant;
+                }
+
+                Constant MakeNumberConstant(double value)
+                {
+                    Constant constant;
+                    constant.m_type = NumberType;
+                    constant.m_number = value;
+                    return constant;
+                }
+
+                bool IsTrue(const Constant& constant)
+                {
+                    return constant.m_type != NilType && (constant.m_type != BoolType || constant.m_bool);
+                }
+
+                bool AreEqual(const Constant& a, const Constant& b)
+                {
+                    if (a.m_type != b.m_type)
+                    {
+                        return false;
+                    }
+
+                    switch (a.m_type)
+                    {
+                    case BoolType:
+                        return a.m_bool == b.m_bool;
+                    case NumberType:
+                        return a.m_number == b.m_number;
+                    case StringType:
+                        return a.m_string == b.m_string;
+                    default:
+                        return true;
+                    }
+                }
+
+                enum class ValueKind : uint8_t
+                {
+                    Constant,   //!< Known at compile time
+                    Register,   //!< Computed at runtime
+                    Context     //!< The context passed to Process()
+                };
+
+                struct Expression
+                {
+                    ValueKind m_kind = ValueKind::Constant;
+                    Constant m_constant;
+                    uint8_t m_register = 0;
+                    TypeMask m_type = NilType;
+                    //! Whether the register holds an intermediate result that nothing else refers to, so it can be reused.
+                    bool m_isTemporary = false;
+                    bool m_isCall = false;
+
+                    TypeMask GetType() const
+                    {
+                        return m_kind == ValueKind::Constant ? m_constant.m_type : m_type;
+                    }
+                };
+
+                struct Variable
+                {
+                    AZStd::string m_name;
+                    //! Parameters bound to constants are constants, so names can be passed to the functions of the script.
+                    ValueKind m_kind = ValueKind::Register;
+                    Constant m_constant;
+                    uint8_t m_register = 0;
+                    TypeMask m_type = NilType;
+                };
+
+                struct Function
+                {
+                    AZStd::vector<AZStd::string> m_parameters;
+                    //! The token range of the body, m_bodyEnd is the closing "end"
+                    size_t m_bodyBegin = 0;
+                    size_t m_bodyEnd = 0;
+                };
+
+                //! A call to a function being compiled, Process() or an inlined function.
+                struct FunctionScope
+                {
+                    AZStd::string m_name;
+                    size_t m_firstVariable = 0;
+                    uint32_t m_blockDepth = 0;
+                    bool m_isProcess = false;
+                    bool m_hasResult = false;
+                    uint8_t m_resultRegister = 0;
+                    TypeMask m_resultType = NilType;
+                    AZStd::vector<uint32_t> m_returnJumps;
+                };
+
+                struct BinaryOperator
+                {
+                    const char* m_symbol;
+                    int m_leftPriority;
+                    int m_rightPriority;
+                };
+
+                // Same priorities as the Lua parser
+                constexpr BinaryOperator BinaryOperators[] = {
+                    { "or", 1, 1 },
+                    { "and", 2, 2 },
+                    { "==", 3, 3 }, { "~=", 3, 3 }, { "<", 3, 3 }, { "<=", 3, 3 }, { ">", 3, 3 }, { ">=", 3, 3 },
+                    { "..", 9, 8 },
+                    { "+", 10, 10 }, { "-", 10, 10 },
+                    { "*", 11, 11 }, { "/", 11, 11 }, { "%", 11, 11 }, { "//", 11, 11 },
+                    { "^", 14, 13 },
+                };
+                constexpr int UnaryPriority = 12;
+
+                constexpr uint32_t MaxInlineDepth = 8;
+
+                bool IsKeyword(AZStd::string_view name)
+                {
+                    static constexpr AZStd::string_view Keywords[] = {
+                        "and", "break", "do", "else", "elseif", "end", "false", "for", "function", "goto", "if", "in",
+                        "local", "nil", "not", "or", "repeat", "return", "then", "true", "until", "while" };
+
+                    for (AZStd::string_view keyword : Keywords)
+                    {
+                        if (name == keyword)
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                //! A single pass compiler that generates the program while it parses the script.
+                //! Functions other than Process() are inlined where they are called, with parameters bound to the arguments,
+                //! so names passed as string literals are still known at compile time inside the called function.
+                class ScriptCompiler
+                {
+                public:
+                    ScriptCompiler(
+                        const AZStd::vector<Token>& tokens,
+                        const MaterialPropertiesLayout* materialPropertiesLayout,
+                        const RHI::ShaderResourceGroupLayout* shaderResourceGroupLayout,
+                        const MaterialNameContext& materialNameContext)
+                        : m_tokens(tokens)
+                        , m_materialPropertiesLayout(materialPropertiesLayout)
+                        , m_shaderResourceGroupLayout(shaderResourceGroupLayout)
+                        , m_materialNameContext(materialNameContext)
+                    {
+                    }
+
+                    Outcome<LuaMaterialFunctorProgram, AZStd::string> Compile()
+                    {
+                        if (!ParseScript() || !CompileProcess())
+                        {
+                            return Failure(m_error);
+                        }
+
+                        // Loading the material type asset validates the program again, this catches compiler bugs at build time.
+                        auto validation = m_program.Validate();
+                        if (!validation.IsSuccess())
+                        {
+                            return Failure(AZStd::string::format("the compiled program is invalid: %s", validation.GetError().c_str()));
+                        }
+
+                        return Success(AZStd::move(m_program));
+                    }
+
+                private:
+                    // Parsing helpers...
+
+                    const Token& Peek(size_t offset = 0) const
+                    {
+                        return m_tokens[AZStd::min(m_position + offset, m_tokens.size() - 1)];
+                    }
+
+                    //! Checks for a keyword or a symbol
+                    bool Check(AZStd::string_view text, size_t offset = 0) const
+                    {
+                        const Token& token = Peek(offset);
+                        return (token.m_type == TokenType::Name || token.m_type == TokenType::Symbol) && token.m_text == text;
+                    }
+
+                    bool Accept(AZStd::string_view text)
+                    {
+                        if (Check(text))
+                        {
+                            ++m_position;
+                            return true;
+                        }
+                        return false;
+                    }
+
+                    bool Expect(AZStd::string_view text)
+                    {
+                        if (Accept(text))
+                        {
+                            return true;
+                        }
+                        return Fail(AZStd::string::format("'%.*s' expected near '%s'", AZ_STRING_ARG(text), Peek().m_text.c_str()));
+                    }
+
+                    bool ExpectName(AZStd::string& name)
+                    {
+                        const Token& token = Peek();
+                        if (token.m_type != TokenType::Name || IsKeyword(token.m_text))
+                        {
+                            return Fail(AZStd::string::format("name expected near '%s'", token.m_text.c_str()));
+                        }
+                        name = token.m_text;
+                        ++m_position;
+                        return true;
+                    }
+
+                    bool IsBlockEnd() const
+                    {
+                        return Peek().m_type == TokenType::End || Check("end") || Check("else") || Check("elseif") || Check("until");
+                    }
+
+                    bool Fail(const AZStd::string& message)
+                    {
+                        if (m_error.empty())
+                        {
+                            m_error = AZStd::string::format("line %u: %s", Peek().m_line, message.c_str());
+                        }
+                        return false;
+                    }
+
+                    // Top level of the script...
+
+                    //! Collects the functions and constants defined at the top level of the script.
+                    bool ParseScript()
+                    {
+                        while (Peek().m_type != TokenType::End)
+                        {
+                            if (Accept(";"))
+                            {
+                                continue;
+                            }
+
+                            const bool isLocal = Accept("local");
+
+                            AZStd::string name;
+                            if (Accept("function"))
+                            {
+                                if (!ExpectName(name))
+                                {
+                                    return false;
+                                }
+
+                                if (Check(".") || Check(":"))
+                                {
+                                    return Fail("functions in tables are not supported");
+                                }
+
+                                Function function;
+                                if (!ParseFunction(function))
+                                {
+                                    return false;
+                                }
+
+                                m_constants.erase(name);
+                                m_functions[name] = AZStd::move(function);
+                            }
+                            else if (Peek().m_type == TokenType::Name && Check("=", 1))
+                            {
+                                ExpectName(name);
+                                Expect("=");
+
+                                Constant constant;
+                                if (!ParseConstant(constant))
+                                {
+                                    return false;
+                                }
+
+                                m_functions.erase(name);
+                                m_constants[name] = AZStd::move(constant);
+                            }
+                            else
+                            {
+                                return Fail(isLocal
+                                    ? "local declarations at the top level must assign a literal"
+                                    : "only functions and constants are supported at the top level of the script");
+                            }
+                        }
+
+                        return true;
+                    }
+
+                    bool ParseFunction(Function& function)
+                    {
+                        if (!Expect("("))
+                        {
+                            return false;
+                        }
+
+                        if (!Check(")"))
+                        {
+                            do
+                            {
+                                AZStd::string parameter;
+                                if (!ExpectName(parameter))
+                                {
+                                    return false;
+                                }
+                                function.m_parameters.push_back(AZStd::move(parameter));
+                            } while (Accept(","));
+                        }
+
+                        if (!Expect(")"))
+                        {
+                            return false;
+                        }
+
+                        // The body is compiled where the function is called, here it is only skipped.
+                        function.m_bodyBegin = m_position;
+                        int depth = 0;
+                        for (;; ++m_position)
+                        {
+                            if (Peek().m_type == TokenType::End)
+                            {
+                                return Fail("'end' expected");
+                            }
+
+                            if (Check("function") || Check("if") || Check("do") || Check("repeat"))
+                            {
+                                ++depth;
+                            }
+                            else if (Check("end") || Check("until"))
+                            {
+                                if (depth == 0)
+                                {
+                                    break;
+                                }
+                                --depth;
+                            }
+                        }
+
+                        function.m_bodyEnd = m_position;
+                        return Expect("end");
+                    }
+
+                    bool ParseConstant(Constant& constant)
+                    {
+                        const bool isNegative = Accept("-");
+                        const Token& token = Peek();
+
+                        if (token.m_type == TokenType::Number)
+                        {
+                            constant = MakeNumberConstant(isNegative ? -token.m_number : token.m_number);
+                        }
+                        else if (isNegative)
+                        {
+                            return Fail("constants at the top level of the script must be literals");
+                        }
+                        else if (token.m_type == TokenType::String)
+                        {
+                            constant.m_type = StringType;
+                            constant.m_string = token.m_text;
+                        }
+                        else if (Check("true") || Check("false"))
+                        {
+                            constant = MakeBoolConstant(Check("true"));
+                        }
+                        else if (!Check("nil"))
+                        {
+                            return Fail("constants at the top level of the script must be literals");
+                        }
+
+                        ++m_position;
+
+                        // Anything but the start of the next statement means the value is an expression
+                        const bool isStatementEnd = Peek().m_type == TokenType::End || Check(";") || Check("function") || Check("local") ||
+                            (Peek().m_type == TokenType::Name && Check("=", 1));
+                        if (!isStatementEnd)
+                        {
+                            return Fail("constants at the top level of the script must be literals");
+                        }
+
+                        return true;
+                    }
+
+                    // Program generation helpers...
+
+                    uint32_t Emit(OpCode opCode, uint8_t target = 0, uint8_t a = 0, uint8_t b = 0, uint32_t operand = 0)
+                    {
+                        LuaMaterialFunctorProgram::Instruction instruction;
+                        instruction.m_opCode = static_cast<uint8_t>(opCode);
+                        instruction.m_target = target;
+                        instruction.m_a = a;
+                        instruction.m_b = b;
+                        instruction.m_operand = operand;
+                        m_program.m_instructions.push_back(instruction);
+                        return aznumeric_cast<uint32_t>(m_program.m_instructions.size() - 1);
+                    }
+
+                    //! Makes the jump instruction at @instructionIndex continue at the next instruction that is emitted.
+                    void PatchJump(uint32_t instructionIndex)
+                    {
+                        m_program.m_instructions[instructionIndex].m_operand = aznumeric_cast<uint32_t>(m_program.m_instructions.size());
+                    }
+
+                    uint32_t AddNumber(double number)
+                    {
+                        auto it = AZStd::find(m_program.m_numbers.begin(), m_program.m_numbers.end(), number);
+                        if (it != m_program.m_numbers.end())
+                        {
+                            return aznumeric_cast<uint32_t>(it - m_program.m_numbers.begin());
+                        }
+                        m_program.m_numbers.push_back(number);
+                        return aznumeric_cast<uint32_t>(m_program.m_numbers.size() - 1);
+                    }
+
+                    uint32_t AddName(const Name& name)
+                    {
+                        m_program.m_names.push_back(name);
+                        return aznumeric_cast<uint32_t>(m_program.m_names.size() - 1);
+                    }
+
+                    uint32_t AddMessage(const AZStd::string& message)
+                    {
+                        m_program.m_messages.push_back(message);
+                        return aznumeric_cast<uint32_t>(m_program.m_messages.size() - 1);
+                    }
+
+                    uint32_t AddPropertyIndex(MaterialPropertyIndex propertyIndex)
+                    {
+                        m_program.m_propertyIndexes.push_back(propertyIndex);
+                        return aznumeric_cast<uint32_t>(m_program.m_propertyIndexes.size() - 1);
+                    }
+
+                    uint32_t AddShaderInputIndex(RHI::ShaderInputConstantIndex shaderInputIndex)
+                    {
+                        m_program.m_shaderInputIndexes.push_back(shaderInputIndex);
+                        return aznumeric_cast<uint32_t>(m_program.m_shaderInputIndexes.size() - 1);
+                    }
+
+                    bool AllocateRegister(uint8_t& registerIndex)
+                    {
+                        if (m_freeRegister >= LuaMaterialFunctorProgram::MaxRegisterCount)
+                        {
+                            return Fail("the script needs too many registers");
+                        }
+                        registerIndex = m_freeRegister++;
+                        return true;
+                    }
+
+                    void SetTemporary(Expression& expression, uint8_t registerIndex, TypeMask type)
+                    {
+                        expression = Expression{};
+                        expression.m_kind = ValueKind::Register;
+                        expression.m_register = registerIndex;
+                        expression.m_type = type;
+                        expression.m_isTemporary = true;
+                    }
+
+                    void SetConstant(Expression& expression, Constant constant)
+                    {
+                        expression = Expression{};
+                        expression.m_constant = AZStd::move(constant);
+                    }
+
+                    //! Stores the value of @expression in @registerIndex.
+                    bool StoreTo(const Expression& expression, uint8_t registerIndex)
+                    {
+                        switch (expression.m_kind)
+                        {
+                        case ValueKind::Register:
+                            if (expression.m_register != registerIndex)
+                            {
+                                Emit(OpCode::Move, registerIndex, expression.m_register);
+                            }
+                            return true;
+                        case ValueKind::Context:
+                            return Fail("the context can only be used to call its functions");
+                        default:
+                            break;
+                        }
+
+                        const Constant& constant = expression.m_constant;
+                        switch (constant.m_type)
+                        {
+                        case NilType:
+                            Emit(OpCode::LoadNil, registerIndex);
+                            return true;
+                        case BoolType:
+                            Emit(OpCode::LoadBool, registerIndex, 0, 0, constant.m_bool ? 1 : 0);
+                            return true;
+                        case NumberType:
+                            Emit(OpCode::LoadNumber, registerIndex, 0, 0, AddNumber(constant.m_number));
+                            return true;
+                        default:
+                            return Fail("strings are only supported as names passed to functions");
+                        }
+                    }
+
+                    //! Returns the register that holds the value of @expression, loading constants into a new register.
+                    bool Materialize(const Expression& expression, uint8_t& registerIndex)
+                    {
+                        if (expression.m_kind == ValueKind::Register)
+                        {
+                            registerIndex = expression.m_register;
+                            return true;
+                        }
+                        return AllocateRegister(registerIndex) && StoreTo(expression, registerIndex);
+                    }
+
+                    //! Returns a register for the result of an operation, reusing the register of a temporary operand.
+                    bool GetResultRegister(const Expression& a, const Expression& b, uint8_t& registerIndex)
+                    {
+                        if (a.m_kind == ValueKind::Register && a.m_isTemporary)
+                        {
+                            registerIndex = a.m_register;
+                            return true;
+                        }
+                        if (b.m_kind == ValueKind::Register && b.m_isTemporary)
+                        {
+                            registerIndex = b.m_register;
+                            return true;
+                        }
+                        return AllocateRegister(registerIndex);
+                    }
+
+                    FunctionScope& GetFunctionScope()
+                    {
+                        return m_functionScopes.back();
+                    }
+
+                    Variable* FindVariable(AZStd::string_view name)
+                    {
+                        for (size_t index = m_variables.size(); index > GetFunctionScope().m_firstVariable; --index)
+                        {
+                            if (m_variables[index - 1].m_name == name)
+                            {
+                                return &m_variables[index - 1];
+                            }
+                        }
+                        return nullptr;
+                    }
+
+                    bool GetNameArgument(const AZStd::vector<Expression>& arguments, size_t index, const char* functionName, AZStd::string& name)
+                    {
+                        if (index >= arguments.size() || arguments[index].m_kind != ValueKind::Constant ||
+                            arguments[index].m_constant.m_type != StringType)
+                        {
+                            return Fail(AZStd::string::format("%s() is only supported with strings known at compile time", functionName));
+                        }
+                        name = arguments[index].m_constant.m_string;
+                        return true;
+                    }
+
+                    bool CheckArgumentCount(const AZStd::vector<Expression>& arguments, size_t count, const char* functionName)
+                    {
+                        if (arguments.size() != count)
+                        {
+                            return Fail(AZStd::string::format("%s() expects %zu arguments", functionName, count));
+                        }
+                        return true;
+                    }
+
+                    // Statements...
+
+                    bool CompileProcess()
+                    {
+                        auto processIt = m_functions.find("Process");
+                        if (processIt == m_functions.end())
+                        {
+                            m_position = m_tokens.size() - 1;
+                            return Fail("the script has no Process() function");
+                        }
+
+                        const Function& process = processIt->second;
+
+                        FunctionScope scope;
+                        scope.m_name = "Process";
+                        scope.m_isProcess = true;
+                        m_functionScopes.push_back(AZStd::move(scope));
+
+                        for (size_t index = 0; index < process.m_parameters.size(); ++index)
+                        {
+                            Variable parameter;
+                            parameter.m_name = process.m_parameters[index];
+                            parameter.m_kind = index == 0 ? ValueKind::Context : ValueKind::Constant;
+                            m_variables.push_back(AZStd::move(parameter));
+                        }
+
+                        m_position = process.m_bodyBegin;
+                        if (!CompileBlock())
+                        {
+                            return false;
+                        }
+
+                        if (m_position != process.m_bodyEnd)
+                        {
+                            return Fail("'end' expected");
+                        }
+
+                        Emit(OpCode::Return);
+                        return true;
+                    }
+
+                    bool CompileBlock()
+                    {
+                        const size_t firstVariable = m_variables.size();
+                        const uint8_t firstFreeRegister = m_freeRegister;
+                        ++GetFunctionScope().m_blockDepth;
+
+                        while (!IsBlockEnd())
+                        {
+                            if (!CompileStatement())
+                            {
+                                return false;
+                            }
+                        }
+
+                        --GetFunctionScope().m_blockDepth;
+                        m_variables.erase(m_variables.begin() + firstVariable, m_variables.end());
+                        m_freeRegister = firstFreeRegister;
+                        return true;
+                    }
+
+                    bool CompileStatement()
+                    {
+                        // Temporaries only live until the end of the statement
+                        const uint8_t statementRegister = m_freeRegister;
+
+                        if (Accept(";"))
+                        {
+                            return true;
+                        }
+
+                        if (Check("local"))
+                        {
+                            return CompileLocal();
+                        }
+
+                        bool result = false;
+                        if (Check("if"))
+                        {
+                            result = CompileIf();
+                        }
+                        else if (Accept("do"))
+                        {
+                            result = CompileBlock() && Expect("end");
+                        }
+                        else if (Check("return"))
+                        {
+                            result = CompileReturn();
+                        }
+                        else if (Peek().m_type == TokenType::Name && !IsKeyword(Peek().m_text) && Check("=", 1))
+                        {
+                            bool declaredVariable = false;
+                            if (!CompileAssignment(declaredVariable))
+                            {
+                                return false;
+                            }
+                            if (declaredVariable)
+                            {
+                                return true;
+                            }
+                            result = true;
+                        }
+                        else if (Peek().m_type == TokenType::Name && IsKeyword(Peek().m_text))
+                        {
+                            return Fail(AZStd::string::format("'%s' is not supported", Peek().m_text.c_str()));
+                        }
+                        else
+                        {
+                            Expression expression;
+                            if (!CompileSuffixedExpression(expression, true))
+                            {
+                                return false;
+                            }
+                            if (!expression.m_isCall)
+                            {
+                                return Fail(AZStd::string::format("syntax error near '%s'", Peek().m_text.c_str()));
+                            }
+                            result = true;
+                        }
+
+                        m_freeRegister = statementRegister;
+                        return result;
+                    }
+
+                    //! Declares a variable after compiling its value, like Lua does.
+                    //! The variable takes the first register of the statement, which is free again once the value is computed.
+                    bool DeclareVariable(const AZStd::string& name)
+                    {
+                        Variable variable;
+                        variable.m_name = name;
+                        variable.m_register = m_freeRegister;
+                        if (variable.m_register >= LuaMaterialFunctorProgram::MaxRegisterCount)
+                        {
+                            return Fail("the script needs too many registers");
+                        }
+
+                        if (Accept("="))
+                        {
+                            Expression value;
+                            if (!CompileExpression(value))
+                            {
+                                return false;
+                            }
+
+                            if (value.m_kind == ValueKind::Constant && value.m_constant.m_type == StringType)
+                            {
+                                // Names stay known at compile time, the variable just can't be assigned again.
+                                variable.m_kind = ValueKind::Constant;
+                                variable.m_constant = value.m_constant;
+                                m_freeRegister = variable.m_register;
+                                m_variables.push_back(AZStd::move(variable));
+                                return true;
+                            }
+
+                            if (!StoreTo(value, variable.m_register))
+                            {
+                                return false;
+                            }
+                            variable.m_type = value.GetType();
+                        }
+                        else
+                        {
+                            Emit(OpCode::LoadNil, variable.m_register);
+                        }
+
+                        // Only the register of the variable stays in use
+                        m_freeRegister = variable.m_register + 1;
+                        m_variables.push_back(AZStd::move(variable));
+                        return true;
+                    }
+
+                    bool CompileLocal()
+                    {
+                        Expect("local");
+                        if (Check("function"))
+                        {
+                            return Fail("local functions are only supported at the top level of the script");
+                        }
+
+                        AZStd::string name;
+                        if (!ExpectName(name))
+                        {
+                            return false;
+                        }
+
+                        if (Check(","))
+                        {
+                            return Fail("multiple assignments are not supported");
+                        }
+
+                        return DeclareVariable(name);
+                    }
+
+                    bool CompileAssignment(bool& declaredVariable)
+                    {
+                        AZStd::string name;
+                        ExpectName(name);
+
+                        if (Variable* variable = FindVariable(name))
+                        {
+                            Expect("=");
+                            if (variable->m_kind != ValueKind::Register)
+                            {
+                                return Fail(AZStd::string::format("'%s' is bound to a name or to the context and can't be assigned", name.c_str()));
+                            }
+
+                            // The expression can't declare variables, so the pointer stays valid
+                            const uint8_t variableRegister = variable->m_register;
+                            Expression value;
+                            if (!CompileExpression(value) || !StoreTo(value, variableRegister))
+                            {
+                                return false;
+                            }
+                            FindVariable(name)->m_type |= value.GetType();
+                            return true;
+                        }
+
+                        if (m_constants.contains(name) || m_functions.contains(name))
+                        {
+                            return Fail(AZStd::string::format("assigning the global '%s' is not supported", name.c_str()));
+                        }
+
+                        // Other globals behave like locals of Process() as long as they are assigned before they are read,
+                        // otherwise they would carry values from the previous call.
+                        if (m_functionScopes.size() != 1 || GetFunctionScope().m_blockDepth != 1)
+                        {
+                            return Fail(AZStd::string::format("the global '%s' must be assigned at the top level of Process() before it is used", name.c_str()));
+                        }
+
+                        declaredVariable = true;
+                        return DeclareVariable(name);
+                    }
+
+                    bool CompileIf()
+                    {
+                        Expect("if");
+
+                        const uint8_t statementRegister = m_freeRegister;
+                        AZStd::vector<uint32_t> endJumps;
+
+                        for (;;)
+                        {
+                            Expression condition;
+                            uint8_t conditionRegister = 0;
+                            if (!CompileExpression(condition) || !Expect("then") || !Materialize(condition, conditionRegister))
+                            {
+                                return false;
+                            }
+
+                            const uint32_t falseJump = Emit(OpCode::JumpIfFalse, 0, conditionRegister);
+                            m_freeRegister = statementRegister;
+
+                            if (!CompileBlock())
+                            {
+                                return false;
+                            }
+
+                            if (Check("elseif") || Check("else"))
+                            {
+                                endJumps.push_back(Emit(OpCode::Jump));
+                            }
+                            PatchJump(falseJump);
+
+                            if (Accept("elseif"))
+                            {
+                                continue;
+                            }
+
+                            if (Accept("else") && !CompileBlock())
+                            {
+                                return false;
+                            }
+                            break;
+                        }
+
+                        for (uint32_t endJump : endJumps)
+                        {
+                            PatchJump(endJump);
+                        }
+
+                        return Expect("end");
+                    }
+
+                    bool CompileReturn()
+                    {
+                        Expect("return");
+
+                        FunctionScope& scope = GetFunctionScope();
+                        if (!IsBlockEnd() && !Check(";"))
+                        {
+                            Expression value;
+                            if (!CompileExpression(value))
+                            {
+                                return false;
+                            }
+
+                            // The value returned by Process() is ignored
+                            if (!scope.m_isProcess && scope.m_hasResult)
+                            {
+                                if (!StoreTo(value, scope.m_resultRegister))
+                                {
+                                    return false;
+                                }
+                                scope.m_resultType |= value.GetType();
+                            }
+                        }
+                        else if (scope.m_hasResult)
+                        {
+                            Emit(OpCode::LoadNil, scope.m_resultRegister);
+                        }
+
+                        Accept(";");
+                        if (!IsBlockEnd())
+                        {
+                            return Fail("'end' expected after return");
+                        }
+
+                        if (scope.m_isProcess)
+                        {
+                            Emit(OpCode::Return);
+                        }
+                        else
+                        {
+                            scope.m_returnJumps.push_back(Emit(OpCode::Jump));
+                        }
+                        return true;
+                    }
+
+                    // Expressions...
+
+                    bool CompileExpression(Expression& result)
+                    {
+                        return CompileSubexpression(result, 0);
+                    }
+
+                    const BinaryOperator* GetBinaryOperator() const
+                    {
+                        for (const BinaryOperator& binaryOperator : BinaryOperators)
+                        {
+                            if (Check(binaryOperator.m_symbol))
+                            {
+                                return &binaryOperator;
+                            }
+                        }
+                        return nullptr;
+                    }
+
+                    bool CompileSubexpression(Expression& result, int limit)
+                    {
+                        if (Check("not") || Check("-"))
+                        {
+                            const bool isNot = Check("not");
+                            ++m_position;
+
+                            Expression operand;
+                            if (!CompileSubexpression(operand, UnaryPriority) || !CompileUnary(isNot, operand, result))
+                            {
+                                return false;
+                            }
+                        }
+                        else if (Check("#") || Check("~"))
+                        {
+                            return Fail(AZStd::string::format("operator '%s' is not supported", Peek().m_text.c_str()));
+                        }
+                        else if (!CompileSimpleExpression(result))
+                        {
+                            return false;
+                        }
+
+                        for (const BinaryOperator* binaryOperator = GetBinaryOperator();
+                             binaryOperator && binaryOperator->m_leftPriority > limit;
+                             binaryOperator = GetBinaryOperator())
+                        {
+                            ++m_position;
+                            const AZStd::string_view symbol = binaryOperator->m_symbol;
+
+                            if (symbol == "and" || symbol == "or")
+                            {
+                                if (!CompileLogical(symbol == "and", binaryOperator->m_rightPriority, result))
+                                {
+                                    return false;
+                                }
+                                continue;
+                            }
+
+                            // Constants are only loaded after the right operand is compiled, operands in registers can't change
+                            // while it is compiled because expressions don't assign variables.
+                            Expression right;
+                            if (!CompileSubexpression(right, binaryOperator->m_rightPriority) || !CompileBinary(symbol, result, right))
+                            {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    }
+
+                    bool CompileUnary(bool isNot, const Expression& operand, Expression& result)
+                    {
+                        if (operand.m_kind == ValueKind::Context)
+                        {
+                            return Fail("the context can only be used to call its functions");
+                        }
+
+                        if (!isNot && operand.GetType() != NumberType)
+                        {
+                            return Fail("arithmetic on a value that may not be a number");
+                        }
+
+                        if (operand.m_kind == ValueKind::Constant)
+                        {
+                            SetConstant(result, isNot ? MakeBoolConstant(!IsTrue(operand.m_constant)) : MakeNumberConstant(-operand.m_constant.m_number));
+                            return true;
+                        }
+
+                        uint8_t target = 0;
+                        if (!GetResultRegister(operand, operand, target))
+                        {
+                            return false;
+                        }
+                        Emit(isNot ? OpCode::Not : OpCode::Negate, target, operand.m_register);
+                        SetTemporary(result, target, isNot ? BoolType : NumberType);
+                        return true;
+                    }
+
+                    bool CompileLogical(bool isAnd, int rightPriority, Expression& result)
+                    {
+                        uint8_t target = 0;
+                        if (result.m_kind == ValueKind::Register && result.m_isTemporary)
+                        {
+                            target = result.m_register;
+                        }
+                        else if (!AllocateRegister(target) || !StoreTo(result, target))
+                        {
+                            return false;
+                        }
+
+                        const TypeMask leftType = result.GetType();
+                        const uint32_t jump = Emit(isAnd ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, 0, target);
+
+                        Expression right;
+                        if (!CompileSubexpression(right, rightPriority) || !StoreTo(right, target))
+                        {
+                            return false;
+                        }
+                        PatchJump(jump);
+
+                        // "a and b" is a when a is nil or false, "a or b" is a when a is anything else
+                        const TypeMask type = isAnd ? (leftType & (NilType | BoolType)) : (leftType & ~NilType);
+                        SetTemporary(result, target, type | right.GetType());
+                        return true;
+                    }
+
+                    bool CompileBinary(AZStd::string_view symbol, Expression& left, const Expression& right)
+                    {
+                        if (left.m_kind == ValueKind::Context || right.m_kind == ValueKind::Context)
+                        {
+                            return Fail("the context can only be used to call its functions");
+                        }
+
+                        const bool isEquality = symbol == "==" || symbol == "~=";
+                        const bool isComparison = symbol == "<" || symbol == "<=" || symbol == ">" || symbol == ">=";
+                        const bool isArithmetic = symbol == "+" || symbol == "-" || symbol == "*" || symbol == "/";
+
+                        if (!isEquality && !isComparison && !isArithmetic)
+                        {
+                            return Fail(AZStd::string::format("operator '%.*s' is not supported", AZ_STRING_ARG(symbol)));
+                        }
+
+                        const bool areConstants = left.m_kind == ValueKind::Constant && right.m_kind == ValueKind::Constant;
+
+                        if (isEquality)
+                        {
+                            if (areConstants)
+                            {
+                                SetConstant(left, MakeBoolConstant(AreEqual(left.m_constant, right.m_constant) == (symbol == "==")));
+                                return true;
+                            }
+
+                            if (((left.GetType() | right.GetType()) & (StringType | ShaderItemType)) != 0)
+                            {
+                                return Fail("comparing strings or shader items is not supported");
+                            }
+                        }
+                        else if (left.GetType() != NumberType || right.GetType() != NumberType)
+                        {
+                            return Fail(AZStd::string::format("operator '%.*s' on a value that may not be a number", AZ_STRING_ARG(symbol)));
+                        }
+                        else if (areConstants)
+                        {
+                            const double a = left.m_constant.m_number;
+                            const double b = right.m_constant.m_number;
+                            Constant constant;
+                            if (symbol == "+")
+                            {
+                                constant = MakeNumberConstant(a + b);
+                            }
+                            else if (symbol == "-")
+                            {
+                                constant = MakeNumberConstant(a - b);
+                            }
+                            else if (symbol == "*")
+                            {
+                                constant = MakeNumberConstant(a * b);
+                            }
+                            else if (symbol == "/")
+                            {
+                                constant = MakeNumberConstant(a / b);
+                            }
+                            else if (symbol == "<")
+                            {
+                                constant = MakeBoolConstant(a < b);
+                            }
+                            else if (symbol == "<=")
+                            {
+                                constant = MakeBoolConstant(a <= b);
+                            }
+                            else if (symbol == ">")
+                            {
+                                constant = MakeBoolConstant(a > b);
+                            }
+                            else
+                            {
+                                constant = MakeBoolConstant(a >= b);
+                            }
+                            SetConstant(left, AZStd::move(constant));
+                            return true;
+                        }
+
+                        uint8_t a = 0;
+                        uint8_t b = 0;
+                        uint8_t target = 0;
+                        if (!Materialize(left, a) || !Materialize(right, b))
+                        {
+                            return false;
+                        }
+
+                        Expression leftOperand = left;
+                        Expression rightOperand = right;
+                        leftOperand.m_kind = rightOperand.m_kind = ValueKind::Register;
+                        leftOperand.m_register = a;
+                        rightOperand.m_register = b;
+                        leftOperand.m_isTemporary |= left.m_kind == ValueKind::Constant;
+                        rightOperand.m_isTemporary |= right.m_kind == ValueKind::Constant;
+                        if (!GetResultRegister(leftOperand, rightOperand, target))
+                        {
+                            return false;
+                        }
+
+                        OpCode opCode = OpCode::Equal;
+                        if (symbol == "~=")
+                        {
+                            opCode = OpCode::NotEqual;
+                        }
+                        else if (symbol == "+")
+                        {
+                            opCode = OpCode::Add;
+                        }
+                        else if (symbol == "-")
+                        {
+                            opCode = OpCode::Subtract;
+                        }
+                        else if (symbol == "*")
+                        {
+                            opCode = OpCode::Multiply;
+                        }
+                        else if (symbol == "/")
+                        {
+                            opCode = OpCode::Divide;
+                        }
+                        else if (symbol == "<" || symbol == ">")
+                        {
+                            opCode = OpCode::Less;
+                        }
+                        else if (symbol == "<=" || symbol == ">=")
+                        {
+                            opCode = OpCode::LessEqual;
+                        }
+
+                        // "a > b" is "b < a"
+                        if (symbol == ">" || symbol == ">=")
+                        {
+                            AZStd::swap(a, b);
+                        }
+
+                        Emit(opCode, target, a, b);
+                        SetTemporary(left, target, isArithmetic ? NumberType : BoolType);
+                        return true;
+                    }
+
+                    bool CompileSimpleExpression(Expression& result)
+                    {
+                        const Token& token = Peek();
+
+                        if (token.m_type == TokenType::Number)
+                        {
+                            SetConstant(result, MakeNumberConstant(token.m_number));
+                        }
+                        else if (token.m_type == TokenType::String)
+                        {
+                            Constant constant;
+                            constant.m_type = StringType;
+                            constant.m_string = token.m_text;
+                            SetConstant(result, AZStd::move(constant));
+                        }
+                        else if (Check("nil"))
+                        {
+                            SetConstant(result, Constant{});
+                        }
+                        else if (Check("true") || Check("false"))
+                        {
+                            SetConstant(result, MakeBoolConstant(Check("true")));
+                        }
+                        else if (Check("function") || Check("{") || Check("..."))
+                        {
+                            return Fail(AZStd::string::format("'%s' is not supported", token.m_text.c_str()));
+                        }
+                        else
+                        {
+                            return CompileSuffixedExpression(result, false);
+                        }
+
+                        ++m_position;
+                        return true;
+                    }
+
+                    bool CompileArguments(AZStd::vector<Expression>& arguments)
+                    {
+                        if (!Expect("("))
+                        {
+                            return false;
+                        }
+
+                        if (Accept(")"))
+                        {
+                            return true;
+                        }
+
+                        do
+                        {
+                            Expression argument;
+                            if (!CompileExpression(argument))
+                            {
+                                return false;
+                            }
+                            arguments.push_back(AZStd::move(argument));
+                        } while (Accept(","));
+
+                        return Expect(")");
+                    }
+
+                    //! @param isStatement whether the expression is a call statement, whose result is not used
+                    bool CompileSuffixedExpression(Expression& result, bool isStatement)
+                    {
+                        if (Accept("("))
+                        {
+                            if (!CompileExpression(result) || !Expect(")"))
+                            {
+                                return false;
+                            }
+                            result.m_isCall = false;
+                        }
+                        else
+                        {
+                            AZStd::string name;
+                            if (!ExpectName(name))
+                            {
+                                return false;
+                            }
+
+                            if (Check("(") && !FindVariable(name))
+                            {
+                                AZStd::vector<Expression> arguments;
+                                if (!CompileArguments(arguments))
+                                {
+                                    return false;
+                                }
+
+                                const bool needsResult = !isStatement || Check(":");
+                                if (!CompileGlobalCall(name, arguments, needsResult, result))
+                                {
+                                    return false;
+                                }
+                            }
+                            else if (!ResolveName(name, result))
+                            {
+                                return false;
+                            }
+                        }
+
+                        for (;;)
+                        {
+                            if (Accept(":"))
+                            {
+                                AZStd::string functionName;
+                                AZStd::vector<Expression> arguments;
+                                if (!ExpectName(functionName) || !CompileArguments(arguments) ||
+                                    !CompileMethodCall(functionName, arguments, result))
+                                {
+                                    return false;
+                                }
+                                result.m_isCall = true;
+                            }
+                            else if (Check("(") || Check("{") || Peek().m_type == TokenType::String)
+                            {
+                                return Fail("only functions of the script and of the context can be called");
+                            }
+                            else if (Check(".") || Check("["))
+                            {
+                                return Fail("indexing is not supported");
+                            }
+                            else
+                            {
+                                return true;
+                            }
+                        }
+                    }
+
+                    bool ResolveName(const AZStd::string& name, Expression& result)
+                    {
+                        if (const Variable* variable = FindVariable(name))
+                        {
+                            result = Expression{};
+                            result.m_kind = variable->m_kind;
+                            result.m_constant = variable->m_constant;
+                            result.m_register = variable->m_register;
+                            result.m_type = variable->m_type;
+                            return true;
+                        }
+
+                        if (auto constantIt = m_constants.find(name); constantIt != m_constants.end())
+                        {
+                            SetConstant(result, constantIt->second);
+                            return true;
+                        }
+
+                        if (m_functions.contains(name))
+                        {
+                            return Fail(AZStd::string::format("the function '%s' can only be called", name.c_str()));
+                        }
+
+                        return Fail(AZStd::string::format("'%s' is not a local, a constant, or a global assigned in Process()", name.c_str()));
+                    }
+
+                    bool CompileGlobalCall(const AZStd::string& name, const AZStd::vector<Expression>& arguments, bool needsResult, Expression& result)
+                    {
+                        auto functionIt = m_functions.find(name);
+                        if (functionIt != m_functions.end())
+                        {
+                            return CompileInlineCall(name, functionIt->second, arguments, needsResult, result);
+                        }
+
+                        OpCode opCode = OpCode::Error;
+                        if (name == "Warning")
+                        {
+                            opCode = OpCode::Warning;
+                        }
+                        else if (name == "Print")
+                        {
+                            opCode = OpCode::Print;
+                        }
+                        else if (name != "Error")
+                        {
+                            return Fail(AZStd::string::format("the function '%s' is not supported", name.c_str()));
+                        }
+
+                        AZStd::string message;
+                        if (!CheckArgumentCount(arguments, 1, name.c_str()) || !GetNameArgument(arguments, 0, name.c_str(), message))
+                        {
+                            return false;
+                        }
+
+                        Emit(opCode, 0, 0, 0, AddMessage(message));
+                        SetConstant(result, Constant{});
+                        result.m_isCall = true;
+                        return true;
+                    }
+
+                    //! Returns whether the body of @function may assign a variable called @name.
+                    bool IsAssigned(const Function& function, const AZStd::string& name) const
+                    {
+                        for (size_t index = function.m_bodyBegin; index + 1 < function.m_bodyEnd; ++index)
+                        {
+                            const Token& token = m_tokens[index];
+                            const Token& nextToken = m_tokens[index + 1];
+                            if (token.m_type == TokenType::Name && token.m_text == name && nextToken.m_type == TokenType::Symbol && nextToken.m_text == "=")
+                            {
+                                return true;
+                            }
+                        }
+                        return false;
+                    }
+
+                    bool CompileInlineCall(
+                        const AZStd::string& name, const Function& function, const AZStd::vector<Expression>& arguments, bool needsResult, Expression& result)
+                    {
+                        for (const FunctionScope& scope : m_functionScopes)
+                        {
+                            if (scope.m_name == name)
+                            {
+                                return Fail(AZStd::string::format("the recursive function '%s' can't be inlined", name.c_str()));
+                            }
+                        }
+
+                        if (m_functionScopes.size() > MaxInlineDepth)
+                        {
+                            return Fail("functions are nested too deeply");
+                        }
+
+                        FunctionScope scope;
+                        scope.m_name = name;
+                        scope.m_hasResult = needsResult;
+                        if (needsResult)
+                        {
+                            if (!AllocateRegister(scope.m_resultRegister))
+                            {
+                                return false;
+                            }
+                            Emit(OpCode::LoadNil, scope.m_resultRegister);
+                        }
+
+                        // Parameters are bound before the scope is entered, the arguments belong to the caller
+                        AZStd::vector<Variable> parameters;
+                        for (size_t index = 0; index < function.m_parameters.size(); ++index)
+                        {
+                            Variable parameter;
+                            parameter.m_name = function.m_parameters[index];
+                            parameter.m_kind = ValueKind::Constant;
+
+                            if (index < arguments.size())
+                            {
+                                const Expression& argument = arguments[index];
+                                parameter.m_kind = argument.m_kind;
+                                parameter.m_constant = argument.m_constant;
+                                parameter.m_type = argument.GetType();
+
+                                if (argument.m_kind == ValueKind::Register)
+                                {
+                                    // Variables of the caller are copied when the function may assign the parameter
+                                    parameter.m_register = argument.m_register;
+                                    const bool needsCopy = !argument.m_isTemporary && IsAssigned(function, parameter.m_name);
+                                    if (needsCopy && (!AllocateRegister(parameter.m_register) || !StoreTo(argument, parameter.m_register)))
+                                    {
+                                        return false;
+                                    }
+                                }
+                            }
+
+                            parameters.push_back(AZStd::move(parameter));
+                        }
+
+                        scope.m_firstVariable = m_variables.size();
+                        m_functionScopes.push_back(AZStd::move(scope));
+                        m_variables.insert(m_variables.end(), parameters.begin(), parameters.end());
+
+                        const size_t callerPosition = m_position;
+                        m_position = function.m_bodyBegin;
+                        if (!CompileBlock())
+                        {
+                            return false;
+                        }
+
+                        if (m_position != function.m_bodyEnd)
+                        {
+                            return Fail("'end' expected");
+                        }
+                        m_position = callerPosition;
+
+                        for (uint32_t returnJump : GetFunctionScope().m_returnJumps)
+                        {
+                            PatchJump(returnJump);
+                        }
+
+                        const FunctionScope calledScope = AZStd::move(GetFunctionScope());
+                        m_functionScopes.pop_back();
+                        m_variables.erase(m_variables.begin() + calledScope.m_firstVariable, m_variables.end());
+
+                        if (needsResult)
+                        {
+                            SetTemporary(result, calledScope.m_resultRegister, calledScope.m_resultType);
+                        }
+                        else
+                        {
+                            SetConstant(result, Constant{});
+                        }
+                        result.m_isCall = true;
+                        return true;
+                    }
+
+                    bool CompileMethodCall(const AZStd::string& functionName, const AZStd::vector<Expression>& arguments, Expression& result)
+                    {
+                        if (result.m_kind == ValueKind::Context)
+                        {
+                            return CompileContextCall(functionName, arguments, result);
+                        }
+
+                        if (result.m_kind == ValueKind::Register && result.m_type == ShaderItemType && functionName == "SetEnabled")
+                        {
+                            uint8_t enabled = 0;
+                            if (!CheckArgumentCount(arguments, 1, "SetEnabled") || !Materialize(arguments[0], enabled))
+                            {
+                                return false;
+                            }
+
+                            Emit(OpCode::SetShaderEnabled, 0, result.m_register, enabled);
+                            SetConstant(result, Constant{});
+                            return true;
+                        }
+
+                        return Fail(AZStd::string::format("calling '%s' is not supported", functionName.c_str()));
+                    }
+
+                    bool CompileContextCall(const AZStd::string& functionName, const AZStd::vector<Expression>& arguments, Expression& result)
+                    {
+                        struct PropertyFunction
+                        {
+                            const char* m_name;
+                            OpCode m_opCode;
+                            TypeMask m_type;
+                        };
+
+                        static constexpr PropertyFunction GetPropertyFunctions[] = {
+                            { "GetMaterialPropertyValue_bool", OpCode::GetPropertyBool, BoolType },
+                            { "GetMaterialPropertyValue_int", OpCode::GetPropertyInt, NumberType },
+                            { "GetMaterialPropertyValue_uint", OpCode::GetPropertyUInt, NumberType },
+                            { "GetMaterialPropertyValue_enum", OpCode::GetPropertyUInt, NumberType },
+                            { "GetMaterialPropertyValue_float", OpCode::GetPropertyFloat, NumberType },
+                            { "GetMaterialPropertyValue_Image", OpCode::GetPropertyImage, ImageType | NilType },
+                        };
+
+                        static constexpr PropertyFunction SetFunctions[] = {
+                            { "SetShaderOptionValue_bool", OpCode::SetShaderOptionBool, 0 },
+                            { "SetShaderOptionValue_uint", OpCode::SetShaderOptionUInt, NumberType },
+                            { "SetShaderConstant_bool", OpCode::SetShaderConstantBool, 0 },
+                            { "SetShaderConstant_int", OpCode::SetShaderConstantInt, NumberType },
+                            { "SetShaderConstant_uint", OpCode::SetShaderConstantUInt, NumberType },
+                            { "SetShaderConstant_float", OpCode::SetShaderConstantFloat, NumberType },
+                            { "SetInternalMaterialPropertyValue_bool", OpCode::SetInternalPropertyBool, 0 },
+                            { "SetInternalMaterialPropertyValue_int", OpCode::SetInternalPropertyInt, NumberType },
+                            { "SetInternalMaterialPropertyValue_uint", OpCode::SetInternalPropertyUInt, NumberType },
+                            { "SetInternalMaterialPropertyValue_enum", OpCode::SetInternalPropertyUInt, NumberType },
+                            { "SetInternalMaterialPropertyValue_float", OpCode::SetInternalPropertyFloat, NumberType },
+                        };
+
+                        for (const PropertyFunction& getFunction : GetPropertyFunctions)
+                        {
+                            if (functionName == getFunction.m_name)
+                            {
+                                return CompileGetProperty(getFunction.m_opCode, getFunction.m_type, arguments, result);
+                            }
+                        }
+
+                        for (const PropertyFunction& setFunction : SetFunctions)
+                        {
+                            if (functionName == setFunction.m_name)
+                            {
+                                // The type is the type the value must have, or zero if any value converts
+                                return CompileSetFunction(setFunction.m_name, setFunction.m_opCode, setFunction.m_type, arguments, result);
+                            }
+                        }
+
+                        AZStd::string name;
+                        if (functionName == "HasMaterialProperty")
+                        {
+                            if (!CheckArgumentCount(arguments, 1, functionName.c_str()) || !GetNameArgument(arguments, 0, functionName.c_str(), name))
+                            {
+                                return false;
+                            }
+
+                            Name propertyName{ name };
+                            m_materialNameContext.ContextualizeProperty(propertyName);
+                            SetConstant(result, MakeBoolConstant(m_materialPropertiesLayout->FindPropertyIndex(propertyName).IsValid()));
+                            return true;
+                        }
+
+                        if (functionName == "SetShaderOptionValue_enum")
+                        {
+                            AZStd::string value;
+                            if (!CheckArgumentCount(arguments, 2, functionName.c_str()) || !GetNameArgument(arguments, 0, functionName.c_str(), name) ||
+                                !GetNameArgument(arguments, 1, functionName.c_str(), value))
+                            {
+                                return false;
+                            }
+
+                            Name optionName{ name };
+                            m_materialNameContext.ContextualizeShaderOption(optionName);
+                            const uint32_t operand = AddName(optionName);
+                            AddName(Name{ value });
+                            Emit(OpCode::SetShaderOptionEnum, 0, 0, 0, operand);
+                            SetConstant(result, Constant{});
+                            return true;
+                        }
+
+                        if (functionName == "HasShaderWithTag" || functionName == "GetShaderByTag")
+                        {
+                            uint8_t target = 0;
+                            if (!CheckArgumentCount(arguments, 1, functionName.c_str()) || !GetNameArgument(arguments, 0, functionName.c_str(), name) ||
+                                !AllocateRegister(target))
+                            {
+                                return false;
+                            }
+
+                            const bool isHas = functionName == "HasShaderWithTag";
+                            Emit(isHas ? OpCode::HasShaderWithTag : OpCode::GetShaderByTag, target, 0, 0, AddName(Name{ name }));
+                            SetTemporary(result, target, isHas ? BoolType : ShaderItemType);
+                            return true;
+                        }
+
+                        return Fail(AZStd::string::format("the context function '%s' is not supported", functionName.c_str()));
+                    }
+
+                    bool CompileGetProperty(OpCode opCode, TypeMask type, const AZStd::vector<Expression>& arguments, Expression& result)
+                    {
+                        AZStd::string name;
+                        uint8_t target = 0;
+                        if (!CheckArgumentCount(arguments, 1, "GetMaterialPropertyValue") ||
+                            !GetNameArgument(arguments, 0, "GetMaterialPropertyValue", name) || !AllocateRegister(target))
+                        {
+                            return false;
+                        }
+
+                        Name propertyName{ name };
+                        m_materialNameContext.ContextualizeProperty(propertyName);
+
+                        const MaterialPropertyIndex propertyIndex = m_materialPropertiesLayout->FindPropertyIndex(propertyName);
+                        if (propertyIndex.IsValid())
+                        {
+                            Emit(opCode, target, 0, 0, AddPropertyIndex(propertyIndex));
+                        }
+                        else
+                        {
+                            // Report the error at runtime like the script does, and use the default value of the type
+                            Emit(OpCode::Error, 0, 0, 0, AddMessage(AZStd::string::format(
+                                "GetMaterialPropertyValue() could not find property '%s'", propertyName.GetCStr())));
+
+                            Expression defaultValue;
+                            if (opCode == OpCode::GetPropertyBool)
+                            {
+                                SetConstant(defaultValue, MakeBoolConstant(false));
+                            }
+                            else if (opCode != OpCode::GetPropertyImage)
+                            {
+                                SetConstant(defaultValue, MakeNumberConstant(0.0));
+                            }
+                            StoreTo(defaultValue, target);
+                        }
+
+                        SetTemporary(result, target, type);
+                        return true;
+                    }
+
+                    bool CompileSetFunction(
+                        const char* functionName, OpCode opCode, TypeMask valueType, const AZStd::vector<Expression>& arguments, Expression& result)
+                    {
+                        AZStd::string name;
+                        uint8_t value = 0;
+                        if (!CheckArgumentCount(arguments, 2, functionName) || !GetNameArgument(arguments, 0, functionName, name))
+                        {
+                            return false;
+                        }
+
+                        if (valueType != 0 && arguments[1].GetType() != valueType)
+                        {
+                            return Fail(AZStd::string::format("%s() is called with a value that may not be a number", functionName));
+                        }
+
+                        if (!Materialize(arguments[1], value))
+                        {
+                            return false;
+                        }
+
+                        SetConstant(result, Constant{});
+
+                        switch (opCode)
+                        {
+                        case OpCode::SetShaderOptionBool:
+                        case OpCode::SetShaderOptionUInt:
+                            {
+                                Name optionName{ name };
+                                m_materialNameContext.ContextualizeShaderOption(optionName);
+                                Emit(opCode, 0, value, 0, AddName(optionName));
+                            }
+                            return true;
+
+                        case OpCode::SetShaderConstantBool:
+                        case OpCode::SetShaderConstantInt:
+                        case OpCode::SetShaderConstantUInt:
+                        case OpCode::SetShaderConstantFloat:
+                            {
+                                if (!m_shaderResourceGroupLayout)
+                                {
+                                    return Fail("SetShaderConstant() needs the layout of the material shader resource group");
+                                }
+
+                                Name inputName{ name };
+                                m_materialNameContext.ContextualizeSrgInput(inputName);
+                                const RHI::ShaderInputConstantIndex inputIndex = m_shaderResourceGroupLayout->FindShaderInputConstantIndex(inputName);
+                                if (inputIndex.IsValid())
+                                {
+                                    Emit(opCode, 0, value, 0, AddShaderInputIndex(inputIndex));
+                                }
+                                else
+                                {
+                                    Emit(OpCode::Error, 0, 0, 0, AddMessage(AZStd::string::format(
+                                        "SetShaderConstant() could not find shader input '%s'", inputName.GetCStr())));
+                                }
+                                m_program.m_usesRuntimeContextFunctions = true;
+                            }
+                            return true;
+
+                        default:
+                            // Internal property names are not contextualized
+                            Emit(opCode, 0, value, 0, AddName(Name{ name }));
+                            m_program.m_usesRuntimeContextFunctions = true;
+                            return true;
+                        }
+                    }
+
+                    const AZStd::vector<Token>& m_tokens;
+                    size_t m_position = 0;
+
+                    const MaterialPropertiesLayout* m_materialPropertiesLayout = nullptr;
+                    const RHI::ShaderResourceGroupLayout* m_shaderResourceGroupLayout = nullptr;
+                    const MaterialNameContext& m_materialNameContext;
+
+                    AZStd::unordered_map<AZStd::string, Function> m_functions;
+                    AZStd::unordered_map<AZStd::string, Constant> m_constants;
+
+                    AZStd::vector<FunctionScope> m_functionScopes;
+                    AZStd::vector<Variable> m_variables;
+                    uint8_t m_freeRegister = 0;
+
+                    LuaMaterialFunctorProgram m_program;
+                    AZStd::string m_error;
+                };
+            } // namespace
+
+            Outcome<LuaMaterialFunctorProgram, AZStd::string> Compile(
+                AZStd::string_view script,
+                const MaterialPropertiesLayout* materialPropertiesLayout,
+                const RHI::ShaderResourceGroupLayout* shaderResourceGroupLayout,
+                const MaterialNameContext& materialNameContext)
+            {
+                auto tokens = Tokenize(script);
+                if (!tokens.IsSuccess())
+                {
+                    return Failure(tokens.TakeError());
+                }
+
+                ScriptCompiler compiler(tokens.GetValue(), materialPropertiesLayout, shaderResourceGroupLayout, materialNameContext);
+                return compiler.Compile();
+            }
+        } // namespace LuaMaterialFunctorCompiler
+    } // namespace RPI
+} // namespace AZ
@@ -7,11 +7,13 @@
  */
 
 #include <Atom/RPI.Edit/Material/LuaMaterialFunctorSourceData.h>
+#include <Atom/RPI.Edit/Material/LuaMaterialFunctorCompiler.h>
 #include <Atom/RPI.Reflect/Material/LuaMaterialFunctor.h>
 #include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Script/ScriptAsset.h>
 #include <AzCore/Script/ScriptSystemBus.h>
+#include <AzCore/Utils/Utils.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 
 namespace AZ
@@ -222,12 +224,59 @@ namespace AZ
             return Success(RPI::Ptr<MaterialFunctor>(functor));
         }
 
+        void LuaMaterialFunctorSourceData::CompileProcessFunction(
+            LuaMaterialFunctor& functor,
+            const AZStd::string& materialTypeSourceFilePath,
+            const MaterialPropertiesLayout* propertiesLayout,
+            const RHI::ShaderResourceGroupLayout* shaderResourceGroupLayout) const
+        {
+            // The script asset holds lua bytecode, so the compiler reads the source file instead
+            AZStd::string script = m_luaScript;
+            if (script.empty())
+            {
+                const size_t MaxScriptFileSize = 1024 * 1024;
+                const AZStd::string scriptPath = AssetUtils::ResolvePathReference(materialTypeSourceFilePath, m_luaSourceFile);
+                auto readOutcome = AZ::Utils::ReadFile(scriptPath, MaxScriptFileSize);
+                if (!readOutcome)
+                {
+                    AZ_TracePrintf("LuaMaterialFunctorSourceData", "Lua functor '%s' will run its script. Could not read the script source. %s\n",
+                        m_luaSourceFile.c_str(), readOutcome.GetError().c_str());
+                    return;
+                }
+                script = readOutcome.TakeValue();
+            }
+
+            auto compileOutcome = LuaMaterialFunctorCompiler::Compile(script, propertiesLayout, shaderResourceGroupLayout, functor.m_materialNameContext);
+            if (compileOutcome)
+            {
+                functor.m_compiledProgram = compileOutcome.TakeValue();
+                AZ_TracePrintf("LuaMaterialFunctorSourceData", "Lua functor '%s' was compiled to %zu instructions.\n",
+                    m_luaSourceFile.c_str(), functor.m_compiledProgram.m_instructions.size());
+            }
+            else
+            {
+                AZ_TracePrintf("LuaMaterialFunctorSourceData", "Lua functor '%s' will run its script. It could not be compiled: %s\n",
+                    m_luaSourceFile.c_str(), compileOutcome.GetError().c_str());
+            }
+        }
+
         RPI::LuaMaterialFunctorSourceData::FunctorResult LuaMaterialFunctorSourceData::CreateFunctor(const RuntimeContext& context) const
         {
-            return CreateFunctor(
+            FunctorResult result = CreateFunctor(
                 context.GetMaterialTypeSourceFilePath(),
                 context.GetMaterialPropertiesLayout(),
                 context.GetNameContext());
+
+            if (result.IsSuccess())
+            {
+                CompileProcessFunction(
+                    static_cast<LuaMaterialFunctor&>(*result.GetValue()),
+                    context.GetMaterialTypeSourceFilePath(),
+                    context.GetMaterialPropertiesLayout(),
+                    context.GetShaderResourceGroupLayout());
+            }
+
+            return result;
         }
 
         RPI::LuaMaterialFunctorSourceData::FunctorResult LuaMaterialFunctorSourceData::CreateFunctor(const EditorContext& context) const
@@ -20,10 +20,12 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Visibility/OcclusionBus.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #include <Atom_RPI_Traits_Platform.h>
 
@@ -124,6 +126,83 @@ namespace AZ
             }
         }
 
+        void CullableBoundsStorage::InsertOrUpdate(Cullable& cullable)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (cullable.m_cullingBoundsIndex == InvalidIndex)
+            {
+                if (m_count == m_blocks.size() * BlockSize)
+                {
+                    m_blocks.emplace_back();
+                }
+                cullable.m_cullingBoundsIndex = m_count++;
+            }
+
+            AZ_Assert(cullable.m_cullingBoundsIndex < m_count, "Cullable has an invalid bounds index, it may be registered with another culling scene");
+            Block& block = m_blocks[cullable.m_cullingBoundsIndex / BlockSize];
+            const uint32_t lane = cullable.m_cullingBoundsIndex % BlockSize;
+            const Vector3& center = cullable.m_cullData.m_boundingSphere.GetCenter();
+            block.m_centerX[lane] = center.GetX();
+            block.m_centerY[lane] = center.GetY();
+            block.m_centerZ[lane] = center.GetZ();
+            block.m_radius[lane] = cullable.m_cullData.m_boundingSphere.GetRadius();
+            block.m_lodSelectionRadius[lane] = cullable.m_lodData.m_lodSelectionRadius;
+            block.m_cullables[lane] = &cullable;
+        }
+
+        void CullableBoundsStorage::Remove(Cullable& cullable)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            const uint32_t index = cullable.m_cullingBoundsIndex;
+            if (index == InvalidIndex)
+            {
+                return;
+            }
+
+            Block& block = m_blocks[index / BlockSize];
+            const uint32_t lane = index % BlockSize;
+            AZ_Assert(block.m_cullables[lane] == &cullable, "Cullable has an invalid bounds index, it may be registered with another culling scene");
+
+            const uint32_t lastIndex = --m_count;
+            Block& lastBlock = m_blocks[lastIndex / BlockSize];
+            const uint32_t lastLane = lastIndex % BlockSize;
+            if (index != lastIndex)
+            {
+                block.m_centerX[lane] = lastBlock.m_centerX[lastLane];
+                block.m_centerY[lane] = lastBlock.m_centerY[lastLane];
+                block.m_centerZ[lane] = lastBlock.m_centerZ[lastLane];
+                block.m_radius[lane] = lastBlock.m_radius[lastLane];
+                block.m_lodSelectionRadius[lane] = lastBlock.m_lodSelectionRadius[lastLane];
+                block.m_cullables[lane] = lastBlock.m_cullables[lastLane];
+                block.m_cullables[lane]->m_cullingBoundsIndex = index;
+            }
+
+            if (lastLane == 0)
+            {
+                m_blocks.pop_back();
+            }
+            else
+            {
+                lastBlock.m_centerX[lastLane] = 0.0f;
+                lastBlock.m_centerY[lastLane] = 0.0f;
+                lastBlock.m_centerZ[lastLane] = 0.0f;
+                lastBlock.m_radius[lastLane] = 0.0f;
+                lastBlock.m_lodSelectionRadius[lastLane] = 0.0f;
+                lastBlock.m_cullables[lastLane] = nullptr;
+            }
+            cullable.m_cullingBoundsIndex = InvalidIndex;
+        }
+
+        uint32_t CullableBoundsStorage::GetCount() const
+        {
+            return m_count;
+        }
+
+        AZStd::span<const CullableBoundsStorage::Block> CullableBoundsStorage::GetBlocks() const
+        {
+            return m_blocks;
+        }
+
         void CullingScene::RegisterOrUpdateCullable(Cullable& cullable)
         {
             // Multiple threads can call RegisterOrUpdateCullable at the same time
@@ -133,6 +212,7 @@ namespace AZ
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
             m_visScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
+            m_cullableBounds.InsertOrUpdate(cullable);
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
@@ -145,6 +225,7 @@ namespace AZ
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
             m_visScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
+            m_cullableBounds.Remove(cullable);
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
@@ -163,6 +244,11 @@ namespace AZ
             return m_visScene;
         }
 
+        const CullableBoundsStorage& CullingScene::GetCullableBounds() const
+        {
+            return m_cullableBounds;
+        }
+
         // Search for and return the entity context ID associated with the scene and connected to OcclusionRequestBus. If there is no
         // matching scene, return a null ID.
         static AzFramework::EntityContextId GetEntityContextIdForOcclusion(const AZ::RPI::Scene* scene)
@@ -271,6 +357,30 @@ namespace AZ
         static bool TestOcclusionCulling(
             const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry);
 
+#ifdef AZ_CULL_DEBUG_ENABLED
+        static void DebugDrawCullable(AuxGeomDraw* auxGeom, const CullingDebugContext& debugCtx, const Cullable& cullable, bool isContainedInFrustum)
+        {
+            if (debugCtx.m_drawBoundingBoxes)
+            {
+                auxGeom->DrawObb(cullable.m_cullData.m_boundingObb, Matrix3x4::Identity(),
+                    isContainedInFrustum ? Colors::Lime : Colors::Yellow, AuxGeomDraw::DrawStyle::Line);
+            }
+
+            if (debugCtx.m_drawBoundingSpheres)
+            {
+                auxGeom->DrawSphere(cullable.m_cullData.m_boundingSphere.GetCenter(), cullable.m_cullData.m_boundingSphere.GetRadius(),
+                    Color(0.5f, 0.5f, 0.5f, 0.3f), AuxGeomDraw::DrawStyle::Shaded);
+            }
+
+            if (debugCtx.m_drawLodRadii)
+            {
+                auxGeom->DrawSphere(cullable.m_cullData.m_boundingSphere.GetCenter(),
+                    cullable.m_lodData.m_lodSelectionRadius,
+                    Color(1.0f, 0.5f, 0.0f, 0.3f), RPI::AuxGeomDraw::DrawStyle::Shaded);
+            }
+        }
+#endif
+
         static void ProcessEntrylist(
             const AZStd::shared_ptr<WorklistData>& worklistData,
             const AZStd::vector<AzFramework::VisibilityEntry*>& entries,
@@ -348,25 +458,8 @@ namespace AZ
                         if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
                             visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
                         {
-                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-                            if (worklistData->m_debugCtx->m_drawBoundingBoxes)
-                            {
-                                auxGeomPtr->DrawObb(c->m_cullData.m_boundingObb, Matrix3x4::Identity(),
-                                    parentNodeContainedInFrustum ? Colors::Lime : Colors::Yellow, AuxGeomDraw::DrawStyle::Line);
-                            }
-
-                            if (worklistData->m_debugCtx->m_drawBoundingSpheres)
-                            {
-                                auxGeomPtr->DrawSphere(c->m_cullData.m_boundingSphere.GetCenter(), c->m_cullData.m_boundingSphere.GetRadius(),
-                                    Color(0.5f, 0.5f, 0.5f, 0.3f), AuxGeomDraw::DrawStyle::Shaded);
-                            }
-
-                            if (worklistData->m_debugCtx->m_drawLodRadii)
-                            {
-                                auxGeomPtr->DrawSphere(c->m_cullData.m_boundingSphere.GetCenter(),
-                                    c->m_lodData.m_lodSelectionRadius,
-                                    Color(1.0f, 0.5f, 0.0f, 0.3f), RPI::AuxGeomDraw::DrawStyle::Shaded);
-                            }
+                            DebugDrawCullable(auxGeomPtr.get(), *worklistData->m_debugCtx,
+                                *static_cast<Cullable*>(visibleEntry->m_userData), parentNodeContainedInFrustum);
                         }
                     }
                 }
@@ -570,6 +663,296 @@ namespace AZ
             return true;
         }
 
+        //! The planes of a frustum with each plane component splatted across a SIMD register, to test four spheres against a plane at once.
+        struct SplattedFrustumPlanes
+        {
+            explicit SplattedFrustumPlanes(const Frustum& frustum)
+            {
+                for (int planeIndex = 0; planeIndex < Frustum::PlaneId::MAX; ++planeIndex)
+                {
+                    const Plane plane = frustum.GetPlane(static_cast<Frustum::PlaneId>(planeIndex));
+                    const Vector3 normal = plane.GetNormal();
+                    m_normalX[planeIndex] = Simd::Vec4::Splat(normal.GetX());
+                    m_normalY[planeIndex] = Simd::Vec4::Splat(normal.GetY());
+                    m_normalZ[planeIndex] = Simd::Vec4::Splat(normal.GetZ());
+                    m_distance[planeIndex] = Simd::Vec4::Splat(plane.GetDistance());
+                }
+            }
+
+            //! Classifies four spheres like Frustum::IntersectSphere(). Lanes that are outside of any plane are set in exteriorMask,
+            //! lanes that intersect any plane are set in overlapsMask, all other lanes are inside the frustum.
+            void ClassifySpheres(
+                Simd::Vec4::FloatArgType centerX,
+                Simd::Vec4::FloatArgType centerY,
+                Simd::Vec4::FloatArgType centerZ,
+                Simd::Vec4::FloatArgType radius,
+                Simd::Vec4::FloatType& exteriorMask,
+                Simd::Vec4::FloatType& overlapsMask) const
+            {
+                const Simd::Vec4::FloatType negativeRadius = Simd::Vec4::Sub(Simd::Vec4::ZeroFloat(), radius);
+                exteriorMask = Simd::Vec4::ZeroFloat();
+                overlapsMask = Simd::Vec4::ZeroFloat();
+                for (int planeIndex = 0; planeIndex < Frustum::PlaneId::MAX; ++planeIndex)
+                {
+                    const Simd::Vec4::FloatType distance = Simd::Vec4::Madd(m_normalX[planeIndex], centerX,
+                        Simd::Vec4::Madd(m_normalY[planeIndex], centerY, Simd::Vec4::Madd(m_normalZ[planeIndex], centerZ, m_distance[planeIndex])));
+                    exteriorMask = Simd::Vec4::Or(exteriorMask, Simd::Vec4::CmpLt(distance, negativeRadius));
+                    overlapsMask = Simd::Vec4::Or(overlapsMask, Simd::Vec4::CmpLt(Simd::Vec4::Abs(distance), radius));
+                }
+            }
+
+            Simd::Vec4::FloatType m_normalX[Frustum::PlaneId::MAX];
+            Simd::Vec4::FloatType m_normalY[Frustum::PlaneId::MAX];
+            Simd::Vec4::FloatType m_normalZ[Frustum::PlaneId::MAX];
+            Simd::Vec4::FloatType m_distance[Frustum::PlaneId::MAX];
+        };
+
+        //! Returns a bit per lane that is set in the comparison mask
+        static uint32_t GetLaneBits(Simd::Vec4::FloatArgType mask)
+        {
+            alignas(16) float maskValues[CullableBoundsStorage::BlockSize];
+            Simd::Vec4::StoreAligned(maskValues, mask);
+            uint32_t laneBits = 0;
+            for (uint32_t lane = 0; lane < CullableBoundsStorage::BlockSize; ++lane)
+            {
+                uint32_t maskBits;
+                memcpy(&maskBits, &maskValues[lane], sizeof(maskBits));
+                laneBits |= (maskBits != 0) ? (1u << lane) : 0u;
+            }
+            return laneBits;
+        }
+
+        //! Adds the draw packets or visible objects of the lods selected by the screen coverage to the view, like AddLodDataToView()
+        //! but with the screen coverage and depth already computed.
+        static uint32_t AddSelectedLodsToView(
+            const Cullable::LodData& lodData,
+            float approxScreenPercentage,
+            float depth,
+            RPI::View& view,
+            AzFramework::VisibilityEntry::TypeFlags typeFlags)
+        {
+            uint32_t numVisibleDrawPackets = 0;
+            auto addLod = [&](const Cullable::LodData::Lod& lod)
+            {
+                numVisibleDrawPackets += static_cast<uint32_t>(lod.m_drawPackets.size());
+                if (typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
+                {
+                    view.AddVisibleObject(lod.m_visibleObjectUserData, depth);
+                }
+                else if (typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                {
+                    view.AddDrawPackets(lod.m_drawPackets, depth);
+                }
+                else
+                {
+                    AZ_Assert(false, "Invalid cullable type flags.")
+                }
+            };
+
+            if (lodData.m_lodConfiguration.m_lodType == Cullable::LodType::SpecificLod)
+            {
+                if (lodData.m_lodConfiguration.m_lodOverride < lodData.m_lods.size())
+                {
+                    addLod(lodData.m_lods[lodData.m_lodConfiguration.m_lodOverride]);
+                }
+                return numVisibleDrawPackets;
+            }
+
+            for (const Cullable::LodData::Lod& lod : lodData.m_lods)
+            {
+                // Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
+                if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
+                {
+                    addLod(lod);
+                }
+            }
+            return numVisibleDrawPackets;
+        }
+
+        //! Culls the cullables of a range of bounds blocks for the view, and adds the lods of the visible ones to the view.
+        //! The frustum tests, the lod screen coverage and the depth are computed for the four cullables of a block at once,
+        //! only the cullables that pass the frustum tests are accessed. The results match ProcessEntrylist().
+        static void ProcessCullableBounds(
+            const AZStd::shared_ptr<WorklistData>& worklistData, AZStd::span<const CullableBoundsStorage::Block> blocks)
+        {
+            AZ_PROFILE_SCOPE(RPI, "Culling: ProcessCullableBounds");
+
+            View& view = *worklistData->m_view;
+            const bool enableFrustumCulling = worklistData->m_debugCtx->m_enableFrustumCulling;
+            const SplattedFrustumPlanes frustumPlanes(worklistData->m_frustum);
+            const SplattedFrustumPlanes excludeFrustumPlanes(worklistData->m_hasExcludeFrustum ? worklistData->m_excludeFrustum : worklistData->m_frustum);
+
+            // The lod selection matches ModelLodUtils::ApproxScreenPercentage() and the depth matches View::AddDrawPacket()
+            const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+            const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+            const Simd::Vec4::FloatType yScale = Simd::Vec4::Splat(viewToClip.GetElement(1, 1));
+            const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+            const Vector3 viewForward = -view.GetViewToWorldMatrix().GetBasisZAsVector3();
+            const Simd::Vec4::FloatType cameraX = Simd::Vec4::Splat(cameraPos.GetX());
+            const Simd::Vec4::FloatType cameraY = Simd::Vec4::Splat(cameraPos.GetY());
+            const Simd::Vec4::FloatType cameraZ = Simd::Vec4::Splat(cameraPos.GetZ());
+            const Simd::Vec4::FloatType forwardX = Simd::Vec4::Splat(viewForward.GetX());
+            const Simd::Vec4::FloatType forwardY = Simd::Vec4::Splat(viewForward.GetY());
+            const Simd::Vec4::FloatType forwardZ = Simd::Vec4::Splat(viewForward.GetZ());
+            const Simd::Vec4::FloatType one = Simd::Vec4::Splat(1.0f);
+
+            // View flags of all visible cullables are combined first, so the view's atomics are only updated once
+            uint32_t andFlags = ~0u;
+            uint32_t orFlags = 0u;
+            uint32_t numDrawPackets = 0;
+            uint32_t numVisibleCullables = 0;
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            AuxGeomDrawPtr auxGeomPtr = worklistData->GetAuxGeomPtr();
+            const CullingDebugContext& debugCtx = *worklistData->m_debugCtx;
+            const bool debugDrawCullables = auxGeomPtr && (debugCtx.m_drawBoundingBoxes || debugCtx.m_drawBoundingSpheres || debugCtx.m_drawLodRadii);
+#endif
+
+            for (const CullableBoundsStorage::Block& block : blocks)
+            {
+                uint32_t candidateLanes = 0;
+                for (uint32_t lane = 0; lane < CullableBoundsStorage::BlockSize; ++lane)
+                {
+                    candidateLanes |= block.m_cullables[lane] ? (1u << lane) : 0u;
+                }
+
+                const Simd::Vec4::FloatType centerX = Simd::Vec4::LoadAligned(block.m_centerX);
+                const Simd::Vec4::FloatType centerY = Simd::Vec4::LoadAligned(block.m_centerY);
+                const Simd::Vec4::FloatType centerZ = Simd::Vec4::LoadAligned(block.m_centerZ);
+                const Simd::Vec4::FloatType radius = Simd::Vec4::LoadAligned(block.m_radius);
+                Simd::Vec4::FloatType exteriorMask;
+                Simd::Vec4::FloatType overlapsMask;
+
+                uint32_t overlappingLanes = 0;
+                if (enableFrustumCulling)
+                {
+                    frustumPlanes.ClassifySpheres(centerX, centerY, centerZ, radius, exteriorMask, overlapsMask);
+                    candidateLanes &= ~GetLaneBits(exteriorMask);
+                    overlappingLanes = GetLaneBits(overlapsMask);
+                }
+
+                if (candidateLanes != 0 && worklistData->m_hasExcludeFrustum)
+                {
+                    // Skip cullables contained in the exclude frustum
+                    excludeFrustumPlanes.ClassifySpheres(centerX, centerY, centerZ, radius, exteriorMask, overlapsMask);
+                    candidateLanes &= GetLaneBits(Simd::Vec4::Or(exteriorMask, overlapsMask));
+                }
+
+                if (candidateLanes == 0)
+                {
+                    continue;
+                }
+
+                const Simd::Vec4::FloatType toCenterX = Simd::Vec4::Sub(centerX, cameraX);
+                const Simd::Vec4::FloatType toCenterY = Simd::Vec4::Sub(centerY, cameraY);
+                const Simd::Vec4::FloatType toCenterZ = Simd::Vec4::Sub(centerZ, cameraZ);
+                const Simd::Vec4::FloatType lodRadius = Simd::Vec4::Mul(yScale, Simd::Vec4::LoadAligned(block.m_lodSelectionRadius));
+                Simd::Vec4::FloatType screenPercentage = lodRadius;
+                if (isPerspective)
+                {
+                    const Simd::Vec4::FloatType distance = Simd::Vec4::Sqrt(Simd::Vec4::Madd(toCenterX, toCenterX,
+                        Simd::Vec4::Madd(toCenterY, toCenterY, Simd::Vec4::Mul(toCenterZ, toCenterZ))));
+                    screenPercentage = Simd::Vec4::Div(lodRadius, distance);
+                }
+                alignas(16) float screenPercentages[CullableBoundsStorage::BlockSize];
+                alignas(16) float depths[CullableBoundsStorage::BlockSize];
+                Simd::Vec4::StoreAligned(screenPercentages, Simd::Vec4::Min(screenPercentage, one));
+                Simd::Vec4::StoreAligned(depths, Simd::Vec4::Madd(toCenterX, forwardX,
+                    Simd::Vec4::Madd(toCenterY, forwardY, Simd::Vec4::Mul(toCenterZ, forwardZ))));
+
+                for (uint32_t lane = 0; lane < CullableBoundsStorage::BlockSize; ++lane)
+                {
+                    if ((candidateLanes & (1u << lane)) == 0)
+                    {
+                        continue;
+                    }
+
+                    Cullable* c = block.m_cullables[lane];
+                    const AzFramework::VisibilityEntry& visibleEntry = c->m_cullData.m_visibilityEntry;
+                    if (!(visibleEntry.m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
+                          visibleEntry.m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList))
+                    {
+                        continue;
+                    }
+
+                    if ((c->m_cullData.m_drawListMask & view.GetDrawListMask()).none() ||
+                        c->m_cullData.m_hideFlags & view.GetUsageFlags() ||
+                        c->m_isHidden)
+                    {
+                        continue;
+                    }
+
+                    if ((overlappingLanes & (1u << lane)) != 0 && !ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb))
+                    {
+                        continue;
+                    }
+
+                    if (!TestOcclusionCulling(worklistData, &visibleEntry))
+                    {
+                        continue;
+                    }
+
+                    numDrawPackets += AddSelectedLodsToView(c->m_lodData, screenPercentages[lane], depths[lane], view, visibleEntry.m_typeFlags);
+                    c->m_isVisible = true;
+                    andFlags &= c->m_flags;
+                    orFlags |= c->m_flags;
+                    ++numVisibleCullables;
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+                    if (debugDrawCullables)
+                    {
+                        DebugDrawCullable(auxGeomPtr.get(), debugCtx, *c, (overlappingLanes & (1u << lane)) == 0);
+                    }
+#endif
+                }
+            }
+
+            if (numVisibleCullables > 0)
+            {
+                // Applying the combined flags is the same as applying the flags of every cullable
+                view.ApplyFlags(andFlags);
+                view.ApplyFlags(orFlags);
+            }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            if (debugCtx.m_enableStats)
+            {
+                CullingDebugContext::CullStats& cullStats = worklistData->m_debugCtx->GetCullStatsForView(&view);
+
+                //no need for mutex here since these are all atomics
+                cullStats.m_numVisibleDrawPackets += numDrawPackets;
+                cullStats.m_numVisibleCullables += numVisibleCullables;
+                ++cullStats.m_numJobs;
+            }
+#else
+            AZ_UNUSED(numDrawPackets);
+#endif
+        }
+
+        //! Returns whether the view can be culled from the cullable bounds, instead of with the octree traversal which is needed
+        //! for the optimizations and debug drawing that work on octree nodes.
+        static bool UseCullableBounds(const WorklistData& worklistData)
+        {
+            if (!worklistData.m_debugCtx->m_useCullableBounds)
+            {
+                return false;
+            }
+
+            if (r_shadowCascadeExtrusionAmount >= 0 && worklistData.m_applyCameraFrustumIntersectionTest && worklistData.m_hasExcludeFrustum)
+            {
+                return false;
+            }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            if (worklistData.m_debugCtx->m_debugDraw &&
+                (worklistData.m_debugCtx->m_drawFullyVisibleNodes || worklistData.m_debugCtx->m_drawPartiallyVisibleNodes))
+            {
+                return false;
+            }
+#endif
+            return true;
+        }
+
         void CullingScene::ProcessCullablesCommon(
             const Scene& scene,
             View& view,
@@ -712,6 +1095,32 @@ namespace AZ
                     worklistData->m_applyCameraFrustumIntersectionTest = true;
                 }
             }
+
+            if (UseCullableBounds(*worklistData))
+            {
+                // Split the blocks evenly across the tasks, each block holds the bounds of four cullables
+                const size_t blocksPerTask = AZStd::max(static_cast<uint32_t>(r_numEntriesPerCullingJob) / CullableBoundsStorage::BlockSize, 1u);
+                const AZStd::span<const CullableBoundsStorage::Block> blocks = m_cullableBounds.GetBlocks();
+                for (size_t firstBlock = 0; firstBlock < blocks.size(); firstBlock += blocksPerTask)
+                {
+                    auto processBlocks = [worklistData, taskBlocks = blocks.subspan(firstBlock, AZStd::min(blocksPerTask, blocks.size() - firstBlock))]()
+                    {
+                        ProcessCullableBounds(worklistData, taskBlocks);
+                    };
+
+                    if (taskGraph != nullptr)
+                    {
+                        taskGraph->AddTask(descriptor, AZStd::move(processBlocks));
+                    }
+                    else
+                    {
+                        AZ::Job* job = AZ::CreateJobFunction(AZStd::move(processBlocks), true);
+                        parentJob->SetContinuation(job);
+                        job->Start();
+                    }
+                }
+                return;
+            }
             
             auto nodeVisitorLambda = [worklistData, taskGraph, parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
@@ -1083,6 +1492,12 @@ namespace AZ
 
             m_taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
 
+            // Apply the cullable updates queued during simulation before any view starts querying the scene
+            if (auto* octreeScene = azrtti_cast<AzFramework::OctreeScene*>(m_visScene))
+            {
+                octreeScene->ProcessDeferredUpdates();
+            }
+
             // Remove any debug artifacts from the previous occlusion culling session.
             const auto& entityContextId = GetEntityContextIdForOcclusion(&scene);
             AzFramework::OcclusionRequestBus::Event(
@@ -151,6 +151,7 @@ namespace AZ
             {
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
                 m_shaderVariants.clear();
+                m_variantLookupCache.Reset();
             }
             auto rootShaderVariantAsset = shaderAsset.GetRootVariantAsset(m_supervariantIndex);
             m_rootVariant.Init(m_asset, rootShaderVariantAsset, m_supervariantIndex);
@@ -305,6 +306,13 @@ namespace AZ
 
         ///////////////////////////////////////////////////////////////////
         /// ShaderVariantFinderNotificationBus overrides
+        void Shader::OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> /*shaderVariantTreeAsset*/, bool /*isError*/)
+        {
+            // A new tree can map the cached ids to different variants, so they are looked up again.
+            AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            m_variantLookupCache.Reset();
+        }
+
         void Shader::OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset, bool isError)
         {
             ShaderReloadDebugTracker::ScopedSection reloadSection("{%p}->Shader::OnShaderVariantAssetReady %s", this, shaderVariantAsset.GetHint().c_str());
@@ -336,6 +344,7 @@ namespace AZ
                 }
                 AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
                 m_shaderVariants.erase(stableId);
+                m_variantLookupCache.Reset();
             }
             else
             {
@@ -352,6 +361,7 @@ namespace AZ
                     {
                         AZ_Error("Shader", false, "Failed to init shaderVariant with StableId=%u", shaderVariantAsset->GetStableId());
                         m_shaderVariants.erase(stableId);
+                        m_variantLookupCache.Reset();
                     }
                     else
                     {
@@ -362,7 +372,15 @@ namespace AZ
                 {
                     //This is the first time the shader variant asset comes to life.
                     updatedVariant.Init(m_asset, shaderVariantAsset, m_supervariantIndex);
-                    m_shaderVariants.emplace(stableId, updatedVariant);
+                    const ShaderVariant* readyVariant = &m_shaderVariants.emplace(stableId, updatedVariant).first->second;
+
+                    // Resolve the ids that were waiting for this variant, so draw packets rebuilt in response to
+                    // OnShaderVariantReinitialized find it without going through the variant finder.
+                    m_variantLookupCache.ResolvePending(
+                        [this, stableId, readyVariant](const ShaderVariantId& shaderVariantId) -> const ShaderVariant*
+                        {
+                            return m_asset->FindVariantStableId(shaderVariantId).GetStableId() == stableId ? readyVariant : nullptr;
+                        });
                 }
             }
 
@@ -429,13 +447,55 @@ namespace AZ
 
         const ShaderVariant& Shader::GetVariant(const ShaderVariantId& shaderVariantId)
         {
+            if (const ShaderVariant* cachedVariant = m_variantLookupCache.Find(shaderVariantId))
+            {
+                return *cachedVariant;
+            }
+
+            // The variant is resolved outside of m_variantCacheMutex. If the cache is reset in the meantime, because the variant tree
+            // was reloaded or a variant was erased, the result may be stale and is returned without being cached.
+            const uint64_t cacheGeneration = m_variantLookupCache.GetGeneration();
+
             Data::Asset<ShaderVariantAsset> shaderVariantAsset = m_asset->GetVariantAsset(shaderVariantId, m_supervariantIndex);
-            if (!shaderVariantAsset || shaderVariantAsset->IsRootVariant())
+            if (!shaderVariantAsset)
+            {
+                // The variant tree or the variant is still loading. The pending entry is resolved when the variant is ready.
+                if (!m_variantLookupCache.Contains(shaderVariantId))
+                {
+                    AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                    // A pending entry is never stale, but the id may have been resolved since Contains() returned.
+                    if (!m_variantLookupCache.Contains(shaderVariantId))
+                    {
+                        m_variantLookupCache.Insert(shaderVariantId, nullptr);
+                    }
+                }
+                return m_rootVariant;
+            }
+
+            if (shaderVariantAsset->IsRootVariant())
             {
+                AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+                if (m_variantLookupCache.GetGeneration() == cacheGeneration)
+                {
+                    m_variantLookupCache.Insert(shaderVariantId, &m_rootVariant);
+                }
                 return m_rootVariant;
             }
 
-            return GetVariant(shaderVariantAsset->GetStableId());
+            const ShaderVariantStableId stableId = shaderVariantAsset->GetStableId();
+            const ShaderVariant& variant = GetVariant(stableId);
+
+            // The variant is looked up again under the lock, in case it was erased since GetVariant() returned.
+            AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            if (m_variantLookupCache.GetGeneration() == cacheGeneration)
+            {
+                auto findIt = m_shaderVariants.find(stableId);
+                if (findIt != m_shaderVariants.end())
+                {
+                    m_variantLookupCache.Insert(shaderVariantId, &findIt->second);
+                }
+            }
+            return variant;
         }
 
         const ShaderVariant& Shader::GetRootVariant()
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
+
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        const ShaderVariant* ShaderVariantLookupCache::Find(const ShaderVariantId& shaderVariantId) const
+        {
+            const Table* table = m_table.load(AZStd::memory_order_acquire);
+            if (!table)
+            {
+                return nullptr;
+            }
+
+            const Entry* entry = FindEntry(*table, shaderVariantId, GetHash(shaderVariantId));
+            return entry ? entry->m_shaderVariant.load(AZStd::memory_order_acquire) : nullptr;
+        }
+
+        bool ShaderVariantLookupCache::Contains(const ShaderVariantId& shaderVariantId) const
+        {
+            const Table* table = m_table.load(AZStd::memory_order_acquire);
+            return table && FindEntry(*table, shaderVariantId, GetHash(shaderVariantId));
+        }
+
+        void ShaderVariantLookupCache::Insert(const ShaderVariantId& shaderVariantId, const ShaderVariant* shaderVariant)
+        {
+            const size_t hash = GetHash(shaderVariantId);
+
+            // Writers are serialized, so the table can't change under this function.
+            Table* table = m_table.load(AZStd::memory_order_relaxed);
+            if (table)
+            {
+                if (Entry* entry = FindEntry(*table, shaderVariantId, hash))
+                {
+                    entry->m_shaderVariant.store(shaderVariant, AZStd::memory_order_release);
+                    return;
+                }
+            }
+
+            // Keep the load factor at or below one half so probe sequences stay short.
+            const size_t entryCount = m_entryCount.load(AZStd::memory_order_relaxed);
+            if (!table || (entryCount + 1) * 2 > table->m_capacity)
+            {
+                table = &Grow();
+            }
+
+            AddEntry(*table, shaderVariantId, hash, shaderVariant);
+            m_entryCount.store(entryCount + 1, AZStd::memory_order_relaxed);
+        }
+
+        void ShaderVariantLookupCache::Reset()
+        {
+            // Retired tables are reset too, lookups that started before they were retired may still read them.
+            for (AZStd::unique_ptr<Table>& table : m_tables)
+            {
+                for (size_t index = 0; index < table->m_capacity; ++index)
+                {
+                    table->m_entries[index].m_shaderVariant.store(nullptr, AZStd::memory_order_release);
+                }
+            }
+
+            // Released after the entries are cleared, so a writer that sees the new generation resolves against the new state.
+            m_generation.fetch_add(1, AZStd::memory_order_release);
+        }
+
+        uint64_t ShaderVariantLookupCache::GetGeneration() const
+        {
+            return m_generation.load(AZStd::memory_order_acquire);
+        }
+
+        size_t ShaderVariantLookupCache::GetEntryCount() const
+        {
+            return m_entryCount.load(AZStd::memory_order_relaxed);
+        }
+
+        size_t ShaderVariantLookupCache::GetHash(const ShaderVariantId& shaderVariantId)
+        {
+            size_t hash = AZStd::hash_range(shaderVariantId.m_key.data(), shaderVariantId.m_key.data() + shaderVariantId.m_key.num_words());
+            AZStd::hash_range(hash, shaderVariantId.m_mask.data(), shaderVariantId.m_mask.data() + shaderVariantId.m_mask.num_words());
+
+            // Zero marks empty entries.
+            return hash ? hash : 1;
+        }
+
+        ShaderVariantLookupCache::Entry* ShaderVariantLookupCache::FindEntry(
+            const Table& table, const ShaderVariantId& shaderVariantId, size_t hash)
+        {
+            const size_t indexMask = table.m_capacity - 1;
+            for (size_t probe = 0, index = hash & indexMask; probe < table.m_capacity; ++probe, index = (index + 1) & indexMask)
+            {
+                Entry& entry = table.m_entries[index];
+                const size_t entryHash = entry.m_hash.load(AZStd::memory_order_acquire);
+                if (entryHash == 0)
+                {
+                    // Ids are added to the first empty entry of their probe sequence, and entries are never removed.
+                    return nullptr;
+                }
+
+                if (entryHash == hash && entry.m_shaderVariantId == shaderVariantId)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        void ShaderVariantLookupCache::AddEntry(
+            Table& table, const ShaderVariantId& shaderVariantId, size_t hash, const ShaderVariant* shaderVariant)
+        {
+            const size_t indexMask = table.m_capacity - 1;
+            for (size_t index = hash & indexMask;; index = (index + 1) & indexMask)
+            {
+                Entry& entry = table.m_entries[index];
+                if (entry.m_hash.load(AZStd::memory_order_relaxed) == 0)
+                {
+                    entry.m_shaderVariantId = shaderVariantId;
+                    entry.m_shaderVariant.store(shaderVariant, AZStd::memory_order_relaxed);
+                    // Lookups that see the hash also see the id and the variant.
+                    entry.m_hash.store(hash, AZStd::memory_order_release);
+                    return;
+                }
+            }
+        }
+
+        ShaderVariantLookupCache::Table& ShaderVariantLookupCache::Grow()
+        {
+            const Table* currentTable = m_table.load(AZStd::memory_order_relaxed);
+
+            AZStd::unique_ptr<Table> table = AZStd::make_unique<Table>();
+            table->m_capacity = currentTable ? currentTable->m_capacity * 2 : InitialCapacity;
+            table->m_entries = AZStd::make_unique<Entry[]>(table->m_capacity);
+
+            if (currentTable)
+            {
+                for (size_t index = 0; index < currentTable->m_capacity; ++index)
+                {
+                    const Entry& entry = currentTable->m_entries[index];
+                    const size_t hash = entry.m_hash.load(AZStd::memory_order_relaxed);
+                    if (hash != 0)
+                    {
+                        AddEntry(*table, entry.m_shaderVariantId, hash, entry.m_shaderVariant.load(AZStd::memory_order_relaxed));
+                    }
+                }
+            }
+
+            m_table.store(table.get(), AZStd::memory_order_release);
+            m_tables.push_back(AZStd::move(table));
+            return *m_tables.back();
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -127,6 +127,11 @@ namespace AZ
             AddDrawPacket(drawPacket, depth);
         }
 
+        void View::AddDrawPackets(AZStd::span<const RHI::DrawPacket* const> drawPackets, float depth)
+        {
+            m_drawListContext.AddDrawPackets(drawPackets, depth);
+        }
+
         void View::AddVisibleObject(const void* userData, float depth)
         {
             // This function is thread safe since VisibleObjectContext has storage per thread for draw item data.
@@ -11,6 +11,7 @@
 #include <Atom/RPI.Reflect/Material/LuaScriptUtilities.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Script/ScriptAsset.h>
@@ -24,14 +25,25 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool,
+            r_luaMaterialFunctorUseCompiledPrograms,
+            true,
+            nullptr,
+            ConsoleFunctorFlags::Null,
+            "Runs the compiled programs of lua material functors instead of their scripts, when the material type builder could compile them."
+        );
+
         void LuaMaterialFunctor::Reflect(ReflectContext* context)
         {
+            LuaMaterialFunctorProgram::Reflect(context);
+
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<LuaMaterialFunctor, RPI::MaterialFunctor>()
-                    ->Version(1)
+                    ->Version(2) // Added compiledProgram
                     ->Field("scriptAsset", &LuaMaterialFunctor::m_scriptAsset)
                     ->Field("materialNameContext", &LuaMaterialFunctor::m_materialNameContext)
+                    ->Field("compiledProgram", &LuaMaterialFunctor::m_compiledProgram)
                     ;
             }
 
@@ -128,6 +140,12 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(RPI);
 
+            if (r_luaMaterialFunctorUseCompiledPrograms && m_compiledProgram.IsValid())
+            {
+                m_compiledProgram.Execute(context);
+                return;
+            }
+
             InitScriptContext();
 
             if (m_scriptStatus == ScriptStatus::Ready)
@@ -148,6 +166,13 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(RPI);
 
+            // A program that calls runtime context functions runs the script instead, which reports the missing functions.
+            if (r_luaMaterialFunctorUseCompiledPrograms && m_compiledProgram.IsValid() && !m_compiledProgram.UsesRuntimeContextFunctions())
+            {
+                m_compiledProgram.Execute(context);
+                return;
+            }
+
             InitScriptContext();
 
             if (m_scriptStatus == ScriptStatus::Ready)
@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Material/LuaMaterialFunctorProgram.h>
+#include <Atom/RPI.Reflect/Material/LuaScriptUtilities.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            enum class ValueType : uint8_t
+            {
+                Nil,
+                Bool,
+                Number,
+                Image,
+                ShaderItem
+            };
+
+            struct Value
+            {
+                ValueType m_type = ValueType::Nil;
+                union
+                {
+                    bool m_bool;
+                    double m_number;
+                    const Image* m_image;
+                    ShaderCollection::Item* m_shaderItem;
+                };
+            };
+
+            Value MakeBool(bool value)
+            {
+                Value result;
+                result.m_type = ValueType::Bool;
+                result.m_bool = value;
+                return result;
+            }
+
+            Value MakeNumber(double value)
+            {
+                Value result;
+                result.m_type = ValueType::Number;
+                result.m_number = value;
+                return result;
+            }
+
+            //! Lua truthiness, only nil and false are false.
+            bool IsTrue(const Value& value)
+            {
+                return value.m_type != ValueType::Nil && (value.m_type != ValueType::Bool || value.m_bool);
+            }
+
+            bool AreEqual(const Value& a, const Value& b)
+            {
+                if (a.m_type != b.m_type)
+                {
+                    return false;
+                }
+
+                switch (a.m_type)
+                {
+                case ValueType::Nil:
+                    return true;
+                case ValueType::Bool:
+                    return a.m_bool == b.m_bool;
+                case ValueType::Number:
+                    return a.m_number == b.m_number;
+                case ValueType::Image:
+                    return a.m_image == b.m_image;
+                default:
+                    // Every GetShaderByTag() call makes a new userdata in Lua, so shader items are never equal.
+                    return false;
+                }
+            }
+
+            // The compiler only emits numeric instructions for operands that are numbers, so the values are read without checks.
+            int32_t ToInt(const Value& value)
+            {
+                return static_cast<int32_t>(static_cast<int64_t>(value.m_number));
+            }
+
+            uint32_t ToUInt(const Value& value)
+            {
+                return static_cast<uint32_t>(static_cast<int64_t>(value.m_number));
+            }
+
+            float ToFloat(const Value& value)
+            {
+                return static_cast<float>(value.m_number);
+            }
+
+            //! Reads a property value the way LuaMaterialFunctorAPI::ReadMaterialPropertyValues::GetMaterialPropertyValue() does,
+            //! reporting the same errors and falling back to the default value of the type.
+            template<typename Type>
+            const Type* ReadPropertyValue(const MaterialFunctorAPI::ReadMaterialPropertyValues& context, MaterialPropertyIndex index)
+            {
+                // The property indexes were resolved against the layout the material type was built with.
+                if (index.GetIndex() >= context.GetMaterialPropertiesLayout()->GetPropertyCount())
+                {
+                    LuaScriptUtilities::Error(AZStd::string::format(
+                        "GetMaterialPropertyValue() got property index %u, which is not in the material properties layout.",
+                        index.GetIndex()));
+                    return nullptr;
+                }
+
+                const MaterialPropertyValue& value = context.GetMaterialPropertyValue(index);
+
+                if (!value.IsValid())
+                {
+                    LuaScriptUtilities::Error(AZStd::string::format(
+                        "GetMaterialPropertyValue() got invalid value for property '%s'",
+                        context.GetMaterialPropertiesLayout()->GetPropertyDescriptor(index)->GetName().GetCStr()));
+                    return nullptr;
+                }
+
+                if (!value.Is<Type>())
+                {
+                    LuaScriptUtilities::Error(AZStd::string::format(
+                        "GetMaterialPropertyValue() accessed property '%s' using the wrong data type.",
+                        context.GetMaterialPropertiesLayout()->GetPropertyDescriptor(index)->GetName().GetCStr()));
+                    return nullptr;
+                }
+
+                return &value.GetValue<Type>();
+            }
+
+            template<typename Type>
+            void SetShaderConstant(MaterialFunctorAPI::RuntimeContext& context, RHI::ShaderInputConstantIndex index, const Type& value)
+            {
+                ShaderResourceGroup* shaderResourceGroup = context.GetShaderResourceGroup();
+                if (!shaderResourceGroup)
+                {
+                    return;
+                }
+
+                // The shader input indexes were resolved against the layout the material type was built with.
+                if (index.GetIndex() >= shaderResourceGroup->GetLayout()->GetShaderInputListForConstants().size())
+                {
+                    LuaScriptUtilities::Error(AZStd::string::format(
+                        "SetShaderConstant() got shader input index %u, which is not in the material shader resource group layout.",
+                        index.GetIndex()));
+                    return;
+                }
+
+                shaderResourceGroup->SetConstant(index, value);
+            }
+
+            //! Executes the instructions that call functions which are only available in MaterialFunctorAPI::RuntimeContext.
+            void ExecuteRuntimeContextInstruction(
+                const LuaMaterialFunctorProgram& program,
+                MaterialFunctorAPI::RuntimeContext& context,
+                const LuaMaterialFunctorProgram::Instruction& instruction,
+                const Value& a)
+            {
+                using OpCode = LuaMaterialFunctorProgram::OpCode;
+
+                switch (static_cast<OpCode>(instruction.m_opCode))
+                {
+                case OpCode::SetShaderConstantBool:
+                    SetShaderConstant(context, program.m_shaderInputIndexes[instruction.m_operand], IsTrue(a));
+                    break;
+                case OpCode::SetShaderConstantInt:
+                    SetShaderConstant(context, program.m_shaderInputIndexes[instruction.m_operand], ToInt(a));
+                    break;
+                case OpCode::SetShaderConstantUInt:
+                    SetShaderConstant(context, program.m_shaderInputIndexes[instruction.m_operand], ToUInt(a));
+                    break;
+                case OpCode::SetShaderConstantFloat:
+                    SetShaderConstant(context, program.m_shaderInputIndexes[instruction.m_operand], ToFloat(a));
+                    break;
+                case OpCode::SetInternalPropertyBool:
+                    context.SetInternalMaterialPropertyValue(program.m_names[instruction.m_operand], MaterialPropertyValue{IsTrue(a)});
+                    break;
+                case OpCode::SetInternalPropertyInt:
+                    context.SetInternalMaterialPropertyValue(program.m_names[instruction.m_operand], MaterialPropertyValue{ToInt(a)});
+                    break;
+                case OpCode::SetInternalPropertyUInt:
+                    context.SetInternalMaterialPropertyValue(program.m_names[instruction.m_operand], MaterialPropertyValue{ToUInt(a)});
+                    break;
+                case OpCode::SetInternalPropertyFloat:
+                    context.SetInternalMaterialPropertyValue(program.m_names[instruction.m_operand], MaterialPropertyValue{ToFloat(a)});
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            //! Validates programs loaded from material type assets, so a stale or corrupt asset falls back to running the script.
+            class LuaMaterialFunctorProgramSerializationEvents
+                : public SerializeContext::IEventHandler
+            {
+                //! Called right after we finish writing data to the instance pointed at by classPtr.
+                void OnWriteEnd(void* classPtr) override
+                {
+                    LuaMaterialFunctorProgram* program = reinterpret_cast<LuaMaterialFunctorProgram*>(classPtr);
+                    if (program->m_instructions.empty())
+                    {
+                        // Scripts that could not be compiled have no program.
+                        return;
+                    }
+
+                    [[maybe_unused]] auto result = program->Validate();
+                    AZ_Warning(
+                        LuaScriptUtilities::DebugName, result.IsSuccess(),
+                        "Discarding the compiled program of a lua material functor, the functor will run its script. %s",
+                        result.IsSuccess() ? "" : result.GetError().c_str());
+                }
+            };
+        } // namespace
+
+        void LuaMaterialFunctorProgram::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<Instruction>()
+                    ->Version(1)
+                    ->Field("opCode", &Instruction::m_opCode)
+                    ->Field("target", &Instruction::m_target)
+                    ->Field("a", &Instruction::m_a)
+                    ->Field("b", &Instruction::m_b)
+                    ->Field("operand", &Instruction::m_operand)
+                    ;
+
+                serializeContext->Class<LuaMaterialFunctorProgram>()
+                    ->Version(1)
+                    ->EventHandler<LuaMaterialFunctorProgramSerializationEvents>()
+                    ->Field("instructions", &LuaMaterialFunctorProgram::m_instructions)
+                    ->Field("numbers", &LuaMaterialFunctorProgram::m_numbers)
+                    ->Field("names", &LuaMaterialFunctorProgram::m_names)
+                    ->Field("messages", &LuaMaterialFunctorProgram::m_messages)
+                    ->Field("propertyIndexes", &LuaMaterialFunctorProgram::m_propertyIndexes)
+                    ->Field("shaderInputIndexes", &LuaMaterialFunctorProgram::m_shaderInputIndexes)
+                    ->Field("usesRuntimeContextFunctions", &LuaMaterialFunctorProgram::m_usesRuntimeContextFunctions)
+                    ;
+            }
+        }
+
+        bool LuaMaterialFunctorProgram::IsValid() const
+        {
+            return m_isValid;
+        }
+
+        Outcome<void, AZStd::string> LuaMaterialFunctorProgram::Validate()
+        {
+            m_isValid = false;
+
+            if (m_instructions.empty())
+            {
+                return Failure(AZStd::string{ "The program has no instructions." });
+            }
+
+            const size_t instructionCount = m_instructions.size();
+            for (size_t instructionIndex = 0; instructionIndex < instructionCount; ++instructionIndex)
+            {
+                const Instruction& instruction = m_instructions[instructionIndex];
+
+                if (instruction.m_opCode > static_cast<uint8_t>(OpCode::Return))
+                {
+                    return Failure(AZStd::string::format(
+                        "Instruction %zu has the unknown opcode %u.", instructionIndex, instruction.m_opCode));
+                }
+
+                if (instruction.m_target >= MaxRegisterCount || instruction.m_a >= MaxRegisterCount || instruction.m_b >= MaxRegisterCount)
+                {
+                    return Failure(AZStd::string::format(
+                        "Instruction %zu uses a register past the %u registers of a program.", instructionIndex, MaxRegisterCount));
+                }
+
+                // The number of entries the operand indexes, starting at the operand, and the size of the list they are in.
+                // Jumps may continue at the end of the instruction list, which returns.
+                size_t operandCount = 1;
+                size_t listSize = 0;
+                bool usesRuntimeContextFunction = false;
+                switch (static_cast<OpCode>(instruction.m_opCode))
+                {
+                case OpCode::LoadNumber:
+                    listSize = m_numbers.size();
+                    break;
+                case OpCode::GetPropertyBool:
+                case OpCode::GetPropertyInt:
+                case OpCode::GetPropertyUInt:
+                case OpCode::GetPropertyFloat:
+                case OpCode::GetPropertyImage:
+                    listSize = m_propertyIndexes.size();
+                    break;
+                case OpCode::Jump:
+                case OpCode::JumpIfFalse:
+                case OpCode::JumpIfTrue:
+                    listSize = instructionCount + 1;
+                    break;
+                case OpCode::SetShaderOptionBool:
+                case OpCode::SetShaderOptionUInt:
+                case OpCode::HasShaderWithTag:
+                case OpCode::GetShaderByTag:
+                    listSize = m_names.size();
+                    break;
+                case OpCode::SetShaderOptionEnum:
+                    operandCount = 2;
+                    listSize = m_names.size();
+                    break;
+                case OpCode::SetShaderConstantBool:
+                case OpCode::SetShaderConstantInt:
+                case OpCode::SetShaderConstantUInt:
+                case OpCode::SetShaderConstantFloat:
+                    listSize = m_shaderInputIndexes.size();
+                    usesRuntimeContextFunction = true;
+                    break;
+                case OpCode::SetInternalPropertyBool:
+                case OpCode::SetInternalPropertyInt:
+                case OpCode::SetInternalPropertyUInt:
+                case OpCode::SetInternalPropertyFloat:
+                    listSize = m_names.size();
+                    usesRuntimeContextFunction = true;
+                    break;
+                case OpCode::Error:
+                case OpCode::Warning:
+                case OpCode::Print:
+                    listSize = m_messages.size();
+                    break;
+                default:
+                    // The other instructions don't use the operand, or use it as a value.
+                    operandCount = 0;
+                    break;
+                }
+
+                if (operandCount > 0 && aznumeric_cast<size_t>(instruction.m_operand) + operandCount > listSize)
+                {
+                    return Failure(AZStd::string::format(
+                        "The operand %u of instruction %zu is out of range.", instruction.m_operand, instructionIndex));
+                }
+
+                // Execute(PipelineRuntimeContext&) relies on this flag to skip those instructions.
+                if (usesRuntimeContextFunction && !m_usesRuntimeContextFunctions)
+                {
+                    return Failure(AZStd::string::format(
+                        "Instruction %zu calls a runtime context function, but the program is not flagged to use them.", instructionIndex));
+                }
+            }
+
+            m_isValid = true;
+            return Success();
+        }
+
+        bool LuaMaterialFunctorProgram::UsesRuntimeContextFunctions() const
+        {
+            return m_usesRuntimeContextFunctions;
+        }
+
+        void LuaMaterialFunctorProgram::Execute(MaterialFunctorAPI::RuntimeContext& context) const
+        {
+            ExecuteInternal(context);
+        }
+
+        void LuaMaterialFunctorProgram::Execute(MaterialFunctorAPI::PipelineRuntimeContext& context) const
+        {
+            AZ_Assert(!m_usesRuntimeContextFunctions, "This program can only run in a MaterialFunctorAPI::RuntimeContext.");
+            ExecuteInternal(context);
+        }
+
+        template<typename ContextType>
+        void LuaMaterialFunctorProgram::ExecuteInternal(ContextType& context) const
+        {
+            AZ_Assert(m_isValid, "Only programs that passed Validate() can be executed.");
+
+            AZStd::array<Value, MaxRegisterCount> registers;
+
+            const uint32_t instructionCount = aznumeric_cast<uint32_t>(m_instructions.size());
+            uint32_t instructionIndex = 0;
+            while (instructionIndex < instructionCount)
+            {
+                const Instruction& instruction = m_instructions[instructionIndex++];
+                Value& target = registers[instruction.m_target];
+                const Value& a = registers[instruction.m_a];
+                const Value& b = registers[instruction.m_b];
+
+                switch (static_cast<OpCode>(instruction.m_opCode))
+                {
+                case OpCode::LoadNil:
+                    target = Value{};
+                    break;
+                case OpCode::LoadBool:
+                    target = MakeBool(instruction.m_operand != 0);
+                    break;
+                case OpCode::LoadNumber:
+                    target = MakeNumber(m_numbers[instruction.m_operand]);
+                    break;
+                case OpCode::Move:
+                    target = a;
+                    break;
+
+                case OpCode::GetPropertyBool:
+                    {
+                        const bool* value = ReadPropertyValue<bool>(context, m_propertyIndexes[instruction.m_operand]);
+                        target = MakeBool(value ? *value : false);
+                    }
+                    break;
+                case OpCode::GetPropertyInt:
+                    {
+                        const int32_t* value = ReadPropertyValue<int32_t>(context, m_propertyIndexes[instruction.m_operand]);
+                        target = MakeNumber(value ? *value : 0);
+                    }
+                    break;
+                case OpCode::GetPropertyUInt:
+                    {
+                        const uint32_t* value = ReadPropertyValue<uint32_t>(context, m_propertyIndexes[instruction.m_operand]);
+                        target = MakeNumber(value ? *value : 0);
+                    }
+                    break;
+                case OpCode::GetPropertyFloat:
+                    {
+                        const float* value = ReadPropertyValue<float>(context, m_propertyIndexes[instruction.m_operand]);
+                        target = MakeNumber(value ? *value : 0.0f);
+                    }
+                    break;
+                case OpCode::GetPropertyImage:
+                    {
+                        const Data::Instance<Image>* value =
+                            ReadPropertyValue<Data::Instance<Image>>(context, m_propertyIndexes[instruction.m_operand]);
+                        target = Value{};
+                        if (value && *value)
+                        {
+                            target.m_type = ValueType::Image;
+                            target.m_image = value->get();
+                        }
+                    }
+                    break;
+
+                case OpCode::Not:
+                    target = MakeBool(!IsTrue(a));
+                    break;
+                case OpCode::Negate:
+                    target = MakeNumber(-a.m_number);
+                    break;
+                case OpCode::Add:
+                    target = MakeNumber(a.m_number + b.m_number);
+                    break;
+                case OpCode::Subtract:
+                    target = MakeNumber(a.m_number - b.m_number);
+                    break;
+                case OpCode::Multiply:
+                    target = MakeNumber(a.m_number * b.m_number);
+                    break;
+                case OpCode::Divide:
+                    target = MakeNumber(a.m_number / b.m_number);
+                    break;
+                case OpCode::Equal:
+                    target = MakeBool(AreEqual(a, b));
+                    break;
+                case OpCode::NotEqual:
+                    target = MakeBool(!AreEqual(a, b));
+                    break;
+                case OpCode::Less:
+                    target = MakeBool(a.m_number < b.m_number);
+                    break;
+                case OpCode::LessEqual:
+                    target = MakeBool(a.m_number <= b.m_number);
+                    break;
+
+                case OpCode::Jump:
+                    instructionIndex = instruction.m_operand;
+                    break;
+                case OpCode::JumpIfFalse:
+                    if (!IsTrue(a))
+                    {
+                        instructionIndex = instruction.m_operand;
+                    }
+                    break;
+                case OpCode::JumpIfTrue:
+                    if (IsTrue(a))
+                    {
+                        instructionIndex = instruction.m_operand;
+                    }
+                    break;
+
+                case OpCode::SetShaderOptionBool:
+                    context.SetShaderOptionValue(m_names[instruction.m_operand], ShaderOptionValue{IsTrue(a)});
+                    break;
+                case OpCode::SetShaderOptionUInt:
+                    context.SetShaderOptionValue(m_names[instruction.m_operand], ShaderOptionValue{ToUInt(a)});
+                    break;
+                case OpCode::SetShaderOptionEnum:
+                    context.SetShaderOptionValue(m_names[instruction.m_operand], m_names[instruction.m_operand + 1]);
+                    break;
+
+                case OpCode::HasShaderWithTag:
+                    target = MakeBool(context.m_localShaderCollection->HasShaderTag(m_names[instruction.m_operand]));
+                    break;
+                case OpCode::GetShaderByTag:
+                    {
+                        const Name& shaderTag = m_names[instruction.m_operand];
+                        target.m_type = ValueType::ShaderItem;
+                        target.m_shaderItem = nullptr;
+                        if (context.m_localShaderCollection->HasShaderTag(shaderTag))
+                        {
+                            target.m_shaderItem = &(*context.m_localShaderCollection)[shaderTag];
+                        }
+                        else
+                        {
+                            LuaScriptUtilities::Error(AZStd::string::format(
+                                "GetShaderByTag('%s') is invalid: Could not find a shader with the tag '%s'.",
+                                shaderTag.GetCStr(), shaderTag.GetCStr()));
+                        }
+                    }
+                    break;
+                case OpCode::SetShaderEnabled:
+                    if (a.m_type == ValueType::ShaderItem && a.m_shaderItem)
+                    {
+                        a.m_shaderItem->SetEnabled(IsTrue(b));
+                    }
+                    break;
+
+                case OpCode::Error:
+                    LuaScriptUtilities::Error(m_messages[instruction.m_operand]);
+                    break;
+                case OpCode::Warning:
+                    LuaScriptUtilities::Warning(m_messages[instruction.m_operand]);
+                    break;
+                case OpCode::Print:
+                    LuaScriptUtilities::Print(m_messages[instruction.m_operand]);
+                    break;
+
+                case OpCode::SetShaderConstantBool:
+                case OpCode::SetShaderConstantInt:
+                case OpCode::SetShaderConstantUInt:
+                case OpCode::SetShaderConstantFloat:
+                case OpCode::SetInternalPropertyBool:
+                case OpCode::SetInternalPropertyInt:
+                case OpCode::SetInternalPropertyUInt:
+                case OpCode::SetInternalPropertyFloat:
+                    if constexpr (AZStd::is_same_v<ContextType, MaterialFunctorAPI::RuntimeContext>)
+                    {
+                        ExecuteRuntimeContextInstruction(*this, context, instruction, a);
+                    }
+                    break;
+
+                case OpCode::Return:
+                    return;
+                }
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -13,6 +13,8 @@
 #include <Atom/RPI.Reflect/Shader/ShaderAssetCreator.h>
 #include <Atom/RPI.Edit/Shader/ShaderVariantAssetCreator.h>
 
+#include <AzCore/Interface/Interface.h>
+
 #include <Common/RHI/Stubs.h>
 
 #include "ShaderAssetTestUtils.h"
@@ -54,10 +56,10 @@ namespace UnitTest
         return bindingInfo;
     }
 
-    static AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> CreateTestShaderVariantAsset(
+    AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> CreateTestShaderVariantAsset(
         AZ::RPI::ShaderVariantId id,
         AZ::RPI::ShaderVariantStableId stableId,
-        const AZStd::vector<AZ::RHI::ShaderStage>& stagesToActivate = { AZ::RHI::ShaderStage::Vertex, AZ::RHI::ShaderStage::Fragment })
+        const AZStd::vector<AZ::RHI::ShaderStage>& stagesToActivate)
     {
         using namespace AZ;
         RPI::ShaderVariantAssetCreator shaderVariantAssetCreator;
@@ -139,4 +141,125 @@ namespace UnitTest
 
         return shaderAsset;
     }
+
+    TestShaderVariantFinder::TestShaderVariantFinder()
+    {
+        m_registeredFinder = AZ::Interface<AZ::RPI::IShaderVariantFinder>::Get();
+        if (m_registeredFinder)
+        {
+            AZ::Interface<AZ::RPI::IShaderVariantFinder>::Unregister(m_registeredFinder);
+        }
+        AZ::Interface<AZ::RPI::IShaderVariantFinder>::Register(this);
+    }
+
+    TestShaderVariantFinder::~TestShaderVariantFinder()
+    {
+        AZ::Interface<AZ::RPI::IShaderVariantFinder>::Unregister(this);
+        if (m_registeredFinder)
+        {
+            AZ::Interface<AZ::RPI::IShaderVariantFinder>::Register(m_registeredFinder);
+        }
+    }
+
+    void TestShaderVariantFinder::SetShaderVariantTreeAsset(AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> shaderVariantTreeAsset)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_shaderVariantTreeAsset = shaderVariantTreeAsset;
+    }
+
+    void TestShaderVariantFinder::AddShaderVariantAsset(AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> shaderVariantAsset)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_shaderVariantAssets[shaderVariantAsset->GetStableId()] = shaderVariantAsset;
+    }
+
+    void TestShaderVariantFinder::SetVariantIdLookupCallback(AZStd::function<void()> callback)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_variantIdLookupCallback = AZStd::move(callback);
+    }
+
+    uint32_t TestShaderVariantFinder::GetVariantIdLookupCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_variantIdLookupCount;
+    }
+
+    bool TestShaderVariantFinder::QueueLoadShaderVariantAssetByVariantId(
+        AZ::Data::Asset<AZ::RPI::ShaderAsset>, const AZ::RPI::ShaderVariantId&, AZ::RPI::SupervariantIndex)
+    {
+        return true;
+    }
+
+    bool TestShaderVariantFinder::QueueLoadShaderVariantTreeAsset(const AZ::Data::AssetId&)
+    {
+        return true;
+    }
+
+    bool TestShaderVariantFinder::QueueLoadShaderVariantAsset(const AZ::Data::AssetId&, AZ::RPI::ShaderVariantStableId, const AZ::Name&)
+    {
+        return true;
+    }
+
+    AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> TestShaderVariantFinder::GetShaderVariantAssetByVariantId(
+        AZ::Data::Asset<AZ::RPI::ShaderAsset> shaderAsset,
+        const AZ::RPI::ShaderVariantId& shaderVariantId,
+        AZ::RPI::SupervariantIndex supervariantIndex)
+    {
+        AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> shaderVariantAsset;
+        AZStd::function<void()> callback;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ++m_variantIdLookupCount;
+            AZStd::swap(callback, m_variantIdLookupCallback);
+
+            if (m_shaderVariantTreeAsset)
+            {
+                const AZ::RPI::ShaderVariantSearchResult searchResult =
+                    m_shaderVariantTreeAsset->FindVariantStableId(shaderAsset->GetShaderOptionGroupLayout(), shaderVariantId);
+                shaderVariantAsset = searchResult.IsRoot() ? shaderAsset->GetRootVariantAsset(supervariantIndex)
+                                                           : FindShaderVariantAsset(searchResult.GetStableId());
+            }
+        }
+
+        if (callback)
+        {
+            callback();
+        }
+        return shaderVariantAsset;
+    }
+
+    AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> TestShaderVariantFinder::GetShaderVariantAssetByStableId(
+        AZ::Data::Asset<AZ::RPI::ShaderAsset>, AZ::RPI::ShaderVariantStableId shaderVariantStableId, AZ::RPI::SupervariantIndex)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return FindShaderVariantAsset(shaderVariantStableId);
+    }
+
+    AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> TestShaderVariantFinder::GetShaderVariantTreeAsset(const AZ::Data::AssetId&)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_shaderVariantTreeAsset;
+    }
+
+    AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> TestShaderVariantFinder::GetShaderVariantAsset(
+        const AZ::Data::AssetId&, AZ::RPI::ShaderVariantStableId variantStableId, AZ::RPI::SupervariantIndex)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return FindShaderVariantAsset(variantStableId);
+    }
+
+    void TestShaderVariantFinder::Reset()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_shaderVariantTreeAsset = {};
+        m_shaderVariantAssets.clear();
+    }
+
+    AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> TestShaderVariantFinder::FindShaderVariantAsset(
+        AZ::RPI::ShaderVariantStableId variantStableId) const
+    {
+        auto findIt = m_shaderVariantAssets.find(variantStableId);
+        return findIt != m_shaderVariantAssets.end() ? findIt->second : AZ::Data::Asset<AZ::RPI::ShaderVariantAsset>{};
+    }
 }
@@ -8,7 +8,13 @@
 
 #pragma once
 
+#include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace UnitTest
 {
@@ -21,4 +27,72 @@ namespace UnitTest
         const AZ::Name& shaderName = AZ::Name{ "TestShader" },
         const AZ::Name& drawListName = AZ::Name{ "depth" } );
 
+    //! Utility function for creating a ShaderVariantAsset with stub shader functions
+    AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> CreateTestShaderVariantAsset(
+        AZ::RPI::ShaderVariantId id,
+        AZ::RPI::ShaderVariantStableId stableId,
+        const AZStd::vector<AZ::RHI::ShaderStage>& stagesToActivate = { AZ::RHI::ShaderStage::Vertex, AZ::RHI::ShaderStage::Fragment });
+
+    //! Replaces the registered IShaderVariantFinder for as long as it exists, so tests can decide which
+    //! ShaderVariantTreeAsset and ShaderVariantAssets are loaded. The ShaderVariantAsyncLoader owned by the RPISystem needs
+    //! an asset catalog to find them. Like the loader, the lookups are guarded by a mutex.
+    class TestShaderVariantFinder final
+        : public AZ::RPI::IShaderVariantFinder
+    {
+    public:
+        TestShaderVariantFinder();
+        ~TestShaderVariantFinder() override;
+
+        //! The tree is used for every shader asset. An empty asset means the tree is still loading.
+        void SetShaderVariantTreeAsset(AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> shaderVariantTreeAsset);
+
+        //! Makes the variant asset available as a loaded asset, for every shader asset.
+        void AddShaderVariantAsset(AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> shaderVariantAsset);
+
+        //! Called after the next GetShaderVariantAssetByVariantId() found its result, outside of the finder's mutex.
+        void SetVariantIdLookupCallback(AZStd::function<void()> callback);
+
+        //! Returns the number of GetShaderVariantAssetByVariantId() calls.
+        uint32_t GetVariantIdLookupCount() const;
+
+        ///////////////////////////////////////////////////////////////////
+        // IShaderVariantFinder overrides
+        bool QueueLoadShaderVariantAssetByVariantId(
+            AZ::Data::Asset<AZ::RPI::ShaderAsset> shaderAsset,
+            const AZ::RPI::ShaderVariantId& shaderVariantId,
+            AZ::RPI::SupervariantIndex supervariantIndex) override;
+        bool QueueLoadShaderVariantTreeAsset(const AZ::Data::AssetId& shaderAssetId) override;
+        bool QueueLoadShaderVariantAsset(
+            const AZ::Data::AssetId& shaderVariantTreeAssetId,
+            AZ::RPI::ShaderVariantStableId variantStableId,
+            const AZ::Name& supervariantName) override;
+
+        AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> GetShaderVariantAssetByVariantId(
+            AZ::Data::Asset<AZ::RPI::ShaderAsset> shaderAsset,
+            const AZ::RPI::ShaderVariantId& shaderVariantId,
+            AZ::RPI::SupervariantIndex supervariantIndex) override;
+        AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> GetShaderVariantAssetByStableId(
+            AZ::Data::Asset<AZ::RPI::ShaderAsset> shaderAsset,
+            AZ::RPI::ShaderVariantStableId shaderVariantStableId,
+            AZ::RPI::SupervariantIndex supervariantIndex) override;
+        AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> GetShaderVariantTreeAsset(const AZ::Data::AssetId& shaderAssetId) override;
+        AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> GetShaderVariantAsset(
+            const AZ::Data::AssetId& shaderVariantTreeAssetId,
+            AZ::RPI::ShaderVariantStableId variantStableId,
+            AZ::RPI::SupervariantIndex supervariantIndex) override;
+        void Reset() override;
+        ///////////////////////////////////////////////////////////////////
+
+    private:
+        AZ::Data::Asset<AZ::RPI::ShaderVariantAsset> FindShaderVariantAsset(AZ::RPI::ShaderVariantStableId variantStableId) const;
+
+        AZ::RPI::IShaderVariantFinder* m_registeredFinder = nullptr;
+
+        mutable AZStd::mutex m_mutex;
+        AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> m_shaderVariantTreeAsset;
+        AZStd::unordered_map<AZ::RPI::ShaderVariantStableId, AZ::Data::Asset<AZ::RPI::ShaderVariantAsset>> m_shaderVariantAssets;
+        AZStd::function<void()> m_variantIdLookupCallback;
+        uint32_t m_variantIdLookupCount = 0;
+    };
+
 } //namespace UnitTest
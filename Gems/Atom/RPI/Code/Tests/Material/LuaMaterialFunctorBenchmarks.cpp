@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <Atom/RPI.Edit/Material/LuaMaterialFunctorSourceData.h>
+#include <Atom/RPI.Reflect/Material/LuaMaterialFunctor.h>
+#include <Atom/RPI.Reflect/Material/MaterialPipelineState.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertyCollection.h>
+#include <Atom/RPI.Reflect/Material/MaterialTypeAsset.h>
+#include <Atom/RPI.Reflect/Material/MaterialTypeAssetCreator.h>
+#include <Common/RPITestFixture.h>
+#include <Common/ShaderAssetTestUtils.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace RPI;
+
+    //! Brings up the RPI the same way the unit tests do, so a benchmark fixture can own it
+    class LuaMaterialFunctorBenchmarkEnvironment : public RPITestFixture
+    {
+    public:
+        using RPITestFixture::SetUp;
+        using RPITestFixture::TearDown;
+
+    private:
+        void TestBody() override
+        {
+        }
+    };
+
+    // Scripts following the patterns of the functors of StandardPBR and EnhancedPBR
+    static const char* const BenchmarkScripts[] = {
+        R"(
+            function GetMaterialPropertyDependencies()
+                return {"roughness.useTexture", "roughness.factor"}
+            end
+
+            function GetShaderOptionDependencies()
+                return {"o_roughness_useTexture"}
+            end
+
+            function Process(context)
+                local useTexture = context:GetMaterialPropertyValue_bool("roughness.useTexture")
+                local factor = context:GetMaterialPropertyValue_float("roughness.factor")
+                context:SetShaderOptionValue_bool("o_roughness_useTexture", useTexture and factor > 0.0)
+            end
+        )",
+        R"(
+            OpacityMode_Opaque = 0
+            OpacityMode_Cutout = 1
+            OpacityMode_Blended = 2
+            OpacityMode_TintedTransparent = 3
+
+            function GetMaterialPropertyDependencies()
+                return {"opacity.mode"}
+            end
+
+            function GetShaderOptionDependencies()
+                return {"o_opacity_mode"}
+            end
+
+            function Process(context)
+                local opacityMode = context:GetMaterialPropertyValue_uint("opacity.mode")
+                if opacityMode == OpacityMode_Cutout then
+                    context:SetShaderOptionValue_enum("o_opacity_mode", "OpacityMode::Cutout")
+                elseif opacityMode == OpacityMode_Blended or opacityMode == OpacityMode_TintedTransparent then
+                    context:SetShaderOptionValue_enum("o_opacity_mode", "OpacityMode::Blended")
+                else
+                    context:SetShaderOptionValue_enum("o_opacity_mode", "OpacityMode::Opaque")
+                end
+            end
+        )",
+        R"(
+            function GetMaterialPropertyDependencies()
+                return {"emissive.enable", "emissive.intensity", "clearCoat.enable", "clearCoat.factor"}
+            end
+
+            function GetShaderOptionDependencies()
+                return {"o_emissive_enabled", "o_clearCoat_enabled", "o_clearCoat_quality"}
+            end
+
+            function IsFeatureEnabled(context, enableName, factorName)
+                return context:GetMaterialPropertyValue_bool(enableName) and context:GetMaterialPropertyValue_float(factorName) > 0.0
+            end
+
+            function Process(context)
+                context:SetShaderOptionValue_bool("o_emissive_enabled", IsFeatureEnabled(context, "emissive.enable", "emissive.intensity"))
+
+                local clearCoatEnabled = IsFeatureEnabled(context, "clearCoat.enable", "clearCoat.factor")
+                context:SetShaderOptionValue_bool("o_clearCoat_enabled", clearCoatEnabled)
+
+                local quality = 0
+                if clearCoatEnabled then
+                    if context:GetMaterialPropertyValue_float("clearCoat.factor") > 0.5 then
+                        quality = 2
+                    else
+                        quality = 1
+                    end
+                end
+                context:SetShaderOptionValue_uint("o_clearCoat_quality", quality)
+            end
+        )"
+    };
+
+    /*
+     * Runs the lua material functors of a material type for many materials, the way Material::Compile() does when
+     * material properties change. Each benchmark thread owns its own materials, as materials are compiled in parallel.
+     * Materials are set up with random property values, so the functors take every branch.
+     */
+    class LuaMaterialFunctorBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr uint32_t MaterialsPerThread = 256;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+
+    protected:
+        struct MaterialData
+        {
+            MaterialPropertyCollection m_properties;
+            ShaderCollection m_generalShaderCollection;
+            MaterialPipelineDataMap m_materialPipelineData;
+        };
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            if (state.thread_index() != 0)
+            {
+                return;
+            }
+
+            m_environment = AZStd::make_unique<LuaMaterialFunctorBenchmarkEnvironment>();
+            m_environment->SetUp();
+
+            Ptr<ShaderOptionGroupLayout> shaderOptions = ShaderOptionGroupLayout::Create();
+            const ShaderOptionValues boolValues = CreateBoolShaderOptionValues();
+            const ShaderOptionValues opacityModeValues = CreateEnumShaderOptionValues({ "OpacityMode::Opaque", "OpacityMode::Cutout", "OpacityMode::Blended" });
+            const ShaderOptionValues qualityValues = CreateIntRangeShaderOptionValues(0, 3);
+            shaderOptions->AddShaderOption(ShaderOptionDescriptor{ Name{ "o_roughness_useTexture" }, ShaderOptionType::Boolean, 0, 0, boolValues, Name{ "False" } });
+            shaderOptions->AddShaderOption(ShaderOptionDescriptor{ Name{ "o_opacity_mode" }, ShaderOptionType::Enumeration, 1, 1, opacityModeValues, Name{ "OpacityMode::Opaque" } });
+            shaderOptions->AddShaderOption(ShaderOptionDescriptor{ Name{ "o_emissive_enabled" }, ShaderOptionType::Boolean, 3, 2, boolValues, Name{ "False" } });
+            shaderOptions->AddShaderOption(ShaderOptionDescriptor{ Name{ "o_clearCoat_enabled" }, ShaderOptionType::Boolean, 4, 3, boolValues, Name{ "False" } });
+            shaderOptions->AddShaderOption(ShaderOptionDescriptor{ Name{ "o_clearCoat_quality" }, ShaderOptionType::IntegerRange, 5, 4, qualityValues, Name{ "0" } });
+            shaderOptions->Finalize();
+
+            MaterialTypeAssetCreator materialTypeCreator;
+            materialTypeCreator.Begin(Uuid::CreateRandom());
+            materialTypeCreator.AddShader(CreateTestShaderAsset(Uuid::CreateRandom(), {}, shaderOptions), ShaderVariantId{}, Name{ "TestShader" });
+            const AZStd::pair<const char*, MaterialPropertyDataType> properties[] = {
+                { "roughness.useTexture", MaterialPropertyDataType::Bool },
+                { "roughness.factor", MaterialPropertyDataType::Float },
+                { "opacity.mode", MaterialPropertyDataType::UInt },
+                { "emissive.enable", MaterialPropertyDataType::Bool },
+                { "emissive.intensity", MaterialPropertyDataType::Float },
+                { "clearCoat.enable", MaterialPropertyDataType::Bool },
+                { "clearCoat.factor", MaterialPropertyDataType::Float },
+            };
+            for (const auto& [propertyName, dataType] : properties)
+            {
+                materialTypeCreator.BeginMaterialProperty(Name{ propertyName }, dataType);
+                materialTypeCreator.EndMaterialProperty();
+            }
+
+            for (const char* script : BenchmarkScripts)
+            {
+                // See also LuaMaterialFunctorTests::AddLuaFunctor
+                LuaMaterialFunctorSourceData functorSourceData;
+                functorSourceData.m_luaScript = script;
+
+                MaterialNameContext nameContext;
+                MaterialFunctorSourceData::RuntimeContext createFunctorContext{
+                    "Benchmark.materialtype",
+                    materialTypeCreator.GetMaterialPropertiesLayout(MaterialPipelineNone),
+                    materialTypeCreator.GetMaterialShaderResourceGroupLayout(),
+                    &nameContext
+                };
+
+                // The same functor twice, one that runs its compiled program and one that runs its script
+                for (AZStd::vector<Ptr<LuaMaterialFunctor>>* functors : { &m_compiledFunctors, &m_scriptFunctors })
+                {
+                    MaterialFunctorSourceData::FunctorResult result = functorSourceData.CreateFunctor(createFunctorContext);
+                    AZ_Assert(result.IsSuccess(), "Failed to create the functor");
+                    functors->push_back(azrtti_cast<LuaMaterialFunctor*>(result.GetValue().get()));
+                }
+                AZ_Assert(m_compiledFunctors.back()->m_compiledProgram.IsValid(), "The benchmark script could not be compiled");
+                m_scriptFunctors.back()->m_compiledProgram = {};
+
+                for (const Name& shaderOption : functorSourceData.GetShaderOptionDependencies())
+                {
+                    materialTypeCreator.ClaimShaderOptionOwnership(shaderOption);
+                }
+            }
+
+            materialTypeCreator.End(m_materialTypeAsset);
+
+            const MaterialPropertiesLayout* layout = m_materialTypeAsset->GetMaterialPropertiesLayout();
+            AZ::SimpleLcgRandom random(1234);
+            m_materials.resize(MaterialsPerThread * state.threads());
+            for (MaterialData& material : m_materials)
+            {
+                material.m_properties.Init(layout, m_materialTypeAsset->GetDefaultPropertyValues());
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "roughness.useTexture" }), MaterialPropertyValue{ random.GetRandom() % 2 == 0 });
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "roughness.factor" }), MaterialPropertyValue{ random.GetRandomFloat() });
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "opacity.mode" }), MaterialPropertyValue{ aznumeric_cast<uint32_t>(random.GetRandom() % 4) });
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "emissive.enable" }), MaterialPropertyValue{ random.GetRandom() % 2 == 0 });
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "emissive.intensity" }), MaterialPropertyValue{ random.GetRandomFloat() });
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "clearCoat.enable" }), MaterialPropertyValue{ random.GetRandom() % 2 == 0 });
+                material.m_properties.SetPropertyValue(layout->FindPropertyIndex(Name{ "clearCoat.factor" }), MaterialPropertyValue{ random.GetRandomFloat() });
+                material.m_generalShaderCollection = m_materialTypeAsset->GetGeneralShaderCollection();
+            }
+        }
+
+        void internalTearDown(const benchmark::State& state)
+        {
+            if (state.thread_index() != 0)
+            {
+                return;
+            }
+
+            m_materials = {};
+            m_compiledFunctors = {};
+            m_scriptFunctors = {};
+            m_materialTypeAsset = {};
+
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        void ProcessMaterials(::benchmark::State& state, const AZStd::vector<Ptr<LuaMaterialFunctor>>& functors)
+        {
+            const size_t firstMaterial = aznumeric_cast<size_t>(state.thread_index()) * MaterialsPerThread;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t materialIndex = firstMaterial; materialIndex < firstMaterial + MaterialsPerThread; ++materialIndex)
+                {
+                    MaterialData& material = m_materials[materialIndex];
+                    for (const Ptr<LuaMaterialFunctor>& functor : functors)
+                    {
+                        MaterialFunctorAPI::RuntimeContext processContext(
+                            material.m_properties,
+                            &functor->GetMaterialPropertyDependencies(),
+                            MaterialPropertyPsoHandling::Allowed,
+                            nullptr,
+                            &material.m_generalShaderCollection,
+                            &material.m_materialPipelineData);
+
+                        functor->Process(processContext);
+                    }
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * MaterialsPerThread);
+        }
+
+        AZStd::unique_ptr<LuaMaterialFunctorBenchmarkEnvironment> m_environment;
+        Data::Asset<MaterialTypeAsset> m_materialTypeAsset;
+        AZStd::vector<Ptr<LuaMaterialFunctor>> m_compiledFunctors;
+        AZStd::vector<Ptr<LuaMaterialFunctor>> m_scriptFunctors;
+        AZStd::vector<MaterialData> m_materials;
+    };
+
+    // Baseline, running the scripts in the script context of each functor, which can't be shared between threads
+    BENCHMARK_DEFINE_F(LuaMaterialFunctorBenchmark, Script)(::benchmark::State& state)
+    {
+        ProcessMaterials(state, m_scriptFunctors);
+    }
+
+    // Running the programs compiled by LuaMaterialFunctorCompiler
+    BENCHMARK_DEFINE_F(LuaMaterialFunctorBenchmark, CompiledProgram)(::benchmark::State& state)
+    {
+        ProcessMaterials(state, m_compiledFunctors);
+    }
+
+    BENCHMARK_REGISTER_F(LuaMaterialFunctorBenchmark, Script);
+
+    BENCHMARK_REGISTER_F(LuaMaterialFunctorBenchmark, CompiledProgram)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+}
+
+#endif
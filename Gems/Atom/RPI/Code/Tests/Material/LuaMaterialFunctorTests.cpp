@@ -7,18 +7,26 @@
  */
 
 #include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
 #include <Common/RPITestFixture.h>
 #include <Common/JsonTestUtils.h>
 #include <Common/ErrorMessageFinder.h>
 #include <Common/ShaderAssetTestUtils.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/Script/ScriptAsset.h>
+#include <AzCore/Utils/Utils.h>
+#include <Atom/RPI.Edit/Material/LuaMaterialFunctorCompiler.h>
 #include <Atom/RPI.Edit/Material/LuaMaterialFunctorSourceData.h>
 #include <Atom/RPI.Reflect/Material/LuaMaterialFunctor.h>
 #include <Atom/RPI.Reflect/Material/MaterialTypeAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialTypeAssetCreator.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
+#include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
 #include <Material/MaterialAssetTestUtils.h>
 
 namespace UnitTest
@@ -26,11 +34,27 @@ namespace UnitTest
     using namespace AZ;
     using namespace RPI;
 
+    //! A material type script of the Atom/Feature/Common gem, with the material properties and shader options it uses.
+    //! The material types of the gem give their scripts a name context, the test material types name the properties the way
+    //! the scripts do instead.
+    struct GemMaterialTypeScript
+    {
+        const char* m_path; //!< Relative to the Materials folder of the gem
+        AZStd::vector<AZStd::pair<const char*, MaterialPropertyDataType>> m_properties;
+        AZStd::vector<const char*> m_shaderOptions; //!< Boolean shader options owned by the script
+    };
+
     class LuaMaterialFunctorTests
         : public RPITestFixture
     {
     public:
-        static void AddLuaFunctor(MaterialTypeAssetCreator& materialTypeCreator, const AZStd::string& script, Name materialPipelineName = MaterialPipelineNone)
+        //! Functors run their scripts unless @useCompiledProgram is true, even when the script can be compiled. The tests of
+        //! LuaMaterialFunctorProgram enable it, the differential test of the gem scripts compares both.
+        static void AddLuaFunctor(
+            MaterialTypeAssetCreator& materialTypeCreator,
+            const AZStd::string& script,
+            Name materialPipelineName = MaterialPipelineNone,
+            bool useCompiledProgram = false)
         {
             // See also MaterialTypeSourceData::AddFunctors
 
@@ -51,6 +75,11 @@ namespace UnitTest
 
             if (result.IsSuccess())
             {
+                if (!useCompiledProgram)
+                {
+                    azrtti_cast<LuaMaterialFunctor*>(result.GetValue().get())->m_compiledProgram = {};
+                }
+
                 materialTypeCreator.AddMaterialFunctor(result.GetValue(), materialPipelineName);
 
                 for (auto& shaderOption : functorSourceData.GetShaderOptionDependencies())
@@ -60,6 +89,141 @@ namespace UnitTest
             }
         }
 
+        // Returns the program compiled for the first functor of the material type, which is invalid if its script could not be compiled
+        static const LuaMaterialFunctorProgram& GetCompiledProgram(
+            const Data::Asset<MaterialTypeAsset>& materialTypeAsset, Name materialPipelineName = MaterialPipelineNone)
+        {
+            const MaterialFunctorList& functors = (materialPipelineName == MaterialPipelineNone)
+                ? materialTypeAsset->GetMaterialFunctors()
+                : materialTypeAsset->GetMaterialPipelinePayloads().at(materialPipelineName).m_materialFunctors;
+            return azrtti_cast<const LuaMaterialFunctor*>(functors[0].get())->m_compiledProgram;
+        }
+
+        static constexpr const char* GemMaterialPipeline = "TestPipeline";
+        static constexpr const char* GemMaterialShader = "TestShader";
+        // The internal properties and shader tags of the material pipeline that runs ShaderEnable.lua.
+        // There are no "main" and "forward_customZ" shaders, so the script also takes the paths for missing shaders.
+        static constexpr const char* ShaderEnableProperties[] = {
+            "isTransparent", "isTintedTransparent", "castShadows", "hasPerPixelDepth", "hasPerPixelClip" };
+        static constexpr const char* ShaderEnableShaderTags[] = {
+            "depth", "depth_customZ", "shadow", "shadow_customZ", "forward", "main_customZ",
+            "transparent", "tintedTransparent", "depthPassTransparentMin", "depthPassTransparentMax" };
+
+        static AZStd::string ReadGemMaterialScript(const char* path)
+        {
+            const AZ::IO::Path scriptPath = AZ::IO::Path{ AZ::Test::GetEngineRootPath() } / "Gems/Atom/Feature/Common/Assets/Materials" / path;
+            auto script = AZ::Utils::ReadFile<AZStd::string>(scriptPath.Native());
+            EXPECT_TRUE(script.IsSuccess()) << script.GetError().c_str();
+            return script.IsSuccess() ? script.TakeValue() : AZStd::string{};
+        }
+
+        //! Creates a material type that runs @script, and ShaderEnable.lua of the gem in a material pipeline. The internal
+        //! material properties set by the script are checked through the shaders ShaderEnable.lua enables.
+        static Data::Asset<MaterialTypeAsset> CreateGemMaterialType(const GemMaterialTypeScript& script, bool useCompiledPrograms)
+        {
+            AZ::RPI::Ptr<AZ::RPI::ShaderOptionGroupLayout> shaderOptions;
+            if (!script.m_shaderOptions.empty())
+            {
+                shaderOptions = RPI::ShaderOptionGroupLayout::Create();
+                uint32_t optionIndex = 0;
+                for (const char* shaderOption : script.m_shaderOptions)
+                {
+                    shaderOptions->AddShaderOption(ShaderOptionDescriptor{
+                        Name{shaderOption}, ShaderOptionType::Boolean, optionIndex, optionIndex, CreateBoolShaderOptionValues(), Name{"False"}});
+                    ++optionIndex;
+                }
+                shaderOptions->Finalize();
+            }
+
+            const Name materialPipelineName{GemMaterialPipeline};
+
+            MaterialTypeAssetCreator materialTypeCreator;
+            materialTypeCreator.Begin(Uuid::CreateRandom());
+            materialTypeCreator.AddShader(
+                CreateTestShaderAsset(Uuid::CreateRandom(), {}, shaderOptions), AZ::RPI::ShaderVariantId{}, Name{GemMaterialShader});
+            for (const char* shaderTag : ShaderEnableShaderTags)
+            {
+                materialTypeCreator.AddShader(
+                    CreateTestShaderAsset(Uuid::CreateRandom()), AZ::RPI::ShaderVariantId{}, Name{shaderTag}, materialPipelineName);
+            }
+            for (const char* propertyName : ShaderEnableProperties)
+            {
+                materialTypeCreator.BeginMaterialProperty(Name{propertyName}, MaterialPropertyDataType::Bool, materialPipelineName);
+                materialTypeCreator.EndMaterialProperty();
+            }
+
+            for (const auto& [propertyName, dataType] : script.m_properties)
+            {
+                materialTypeCreator.BeginMaterialProperty(Name{propertyName}, dataType);
+                if (dataType == MaterialPropertyDataType::Enum)
+                {
+                    materialTypeCreator.SetMaterialPropertyEnumNames({"Value0", "Value1", "Value2", "Value3"});
+                }
+                materialTypeCreator.EndMaterialProperty();
+            }
+
+            // None of the scripts sets castShadows, so it is a material property like in the material types of the gem
+            materialTypeCreator.BeginMaterialProperty(Name{"castShadows"}, MaterialPropertyDataType::Bool);
+            materialTypeCreator.ConnectMaterialPropertyToInternalProperty(Name{"castShadows"});
+            materialTypeCreator.EndMaterialProperty();
+
+            AddLuaFunctor(materialTypeCreator, ReadGemMaterialScript(script.m_path), MaterialPipelineNone, useCompiledPrograms);
+            AddLuaFunctor(materialTypeCreator, ReadGemMaterialScript("Pipelines/Common/ShaderEnable.lua"), materialPipelineName, useCompiledPrograms);
+
+            Data::Asset<MaterialTypeAsset> materialTypeAsset;
+            EXPECT_TRUE(materialTypeCreator.End(materialTypeAsset));
+            return materialTypeAsset;
+        }
+
+        //! Returns the values of the shader options owned by @script, and whether each shader of the material pipeline is enabled
+        static AZStd::vector<uint32_t> GetGemMaterialResults(const Material& material, const GemMaterialTypeScript& script)
+        {
+            AZStd::vector<uint32_t> results;
+
+            const ShaderOptionGroup* shaderOptions = material.GetGeneralShaderCollection()[Name{GemMaterialShader}].GetShaderOptions();
+            for (const char* shaderOption : script.m_shaderOptions)
+            {
+                results.push_back(shaderOptions->GetValue(Name{shaderOption}).GetIndex());
+            }
+
+            for (const ShaderCollection::Item& shaderItem : material.GetShaderCollection(Name{GemMaterialPipeline}))
+            {
+                results.push_back(shaderItem.IsEnabled() ? 1 : 0);
+            }
+
+            return results;
+        }
+
+        //! Copies @program with the serialize context, which runs the same event handlers as loading it from an asset
+        LuaMaterialFunctorProgram LoadProgram(const LuaMaterialFunctorProgram& program)
+        {
+            LuaMaterialFunctorProgram* loadedProgram = GetSerializeContext()->CloneObject(&program);
+            LuaMaterialFunctorProgram result = *loadedProgram;
+            delete loadedProgram;
+            return result;
+        }
+
+        Data::Instance<Image> CreateTestImage() const
+        {
+            Data::Asset<ImageMipChainAsset> mipChainAsset;
+            ImageMipChainAssetCreator mipChainCreator;
+            mipChainCreator.Begin(Uuid::CreateRandom(), 1, 1);
+            mipChainCreator.BeginMip(RHI::GetImageSubresourceLayout(RHI::Size{ 1,1,1 }, RHI::Format::R8_UNORM));
+            uint8_t pixel = 0;
+            mipChainCreator.AddSubImage(&pixel, 1);
+            mipChainCreator.EndMip();
+            mipChainCreator.End(mipChainAsset);
+
+            Data::Asset<StreamingImageAsset> imageAsset;
+            StreamingImageAssetCreator imageCreator;
+            imageCreator.Begin(Uuid::CreateRandom());
+            imageCreator.AddMipChainAsset(*mipChainAsset.Get());
+            imageCreator.SetFlags(StreamingImageFlags::NotStreamable);
+            imageCreator.SetPoolAssetId(ImageSystemInterface::Get()->GetSystemStreamingPool()->GetAssetId());
+            imageCreator.End(imageAsset);
+
+            return StreamingImage::FindOrCreate(imageAsset);
+        }
 
     protected:
         void SetUp() override
@@ -91,6 +255,9 @@ namespace UnitTest
     class TestMaterialData
     {
     public:
+        // The functors of the next Setup run their compiled programs, when their scripts can be compiled
+        void UseCompiledPrograms() { m_useCompiledPrograms = true; }
+
         // Setup for a single material property and nothing else, used in particular to test setting render states
         void Setup(
             MaterialPropertyDataType dataType,
@@ -102,7 +269,7 @@ namespace UnitTest
             materialTypeCreator.AddShader(CreateTestShaderAsset(Uuid::CreateRandom()), AZ::RPI::ShaderVariantId{}, Name{"TestShader"});
             materialTypeCreator.BeginMaterialProperty(Name{materialPropertyName}, dataType);
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript, MaterialPipelineNone, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -128,7 +295,7 @@ namespace UnitTest
             materialTypeCreator.AddShader(CreateTestShaderAsset(Uuid::CreateRandom(), materialSrgLayout));
             materialTypeCreator.BeginMaterialProperty(Name{materialPropertyName}, dataType);
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript, MaterialPipelineNone, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -155,7 +322,7 @@ namespace UnitTest
             materialTypeCreator.AddShader(CreateTestShaderAsset(Uuid::CreateRandom(), {}, shaderOptionsLayout), AZ::RPI::ShaderVariantId{}, Name{"TestShader"});
             materialTypeCreator.BeginMaterialProperty(Name{materialPropertyName}, dataType);
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript, MaterialPipelineNone, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -184,7 +351,7 @@ namespace UnitTest
             materialTypeCreator.EndMaterialProperty();
             materialTypeCreator.BeginMaterialProperty(Name{secondaryPropertyName}, secondaryPropertyDataType);
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript, MaterialPipelineNone, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -215,7 +382,7 @@ namespace UnitTest
             materialTypeCreator.BeginMaterialProperty(Name{materialPropertyName}, dataType);
             materialTypeCreator.ConnectMaterialPropertyToInternalProperty(Name{pipelineMaterialPropertyName});
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScriptForMaterialPipeline, materialPipelineName);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScriptForMaterialPipeline, materialPipelineName, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -247,7 +414,7 @@ namespace UnitTest
             materialTypeCreator.BeginMaterialProperty(Name{materialPropertyName}, dataType);
             materialTypeCreator.ConnectMaterialPropertyToInternalProperty(Name{pipelineMaterialPropertyName});
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScriptForMaterialPipeline, materialPipelineName);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScriptForMaterialPipeline, materialPipelineName, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -280,8 +447,8 @@ namespace UnitTest
             materialTypeCreator.BeginMaterialProperty(Name{materialPropertyName}, materialPropertyType);
             materialTypeCreator.ConnectMaterialPropertyToInternalProperty(Name{pipelineMaterialPropertyName});
             materialTypeCreator.EndMaterialProperty();
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript);
-            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScriptForMaterialPipeline, materialPipelineName);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScript, MaterialPipelineNone, m_useCompiledPrograms);
+            LuaMaterialFunctorTests::AddLuaFunctor(materialTypeCreator, luaFunctorScriptForMaterialPipeline, materialPipelineName, m_useCompiledPrograms);
             EXPECT_TRUE(materialTypeCreator.End(m_materialTypeAsset));
 
             Data::Asset<MaterialAsset> materialAsset;
@@ -308,6 +475,7 @@ namespace UnitTest
         MaterialPropertyIndex m_otherMaterialPropertyIndex;
         RHI::ShaderInputConstantIndex m_srgConstantIndex;
         ShaderOptionIndex m_shaderOptionIndex;
+        bool m_useCompiledPrograms = false;
     };
 
     TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_RuntimeContext_GetMaterialProperty_SetShaderConstant_Bool)
@@ -1599,4 +1767,382 @@ namespace UnitTest
         EXPECT_FALSE(testData.GetMaterial()->GetShaderCollection(Name{"TestPipeline"})[Name{"TestShader"}].IsEnabled());
     }
 
+    TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_CompiledProgram_InlinesFunctionsAndConstants)
+    {
+        using namespace AZ::RPI;
+
+        const char* functorScript =
+            R"(
+                Mode_Low = 0
+                Mode_High = 4
+
+                function GetMaterialPropertyDependencies()
+                    return {"general.TestUInt"}
+                end
+
+                function GetShaderOptionDependencies()
+                    return {"o_uint", "o_enum"}
+                end
+
+                function SetQuality(context, quality)
+                    context:SetShaderOptionValue_enum("o_enum", quality)
+                end
+
+                function Process(context)
+                    local mode = context:GetMaterialPropertyValue_uint("general.TestUInt")
+                    if mode == Mode_Low then
+                        SetQuality(context, "Quality::Low")
+                    elseif mode < Mode_High or mode > 6 then
+                        SetQuality(context, "Quality::Medium")
+                    else
+                        SetQuality(context, "Quality::High")
+                    end
+                    context:SetShaderOptionValue_uint("o_uint", mode * 2 + 1)
+                end
+            )";
+
+        AZ::RPI::Ptr<AZ::RPI::ShaderOptionGroupLayout> options = CreateCommonTestShaderOptionsLayout();
+
+        TestMaterialData testData;
+        testData.UseCompiledPrograms();
+        testData.Setup(options, MaterialPropertyDataType::UInt, "general.TestUInt", "o_uint", functorScript);
+
+        EXPECT_TRUE(GetCompiledProgram(testData.GetMaterialTypeAsset()).IsValid());
+
+        const AZStd::pair<uint32_t, uint32_t> modeToQualityIndex[] = { { 0u, 0u }, { 1u, 1u }, { 5u, 2u }, { 7u, 1u } };
+        for (const auto& [mode, qualityIndex] : modeToQualityIndex)
+        {
+            testData.GetMaterial()->SetPropertyValue(testData.GetMaterialPropertyIndex(), MaterialPropertyValue{mode});
+            EXPECT_TRUE(testData.GetMaterial()->Compile());
+            const ShaderOptionGroup* shaderOptions = testData.GetMaterial()->GetGeneralShaderCollection()[0].GetShaderOptions();
+            EXPECT_EQ(qualityIndex, shaderOptions->GetValue(Name{"o_enum"}).GetIndex());
+            EXPECT_EQ(mode * 2 + 1, shaderOptions->GetValue(Name{"o_uint"}).GetIndex());
+        }
+    }
+
+    TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_CompiledProgram_UnsupportedScriptRunsInLua)
+    {
+        using namespace AZ::RPI;
+
+        const char* functorScript =
+            R"(
+                function GetMaterialPropertyDependencies()
+                    return {"general.MyBool"}
+                end
+
+                function Process(context)
+                    local boolValue = context:GetMaterialPropertyValue_bool("general.MyBool")
+                    for i=0,context:GetShaderCount()-1 do
+                        context:GetShader(i):SetEnabled(boolValue)
+                    end
+                end
+            )";
+
+        TestMaterialData testData;
+        testData.UseCompiledPrograms();
+        testData.Setup(MaterialPropertyDataType::Bool, "general.MyBool", functorScript);
+
+        EXPECT_FALSE(GetCompiledProgram(testData.GetMaterialTypeAsset()).IsValid());
+
+        testData.GetMaterial()->SetPropertyValue(testData.GetMaterialPropertyIndex(), MaterialPropertyValue{false});
+        EXPECT_TRUE(testData.GetMaterial()->Compile());
+        EXPECT_FALSE(testData.GetMaterial()->GetGeneralShaderCollection()[Name{"TestShader"}].IsEnabled());
+
+        testData.GetMaterial()->SetPropertyValue(testData.GetMaterialPropertyIndex(), MaterialPropertyValue{true});
+        EXPECT_TRUE(testData.GetMaterial()->Compile());
+        EXPECT_TRUE(testData.GetMaterial()->GetGeneralShaderCollection()[Name{"TestShader"}].IsEnabled());
+    }
+
+    TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_CompiledProgram_PipelineScriptWithGlobals)
+    {
+        using namespace AZ::RPI;
+
+        // Follows the pattern of ShaderEnable.lua, which runs for every material of every material pipeline
+
+        const char* functorScriptForPipeline =
+            R"(
+                function GetMaterialPropertyDependencies()
+                    return {"TestPipelineProperty"}
+                end
+
+                function TrySetShaderEnabled(context, shaderTag, enabled)
+                    if(context:HasShaderWithTag(shaderTag)) then
+                        local shader = context:GetShaderByTag(shaderTag)
+                        if(shader) then
+                            shader:SetEnabled(enabled)
+                        end
+                    end
+                end
+
+                function TryGetBoolProperty(context, propertyName, defaultValue)
+                    if(context:HasMaterialProperty(propertyName)) then
+                        return context:GetMaterialPropertyValue_bool(propertyName)
+                    else
+                        return defaultValue
+                    end
+                end
+
+                function Process(context)
+                    isEnabled = TryGetBoolProperty(context, "TestPipelineProperty", false)
+                    castShadows = TryGetBoolProperty(context, "MissingProperty", true)
+                    TrySetShaderEnabled(context, "TestShader", isEnabled and castShadows)
+                    TrySetShaderEnabled(context, "MissingShader", false)
+                end
+            )";
+
+        TestMaterialData testData;
+        testData.UseCompiledPrograms();
+        testData.SetupMaterialPipeline(MaterialPropertyDataType::Bool, "general.MyBool", "TestPipelineProperty", functorScriptForPipeline);
+
+        const LuaMaterialFunctorProgram& program = GetCompiledProgram(testData.GetMaterialTypeAsset(), Name{"TestPipeline"});
+        EXPECT_TRUE(program.IsValid());
+        EXPECT_FALSE(program.UsesRuntimeContextFunctions());
+
+        testData.GetMaterial()->SetPropertyValue(testData.GetMaterialPropertyIndex(), MaterialPropertyValue{true});
+        EXPECT_TRUE(testData.GetMaterial()->Compile());
+        EXPECT_TRUE(testData.GetMaterial()->GetShaderCollection(Name{"TestPipeline"})[Name{"TestShader"}].IsEnabled());
+
+        testData.GetMaterial()->SetPropertyValue(testData.GetMaterialPropertyIndex(), MaterialPropertyValue{false});
+        EXPECT_TRUE(testData.GetMaterial()->Compile());
+        EXPECT_FALSE(testData.GetMaterial()->GetShaderCollection(Name{"TestPipeline"})[Name{"TestShader"}].IsEnabled());
+    }
+
+    TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_Compiler_ReportsUnsupportedScripts)
+    {
+        using namespace AZ::RPI;
+
+        TestMaterialData testData;
+        testData.Setup(MaterialPropertyDataType::Bool, "general.MyBool",
+            R"(
+                function GetMaterialPropertyDependencies()
+                    return {"general.MyBool"}
+                end
+
+                function Process(context)
+                end
+            )");
+
+        const MaterialPropertiesLayout* layout = testData.GetMaterialTypeAsset()->GetMaterialPropertiesLayout();
+        MaterialNameContext nameContext;
+
+        auto compile = [&](const char* process)
+        {
+            return LuaMaterialFunctorCompiler::Compile(process, layout, nullptr, nameContext);
+        };
+
+        auto expectError = [&](const char* process, const char* expectedError)
+        {
+            auto outcome = compile(process);
+            ASSERT_FALSE(outcome.IsSuccess());
+            EXPECT_TRUE(outcome.GetError().contains(expectedError)) << outcome.GetError().c_str();
+        };
+
+        EXPECT_TRUE(compile("function Process(context) local value = context:GetMaterialPropertyValue_bool('general.MyBool') end").IsSuccess());
+
+        expectError("function ProcessEditor(context) end", "no Process() function");
+        expectError("function Process(context) for i=0,1 do end end", "'for' is not supported");
+        expectError("function Process(context) Print('a' .. 'b') end", "operator '..' is not supported");
+        expectError("function Process(context) local name = GetName() end", "the function 'GetName' is not supported");
+        expectError("function Process(context) if enabled then end enabled = true end", "'enabled' is not a local");
+        expectError("function Process(context) if true then enabled = true end end", "must be assigned at the top level of Process()");
+        expectError("function Process(context) local v = context:GetMaterialPropertyValue_bool('general.MyBool') + 1 end", "may not be a number");
+        expectError("function Process(context) context:SetShaderConstant_float('m_float', 1.0) end", "layout of the material shader resource group");
+        expectError("function F(context) F(context) end function Process(context) F(context) end", "recursive function 'F'");
+    }
+    TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_CompiledProgram_LoadingValidatesInstructions)
+    {
+        using namespace AZ::RPI;
+        using OpCode = LuaMaterialFunctorProgram::OpCode;
+
+        TestMaterialData testData;
+        testData.Setup(MaterialPropertyDataType::UInt, "general.MyUInt",
+            R"(
+                function GetMaterialPropertyDependencies()
+                    return {"general.MyUInt"}
+                end
+
+                function Process(context)
+                end
+            )");
+
+        MaterialNameContext nameContext;
+        auto outcome = LuaMaterialFunctorCompiler::Compile(
+            R"(
+                function Process(context)
+                    if context:GetMaterialPropertyValue_uint("general.MyUInt") > 2 then
+                        context:SetShaderOptionValue_enum("o_enum", "Quality::High")
+                    end
+                    Print("done")
+                end
+            )",
+            testData.GetMaterialTypeAsset()->GetMaterialPropertiesLayout(), nullptr, nameContext);
+        ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError().c_str();
+
+        const LuaMaterialFunctorProgram& program = outcome.GetValue();
+        EXPECT_TRUE(program.IsValid());
+        EXPECT_TRUE(LoadProgram(program).IsValid());
+
+        // Each case changes the program the way a stale or corrupt material type asset could
+        auto expectInvalid = [&](const char* description, OpCode opCode, const AZStd::function<void(LuaMaterialFunctorProgram&, uint32_t)>& corrupt)
+        {
+            LuaMaterialFunctorProgram corruptProgram = program;
+            auto instruction = AZStd::find_if(corruptProgram.m_instructions.begin(), corruptProgram.m_instructions.end(),
+                [opCode](const LuaMaterialFunctorProgram::Instruction& instruction) { return instruction.m_opCode == static_cast<uint8_t>(opCode); });
+            ASSERT_NE(instruction, corruptProgram.m_instructions.end()) << description;
+            corrupt(corruptProgram, aznumeric_cast<uint32_t>(instruction - corruptProgram.m_instructions.begin()));
+
+            EXPECT_FALSE(corruptProgram.Validate().IsSuccess()) << description;
+            EXPECT_FALSE(corruptProgram.IsValid()) << description;
+            EXPECT_FALSE(LoadProgram(corruptProgram).IsValid()) << description;
+        };
+
+        expectInvalid("unknown opcode", OpCode::Print, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_opCode = static_cast<uint8_t>(OpCode::Return) + 1; });
+        expectInvalid("target register", OpCode::GetPropertyUInt, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_target = LuaMaterialFunctorProgram::MaxRegisterCount; });
+        expectInvalid("register a", OpCode::JumpIfFalse, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_a = 255; });
+        expectInvalid("register b", OpCode::Print, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_b = LuaMaterialFunctorProgram::MaxRegisterCount; });
+        expectInvalid("number", OpCode::LoadNumber, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_operand = aznumeric_cast<uint32_t>(p.m_numbers.size()); });
+        expectInvalid("property index", OpCode::GetPropertyUInt, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_operand = aznumeric_cast<uint32_t>(p.m_propertyIndexes.size()); });
+        expectInvalid("jump target", OpCode::JumpIfFalse, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_operand = aznumeric_cast<uint32_t>(p.m_instructions.size() + 1); });
+        expectInvalid("enum value name", OpCode::SetShaderOptionEnum, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_operand = aznumeric_cast<uint32_t>(p.m_names.size() - 1); });
+        expectInvalid("operand overflow", OpCode::SetShaderOptionEnum, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_operand = AZStd::numeric_limits<uint32_t>::max(); });
+        expectInvalid("message", OpCode::Print, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i].m_operand = aznumeric_cast<uint32_t>(p.m_messages.size()); });
+        expectInvalid("runtime context function", OpCode::Print, [](LuaMaterialFunctorProgram& p, uint32_t i)
+            { p.m_instructions[i] = LuaMaterialFunctorProgram::Instruction{ static_cast<uint8_t>(OpCode::SetInternalPropertyBool), 0, 0, 0, 0 }; });
+        expectInvalid("no instructions", OpCode::Return, [](LuaMaterialFunctorProgram& p, uint32_t)
+            { p.m_instructions.clear(); });
+    }
+
+    // Runs the material type scripts of the Atom/Feature/Common gem that can be compiled, and compares the results of their
+    // compiled programs with the results of running the scripts, for every combination of the material property values.
+    TEST_F(LuaMaterialFunctorTests, LuaMaterialFunctor_CompiledProgram_GemScriptsMatchLua)
+    {
+        using namespace AZ::RPI;
+
+        constexpr MaterialPropertyDataType Bool = MaterialPropertyDataType::Bool;
+        constexpr MaterialPropertyDataType Float = MaterialPropertyDataType::Float;
+        constexpr MaterialPropertyDataType Enum = MaterialPropertyDataType::Enum;
+        constexpr MaterialPropertyDataType Image = MaterialPropertyDataType::Image;
+
+        const GemMaterialTypeScript scripts[] = {
+            { "Types/BasePBR_VertexColorEnableFeature.lua", { { "enable", Bool } }, { "o_useVertexColor" } },
+            { "Types/EnhancedPBR_Anisotropy.lua",
+                { { "enableAnisotropy", Bool }, { "factor", Float }, { "anisotropyAngle", Float } },
+                { "o_enableAnisotropy" } },
+            { "Types/EnhancedPBR_SubsurfaceState.lua",
+                { { "enableSubsurfaceScattering", Bool }, { "influenceMap", Image }, { "useInfluenceMap", Bool },
+                  { "transmissionMode", Enum }, { "thicknessMap", Image }, { "useThicknessMap", Bool } },
+                { "o_subsurfaceScattering_useTexture", "o_transmission_useTexture" } },
+            { "Types/Skin_SpecularF0.lua",
+                { { "specularF0.enableMultiScatterCompensation", Bool } },
+                { "o_specularF0_enableMultiScatterCompensation" } },
+            { "Types/StandardMultilayerPBR_ClearCoatEnableFeature.lua",
+                { { "layer1.clearCoat.enable", Bool }, { "layer2.clearCoat.enable", Bool }, { "layer3.clearCoat.enable", Bool } },
+                { "o_clearCoat_feature_enabled" } },
+            { "Types/StandardPBR_ClearCoatEnableFeature.lua",
+                { { "enable", Bool } },
+                { "o_clearCoat_feature_enabled", "o_materialUseForwardPassIBLSpecular" } },
+            { "Types/StandardPBR_ClearCoatState.lua",
+                { { "enable", Bool }, { "influenceMap", Image }, { "useInfluenceMap", Bool }, { "roughnessMap", Image },
+                  { "useRoughnessMap", Bool }, { "normalMap", Image }, { "useNormalMap", Bool } },
+                { "o_clearCoat_enabled", "o_clearCoat_factor_useTexture", "o_clearCoat_roughness_useTexture", "o_clearCoat_normal_useTexture" } },
+            { "Types/StandardPBR_EmissiveState.lua",
+                { { "enable", Bool }, { "useTexture", Bool }, { "textureMap", Image } },
+                { "o_emissive_useTexture", "o_emissiveEnabled" } },
+            { "Types/StandardPBR_HandleOpacityMode.lua",
+                { { "mode", Enum }, { "alphaSource", Enum }, { "textureMap", Image } },
+                {} },
+            { "Types/StandardPBR_Metallic.lua", { { "textureMap", Image }, { "useTexture", Bool } }, { "o_metallic_useTexture" } },
+            { "Types/StandardPBR_ParallaxState.lua",
+                { { "textureMap", Image }, { "useTexture", Bool }, { "pdo", Bool } },
+                { "o_parallax_feature_enabled", "o_useHeightmap" } },
+            { "Types/StandardPBR_Roughness.lua", { { "textureMap", Image }, { "useTexture", Bool } }, { "o_roughness_useTexture" } },
+            { "Types/MaterialInputs/DetailMapsCommonFunctor.lua",
+                { { "enableDetailLayer", Bool }, { "blendDetailMask", Image }, { "enableDetailMaskTexture", Bool },
+                  { "enableBaseColor", Bool }, { "baseColorDetailMap", Image }, { "enableNormals", Bool }, { "normalDetailMap", Image } },
+                { "o_detail_blendMask_useTexture", "o_detail_baseColor_useTexture", "o_detail_normal_useTexture" } },
+        };
+
+        Data::Instance<AZ::RPI::Image> testImage = CreateTestImage();
+        ASSERT_TRUE(testImage);
+
+        for (const GemMaterialTypeScript& script : scripts)
+        {
+            Data::Asset<MaterialTypeAsset> scriptMaterialTypeAsset = CreateGemMaterialType(script, false);
+            Data::Asset<MaterialTypeAsset> programMaterialTypeAsset = CreateGemMaterialType(script, true);
+            ASSERT_TRUE(scriptMaterialTypeAsset && programMaterialTypeAsset) << script.m_path;
+            EXPECT_TRUE(GetCompiledProgram(programMaterialTypeAsset).IsValid()) << script.m_path;
+            EXPECT_TRUE(GetCompiledProgram(programMaterialTypeAsset, Name{GemMaterialPipeline}).IsValid()) << script.m_path;
+
+            Data::Instance<Material> materials[2];
+            for (size_t i = 0; i < 2; ++i)
+            {
+                Data::Asset<MaterialAsset> materialAsset;
+                MaterialAssetCreator materialCreator;
+                materialCreator.Begin(Uuid::CreateRandom(), i == 0 ? scriptMaterialTypeAsset : programMaterialTypeAsset);
+                EXPECT_TRUE(materialCreator.End(materialAsset));
+                materials[i] = Material::Create(materialAsset);
+            }
+
+            AZStd::vector<AZStd::pair<const char*, MaterialPropertyDataType>> properties = script.m_properties;
+            properties.emplace_back("castShadows", Bool);
+
+            // Bools and images are set or not, enums take each of their values and floats are zero or not
+            size_t combinationCount = 1;
+            for (const auto& property : properties)
+            {
+                combinationCount *= (property.second == Enum) ? 4 : 2;
+            }
+
+            for (size_t combination = 0; combination < combinationCount; ++combination)
+            {
+                size_t remainingCombination = combination;
+                for (const auto& [propertyName, dataType] : properties)
+                {
+                    const uint32_t valueCount = (dataType == Enum) ? 4 : 2;
+                    const uint32_t value = aznumeric_cast<uint32_t>(remainingCombination % valueCount);
+                    remainingCombination /= valueCount;
+
+                    MaterialPropertyValue propertyValue;
+                    switch (dataType)
+                    {
+                    case Bool:
+                        propertyValue = value != 0;
+                        break;
+                    case Float:
+                        propertyValue = value * 0.5f;
+                        break;
+                    case Enum:
+                        propertyValue = value;
+                        break;
+                    default:
+                        propertyValue = (value != 0) ? testImage : Data::Instance<AZ::RPI::Image>{};
+                        break;
+                    }
+
+                    for (const Data::Instance<Material>& material : materials)
+                    {
+                        material->SetPropertyValue(material->FindPropertyIndex(Name{propertyName}), propertyValue);
+                    }
+                }
+
+                for (const Data::Instance<Material>& material : materials)
+                {
+                    EXPECT_TRUE(material->Compile());
+                }
+
+                EXPECT_EQ(GetGemMaterialResults(*materials[0], script), GetGemMaterialResults(*materials[1], script))
+                    << script.m_path << ", combination " << combination;
+            }
+        }
+    }
 }
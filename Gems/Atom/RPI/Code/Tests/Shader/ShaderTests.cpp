@@ -19,14 +19,17 @@
 
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantLookupCache.h>
 
 #include <Common/RPITestFixture.h>
 #include <Common/ErrorMessageFinder.h>
 #include <Common/SerializeTester.h>
+#include <Common/ShaderAssetTestUtils.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Utils/TypeHash.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 
 namespace AZ
@@ -2060,5 +2063,216 @@ namespace UnitTest
              EXPECT_TRUE(rootShaderVariant.UseSpecializationConstants());
          }
     }
-}
 
+    static RPI::ShaderVariantId CreateLookupCacheTestVariantId(uint32_t index)
+    {
+        RPI::ShaderVariantId shaderVariantId;
+        shaderVariantId.m_key = RPI::ShaderVariantKey{ index };
+        shaderVariantId.m_mask = RPI::ShaderVariantKey{ 0xFFFFFFFF };
+        return shaderVariantId;
+    }
+
+    TEST_F(ShaderTests, ShaderVariantLookupCache_InsertFindReset)
+    {
+        // Enough ids to grow the table several times.
+        constexpr uint32_t VariantIdCount = 1000;
+        AZStd::vector<RPI::ShaderVariant> shaderVariants(VariantIdCount);
+
+        RPI::ShaderVariantLookupCache lookupCache;
+        EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(0)), nullptr);
+        EXPECT_FALSE(lookupCache.Contains(CreateLookupCacheTestVariantId(0)));
+
+        for (uint32_t index = 0; index < VariantIdCount; ++index)
+        {
+            lookupCache.Insert(CreateLookupCacheTestVariantId(index), &shaderVariants[index]);
+        }
+        EXPECT_EQ(lookupCache.GetEntryCount(), VariantIdCount);
+
+        for (uint32_t index = 0; index < VariantIdCount; ++index)
+        {
+            EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(index)), &shaderVariants[index]);
+        }
+
+        // Ids are compared by key and mask.
+        RPI::ShaderVariantId otherMaskVariantId = CreateLookupCacheTestVariantId(1);
+        otherMaskVariantId.m_mask = RPI::ShaderVariantKey{ 0xFF };
+        EXPECT_EQ(lookupCache.Find(otherMaskVariantId), nullptr);
+        EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(VariantIdCount)), nullptr);
+
+        // Reset keeps the ids as pending entries, and starts a new generation.
+        EXPECT_EQ(lookupCache.GetGeneration(), 0u);
+        lookupCache.Reset();
+        EXPECT_EQ(lookupCache.GetGeneration(), 1u);
+        EXPECT_EQ(lookupCache.GetEntryCount(), VariantIdCount);
+        for (uint32_t index = 0; index < VariantIdCount; ++index)
+        {
+            EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(index)), nullptr);
+            EXPECT_TRUE(lookupCache.Contains(CreateLookupCacheTestVariantId(index)));
+        }
+
+        // Only pending entries are resolved, and only with the variants the function returns.
+        uint32_t resolveCount = 0;
+        lookupCache.ResolvePending(
+            [&](const RPI::ShaderVariantId& shaderVariantId) -> const RPI::ShaderVariant*
+            {
+                ++resolveCount;
+                const uint32_t index = aznumeric_cast<uint32_t>(shaderVariantId.m_key.to_ulong());
+                return index % 2 == 0 ? &shaderVariants[index] : nullptr;
+            });
+        EXPECT_EQ(resolveCount, VariantIdCount);
+
+        resolveCount = 0;
+        lookupCache.ResolvePending(
+            [&resolveCount](const RPI::ShaderVariantId&) -> const RPI::ShaderVariant*
+            {
+                ++resolveCount;
+                return nullptr;
+            });
+        EXPECT_EQ(resolveCount, VariantIdCount / 2);
+
+        for (uint32_t index = 0; index < VariantIdCount; ++index)
+        {
+            const RPI::ShaderVariant* expectedVariant = index % 2 == 0 ? &shaderVariants[index] : nullptr;
+            EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(index)), expectedVariant);
+        }
+
+        // Inserting an existing id updates its entry.
+        lookupCache.Insert(CreateLookupCacheTestVariantId(1), &shaderVariants[1]);
+        EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(1)), &shaderVariants[1]);
+        EXPECT_EQ(lookupCache.GetEntryCount(), VariantIdCount);
+    }
+
+    TEST_F(ShaderTests, ShaderVariantLookupCache_FindWhileInserting)
+    {
+        constexpr uint32_t VariantIdCount = 4096;
+        constexpr uint32_t ReaderCount = 4;
+        AZStd::vector<RPI::ShaderVariant> shaderVariants(VariantIdCount);
+
+        RPI::ShaderVariantLookupCache lookupCache;
+        AZStd::atomic_bool isWriterDone{ false };
+        AZStd::atomic<uint32_t> mismatchCount{ 0 };
+
+        AZStd::vector<AZStd::thread> readers;
+        for (uint32_t readerIndex = 0; readerIndex < ReaderCount; ++readerIndex)
+        {
+            readers.emplace_back(
+                [&]()
+                {
+                    do
+                    {
+                        for (uint32_t index = 0; index < VariantIdCount; ++index)
+                        {
+                            // A lookup either misses or returns the variant inserted for the id, even while the table grows.
+                            const RPI::ShaderVariant* shaderVariant = lookupCache.Find(CreateLookupCacheTestVariantId(index));
+                            if (shaderVariant && shaderVariant != &shaderVariants[index])
+                            {
+                                ++mismatchCount;
+                            }
+                        }
+                    } while (!isWriterDone);
+                });
+        }
+
+        for (uint32_t index = 0; index < VariantIdCount; ++index)
+        {
+            lookupCache.Insert(CreateLookupCacheTestVariantId(index), &shaderVariants[index]);
+        }
+        isWriterDone = true;
+
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        EXPECT_EQ(mismatchCount, 0u);
+        for (uint32_t index = 0; index < VariantIdCount; ++index)
+        {
+            EXPECT_EQ(lookupCache.Find(CreateLookupCacheTestVariantId(index)), &shaderVariants[index]);
+        }
+    }
+
+    TEST_F(ShaderTests, Shader_GetVariant_PendingVariantIsResolvedWhenReady)
+    {
+        TestShaderVariantFinder variantFinder;
+
+        Data::Asset<RPI::ShaderAsset> shaderAsset = CreateShaderAsset();
+        variantFinder.SetShaderVariantTreeAsset(CreateShaderVariantTreeAssetForSearch(shaderAsset));
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(shaderAsset);
+
+        // [Fuchsia] is stable id 1 in the tree, its variant isn't loaded yet.
+        const RPI::ShaderVariantId shaderVariantId = CreateShaderOptionGroup({ Name("Fuchsia") }).GetShaderVariantId();
+        EXPECT_TRUE(shader->GetVariant(shaderVariantId).IsRootVariant());
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 1u);
+
+        // Pending ids keep asking the variant finder until the variant is ready.
+        EXPECT_TRUE(shader->GetVariant(shaderVariantId).IsRootVariant());
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 2u);
+
+        Data::Asset<RPI::ShaderVariantAsset> shaderVariantAsset =
+            CreateTestShaderVariantAsset(shaderVariantId, RPI::ShaderVariantStableId{ 1 }, false);
+        variantFinder.AddShaderVariantAsset(shaderVariantAsset);
+        RPI::ShaderVariantFinderNotificationBus::Event(
+            shaderAsset.GetId(), &RPI::ShaderVariantFinderNotification::OnShaderVariantAssetReady, shaderVariantAsset, false);
+
+        // The notification resolved the pending id, so the variant is returned without asking the variant finder.
+        const RPI::ShaderVariant& shaderVariant = shader->GetVariant(shaderVariantId);
+        EXPECT_EQ(shaderVariant.GetStableId(), RPI::ShaderVariantStableId{ 1 });
+        EXPECT_EQ(&shader->GetVariant(shaderVariantId), &shaderVariant);
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 2u);
+    }
+
+    TEST_F(ShaderTests, Shader_GetVariant_TreeReloadResetsCachedVariants)
+    {
+        TestShaderVariantFinder variantFinder;
+
+        Data::Asset<RPI::ShaderAsset> shaderAsset = CreateShaderAsset();
+        const RPI::ShaderVariantId shaderVariantId = CreateShaderOptionGroup({ Name("Fuchsia") }).GetShaderVariantId();
+        variantFinder.SetShaderVariantTreeAsset(CreateShaderVariantTreeAssetForSearch(shaderAsset));
+        variantFinder.AddShaderVariantAsset(CreateTestShaderVariantAsset(shaderVariantId, RPI::ShaderVariantStableId{ 1 }, false));
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(shaderAsset);
+
+        EXPECT_EQ(shader->GetVariant(shaderVariantId).GetStableId(), RPI::ShaderVariantStableId{ 1 });
+        EXPECT_EQ(shader->GetVariant(shaderVariantId).GetStableId(), RPI::ShaderVariantStableId{ 1 });
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 1u);
+
+        // The new tree only has the root variant, so the cached variant must not be returned anymore.
+        Data::Asset<RPI::ShaderVariantTreeAsset> reloadedTreeAsset = CreateEmptyShaderVariantTreeAsset(shaderAsset);
+        variantFinder.SetShaderVariantTreeAsset(reloadedTreeAsset);
+        RPI::ShaderVariantFinderNotificationBus::Event(
+            shaderAsset.GetId(), &RPI::ShaderVariantFinderNotification::OnShaderVariantTreeAssetReady, reloadedTreeAsset, false);
+
+        EXPECT_TRUE(shader->GetVariant(shaderVariantId).IsRootVariant());
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 2u);
+        EXPECT_TRUE(shader->GetVariant(shaderVariantId).IsRootVariant());
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 2u);
+    }
+
+    TEST_F(ShaderTests, Shader_GetVariant_TreeReloadDuringLookupIsNotCached)
+    {
+        TestShaderVariantFinder variantFinder;
+
+        Data::Asset<RPI::ShaderAsset> shaderAsset = CreateShaderAsset();
+        const RPI::ShaderVariantId shaderVariantId = CreateShaderOptionGroup({ Name("Fuchsia") }).GetShaderVariantId();
+        variantFinder.SetShaderVariantTreeAsset(CreateEmptyShaderVariantTreeAsset(shaderAsset));
+        variantFinder.AddShaderVariantAsset(CreateTestShaderVariantAsset(shaderVariantId, RPI::ShaderVariantStableId{ 1 }, false));
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(shaderAsset);
+
+        // The tree is reloaded after the variant finder resolved the id with the old tree, but before the shader caches the result.
+        Data::Asset<RPI::ShaderVariantTreeAsset> reloadedTreeAsset = CreateShaderVariantTreeAssetForSearch(shaderAsset);
+        variantFinder.SetVariantIdLookupCallback(
+            [&]()
+            {
+                variantFinder.SetShaderVariantTreeAsset(reloadedTreeAsset);
+                RPI::ShaderVariantFinderNotificationBus::Event(
+                    shaderAsset.GetId(), &RPI::ShaderVariantFinderNotification::OnShaderVariantTreeAssetReady, reloadedTreeAsset, false);
+            });
+
+        // The lookup that raced with the reload returns the root variant from the old tree, but doesn't cache it.
+        EXPECT_TRUE(shader->GetVariant(shaderVariantId).IsRootVariant());
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 1u);
+
+        EXPECT_EQ(shader->GetVariant(shaderVariantId).GetStableId(), RPI::ShaderVariantStableId{ 1 });
+        EXPECT_EQ(shader->GetVariant(shaderVariantId).GetStableId(), RPI::ShaderVariantStableId{ 1 });
+        EXPECT_EQ(variantFinder.GetVariantIdLookupCount(), 2u);
+    }
+}
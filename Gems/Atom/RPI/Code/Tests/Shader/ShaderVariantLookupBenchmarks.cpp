@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <Atom/RPI.Edit/Shader/ShaderVariantTreeAssetCreator.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+#include <Common/RPITestFixture.h>
+#include <Common/ShaderAssetTestUtils.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    //! Brings up the RPI the same way the unit tests do, so a benchmark fixture can own it
+    class ShaderVariantLookupBenchmarkEnvironment : public RPITestFixture
+    {
+    public:
+        using RPITestFixture::SetUp;
+        using RPITestFixture::TearDown;
+
+    private:
+        void TestBody() override
+        {
+        }
+    };
+
+    /*
+     * Resolves ShaderVariantIds with RPI::Shader from several threads at once, the way draw packets are built in parallel.
+     * The shader has one integer option, and the variant tree has a variant for each of its values. Each thread walks the
+     * ids from its own offset. Every variant is loaded and was requested once before the benchmark loop, so the benchmarks
+     * measure only the cost of the lookup and the contention between the threads.
+     * The variant finder is a TestShaderVariantFinder, which guards its lookups with a mutex like the ShaderVariantAsyncLoader.
+     */
+    class ShaderVariantLookupBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr uint32_t VariantIdCount = 256;
+        static constexpr uint32_t LookupsPerIteration = 64;
+
+        template<typename LookupFunction>
+        void RunLookups(::benchmark::State& state, LookupFunction&& lookupFunction)
+        {
+            if (state.thread_index() == 0)
+            {
+                CreateShader();
+            }
+
+            // Setup by the first thread is visible to every thread once the benchmark loop starts
+            uint32_t variantIndex = aznumeric_cast<uint32_t>((state.thread_index() * VariantIdCount) / state.threads());
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (uint32_t i = 0; i < LookupsPerIteration; ++i)
+                {
+                    const RPI::ShaderVariant& shaderVariant = lookupFunction(m_shaderVariantIds[variantIndex]);
+                    benchmark::DoNotOptimize(&shaderVariant);
+                    variantIndex = (variantIndex + 1) % VariantIdCount;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * LookupsPerIteration);
+
+            if (state.thread_index() == 0)
+            {
+                DestroyShader();
+            }
+        }
+
+    protected:
+        void CreateShader()
+        {
+            m_environment = AZStd::make_unique<ShaderVariantLookupBenchmarkEnvironment>();
+            m_environment->SetUp();
+            m_variantFinder = AZStd::make_unique<TestShaderVariantFinder>();
+
+            const Name optionName{ "o_index" };
+            AZStd::vector<RPI::ShaderOptionValuePair> optionRange;
+            optionRange.push_back({ Name{ "0" }, RPI::ShaderOptionValue{ 0 } });
+            optionRange.push_back({ Name{ AZStd::to_string(VariantIdCount - 1) }, RPI::ShaderOptionValue{ VariantIdCount - 1 } });
+            RPI::Ptr<RPI::ShaderOptionGroupLayout> shaderOptionGroupLayout = RPI::ShaderOptionGroupLayout::Create();
+            shaderOptionGroupLayout->AddShaderOption(
+                RPI::ShaderOptionDescriptor{ optionName, RPI::ShaderOptionType::IntegerRange, 0, 0, optionRange, Name{ "0" } });
+            shaderOptionGroupLayout->Finalize();
+
+            Data::Asset<RPI::ShaderAsset> shaderAsset = CreateTestShaderAsset(Uuid::CreateRandom(), nullptr, shaderOptionGroupLayout);
+
+            // Stable id 0 is the root variant, so the variant of each option value gets the value plus one.
+            AZStd::vector<RPI::ShaderVariantListSourceData::VariantInfo> variantInfos;
+            for (uint32_t index = 0; index < VariantIdCount; ++index)
+            {
+                RPI::ShaderOptionGroup shaderOptionGroup(shaderOptionGroupLayout);
+                shaderOptionGroup.SetValue(optionName, RPI::ShaderOptionValue{ index });
+                m_shaderVariantIds.push_back(shaderOptionGroup.GetShaderVariantId());
+
+                RPI::ShaderOptionValuesSourceData options;
+                options[optionName] = Name{ AZStd::to_string(index) };
+                variantInfos.push_back(RPI::ShaderVariantListSourceData::VariantInfo{ index + 1, options });
+
+                m_variantFinder->AddShaderVariantAsset(
+                    CreateTestShaderVariantAsset(m_shaderVariantIds.back(), RPI::ShaderVariantStableId{ index + 1 }));
+            }
+
+            RPI::ShaderVariantTreeAssetCreator shaderVariantTreeAssetCreator;
+            shaderVariantTreeAssetCreator.Begin(Uuid::CreateRandom());
+            shaderVariantTreeAssetCreator.SetShaderOptionGroupLayout(*shaderOptionGroupLayout);
+            shaderVariantTreeAssetCreator.SetVariantInfos(variantInfos);
+            Data::Asset<RPI::ShaderVariantTreeAsset> shaderVariantTreeAsset;
+            shaderVariantTreeAssetCreator.End(shaderVariantTreeAsset);
+            m_variantFinder->SetShaderVariantTreeAsset(shaderVariantTreeAsset);
+
+            m_shader = RPI::Shader::FindOrCreate(shaderAsset);
+            for (const RPI::ShaderVariantId& shaderVariantId : m_shaderVariantIds)
+            {
+                m_shader->GetVariant(shaderVariantId);
+            }
+        }
+
+        void DestroyShader()
+        {
+            m_shader = nullptr;
+            m_shaderVariantIds = {};
+            m_variantFinder.reset();
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        AZStd::unique_ptr<ShaderVariantLookupBenchmarkEnvironment> m_environment;
+        AZStd::unique_ptr<TestShaderVariantFinder> m_variantFinder;
+        Data::Instance<RPI::Shader> m_shader;
+        AZStd::vector<RPI::ShaderVariantId> m_shaderVariantIds;
+    };
+
+    // Baseline, Shader::GetVariant(ShaderVariantId) before the lookup cache: the variant finder resolves the id to a variant
+    // asset, then the variant is found by its stable id under m_variantCacheMutex.
+    BENCHMARK_DEFINE_F(ShaderVariantLookupBenchmark, VariantFinderLookup)(::benchmark::State& state)
+    {
+        RunLookups(
+            state,
+            [this](const RPI::ShaderVariantId& shaderVariantId) -> const RPI::ShaderVariant&
+            {
+                Data::Asset<RPI::ShaderVariantAsset> shaderVariantAsset =
+                    m_shader->GetAsset()->GetVariantAsset(shaderVariantId, m_shader->GetSupervariantIndex());
+                if (!shaderVariantAsset || shaderVariantAsset->IsRootVariant())
+                {
+                    return m_shader->GetRootVariant();
+                }
+                return m_shader->GetVariant(shaderVariantAsset->GetStableId());
+            });
+    }
+
+    // Shader::GetVariant(ShaderVariantId), which returns resolved ids from its lookup cache
+    BENCHMARK_DEFINE_F(ShaderVariantLookupBenchmark, ShaderGetVariant)(::benchmark::State& state)
+    {
+        RunLookups(
+            state,
+            [this](const RPI::ShaderVariantId& shaderVariantId) -> const RPI::ShaderVariant&
+            {
+                return m_shader->GetVariant(shaderVariantId);
+            });
+    }
+
+    BENCHMARK_REGISTER_F(ShaderVariantLookupBenchmark, VariantFinderLookup)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_REGISTER_F(ShaderVariantLookupBenchmark, ShaderGetVariant)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+}
+
+#endif
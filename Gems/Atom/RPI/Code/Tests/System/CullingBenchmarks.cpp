@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Scene/SceneSystemComponent.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace RPI;
+
+    //! Brings up the RPI the same way the unit tests do, so a benchmark fixture can own it
+    class CullingBenchmarkEnvironment : public RPITestFixture
+    {
+    public:
+        using RPITestFixture::SetUp;
+        using RPITestFixture::TearDown;
+
+    private:
+        void TestBody() override
+        {
+        }
+    };
+
+    /*
+     * Culls a scene of randomly placed cullables against four perspective views looking along the horizontal axes,
+     * which see roughly a quarter of the scene each. Every cullable has two lods split by screen coverage.
+     * The argument is the number of cullables in the scene.
+     */
+    class CullingBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<size_t>(state.range(0)));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        void internalSetUp(size_t cullableCount)
+        {
+            m_environment = AZStd::make_unique<CullingBenchmarkEnvironment>();
+            m_environment->SetUp();
+
+            m_executor = aznew TaskExecutor{};
+            TaskExecutor::SetInstance(m_executor);
+
+            m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+            m_sceneSystemComponent = new AzFramework::SceneSystemComponent;
+            m_scene = Scene::CreateScene(SceneDescriptor{});
+            m_cullingScene = m_scene->GetCullingScene();
+            m_cullingScene->Activate(m_scene.get());
+
+            CreateViews();
+            CreateCullables(cullableCount);
+        }
+
+        void internalTearDown()
+        {
+            for (AZStd::unique_ptr<Cullable>& cullable : m_cullables)
+            {
+                m_cullingScene->UnregisterCullable(*cullable);
+            }
+            m_cullables = {};
+            m_views = {};
+            m_cullingScene->Deactivate();
+            m_scene = nullptr;
+            delete m_octreeSystemComponent;
+            delete m_sceneSystemComponent;
+
+            if (&TaskExecutor::Instance() == m_executor)
+            {
+                TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        void CreateViews()
+        {
+            RHI::DrawListMask drawListMask;
+            drawListMask.reset();
+            drawListMask.flip();
+
+            Matrix4x4 viewToClip = Matrix4x4::CreateIdentity();
+            MakePerspectiveFovMatrixRH(viewToClip, DegToRad(90.0f), 1.0f, 0.1f, 1000.0f, true);
+
+            for (uint32_t viewIndex = 0; viewIndex < 4; ++viewIndex)
+            {
+                ViewPtr view = View::CreateView(Name(AZStd::string::format("CullingBenchmarkView%u", viewIndex)), View::UsageCamera);
+                view->SetDrawListMask(drawListMask);
+                view->SetCameraTransform(Matrix3x4::CreateRotationZ(DegToRad(90.0f * viewIndex)));
+                view->SetViewToClipMatrix(viewToClip);
+                m_views.push_back(view);
+            }
+        }
+
+        void CreateCullables(size_t cullableCount)
+        {
+            AZ::SimpleLcgRandom random(1234);
+            m_cullables.reserve(cullableCount);
+            for (size_t i = 0; i < cullableCount; ++i)
+            {
+                const Vector3 center(
+                    random.GetRandomFloat() * 1000.0f - 500.0f,
+                    random.GetRandomFloat() * 1000.0f - 500.0f,
+                    random.GetRandomFloat() * 100.0f - 50.0f);
+                const Aabb aabb = Aabb::CreateCenterRadius(center, 0.5f + random.GetRandomFloat() * 4.0f);
+
+                m_cullables.push_back(AZStd::make_unique<Cullable>());
+                Cullable& cullable = *m_cullables.back();
+                cullable.m_cullData.m_boundingObb = Obb::CreateFromAabb(aabb);
+                cullable.m_cullData.m_boundingSphere = Sphere::CreateFromAabb(aabb);
+                cullable.m_cullData.m_visibilityEntry.m_boundingVolume = aabb;
+                cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList;
+                cullable.m_cullData.m_visibilityEntry.m_userData = &cullable;
+                cullable.m_cullData.m_drawListMask.reset();
+                cullable.m_cullData.m_drawListMask.flip();
+                cullable.m_lodData.m_lodSelectionRadius = 0.5f * aabb.GetExtents().GetMaxElement();
+
+                Cullable::LodData::Lod highDetailLod;
+                highDetailLod.m_screenCoverageMin = 0.05f;
+                highDetailLod.m_screenCoverageMax = 1.0f;
+                highDetailLod.m_visibleObjectUserData = reinterpret_cast<void*>(i * 2 + 1);
+                cullable.m_lodData.m_lods.push_back(highDetailLod);
+
+                Cullable::LodData::Lod lowDetailLod;
+                lowDetailLod.m_screenCoverageMin = 0.0f;
+                lowDetailLod.m_screenCoverageMax = 0.05f;
+                lowDetailLod.m_visibleObjectUserData = reinterpret_cast<void*>(i * 2 + 2);
+                cullable.m_lodData.m_lods.push_back(lowDetailLod);
+
+                m_cullingScene->RegisterOrUpdateCullable(cullable);
+            }
+        }
+
+        //! Culls every view once, the same way RPI::Scene::PrepareRender does
+        void Cull()
+        {
+            m_cullingScene->BeginCulling(*m_scene, m_views);
+
+            static const TaskDescriptor processCullablesDescriptor{ "RPI::Scene::ProcessCullables", "Graphics" };
+            TaskGraphEvent processCullablesTGEvent{ "ProcessCullables Wait" };
+            TaskGraph processCullablesTG{ "ProcessCullables" };
+            for (ViewPtr& viewPtr : m_views)
+            {
+                processCullablesTG.AddTask(
+                    processCullablesDescriptor,
+                    [this, &viewPtr, &processCullablesTGEvent]()
+                    {
+                        TaskGraph subTaskGraph{ "ProcessCullables Subgraph" };
+                        m_cullingScene->ProcessCullablesTG(*m_scene, *viewPtr, subTaskGraph, processCullablesTGEvent);
+                        if (!subTaskGraph.IsEmpty())
+                        {
+                            subTaskGraph.Detach();
+                            subTaskGraph.Submit(&processCullablesTGEvent);
+                        }
+                    });
+            }
+
+            processCullablesTG.Submit(&processCullablesTGEvent);
+            processCullablesTGEvent.Wait();
+            m_cullingScene->EndCulling(*m_scene, m_views);
+
+            for (ViewPtr& viewPtr : m_views)
+            {
+                viewPtr->FinalizeVisibleObjectList();
+            }
+        }
+
+        void RunCulling(benchmark::State& state, bool useCullableBounds)
+        {
+            m_cullingScene->GetDebugContext().m_useCullableBounds = useCullableBounds;
+            for ([[maybe_unused]] auto value : state)
+            {
+                Cull();
+            }
+            state.SetItemsProcessed(aznumeric_cast<int64_t>(state.iterations() * m_cullables.size() * m_views.size()));
+        }
+
+        AZStd::unique_ptr<CullingBenchmarkEnvironment> m_environment;
+        TaskExecutor* m_executor = nullptr;
+        AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        AzFramework::SceneSystemComponent* m_sceneSystemComponent = nullptr;
+        ScenePtr m_scene;
+        CullingScene* m_cullingScene = nullptr;
+        AZStd::vector<ViewPtr> m_views;
+        AZStd::vector<AZStd::unique_ptr<Cullable>> m_cullables;
+    };
+
+    // Baseline, cullables are gathered by traversing the visibility octree
+    BENCHMARK_DEFINE_F(CullingBenchmark, OctreeTraversal)(benchmark::State& state)
+    {
+        RunCulling(state, false);
+    }
+
+    // Cullables are tested four at a time from the bounds blocks owned by the culling scene
+    BENCHMARK_DEFINE_F(CullingBenchmark, CullableBoundsBlocks)(benchmark::State& state)
+    {
+        RunCulling(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(CullingBenchmark, OctreeTraversal)
+        ->ArgName("Cullables")
+        ->Arg(10000)->Arg(100000)->Arg(250000)
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    BENCHMARK_REGISTER_F(CullingBenchmark, CullableBoundsBlocks)
+        ->ArgName("Cullables")
+        ->Arg(10000)->Arg(100000)->Arg(250000)
+        ->Unit(benchmark::kMillisecond)
+        ;
+}
+
+#endif
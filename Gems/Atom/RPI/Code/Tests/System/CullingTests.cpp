@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Scene/SceneSystemComponent.h>
@@ -227,6 +228,23 @@ namespace UnitTest
             }
         }
 
+        using VisibleObjectsByView = AZStd::vector<AZStd::vector<AZStd::pair<const void*, float>>>;
+
+        //! Returns the visible objects of every view sorted by their user data
+        VisibleObjectsByView GetVisibleObjects()
+        {
+            VisibleObjectsByView visibleObjects(m_views.size());
+            for (size_t viewIndex = 0; viewIndex < m_views.size(); ++viewIndex)
+            {
+                for (const VisibleObjectProperties& visibleObject : m_views[viewIndex]->GetVisibleObjectList())
+                {
+                    visibleObjects[viewIndex].emplace_back(visibleObject.m_userData, visibleObject.m_depth);
+                }
+                AZStd::sort(visibleObjects[viewIndex].begin(), visibleObjects[viewIndex].end());
+            }
+            return visibleObjects;
+        }
+
         TaskExecutor* m_executor;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent;
         AzFramework::SceneSystemComponent* m_sceneSystemComponent;
@@ -255,4 +273,101 @@ namespace UnitTest
             m_cullingScene->UnregisterCullable(object);
         }
     }
+
+    TEST_F(CullingTests, CullableBounds_RegisterAndUnregister_KeepsBlocksPacked)
+    {
+        const CullableBoundsStorage& cullableBounds = m_cullingScene->GetCullableBounds();
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+        EXPECT_EQ(cullableBounds.GetCount(), m_testObjects.size());
+        EXPECT_EQ(cullableBounds.GetBlocks().size(), 3);
+
+        // Updating a cullable keeps its place
+        m_cullingScene->RegisterOrUpdateCullable(m_testObjects[3]);
+        EXPECT_EQ(m_testObjects[3].m_cullingBoundsIndex, 3);
+        EXPECT_EQ(cullableBounds.GetCount(), m_testObjects.size());
+
+        // Removing a cullable moves the last one into its place
+        m_cullingScene->UnregisterCullable(m_testObjects[2]);
+        EXPECT_EQ(m_testObjects[2].m_cullingBoundsIndex, CullableBoundsStorage::InvalidIndex);
+        EXPECT_EQ(m_testObjects[9].m_cullingBoundsIndex, 2);
+        EXPECT_EQ(cullableBounds.GetCount(), m_testObjects.size() - 1);
+        EXPECT_EQ(cullableBounds.GetBlocks().size(), 3);
+
+        uint32_t cullableCount = 0;
+        for (const CullableBoundsStorage::Block& block : cullableBounds.GetBlocks())
+        {
+            for (uint32_t lane = 0; lane < CullableBoundsStorage::BlockSize; ++lane)
+            {
+                if (const Cullable* cullable = block.m_cullables[lane])
+                {
+                    EXPECT_EQ(cullable->m_cullingBoundsIndex, cullableCount);
+                    EXPECT_EQ(block.m_centerX[lane], cullable->m_cullData.m_boundingSphere.GetCenter().GetX());
+                    EXPECT_EQ(block.m_radius[lane], cullable->m_cullData.m_boundingSphere.GetRadius());
+                    ++cullableCount;
+                }
+            }
+        }
+        EXPECT_EQ(cullableCount, cullableBounds.GetCount());
+
+        m_cullingScene->UnregisterCullable(m_testObjects[2]);
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->UnregisterCullable(object);
+        }
+        EXPECT_EQ(cullableBounds.GetCount(), 0);
+        EXPECT_TRUE(cullableBounds.GetBlocks().empty());
+    }
+
+    TEST_F(CullingTests, CullableBounds_RandomObjects_MatchOctreeTraversal)
+    {
+        // Objects around all views, with two lods split at a screen coverage that some of them cross
+        constexpr size_t objectCount = 1001;
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<AZStd::unique_ptr<Cullable>> objects;
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            const Vector3 center(random.GetRandomFloat() * 80.0f - 40.0f, random.GetRandomFloat() * 80.0f - 40.0f, random.GetRandomFloat() * 20.0f - 10.0f);
+            objects.push_back(AZStd::make_unique<Cullable>());
+            Cullable& object = *objects.back();
+            InitializeCullableFromAabb(object, Aabb::CreateCenterRadius(center, 0.1f + random.GetRandomFloat() * 3.0f), i * 2);
+
+            object.m_lodData.m_lods[0].m_screenCoverageMin = 0.1f;
+            Cullable::LodData::Lod lowDetailLod;
+            lowDetailLod.m_screenCoverageMin = 0.0f;
+            lowDetailLod.m_screenCoverageMax = 0.1f;
+            lowDetailLod.m_visibleObjectUserData = reinterpret_cast<void*>(i * 2 + 1 + visibleObjectUserDataOffset);
+            object.m_lodData.m_lods.push_back(lowDetailLod);
+
+            object.m_isHidden = (i % 17) == 0;
+            object.m_cullData.m_hideFlags = (i % 13) == 0 ? RPI::View::UsageShadow : RPI::View::UsageNone;
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        m_cullingScene->GetDebugContext().m_useCullableBounds = false;
+        Cull(m_views);
+        const VisibleObjectsByView octreeVisibleObjects = GetVisibleObjects();
+
+        m_cullingScene->GetDebugContext().m_useCullableBounds = true;
+        Cull(m_views);
+        const VisibleObjectsByView boundsVisibleObjects = GetVisibleObjects();
+
+        for (size_t viewIndex = 0; viewIndex < m_views.size(); ++viewIndex)
+        {
+            EXPECT_GT(octreeVisibleObjects[viewIndex].size(), 0);
+            ASSERT_EQ(boundsVisibleObjects[viewIndex].size(), octreeVisibleObjects[viewIndex].size());
+            for (size_t i = 0; i < boundsVisibleObjects[viewIndex].size(); ++i)
+            {
+                EXPECT_EQ(boundsVisibleObjects[viewIndex][i].first, octreeVisibleObjects[viewIndex][i].first);
+                EXPECT_NEAR(boundsVisibleObjects[viewIndex][i].second, octreeVisibleObjects[viewIndex][i].second, 0.001f);
+            }
+        }
+
+        for (AZStd::unique_ptr<Cullable>& object : objects)
+        {
+            m_cullingScene->UnregisterCullable(*object);
+        }
+    }
 }
@@ -14,6 +14,7 @@ set(FILES
     Include/Atom/RPI.Edit/Common/ConvertibleSource.h
     Include/Atom/RPI.Edit/Common/JsonReportingHelper.h
     Include/Atom/RPI.Edit/Common/JsonUtils.h
+    Include/Atom/RPI.Edit/Material/LuaMaterialFunctorCompiler.h
     Include/Atom/RPI.Edit/Material/LuaMaterialFunctorSourceData.h
     Include/Atom/RPI.Edit/Material/MaterialTypeSourceData.h
     Include/Atom/RPI.Edit/Material/MaterialConverterBus.h
@@ -38,6 +39,7 @@ set(FILES
     Include/Atom/RPI.Edit/Shader/ShaderVariantListSourceData.h
     Include/Atom/RPI.Edit/Shader/ShaderVariantAssetCreator.h
     Include/Atom/RPI.Edit/Shader/ShaderVariantTreeAssetCreator.h
+    Source/RPI.Edit/Material/LuaMaterialFunctorCompiler.cpp
     Source/RPI.Edit/Material/LuaMaterialFunctorSourceData.cpp
     Source/RPI.Edit/Material/MaterialTypeSourceData.cpp
     Source/RPI.Edit/Material/MaterialPropertyId.cpp
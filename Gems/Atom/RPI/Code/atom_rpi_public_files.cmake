@@ -95,6 +95,7 @@ set(FILES
     Include/Atom/RPI.Public/Shader/Shader.h
     Include/Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h
     Include/Atom/RPI.Public/Shader/ShaderVariant.h
+    Include/Atom/RPI.Public/Shader/ShaderVariantLookupCache.h
     Include/Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h
     Include/Atom/RPI.Public/Shader/ShaderResourceGroup.h
     Include/Atom/RPI.Public/Shader/ShaderResourceGroupPool.h
@@ -180,6 +181,7 @@ set(FILES
     Source/RPI.Public/Pass/Specific/SwapChainPass.cpp
     Source/RPI.Public/Shader/Shader.cpp
     Source/RPI.Public/Shader/ShaderVariant.cpp
+    Source/RPI.Public/Shader/ShaderVariantLookupCache.cpp
     Source/RPI.Public/Shader/ShaderReloadDebugTracker.cpp
     Source/RPI.Public/Shader/ShaderResourceGroup.cpp
     Source/RPI.Public/Shader/ShaderResourceGroupPool.cpp
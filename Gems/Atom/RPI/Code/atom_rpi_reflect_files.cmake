@@ -53,6 +53,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Image/StreamingImagePoolAsset.h
     Include/Atom/RPI.Reflect/Image/StreamingImagePoolAssetCreator.h
     Include/Atom/RPI.Reflect/Material/LuaMaterialFunctor.h
+    Include/Atom/RPI.Reflect/Material/LuaMaterialFunctorProgram.h
     Include/Atom/RPI.Reflect/Material/LuaScriptUtilities.h
     Include/Atom/RPI.Reflect/Material/MaterialAsset.h
     Include/Atom/RPI.Reflect/Material/MaterialAssetCreator.h
@@ -143,6 +144,7 @@ set(FILES
     Source/RPI.Reflect/Material/MaterialAssetCreator.cpp
     Source/RPI.Reflect/Material/MaterialNameContext.cpp
     Source/RPI.Reflect/Material/LuaMaterialFunctor.cpp
+    Source/RPI.Reflect/Material/LuaMaterialFunctorProgram.cpp
     Source/RPI.Reflect/Material/LuaScriptUtilities.cpp
     Source/RPI.Reflect/Material/MaterialDynamicMetadata.cpp
     Source/RPI.Reflect/Material/MaterialPropertyCollection.cpp
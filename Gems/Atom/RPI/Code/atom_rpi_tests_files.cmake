@@ -24,6 +24,7 @@ set(FILES
     Tests/Common/TestFeatureProcessors.h
     Tests/Image/StreamingImageTests.cpp
     Tests/Material/LuaMaterialFunctorTests.cpp
+    Tests/Material/LuaMaterialFunctorBenchmarks.cpp
     Tests/Material/MaterialVersionUpdateTests.cpp
     Tests/Material/MaterialTypeAssetTests.cpp
     Tests/Material/MaterialTypeSourceDataTests.cpp
@@ -41,10 +42,12 @@ set(FILES
     Tests/Model/SkinJointIdPaddingTests.cpp
     Tests/Pass/PassTests.cpp
     Tests/Shader/ShaderTests.cpp
+    Tests/Shader/ShaderVariantLookupBenchmarks.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupConstantBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupImageTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupGeneralTests.cpp
+    Tests/System/CullingBenchmarks.cpp
     Tests/System/CullingTests.cpp
     Tests/System/FeatureProcessorFactoryTests.cpp
     Tests/System/GpuQueryTests.cpp
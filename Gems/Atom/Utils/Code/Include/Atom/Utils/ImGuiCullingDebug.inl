@@ -42,6 +42,7 @@ namespace AZ
 
                 ImGui::Checkbox("Enable Frustum Culling", &debugCtx.m_enableFrustumCulling);
                 ImGui::Checkbox("Enable Parallel Octree Traversal",  &debugCtx.m_parallelOctreeTraversal);
+                ImGui::Checkbox("Test Cullable Bounds In Blocks", &debugCtx.m_useCullableBounds);
                 ImGui::Checkbox("Freeze Frustums", &debugCtx.m_freezeFrustums);
                 ImGui::Checkbox("Debug Draw", &debugCtx.m_debugDraw);
                 {
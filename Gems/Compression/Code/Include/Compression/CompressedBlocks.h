@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+namespace Compression
+{
+    //! Compresses the uncompressed data as a sequence of independently compressed blocks and appends them to compressedData.
+    //! Every block is padded so it starts at a multiple of compressedBlockAlignment from where the appended data starts.
+    //! The returned layout can be assigned to AZ::IO::CompressionInfo::m_blockLayout, together with a decompressor created by
+    //! CreateBlockDecompressor, which allows Streamer to only read and decompress the blocks that overlap with a request.
+    //! @param compressedData destination the compressed blocks are appended to
+    //! @param compressionInterface compressor used for every block
+    //! @param uncompressedData source data to compress
+    //! @param uncompressedBlockSize size of each block before compression, only the last block can be smaller
+    //! @param compressedBlockAlignment power of two alignment of the start of each compressed block
+    //! @return the layout of the compressed blocks, or nullptr if a block failed to compress in which case compressedData is unchanged
+    AZStd::shared_ptr<AZ::IO::CompressedBlockLayout> CompressBlocks(AZStd::vector<AZStd::byte>& compressedData,
+        const ICompressionInterface& compressionInterface, AZStd::span<const AZStd::byte> uncompressedData,
+        size_t uncompressedBlockSize, size_t compressedBlockAlignment = 1);
+
+    //! Creates a decompression callback for AZ::IO::CompressionInfo that decompresses a single block written by CompressBlocks.
+    //! When it's given the entire file instead, it decompresses every block of the file in order, so readers that don't
+    //! stream per block, such as AZ::IO::FullFileDecompressor, can still read the file.
+    //! The decompression interface is referenced by the callback, so it has to outlive any CompressionInfo that uses it.
+    AZ::IO::DecompressionFunc CreateBlockDecompressor(const IDecompressionInterface& decompressionInterface);
+} // namespace Compression
+
+#include "CompressedBlocks.inl"
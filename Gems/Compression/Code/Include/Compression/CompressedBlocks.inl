@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace Compression
+{
+    inline AZStd::shared_ptr<AZ::IO::CompressedBlockLayout> CompressBlocks(AZStd::vector<AZStd::byte>& compressedData,
+        const ICompressionInterface& compressionInterface, AZStd::span<const AZStd::byte> uncompressedData,
+        size_t uncompressedBlockSize, size_t compressedBlockAlignment)
+    {
+        AZ_Assert(uncompressedBlockSize > 0, "CompressBlocks requires a block size larger than zero.");
+        AZ_Assert(compressedBlockAlignment > 0 && (compressedBlockAlignment & (compressedBlockAlignment - 1)) == 0,
+            "CompressBlocks requires the block alignment to be a power of two, but got %zu.", compressedBlockAlignment);
+
+        auto layout = AZStd::make_shared<AZ::IO::CompressedBlockLayout>();
+        layout->m_uncompressedBlockSize = uncompressedBlockSize;
+        layout->m_compressedBlockAlignment = compressedBlockAlignment;
+        layout->m_compressedBlockSizes.reserve((uncompressedData.size() + uncompressedBlockSize - 1) / uncompressedBlockSize);
+
+        const size_t fileStart = compressedData.size();
+        for (size_t blockOffset = 0; blockOffset < uncompressedData.size(); blockOffset += uncompressedBlockSize)
+        {
+            AZStd::span<const AZStd::byte> block =
+                uncompressedData.subspan(blockOffset, AZStd::min(uncompressedBlockSize, uncompressedData.size() - blockOffset));
+            // Resizing zero fills the padding in front of the block.
+            const size_t blockStart = fileStart + AZ_SIZE_ALIGN_UP(compressedData.size() - fileStart, compressedBlockAlignment);
+            compressedData.resize(blockStart + compressionInterface.CompressBound(block.size()));
+
+            CompressionResultData result =
+                compressionInterface.CompressBlock(AZStd::span<AZStd::byte>(compressedData).subspan(blockStart), block);
+            if (!result)
+            {
+                compressedData.resize(fileStart);
+                return nullptr;
+            }
+            compressedData.resize(blockStart + result.GetCompressedByteCount());
+            layout->m_compressedBlockSizes.push_back(result.GetCompressedByteCount());
+        }
+        return layout;
+    }
+
+    inline AZ::IO::DecompressionFunc CreateBlockDecompressor(const IDecompressionInterface& decompressionInterface)
+    {
+        auto decompressBlock = [&decompressionInterface](const AZStd::byte* compressed, size_t compressedSize,
+            AZStd::byte* uncompressed, size_t uncompressedSize) -> bool
+        {
+            DecompressionResultData result = decompressionInterface.DecompressBlock(
+                AZStd::span<AZStd::byte>(uncompressed, uncompressedSize), AZStd::span<const AZStd::byte>(compressed, compressedSize));
+            // Every block has to decompress to exactly the size the layout describes, anything else means the data is corrupt.
+            return result && result.GetUncompressedByteCount() == uncompressedSize;
+        };
+
+        return [decompressBlock](const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize,
+            void* uncompressed, size_t uncompressedBufferSize) -> bool
+        {
+            const AZ::IO::CompressedBlockLayout* layout = info.m_blockLayout.get();
+            const bool isWholeFile = layout != nullptr && layout->m_compressedBlockSizes.size() > 1
+                && uncompressedBufferSize == info.m_uncompressedSize;
+            if (!isWholeFile)
+            {
+                return decompressBlock(reinterpret_cast<const AZStd::byte*>(compressed), compressedSize,
+                    reinterpret_cast<AZStd::byte*>(uncompressed), uncompressedBufferSize);
+            }
+
+            // Stack entries that don't stream per block hand over the entire file, so walk its blocks one after another.
+            const auto* compressedBlock = reinterpret_cast<const AZStd::byte*>(compressed);
+            const auto* compressedEnd = compressedBlock + compressedSize;
+            auto* uncompressedBlock = reinterpret_cast<AZStd::byte*>(uncompressed);
+            size_t remainingSize = uncompressedBufferSize;
+            for (size_t blockCompressedSize : layout->m_compressedBlockSizes)
+            {
+                const size_t blockUncompressedSize = AZStd::min(layout->m_uncompressedBlockSize, remainingSize);
+                if (blockCompressedSize > static_cast<size_t>(compressedEnd - compressedBlock) ||
+                    !decompressBlock(compressedBlock, blockCompressedSize, uncompressedBlock, blockUncompressedSize))
+                {
+                    return false;
+                }
+                uncompressedBlock += blockUncompressedSize;
+                remainingSize -= blockUncompressedSize;
+                const size_t alignedBlockSize = AZ_SIZE_ALIGN_UP(blockCompressedSize, layout->m_compressedBlockAlignment);
+                compressedBlock += AZStd::min(alignedBlockSize, static_cast<size_t>(compressedEnd - compressedBlock));
+            }
+            return remainingSize == 0;
+        };
+    }
+} // namespace Compression
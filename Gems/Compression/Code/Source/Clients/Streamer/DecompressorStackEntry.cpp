@@ -55,6 +55,11 @@ namespace Compression
         return m_compressedData != nullptr;
     }
 
+    bool DecompressorRegistrarEntry::BlockTaskInformation::IsProcessing() const
+    {
+        return m_taskGraphEvent != nullptr;
+    }
+
     DecompressorRegistrarEntry::DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment)
         : AZ::IO::StreamStackEntry("Compression Gem decompressor registrar")
         , m_maxNumReads(maxNumReads)
@@ -63,10 +68,12 @@ namespace Compression
     {
 
         m_processingJobs = AZStd::make_unique<DecompressionInformation[]>(m_maxNumTasks);
+        m_blockTasks = AZStd::make_unique<BlockTaskInformation[]>(m_maxNumTasks);
 
         m_readBuffers = AZStd::make_unique<Buffer[]>(maxNumReads);
         m_readRequests = AZStd::make_unique<AZ::IO::FileRequest*[]>(maxNumReads);
         m_readBufferStatus = AZStd::make_unique<ReadBufferStatus[]>(maxNumReads);
+        m_blockStreams = AZStd::make_unique<BlockStreamInformation[]>(maxNumReads);
         for (AZ::u32 i = 0; i < maxNumReads; ++i)
         {
             m_readBufferStatus[i] = ReadBufferStatus::Unused;
@@ -77,6 +84,27 @@ namespace Compression
         m_decompressionDurationMicroSec.PushEntry(1);
     }
 
+    DecompressorRegistrarEntry::~DecompressorRegistrarEntry()
+    {
+        // Running tasks write into buffers owned by this entry, so they have to finish before anything is released.
+        if (m_taskGraphEvent)
+        {
+            m_taskGraphEvent->Wait();
+        }
+        for (AZ::u32 i = 0; i < m_maxNumTasks; ++i)
+        {
+            BlockTaskInformation& task = m_blockTasks[i];
+            if (task.IsProcessing())
+            {
+                task.m_taskGraphEvent->Wait();
+            }
+            if (task.m_scratchBuffer != nullptr)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(task.m_scratchBuffer, task.m_scratchBufferSize, m_alignment);
+            }
+        }
+    }
+
     void DecompressorRegistrarEntry::PrepareRequest(AZ::IO::FileRequest* request)
     {
         AZ_Assert(request, "PrepareRequest was provided a null request.");
@@ -133,10 +161,14 @@ namespace Compression
     bool DecompressorRegistrarEntry::ExecuteRequests()
     {
         bool result = false;
-        // First queue jobs as this might open up new read slots.
+        // First queue jobs as this might open up new read slots. Blocks go first as their reads have already landed.
         if (m_numInFlightReads > 0 && m_numRunningTasks < m_maxNumTasks)
         {
-            result = StartDecompressions();
+            result = StartBlockDecompressions();
+            if (m_numRunningTasks < m_maxNumTasks)
+            {
+                result = StartDecompressions() || result;
+            }
         }
 
         // Queue as many new reads as possible.
@@ -246,6 +278,10 @@ namespace Compression
             case ReadBufferStatus::PendingDecompression:
                 baseTime = now;
                 break;
+            case ReadBufferStatus::StreamingBlocks:
+                // Blocks are decompressed as their reads land, so each block request gets its own estimate.
+                EstimateStreamingBlocks(i, now, decompressionDelay, totalDecompressionDuration, totalBytesDecompressed);
+                continue;
             default:
                 AZ_Assert(false, "Unsupported buffer type: %i.", m_readBufferStatus[i]);
                 continue;
@@ -304,6 +340,36 @@ namespace Compression
         }
     }
 
+    void DecompressorRegistrarEntry::EstimateStreamingBlocks(AZ::u32 readSlot, AZStd::chrono::steady_clock::time_point now,
+        AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const
+    {
+        for (const BlockDecompressionInformation& block : m_blockStreams[readSlot].m_blocks)
+        {
+            if (block.m_activeRequest == nullptr)
+            {
+                continue;
+            }
+
+            auto decompressionDuration = AZStd::chrono::microseconds(
+                static_cast<AZ::u64>((block.m_compressedSize * totalDecompressionDurationUs) / totalBytesDecompressed));
+            if (AZStd::holds_alternative<AZ::IO::Requests::WaitData>(block.m_activeRequest->GetCommand()))
+            {
+                auto timeInProcessing = now - block.m_jobStartTime;
+                auto timeLeft = decompressionDuration > timeInProcessing ? decompressionDuration - timeInProcessing : AZStd::chrono::microseconds(0);
+                block.m_activeRequest->SetEstimatedCompletion(now + timeLeft);
+            }
+            else
+            {
+                AZStd::chrono::steady_clock::time_point baseTime = block.m_activeRequest->GetEstimatedCompletion();
+                if (baseTime == AZStd::chrono::steady_clock::time_point())
+                {
+                    baseTime = now;
+                }
+                block.m_activeRequest->SetEstimatedCompletion(baseTime + decompressionDelay + decompressionDuration);
+            }
+        }
+    }
+
     void DecompressorRegistrarEntry::CollectStatistics(AZStd::vector<AZ::IO::Statistic>& statistics) const
     {
         constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
@@ -346,6 +412,19 @@ namespace Compression
                 "speed than decompressing can't keep up with file reads. Increasing the number of jobs can help hide this issue, but only "
                 "for parallel reads, while individual reads will still remain decompression bound."));
 
+            if (m_blockDecompressionLatencyMicroSec.GetNumRecorded() > 0)
+            {
+                statistics.push_back(AZ::IO::Statistic::CreateInteger(
+                    m_name, "Running block decompressions", m_numRunningBlockTasks,
+                    "The number of blocks from files with a block layout that are currently being decompressed on the task system."));
+                double averageBlockLatency = m_blockDecompressionLatencyMicroSec.CalculateAverage() * usToMs;
+                statistics.push_back(AZ::IO::Statistic::CreateFloat(
+                    m_name, "Block decompression latency (avg. ms)", averageBlockLatency,
+                    "The amount of time in milliseconds between the read of a compressed block landing and that block being fully "
+                    "decompressed. This includes the time waiting for the task system to pick up the block. If this is much higher than "
+                    "the time it takes to read a block, decompression can't keep up with the reads."));
+            }
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             statistics.push_back(AZ::IO::Statistic::CreatePercentageRange(
                 m_name, DecompBoundName, m_decompressionBoundStat.GetAverage(), m_decompressionBoundStat.GetMinimum(),
@@ -372,6 +451,18 @@ namespace Compression
             && m_numRunningTasks == 0;
     }
 
+    bool DecompressorRegistrarEntry::UsesBlockStreaming(const AZ::IO::Requests::CompressedReadData& data)
+    {
+        const AZ::IO::CompressedBlockLayout* layout = data.m_compressionInfo.m_blockLayout.get();
+        if (layout == nullptr || layout->m_uncompressedBlockSize == 0 || data.m_readSize == 0)
+        {
+            return false;
+        }
+        // Only use the layout if it actually describes the full file, otherwise fall back to decompressing the file as a whole.
+        size_t blockCount = (data.m_compressionInfo.m_uncompressedSize + layout->m_uncompressedBlockSize - 1) / layout->m_uncompressedBlockSize;
+        return layout->m_compressedBlockSizes.size() == blockCount;
+    }
+
     void DecompressorRegistrarEntry::PrepareReadRequest(AZ::IO::FileRequest* request, AZ::IO::Requests::ReadRequestData& data)
     {
         if (AZ::IO::CompressionInfo info; AZ::IO::CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
@@ -523,6 +614,12 @@ namespace Compression
                 AZ::IO::CompressionInfo& info = data->m_compressionInfo;
                 AZ_Assert(info.m_decompressor, "DecompressorRegistrarEntry is planning to a queue a request for reading but couldn't find a decompressor.");
 
+                if (UsesBlockStreaming(*data))
+                {
+                    StartBlockStreaming(compressedReadRequest, i);
+                    return;
+                }
+
                 // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
                 // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
                 // the BlockCache's prolog and epilog are read into aligned buffers.
@@ -736,6 +833,229 @@ namespace Compression
         return;
     }
 
+    void DecompressorRegistrarEntry::StartBlockStreaming(AZ::IO::FileRequest* compressedReadRequest, AZ::u32 readSlot)
+    {
+        auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedReadRequest->GetCommand());
+        AZ_Assert(data, "Compressed request that's starting block streaming in DecompressorRegistrarEntry didn't contain compression read data.");
+        AZ::IO::CompressionInfo& info = data->m_compressionInfo;
+        const AZ::IO::CompressedBlockLayout& layout = *info.m_blockLayout;
+        const size_t blockAlignment = layout.m_compressedBlockAlignment;
+
+        // Only the blocks that overlap with the requested range need to be read and decompressed.
+        const size_t firstBlock = data->m_readOffset / layout.m_uncompressedBlockSize;
+        const size_t endBlock = (data->m_readOffset + data->m_readSize + layout.m_uncompressedBlockSize - 1) / layout.m_uncompressedBlockSize;
+
+        size_t firstBlockOffset = 0;
+        for (size_t blockIndex = 0; blockIndex < firstBlock; ++blockIndex)
+        {
+            firstBlockOffset += AZ_SIZE_ALIGN_UP(layout.m_compressedBlockSizes[blockIndex], blockAlignment);
+        }
+
+        BlockStreamInformation& stream = m_blockStreams[readSlot];
+        stream.m_blocks.resize(endBlock - firstBlock);
+        size_t blockOffset = firstBlockOffset;
+        for (size_t blockIndex = firstBlock; blockIndex < endBlock; ++blockIndex)
+        {
+            BlockDecompressionInformation& block = stream.m_blocks[blockIndex - firstBlock];
+            block.m_compressedSize = layout.m_compressedBlockSizes[blockIndex];
+            block.m_uncompressedOffset = blockIndex * layout.m_uncompressedBlockSize;
+            block.m_uncompressedSize = AZStd::min(layout.m_uncompressedBlockSize, info.m_uncompressedSize - block.m_uncompressedOffset);
+            block.m_compressedOffset = blockOffset - firstBlockOffset;
+            blockOffset += AZ_SIZE_ALIGN_UP(block.m_compressedSize, blockAlignment);
+        }
+        const size_t compressedSpanSize = stream.m_blocks.back().m_compressedOffset + stream.m_blocks.back().m_compressedSize;
+
+        // Same as for full file reads, the buffer is aligned down so reads between the BlockCache's prolog and epilog land in aligned memory.
+        const size_t spanOffset = info.m_offset + firstBlockOffset;
+        const size_t offsetAdjustment = spanOffset - AZ_SIZE_ALIGN_DOWN(spanOffset, aznumeric_cast<size_t>(m_alignment));
+        stream.m_bufferSize = AZ_SIZE_ALIGN_UP((compressedSpanSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        m_readBuffers[readSlot] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+            stream.m_bufferSize, m_alignment));
+        m_memoryUsage += stream.m_bufferSize;
+
+        m_readRequests[readSlot] = compressedReadRequest;
+        m_readBufferStatus[readSlot] = ReadBufferStatus::StreamingBlocks;
+        stream.m_numPendingBlocks = aznumeric_caster(stream.m_blocks.size());
+        AZ_Assert(m_numInFlightReads < m_maxNumReads,
+            "A FileRequest was queued for block streaming in DecompressorRegistrarEntry, but there's no slots available.");
+        m_numInFlightReads++;
+
+        // Queue all block reads at once so the next nodes can schedule them back to back. Each block is decompressed as soon as its
+        // read completes instead of waiting for the entire file.
+        for (size_t blockIndex = 0; blockIndex < stream.m_blocks.size(); ++blockIndex)
+        {
+            BlockDecompressionInformation& block = stream.m_blocks[blockIndex];
+            const size_t bufferOffset = offsetAdjustment + block.m_compressedOffset;
+            Buffer blockBuffer = m_readBuffers[readSlot] + bufferOffset;
+            block.m_compressedData = blockBuffer;
+
+            AZ::IO::FileRequest* blockReadRequest = m_context->GetNewInternalRequest();
+            blockReadRequest->CreateRead(compressedReadRequest, blockBuffer, stream.m_bufferSize - bufferOffset,
+                info.m_archiveFilename, spanOffset + block.m_compressedOffset, block.m_compressedSize, info.m_isSharedPak);
+
+            auto BlockReadCommandComplete = [this, readSlot, blockIndex](AZ::IO::FileRequest& request)
+            {
+                FinishBlockRead(&request, readSlot, blockIndex);
+            };
+            blockReadRequest->SetCompletionCallback(AZStd::move(BlockReadCommandComplete));
+            block.m_activeRequest = blockReadRequest;
+            m_next->QueueRequest(blockReadRequest);
+        }
+    }
+
+    void DecompressorRegistrarEntry::FinishBlockRead(AZ::IO::FileRequest* readRequest, AZ::u32 readSlot, size_t blockIndex)
+    {
+        BlockStreamInformation& stream = m_blockStreams[readSlot];
+        BlockDecompressionInformation& block = stream.m_blocks[blockIndex];
+        AZ_Assert(block.m_activeRequest == readRequest, "Request in the block slot isn't the same as the block read that's being completed.");
+
+        AZ::IO::FileRequest* compressedRequest = readRequest->GetParent();
+        AZ_Assert(compressedRequest, "Block read requests started by DecompressorRegistrarEntry is missing a parent request.");
+
+        if (readRequest->GetStatus() != AZ::IO::IStreamerTypes::RequestStatus::Completed)
+        {
+            // The status of the read is forwarded to the compressed request by the streamer, but a cancel can't override the
+            // completed status set by blocks that already finished, so explicitly fail the request in that case.
+            if (compressedRequest->GetStatus() == AZ::IO::IStreamerTypes::RequestStatus::Completed)
+            {
+                compressedRequest->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Failed);
+            }
+            stream.m_hasFailedRead = true;
+            block.m_activeRequest = nullptr;
+            FinishBlock(readSlot);
+            return;
+        }
+
+        if (stream.m_hasFailedRead)
+        {
+            // The request can no longer succeed so there's no point in decompressing the remaining blocks.
+            block.m_activeRequest = nullptr;
+            FinishBlock(readSlot);
+            return;
+        }
+
+        // Add a wait so the compressed request isn't completed until this block has been decompressed. The task will
+        // complete the wait, which in turn calls FinishBlockDecompression on the main streaming thread.
+        AZ::IO::FileRequest* waitRequest = m_context->GetNewInternalRequest();
+        waitRequest->CreateWait(compressedRequest);
+
+        block.m_activeRequest = waitRequest;
+        block.m_queueStartTime = AZStd::chrono::steady_clock::now();
+        block.m_jobStartTime = block.m_queueStartTime; // Set these to the same in case the scheduler requests an update before the job has started.
+
+        m_pendingBlocks.push_back({ readSlot, blockIndex });
+        ++m_numPendingDecompression;
+        StartBlockDecompressions();
+    }
+
+    bool DecompressorRegistrarEntry::StartBlockDecompressions()
+    {
+        bool submittedTask = false;
+        for (AZ::u32 taskSlot = 0; taskSlot < m_maxNumTasks && !m_pendingBlocks.empty() && m_numRunningTasks < m_maxNumTasks; ++taskSlot)
+        {
+            BlockTaskInformation& task = m_blockTasks[taskSlot];
+            if (task.IsProcessing())
+            {
+                continue;
+            }
+
+            task.m_block = m_pendingBlocks.front();
+            m_pendingBlocks.pop_front();
+            BlockDecompressionInformation& block = m_blockStreams[task.m_block.m_readSlot].m_blocks[task.m_block.m_blockIndex];
+
+            AZ::IO::FileRequest* compressedRequest = block.m_activeRequest->GetParent();
+            auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request in DecompressorRegistrarEntry that's starting block decompression didn't contain compression read data.");
+
+            // Blocks that are only partially requested are decompressed into the scratch buffer of the slot first.
+            const bool isPartialBlock = block.m_uncompressedOffset < data->m_readOffset ||
+                block.m_uncompressedOffset + block.m_uncompressedSize > data->m_readOffset + data->m_readSize;
+            if (isPartialBlock && task.m_scratchBufferSize < block.m_uncompressedSize)
+            {
+                if (task.m_scratchBuffer != nullptr)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(task.m_scratchBuffer, task.m_scratchBufferSize, m_alignment);
+                    m_memoryUsage -= task.m_scratchBufferSize;
+                }
+                task.m_scratchBuffer = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                    block.m_uncompressedSize, m_alignment));
+                task.m_scratchBufferSize = block.m_uncompressedSize;
+                m_memoryUsage += task.m_scratchBufferSize;
+            }
+
+            auto BlockDecompressionFinishedCB = [this, taskSlot](AZ::IO::FileRequest& request)
+            {
+                FinishBlockDecompression(&request, taskSlot);
+            };
+            block.m_activeRequest->SetCompletionCallback(AZStd::move(BlockDecompressionFinishedCB));
+
+            AZ::TaskGraph taskGraph{ "Block Decompression Tasks" };
+            taskGraph.AddTask(AZ::TaskDescriptor{ "Decompress block", "Compression" },
+                [this, &block, scratchBuffer = task.m_scratchBuffer]()
+                {
+                    BlockDecompression(m_context, block, scratchBuffer);
+                });
+            task.m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Decompressor Registrar Block Wait");
+            taskGraph.SubmitOnExecutor(m_taskExecutor, task.m_taskGraphEvent.get());
+
+            --m_numPendingDecompression;
+            ++m_numRunningTasks;
+            ++m_numRunningBlockTasks;
+            submittedTask = true;
+        }
+        return submittedTask;
+    }
+
+    void DecompressorRegistrarEntry::FinishBlockDecompression([[maybe_unused]] AZ::IO::FileRequest* waitRequest, AZ::u32 taskSlot)
+    {
+        BlockTaskInformation& task = m_blockTasks[taskSlot];
+        BlockDecompressionInformation& block = m_blockStreams[task.m_block.m_readSlot].m_blocks[task.m_block.m_blockIndex];
+        AZ_Assert(block.m_activeRequest == waitRequest, "Block slot didn't contain the expected wait request.");
+
+        // The wait is completed from inside the task, so let the task fully wrap up before the slot can be reused.
+        task.m_taskGraphEvent->Wait();
+        task.m_taskGraphEvent.reset();
+
+        auto endTime = AZStd::chrono::steady_clock::now();
+        m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            block.m_jobStartTime - block.m_queueStartTime).count());
+        m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            endTime - block.m_jobStartTime).count());
+        m_blockDecompressionLatencyMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            endTime - block.m_queueStartTime).count());
+        m_bytesDecompressed.PushEntry(block.m_compressedSize);
+
+        AZ_Assert(m_numRunningBlockTasks > 0, "About to complete a block decompression, but the internal count doesn't see a running block.");
+        --m_numRunningBlockTasks;
+        AZ_Assert(m_numRunningTasks > 0, "About to complete a block decompression, but the internal count doesn't see a running job.");
+        --m_numRunningTasks;
+        block.m_activeRequest = nullptr;
+        FinishBlock(task.m_block.m_readSlot);
+    }
+
+    void DecompressorRegistrarEntry::FinishBlock(AZ::u32 readSlot)
+    {
+        BlockStreamInformation& stream = m_blockStreams[readSlot];
+        AZ_Assert(stream.m_numPendingBlocks > 0, "Finishing a block in DecompressorRegistrarEntry, but no blocks are pending for the read slot.");
+        if (--stream.m_numPendingBlocks > 0)
+        {
+            return;
+        }
+
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_readBuffers[readSlot], stream.m_bufferSize, m_alignment);
+        m_readBuffers[readSlot] = nullptr;
+        m_memoryUsage -= stream.m_bufferSize;
+        stream.m_bufferSize = 0;
+        stream.m_blocks.clear();
+
+        m_readRequests[readSlot] = nullptr;
+        m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
+        AZ_Assert(m_numInFlightReads > 0,
+            "Trying to decrement a read request after all its blocks completed in DecompressorRegistrarEntry, "
+            "but no read requests are supposed to be queued.");
+        m_numInFlightReads--;
+    }
+
     void DecompressorRegistrarEntry::FullDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info)
     {
         info.m_jobStartTime = AZStd::chrono::steady_clock::now();
@@ -783,6 +1103,47 @@ namespace Compression
         context->WakeUpSchedulingThread();
     }
 
+    void DecompressorRegistrarEntry::BlockDecompression(AZ::IO::StreamerContext* context, BlockDecompressionInformation& block, Buffer scratchBuffer)
+    {
+        block.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        AZ::IO::FileRequest* waitRequest = block.m_activeRequest;
+        AZ::IO::FileRequest* compressedRequest = waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to DecompressorRegistrarEntry was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in DecompressorRegistrarEntry that's running block decompression didn't contain compression read data.");
+        AZ::IO::CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_decompressor, "Block decompressor job started, but there's no decompressor callback assigned.");
+
+        const size_t readStart = request->m_readOffset;
+        const size_t readEnd = readStart + request->m_readSize;
+        const size_t blockEnd = block.m_uncompressedOffset + block.m_uncompressedSize;
+        const size_t copyStart = AZStd::max(readStart, block.m_uncompressedOffset);
+        const size_t copyEnd = AZStd::min(readEnd, blockEnd);
+        auto output = reinterpret_cast<AZ::u8*>(request->m_output);
+
+        bool success;
+        if (copyStart == block.m_uncompressedOffset && copyEnd == blockEnd)
+        {
+            // The entire block is requested so decompress directly into the output.
+            success = compressionInfo.m_decompressor(compressionInfo, block.m_compressedData, block.m_compressedSize,
+                output + (block.m_uncompressedOffset - readStart), block.m_uncompressedSize);
+        }
+        else
+        {
+            success = compressionInfo.m_decompressor(compressionInfo, block.m_compressedData, block.m_compressedSize,
+                scratchBuffer, block.m_uncompressedSize);
+            if (success)
+            {
+                memcpy(output + (copyStart - readStart), scratchBuffer + (copyStart - block.m_uncompressedOffset), copyEnd - copyStart);
+            }
+        }
+        waitRequest->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
+
+        context->MarkRequestAsCompleted(waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
     void DecompressorRegistrarEntry::Report(const AZ::IO::Requests::ReportData& data) const
     {
         switch (data.m_reportType)
@@ -14,6 +14,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/Task/TaskExecutor.h>
@@ -25,6 +26,7 @@ namespace AZ::IO
 }
 namespace AZ::IO::Requests
 {
+    struct CompressedReadData;
     struct ReadRequestData;
     struct ReportData;
 }
@@ -66,12 +68,16 @@ namespace Compression
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Files that provide a CompressedBlockLayout are instead streamed per block. Only the blocks that overlap
+    //! the requested range are read, and each block is queued for decompression as soon as its read lands, so
+    //! decompression of the first blocks overlaps with the reads of the later ones. Block decompressions share
+    //! the decompression slots with full file decompressions, so no more than m_maxNumTasks tasks run at once.
     class DecompressorRegistrarEntry
         : public AZ::IO::StreamStackEntry
     {
     public:
         DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment);
-        ~DecompressorRegistrarEntry() override = default;
+        ~DecompressorRegistrarEntry() override;
 
         void PrepareRequest(AZ::IO::FileRequest* request) override;
         void QueueRequest(AZ::IO::FileRequest* request) override;
@@ -90,7 +96,8 @@ namespace Compression
         {
             Unused,
             ReadInFlight,
-            PendingDecompression
+            PendingDecompression,
+            StreamingBlocks
         };
 
         struct DecompressionInformation
@@ -104,7 +111,51 @@ namespace Compression
             AZ::u32 m_alignmentOffset{ 0 };
         };
 
+        //! State for a single compressed block of a file that's being streamed per block.
+        struct BlockDecompressionInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_queueStartTime;
+            AZStd::chrono::steady_clock::time_point m_jobStartTime;
+            //! The block read while reading, the wait request while decompressing and nullptr once the block is done.
+            AZ::IO::FileRequest* m_activeRequest{ nullptr };
+            const AZ::u8* m_compressedData{ nullptr };
+            size_t m_compressedOffset{ 0 }; //!< Offset of the compressed block relative to the first block that's read.
+            size_t m_compressedSize{ 0 };
+            size_t m_uncompressedOffset{ 0 }; //!< Offset of the block in the uncompressed file.
+            size_t m_uncompressedSize{ 0 };
+        };
+
+        //! State for a compressed request that occupies a read slot while its blocks are streamed.
+        struct BlockStreamInformation
+        {
+            AZStd::vector<BlockDecompressionInformation> m_blocks;
+            size_t m_bufferSize{ 0 };
+            AZ::u32 m_numPendingBlocks{ 0 }; //!< Blocks that are still being read or decompressed.
+            bool m_hasFailedRead{ false }; //!< Set when a block read failed, blocks that land afterwards are no longer decompressed.
+        };
+
+        //! A block that has been read and is waiting for a decompression slot.
+        struct PendingBlock
+        {
+            AZ::u32 m_readSlot{ 0 };
+            size_t m_blockIndex{ 0 };
+        };
+
+        //! State for a decompression slot that's running a block decompression task.
+        struct BlockTaskInformation
+        {
+            bool IsProcessing() const;
+
+            //! Signaled once the task has finished, set for as long as the slot is in use.
+            AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
+            //! Decompression target for blocks that are only partially requested, kept between tasks and only grown when needed.
+            Buffer m_scratchBuffer{ nullptr };
+            size_t m_scratchBufferSize{ 0 };
+            PendingBlock m_block;
+        };
+
         bool IsIdle() const;
+        static bool UsesBlockStreaming(const AZ::IO::Requests::CompressedReadData& data);
 
         void PrepareReadRequest(AZ::IO::FileRequest* request, AZ::IO::Requests::ReadRequestData& data);
         void PrepareDedicatedCache(AZ::IO::FileRequest* request, const AZ::IO::RequestPath& path);
@@ -112,23 +163,35 @@ namespace Compression
 
         void EstimateCompressedReadRequest(AZ::IO::FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
             AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
+        void EstimateStreamingBlocks(AZ::u32 readSlot, AZStd::chrono::steady_clock::time_point now,
+            AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
 
         void StartArchiveRead(AZ::IO::FileRequest* compressedReadRequest);
         void FinishArchiveRead(AZ::IO::FileRequest* readRequest, AZ::u32 readSlot);
         bool StartDecompressions();
         void FinishDecompression(AZ::IO::FileRequest* waitRequest, AZ::u32 jobSlot);
 
+        void StartBlockStreaming(AZ::IO::FileRequest* compressedReadRequest, AZ::u32 readSlot);
+        void FinishBlockRead(AZ::IO::FileRequest* readRequest, AZ::u32 readSlot, size_t blockIndex);
+        bool StartBlockDecompressions();
+        void FinishBlockDecompression(AZ::IO::FileRequest* waitRequest, AZ::u32 taskSlot);
+        void FinishBlock(AZ::u32 readSlot);
+
         static void FullDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
+        static void BlockDecompression(AZ::IO::StreamerContext* context, BlockDecompressionInformation& block, Buffer scratchBuffer);
 
         void Report(const AZ::IO::Requests::ReportData& data) const;
 
         AZStd::deque<AZ::IO::FileRequest*> m_pendingReads;
         AZStd::deque<AZ::IO::FileRequest*> m_pendingFileExistChecks;
+        AZStd::deque<PendingBlock> m_pendingBlocks;
 
         AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
         AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_decompressionDurationMicroSec;
         AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_bytesDecompressed;
+        //! Time between a block's read landing and the block being fully decompressed.
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_blockDecompressionLatencyMicroSec;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZ::Statistics::RunningStatistic m_decompressionBoundStat;
         AZ::Statistics::RunningStatistic m_readBoundStat;
@@ -139,17 +202,21 @@ namespace Compression
 
         AZStd::unique_ptr<Buffer[]> m_readBuffers;
         // Nullptr if not reading, the read request if reading the file and the wait request for decompression when waiting on decompression.
+        // When streaming blocks this holds the compressed request itself as the individual block requests are tracked in m_blockStreams.
         AZStd::unique_ptr<AZ::IO::FileRequest*[]> m_readRequests;
         AZStd::unique_ptr<ReadBufferStatus[]> m_readBufferStatus;
+        AZStd::unique_ptr<BlockStreamInformation[]> m_blockStreams;
 
         AZStd::unique_ptr<DecompressionInformation[]> m_processingJobs;
+        AZStd::unique_ptr<BlockTaskInformation[]> m_blockTasks;
 
         size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
         AZ::u32 m_maxNumReads{ 2 };
         AZ::u32 m_numInFlightReads{ 0 };
         AZ::u32 m_numPendingDecompression{ 0 };
         AZ::u32 m_maxNumTasks{ 1 };
-        AZ::u32 m_numRunningTasks{ 0 };
+        AZ::u32 m_numRunningTasks{ 0 }; //!< Includes the running block decompressions.
+        AZ::u32 m_numRunningBlockTasks{ 0 };
         AZ::u32 m_alignment{ 0 };
     };
 } // namespace AZ::IO
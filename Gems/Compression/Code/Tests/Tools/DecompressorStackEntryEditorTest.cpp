@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Compression/CompressedBlocks.h>
+#include <Clients/DecompressorLZ4Impl.h>
+#include <Clients/Streamer/DecompressorStackEntry.h>
+#include <Tools/CompressorLZ4Impl.h>
+
+namespace CompressionStreamerTest
+{
+    //! Serves reads from an in memory archive. Only one read is completed per ExecuteRequests call so that several
+    //! blocks are in flight at the same time, and reads can be canceled after a number of them have completed.
+    class MemoryArchiveEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        explicit MemoryArchiveEntry(const AZStd::vector<AZStd::byte>& archive)
+            : AZ::IO::StreamStackEntry("MemoryArchiveEntry")
+            , m_archive(archive)
+        {
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            m_pendingReads.push_back(request);
+        }
+
+        bool ExecuteRequests() override
+        {
+            if (m_pendingReads.empty())
+            {
+                return false;
+            }
+
+            AZ::IO::FileRequest* request = m_pendingReads.front();
+            m_pendingReads.pop_front();
+            auto read = AZStd::get_if<AZ::IO::Requests::ReadData>(&request->GetCommand());
+            if (read == nullptr || m_numCompletedReads >= m_numReadsBeforeCancel)
+            {
+                request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Canceled);
+            }
+            else
+            {
+                EXPECT_LE(read->m_offset + read->m_size, m_archive.size());
+                EXPECT_LE(read->m_size, read->m_outputSize);
+                memcpy(read->m_output, m_archive.data() + read->m_offset, read->m_size);
+                request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                ++m_numCompletedReads;
+            }
+            m_context->MarkRequestAsCompleted(request);
+            return true;
+        }
+
+        void UpdateStatus(Status& status) const override
+        {
+            status.m_isIdle = status.m_isIdle && m_pendingReads.empty();
+        }
+
+        size_t m_numCompletedReads = 0;
+        size_t m_numReadsBeforeCancel = AZStd::numeric_limits<size_t>::max();
+
+    private:
+        const AZStd::vector<AZStd::byte>& m_archive;
+        AZStd::deque<AZ::IO::FileRequest*> m_pendingReads;
+    };
+
+    class DecompressorStackEntryFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t BlockSize = 16 * 1024;
+        static constexpr size_t BlockAlignment = 64;
+        static constexpr size_t BlockCount = 6;
+        static constexpr size_t FileSize = BlockSize * (BlockCount - 1) + 1234; // The last block is only partially filled.
+        static constexpr size_t ArchiveOffset = 100; // Unrelated data in front of the file in the archive.
+        static constexpr AZ::u32 ReadAlignment = 4096;
+
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            // Compressible, but not so repetitive that every block compresses to the same handful of bytes.
+            m_uncompressed.resize(FileSize);
+            for (size_t i = 0; i < FileSize; ++i)
+            {
+                m_uncompressed[i] = AZStd::byte(((i * 7) ^ (i >> 9)) & 0xff);
+            }
+
+            m_archive.resize(ArchiveOffset);
+            m_layout = Compression::CompressBlocks(m_archive, m_compressor, m_uncompressed, BlockSize, BlockAlignment);
+            ASSERT_NE(nullptr, m_layout);
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            m_archiveEntry = AZStd::make_shared<MemoryArchiveEntry>(m_archive);
+        }
+
+        void TearDown() override
+        {
+            m_decompressorEntry.reset();
+            m_archiveEntry.reset();
+            m_context.reset();
+            m_layout.reset();
+            m_archive = {};
+            m_uncompressed = {};
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        void CreateDecompressorEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks)
+        {
+            m_decompressorEntry = AZStd::make_shared<Compression::DecompressorRegistrarEntry>(maxNumReads, maxNumTasks, ReadAlignment);
+            m_decompressorEntry->SetContext(*m_context);
+            m_decompressorEntry->SetNext(m_archiveEntry);
+        }
+
+        AZ::IO::FileRequest* QueueCompressedRead(void* output, size_t offset, size_t size, AZ::IO::IStreamerTypes::RequestStatus& status)
+        {
+            AZ::IO::CompressionInfo info;
+            info.m_offset = ArchiveOffset;
+            info.m_compressedSize = m_archive.size() - ArchiveOffset;
+            info.m_uncompressedSize = FileSize;
+            info.m_isCompressed = true;
+            info.m_decompressor = Compression::CreateBlockDecompressor(m_decompressor);
+            info.m_blockLayout = m_layout;
+
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(info), output, offset, size);
+            request->SetCompletionCallback([&status](const AZ::IO::FileRequest& request)
+                {
+                    status = request.GetStatus();
+                });
+            m_decompressorEntry->QueueRequest(request);
+            return request;
+        }
+
+        void RunUntilIdle()
+        {
+            bool isIdle = false;
+            while (!isIdle)
+            {
+                bool hasWorked = m_decompressorEntry->ExecuteRequests();
+                hasWorked = m_context->FinalizeCompletedRequests() || hasWorked;
+
+                AZ::IO::StreamStackEntry::Status status;
+                m_decompressorEntry->UpdateStatus(status);
+                isIdle = !hasWorked && status.m_isIdle;
+                if (!hasWorked)
+                {
+                    // Block decompressions are still running on the task executor.
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        AZ::IO::IStreamerTypes::RequestStatus ReadCompressed(AZStd::vector<AZStd::byte>& output, size_t offset, size_t size)
+        {
+            AZ::IO::IStreamerTypes::RequestStatus status = AZ::IO::IStreamerTypes::RequestStatus::Pending;
+            output.resize(size);
+            QueueCompressedRead(output.data(), offset, size, status);
+            RunUntilIdle();
+            return status;
+        }
+
+        bool MatchesSource(const AZStd::vector<AZStd::byte>& output, size_t offset) const
+        {
+            return memcmp(output.data(), m_uncompressed.data() + offset, output.size()) == 0;
+        }
+
+        CompressionLZ4::CompressorLZ4 m_compressor;
+        CompressionLZ4::DecompressorLZ4 m_decompressor;
+        AZStd::vector<AZStd::byte> m_uncompressed;
+        AZStd::vector<AZStd::byte> m_archive;
+        AZStd::shared_ptr<AZ::IO::CompressedBlockLayout> m_layout;
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::shared_ptr<MemoryArchiveEntry> m_archiveEntry;
+        AZStd::shared_ptr<Compression::DecompressorRegistrarEntry> m_decompressorEntry;
+    };
+
+    TEST_F(DecompressorStackEntryFixture, CompressBlocks_LZ4_ProducesAlignedIndependentBlocks)
+    {
+        EXPECT_EQ(BlockSize, m_layout->m_uncompressedBlockSize);
+        EXPECT_EQ(BlockAlignment, m_layout->m_compressedBlockAlignment);
+        ASSERT_EQ(BlockCount, m_layout->m_compressedBlockSizes.size());
+
+        size_t blockStart = ArchiveOffset;
+        for (size_t blockIndex = 0; blockIndex < BlockCount; ++blockIndex)
+        {
+            const size_t uncompressedSize = AZStd::min(BlockSize, FileSize - blockIndex * BlockSize);
+            AZStd::vector<AZStd::byte> block(uncompressedSize);
+            Compression::DecompressionResultData result = m_decompressor.DecompressBlock(block,
+                AZStd::span<const AZStd::byte>(m_archive.data() + blockStart, m_layout->m_compressedBlockSizes[blockIndex]));
+            ASSERT_TRUE(result);
+            EXPECT_EQ(uncompressedSize, result.GetUncompressedByteCount());
+            EXPECT_EQ(0, memcmp(block.data(), m_uncompressed.data() + blockIndex * BlockSize, uncompressedSize));
+
+            blockStart += AZ_SIZE_ALIGN_UP(m_layout->m_compressedBlockSizes[blockIndex], BlockAlignment);
+        }
+    }
+
+    TEST_F(DecompressorStackEntryFixture, BlockLayout_FullRead_DecompressesEveryBlockIntoOutput)
+    {
+        CreateDecompressorEntry(2, 2);
+
+        AZStd::vector<AZStd::byte> output;
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ReadCompressed(output, 0, FileSize));
+        EXPECT_TRUE(MatchesSource(output, 0));
+        EXPECT_EQ(BlockCount, m_archiveEntry->m_numCompletedReads);
+    }
+
+    TEST_F(DecompressorStackEntryFixture, BlockLayout_PartialReads_OnlyReadOverlappingBlocks)
+    {
+        CreateDecompressorEntry(2, 2);
+
+        struct Range
+        {
+            size_t m_offset;
+            size_t m_size;
+            size_t m_expectedBlockReads;
+        };
+        const Range ranges[] = {
+            { BlockSize + 100, 200, 1 }, // Inside a single block.
+            { BlockSize - 10, BlockSize * 2 + 20, 4 }, // Partial first and last block with full blocks in between.
+            { BlockSize * 2, BlockSize, 1 }, // Exactly one full block.
+            { FileSize - 50, 50, 1 }, // The end of the partially filled last block.
+        };
+        for (const Range& range : ranges)
+        {
+            m_archiveEntry->m_numCompletedReads = 0;
+            AZStd::vector<AZStd::byte> output;
+            EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ReadCompressed(output, range.m_offset, range.m_size));
+            EXPECT_TRUE(MatchesSource(output, range.m_offset));
+            EXPECT_EQ(range.m_expectedBlockReads, m_archiveEntry->m_numCompletedReads);
+        }
+    }
+
+    TEST_F(DecompressorStackEntryFixture, BlockLayout_MoreBlocksThanTasks_AllRequestsComplete)
+    {
+        // A single decompression slot has to be shared by all blocks of all requests.
+        CreateDecompressorEntry(2, 1);
+
+        constexpr size_t RequestCount = 4;
+        AZStd::vector<AZStd::byte> outputs[RequestCount];
+        AZ::IO::IStreamerTypes::RequestStatus statuses[RequestCount];
+        for (size_t i = 0; i < RequestCount; ++i)
+        {
+            const size_t offset = i * 1000;
+            outputs[i].resize(FileSize - offset);
+            statuses[i] = AZ::IO::IStreamerTypes::RequestStatus::Pending;
+            QueueCompressedRead(outputs[i].data(), offset, outputs[i].size(), statuses[i]);
+        }
+        RunUntilIdle();
+
+        for (size_t i = 0; i < RequestCount; ++i)
+        {
+            EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, statuses[i]);
+            EXPECT_TRUE(MatchesSource(outputs[i], i * 1000));
+        }
+    }
+
+    TEST_F(DecompressorStackEntryFixture, BlockLayout_CanceledBlockRead_RequestFailsAndSlotsAreReleased)
+    {
+        CreateDecompressorEntry(1, 2);
+
+        // The first blocks are read and decompressed, after which the remaining block reads are canceled.
+        m_archiveEntry->m_numReadsBeforeCancel = 2;
+        AZStd::vector<AZStd::byte> output;
+        AZ::IO::IStreamerTypes::RequestStatus status = ReadCompressed(output, 0, FileSize);
+        EXPECT_NE(AZ::IO::IStreamerTypes::RequestStatus::Completed, status);
+        EXPECT_NE(AZ::IO::IStreamerTypes::RequestStatus::Pending, status);
+
+        // The only read slot has to be available again for the next request.
+        m_archiveEntry->m_numReadsBeforeCancel = AZStd::numeric_limits<size_t>::max();
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ReadCompressed(output, BlockSize / 2, BlockSize * 2));
+        EXPECT_TRUE(MatchesSource(output, BlockSize / 2));
+    }
+} // namespace CompressionStreamerTest
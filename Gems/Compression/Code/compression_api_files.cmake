@@ -5,6 +5,8 @@
 #
 
 set(FILES
+    Include/Compression/CompressedBlocks.h
+    Include/Compression/CompressedBlocks.inl
     Include/Compression/CompressionBus.h
     Include/Compression/CompressionInterfaceAPI.h
     Include/Compression/CompressionInterfaceAPI.inl
@@ -14,7 +14,10 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
@@ -198,6 +201,13 @@ namespace Multiplayer
         bool SerializeStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer);
         void NotifyStateDeltaChanges(ReplicationRecord& replicationRecord);
 
+        //! Returns the serialized replication record and state delta for the provided record.
+        //! Connections requesting the same set of changes within the same host frame share a single serialized buffer, which
+        //! must not be modified. Safe to call concurrently from multiple connections.
+        //! @param replicationRecord the set of changes to serialize
+        //! @return the shared serialized buffer, nullptr if serialization failed
+        AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> GetSharedStateDelta(const ReplicationRecord& replicationRecord);
+
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
@@ -214,6 +224,7 @@ namespace Multiplayer
         void NetworkAttach();
 
         void HandleMarkedDirty();
+        void ClearSharedStateDeltas();
         void HandleLocalServerRpcMessage(NetworkEntityRpcMessage& message);
         void HandleLocalAutonomousToAuthorityRpcMessage(NetworkEntityRpcMessage& message);
         void HandleLocalAuthorityToAutonomousRpcMessage(NetworkEntityRpcMessage& message);
@@ -237,6 +248,17 @@ namespace Multiplayer
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
         AZStd::vector<MultiplayerComponent*> m_multiplayerInputComponentVector;
 
+        struct SharedStateDelta
+        {
+            HostFrameId m_hostFrameId = InvalidHostFrameId;
+            ReplicationRecord m_record;
+            AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> m_data;
+        };
+        // State deltas serialized during the current host frame, reused by every connection sending the same set of changes.
+        // Released by the NetworkEntityManager once the entity updates of the frame have been sent.
+        AZStd::vector<SharedStateDelta> m_sharedStateDeltas;
+        AZStd::mutex m_sharedStateDeltaMutex;
+
         RpcSendEvent m_sendAuthorityToClientRpcEvent;
         RpcSendEvent m_sendAuthorityToAutonomousRpcEvent;
         RpcSendEvent m_sendServerToAuthorityRpcEvent;
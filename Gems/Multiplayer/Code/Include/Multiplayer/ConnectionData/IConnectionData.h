@@ -39,6 +39,13 @@ namespace Multiplayer
         //! @return reference to the EntityReplicationManager for this connection data instance
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
+        //! Serializes the entity updates for the remote endpoint ahead of SendUpdates, which then sends them.
+        //! Pending entities have to be activated beforehand, see EntityReplicationManager::GenerateUpdates for the thread safety.
+        virtual void GenerateUpdates() = 0;
+
+        //! Sends the updates to the remote endpoint without activating pending entities, generating the entity updates first if needed.
+        virtual void SendUpdates() = 0;
+
         //! Creates and manages sending updates to the remote endpoint.
         virtual void Update() = 0;
 
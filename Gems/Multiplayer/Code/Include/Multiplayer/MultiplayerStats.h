@@ -10,6 +10,7 @@
 
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/Time/ITime.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -30,12 +31,15 @@ namespace Multiplayer
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
         static const uint32_t RingbufferSamples = 32;
-        using MetricRingbuffer = AZStd::array<uint64_t, RingbufferSamples>;
+        using MetricRingbuffer = AZStd::array<AZStd::atomic<uint64_t>, RingbufferSamples>;
+        //! Counters are atomic since entity updates for several connections may be serialized concurrently.
         struct Metric
         {
             Metric();
-            uint64_t m_totalCalls = 0;
-            uint64_t m_totalBytes = 0;
+            Metric(const Metric& rhs);
+            Metric& operator=(const Metric& rhs);
+            AZStd::atomic<uint64_t> m_totalCalls{ 0 };
+            AZStd::atomic<uint64_t> m_totalBytes{ 0 };
             MetricRingbuffer m_callHistory;
             MetricRingbuffer m_byteHistory;
         };
@@ -94,5 +98,9 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! Returns true if any handler is connected to the stats events.
+        //! The events are signaled on the thread that records the stat, so handlers require stats to be recorded from a single thread.
+        bool HasConnectedHandlers() const;
     };
 }
@@ -60,6 +60,14 @@ namespace Multiplayer
         const HostId& GetRemoteHostId() const;
 
         void ActivatePendingEntities();
+
+        //! Serializes the entity updates for this connection without sending them, they are sent by the next call to SendUpdates.
+        //! Updates for different connections may be generated concurrently, as long as no entity is activated, deactivated or
+        //! modified meanwhile. The state shared between connections, the multiplayer stats and the shared state deltas of the
+        //! NetBindComponents, is safe to update from several threads.
+        void GenerateUpdates();
+
+        //! Sends entity updates, rpcs and resets to the remote host, generating the entity updates first if GenerateUpdates wasn't called.
         void SendUpdates();
         void Clear(bool forMigration);
 
@@ -122,7 +130,7 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void SendEntityUpdateMessages(uint32_t& nextUpdateIndex);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
 
@@ -212,6 +220,11 @@ namespace Multiplayer
 
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_entityPendingRemovalMs = AZ::Time::ZeroTimeMs;
+        // Update messages serialized by GenerateUpdates, and the replicator each message was generated by
+        AZStd::vector<NetworkEntityUpdateMessage> m_generatedUpdates;
+        AZStd::vector<EntityReplicator*> m_generatedUpdateReplicators;
+        bool m_hasGeneratedUpdates = false;
+
         AZ::TimeMs m_frameTimeMs = AZ::Time::ZeroTimeMs;
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
@@ -55,6 +55,10 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records would serialize the same set of changes for the same remote role.
+        //! Consumed bit counts and sent packet ids are not compared.
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
@@ -39,11 +39,21 @@ namespace Multiplayer
         //! Return true if a given entity should be filtered out, false otherwise.
         //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
         //! Ideally, this method should be implemented as a quick look up.
+        //! Note: calls are serialized unless SupportsConcurrentFiltering() returns true.
         //!
         //! @param entity the entity to be considered for filtering
         //! @param controllerEntity player's entity for the associated connection
         //! @param connectionId the affected connection should the entity be filtered out.
         //! @return if false the given entity will be not be replicated to the connection
         virtual bool IsEntityFiltered(AZ::Entity* entity, ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) = 0;
+
+        //! Return true if IsEntityFiltered(...) is safe to call concurrently from multiple threads for different connections.
+        //! When it is, the server gathers the replication candidates of all connections in parallel on the task graph.
+        //! Otherwise, candidates are gathered one connection at a time.
+        //! @return true if IsEntityFiltered(...) can be called concurrently, false by default
+        virtual bool SupportsConcurrentFiltering() const
+        {
+            return false;
+        }
     };
 }
@@ -168,6 +168,11 @@ namespace Multiplayer
         //! Notifies entities that they should process their dirty state.
         virtual void NotifyEntitiesDirtied() = 0;
 
+        //! Registers an entity that holds serialized state deltas shared between connections.
+        //! The deltas are released once the entity updates of the current tick have been sent. Safe to call from multiple threads.
+        //! @param netEntityId the entity holding shared state deltas
+        virtual void AddEntityWithSharedStateDeltas(NetEntityId netEntityId) = 0;
+
         //! Notifies entities that they should process change notifications.
         virtual void NotifyEntitiesChanged() = 0;
 
@@ -11,12 +11,14 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace Multiplayer
 {
     //! @class NetworkEntityUpdateMessage
     //! @brief Property replication packet.
+    //! Copies of a message share the same data buffer, a buffer is only duplicated once a shared copy is modified.
     class NetworkEntityUpdateMessage
     {
     public:
@@ -77,6 +79,11 @@ namespace Multiplayer
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
 
+        //! Shares an already serialized data buffer with this message rather than copying it.
+        //! The buffer must not be modified once shared, messages referencing it copy the buffer before modifying their data.
+        //! @param value the serialized data buffer to share
+        void SetSharedData(AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> value);
+
         //! Gets the current value of Data.
         //! @return the current value of Data
         const AzNetworking::PacketEncodingBuffer* GetData() const;
@@ -92,6 +99,9 @@ namespace Multiplayer
 
     private:
 
+        //! Allocates the data buffer if required, and makes sure it isn't shared with any other message.
+        AzNetworking::PacketEncodingBuffer& GetUniqueData();
+
         NetEntityRole  m_networkRole = NetEntityRole::InvalidRole;
         NetEntityId    m_entityId = InvalidNetEntityId;
         bool           m_isDelete = false;
@@ -101,7 +111,8 @@ namespace Multiplayer
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
-        AZStd::unique_ptr<AzNetworking::PacketEncodingBuffer> m_data;
+        // Shared between copies of the message, and between connections replicating the same entity delta
+        AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> m_data;
     };
     using NetworkEntityUpdateVector = AZStd::fixed_vector<NetworkEntityUpdateMessage, MaxAggregateEntityMessages>;
 }
@@ -14,6 +14,8 @@
 
 namespace Multiplayer
 {
+    class RewindHistory;
+
     //! @class INetworkTime
     //! @brief This is an AZ::Interface<> for managing multiplayer specific time related operations.
     class INetworkTime
@@ -71,6 +73,10 @@ namespace Multiplayer
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Retrieves the hit volume history of rewindable entities, which supports lag compensated queries without syncing entity state.
+        //! @return pointer to the rewind history, or nullptr if no history is being recorded
+        virtual const RewindHistory* GetRewindHistory() const = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! @class RewindHistory
+    //! @brief Ring buffer of per host frame hit volume snapshots, used for lag compensated queries.
+    //! Every recorded frame stores the world bounds of each rewindable entity, along with its bounds on the preceding frame so
+    //! queries can blend between the two. Bounds are stored as structure of arrays and sorted along the x axis, which serves as
+    //! the broadphase for queries. Queries run directly against the history without syncing any entity or physics state back
+    //! in time, and as they never modify the history they can be run concurrently from multiple threads, so long as no frame is
+    //! being recorded at the same time.
+    class RewindHistory
+    {
+    public:
+
+        //! A single hit returned by a historical raycast.
+        struct RaycastHit
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_distance = 0.0f;
+        };
+
+        //! Constructor.
+        //! @param frameCount the number of host frames of history to keep
+        explicit RewindHistory(uint32_t frameCount = RewindHistorySize);
+
+        //! Starts recording the hit volumes of the provided host frame, replacing the oldest recorded frame.
+        //! @param frameId the host frame the hit volumes belong to
+        void BeginFrame(HostFrameId frameId);
+
+        //! Records the hit volume of a single entity for the frame being recorded.
+        //! @param netEntityId the entity the hit volume belongs to
+        //! @param bounds      the world space bounds of the entity
+        void AddHitVolume(NetEntityId netEntityId, const AZ::Aabb& bounds);
+
+        //! Completes recording of the current frame, building the broadphase used by queries.
+        void EndFrame();
+
+        //! Discards all recorded frames.
+        void Clear();
+
+        //! Returns true if the hit volumes for the requested host frame are still in the history.
+        //! @param frameId the host frame to check for
+        //! @return boolean true if the frame can be queried
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Gathers all entities whose rewound hit volume overlaps the provided volume.
+        //! @param frameId     the host frame to query
+        //! @param blendFactor the factor used to blend between hit volumes at the previous and provided host frame
+        //! @param volume      the world space volume to test against
+        //! @param outEntities output list the overlapping entities are appended to
+        //! @return boolean true if the frame was found in the history
+        bool Overlap(HostFrameId frameId, float blendFactor, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outEntities) const;
+
+        //! Gathers all entities whose rewound hit volume is intersected by the provided ray, sorted by distance.
+        //! @param frameId     the host frame to query
+        //! @param blendFactor the factor used to blend between hit volumes at the previous and provided host frame
+        //! @param start       the world space start of the ray
+        //! @param direction   the normalized direction of the ray
+        //! @param distance    the maximum distance along the ray to test
+        //! @param outHits     output list the hits are appended to
+        //! @return boolean true if the frame was found in the history
+        bool Raycast(HostFrameId frameId, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float distance, AZStd::vector<RaycastHit>& outHits) const;
+
+    private:
+
+        //! Hit volumes for a single host frame, stored as structure of arrays sorted by swept minimum x.
+        struct FrameSnapshot
+        {
+            void Clear();
+            void Resize(AZStd::size_t count);
+            AZStd::size_t GetSize() const;
+
+            //! Returns the index of the provided entity in this frame, or GetSize() if it isn't present.
+            AZStd::size_t Find(NetEntityId netEntityId) const;
+
+            HostFrameId m_frameId = InvalidHostFrameId;
+
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<float> m_minX, m_minY, m_minZ;
+            AZStd::vector<float> m_maxX, m_maxY, m_maxZ;
+            AZStd::vector<float> m_prevMinX, m_prevMinY, m_prevMinZ;
+            AZStd::vector<float> m_prevMaxX, m_prevMaxY, m_prevMaxZ;
+
+            // Broadphase, the minimum x of the bounds swept from the previous frame in ascending order, and the widest swept bounds
+            AZStd::vector<float> m_sweptMinX;
+            float m_maxSweptWidth = 0.0f;
+
+            // Indices sorted by NetEntityId, used to look up the previous bounds of an entity when recording the next frame
+            AZStd::vector<uint32_t> m_netEntityIdOrder;
+        };
+
+        const FrameSnapshot* FindFrame(HostFrameId frameId) const;
+
+        //! Returns the range of entries whose swept bounds may overlap [minX, maxX] along the x axis.
+        static void GetCandidateRange(const FrameSnapshot& frame, float minX, float maxX, AZStd::size_t& outBegin, AZStd::size_t& outEnd);
+
+        //! Returns the hit volume of the requested entry, blended between its previous and current bounds.
+        static AZ::Aabb GetBlendedBounds(const FrameSnapshot& frame, AZStd::size_t index, float blendFactor);
+
+        struct PendingHitVolume
+        {
+            NetEntityId m_netEntityId;
+            AZ::Aabb m_bounds;
+        };
+
+        AZStd::vector<FrameSnapshot> m_frames;
+        AZStd::vector<PendingHitVolume> m_pendingHitVolumes;
+        HostFrameId m_recordingFrameId = InvalidHostFrameId;
+    };
+}
@@ -21,10 +21,14 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
 namespace Multiplayer
 {
+    // Bounds the number of distinct serialized deltas kept per entity, connections with other baselines serialize their own copy
+    static constexpr AZStd::size_t MaxSharedStateDeltas = 4;
+
     void NetBindComponent::Reflect(AZ::ReflectContext* context)
     {
         PrefabEntityId::Reflect(context);
@@ -586,6 +590,8 @@ namespace Multiplayer
     {
         if (!m_handleMarkedDirty.IsConnected())
         {
+            // Any deltas serialized this frame no longer reflect the entity state
+            ClearSharedStateDeltas();
             GetNetworkEntityManager()->AddEntityMarkedDirtyHandler(m_handleMarkedDirty);
         }
     }
@@ -686,6 +692,56 @@ namespace Multiplayer
         return success;
     }
 
+    AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> NetBindComponent::GetSharedStateDelta(const ReplicationRecord& replicationRecord)
+    {
+        const HostFrameId hostFrameId = GetNetworkTime()->GetHostFrameId();
+
+        // Hold the lock while serializing, so that other connections waiting on the same delta pick up the result
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaMutex);
+        for (const SharedStateDelta& sharedStateDelta : m_sharedStateDeltas)
+        {
+            if ((sharedStateDelta.m_hostFrameId == hostFrameId) && sharedStateDelta.m_record.HasSameChanges(replicationRecord))
+            {
+                return sharedStateDelta.m_data;
+            }
+        }
+
+        ReplicationRecord record = replicationRecord;
+        record.ResetConsumedBits();
+        AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> data = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+        InputSerializer inputSerializer(data->GetBuffer(), static_cast<uint32_t>(data->GetCapacity()));
+        record.Serialize(inputSerializer);
+        SerializeStateDeltaMessage(record, inputSerializer);
+        if (!inputSerializer.IsValid())
+        {
+            return nullptr;
+        }
+        data->Resize(inputSerializer.GetSize());
+
+        // Deltas from previous frames can never be reused
+        AZStd::erase_if(m_sharedStateDeltas, [hostFrameId](const SharedStateDelta& sharedStateDelta)
+        {
+            return sharedStateDelta.m_hostFrameId != hostFrameId;
+        });
+        if (m_sharedStateDeltas.size() < MaxSharedStateDeltas)
+        {
+            if (m_sharedStateDeltas.empty())
+            {
+                // Lets the network entity manager release the deltas once this tick's updates have been sent, so idle entities
+                // don't hold on to their last deltas
+                GetNetworkEntityManager()->AddEntityWithSharedStateDeltas(GetNetEntityId());
+            }
+            m_sharedStateDeltas.push_back({ hostFrameId, replicationRecord, data });
+        }
+        return data;
+    }
+
+    void NetBindComponent::ClearSharedStateDeltas()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaMutex);
+        m_sharedStateDeltas.clear();
+    }
+
     void NetBindComponent::NotifyStateDeltaChanges(ReplicationRecord& replicationRecord)
     {
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
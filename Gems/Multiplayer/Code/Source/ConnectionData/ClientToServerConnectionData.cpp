@@ -50,9 +50,19 @@ namespace Multiplayer
         return m_entityReplicationManager;
     }
 
+    void ClientToServerConnectionData::GenerateUpdates()
+    {
+        m_entityReplicationManager.GenerateUpdates();
+    }
+
+    void ClientToServerConnectionData::SendUpdates()
+    {
+        m_entityReplicationManager.SendUpdates();
+    }
+
     void ClientToServerConnectionData::Update()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+        SendUpdates();
     }
 }
@@ -71,19 +71,37 @@ namespace Multiplayer
         return m_entityReplicationManager;
     }
 
+    void ServerToClientConnectionData::GenerateUpdates()
+    {
+        if (ShouldSendEntityUpdates())
+        {
+            m_entityReplicationManager.GenerateUpdates();
+        }
+    }
+
+    void ServerToClientConnectionData::SendUpdates()
+    {
+        if (ShouldSendEntityUpdates())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
     void ServerToClientConnectionData::Update()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+        SendUpdates();
+    }
 
+    bool ServerToClientConnectionData::ShouldSendEntityUpdates() const
+    {
         if (CanSendUpdates())
         {
-            NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+            const NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates();
-            }
+            return (netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
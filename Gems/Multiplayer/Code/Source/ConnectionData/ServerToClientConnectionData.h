@@ -31,6 +31,8 @@ namespace Multiplayer
         ConnectionDataType GetConnectionDataType() const override;
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
+        void GenerateUpdates() override;
+        void SendUpdates() override;
         void Update() override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
@@ -44,6 +46,7 @@ namespace Multiplayer
         void SetProviderTicket(const AZStd::string&);
 
     private:
+        bool ShouldSendEntityUpdates() const;
         void OnControlledEntityRemove();
         void OnControlledEntityMigration(const ConstNetworkEntityHandle& entityHandle, const HostId& remoteHostId);
         void OnGameplayStarted();
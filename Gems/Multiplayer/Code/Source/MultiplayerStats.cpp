@@ -14,8 +14,36 @@ namespace Multiplayer
 {
     MultiplayerStats::Metric::Metric()
     {
-        AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
-        AZStd::uninitialized_fill_n(m_byteHistory.data(), RingbufferSamples, 0);
+        for (uint32_t index = 0; index < RingbufferSamples; ++index)
+        {
+            m_callHistory[index].store(0, AZStd::memory_order_relaxed);
+            m_byteHistory[index].store(0, AZStd::memory_order_relaxed);
+        }
+    }
+
+    MultiplayerStats::Metric::Metric(const Metric& rhs)
+    {
+        *this = rhs;
+    }
+
+    MultiplayerStats::Metric& MultiplayerStats::Metric::operator=(const Metric& rhs)
+    {
+        m_totalCalls.store(rhs.m_totalCalls.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        m_totalBytes.store(rhs.m_totalBytes.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        for (uint32_t index = 0; index < RingbufferSamples; ++index)
+        {
+            m_callHistory[index].store(rhs.m_callHistory[index].load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+            m_byteHistory[index].store(rhs.m_byteHistory[index].load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    static void RecordMetric(MultiplayerStats::Metric& metric, uint64_t recordMetricIndex, uint32_t totalBytes)
+    {
+        metric.m_totalCalls.fetch_add(1, AZStd::memory_order_relaxed);
+        metric.m_totalBytes.fetch_add(totalBytes, AZStd::memory_order_relaxed);
+        metric.m_callHistory[recordMetricIndex].fetch_add(1, AZStd::memory_order_relaxed);
+        metric.m_byteHistory[recordMetricIndex].fetch_add(totalBytes, AZStd::memory_order_relaxed);
     }
 
     void MultiplayerStats::ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount)
@@ -52,10 +80,7 @@ namespace Multiplayer
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
         {
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalBytes += totalBytes;
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_callHistory[m_recordMetricIndex]++;
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+            RecordMetric(m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex], m_recordMetricIndex, totalBytes);
         }
         else
         {
@@ -72,10 +97,7 @@ namespace Multiplayer
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesRecv.size() > propertyIndex)
         {
-            m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalCalls++;
-            m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalBytes += totalBytes;
-            m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_callHistory[m_recordMetricIndex]++;
-            m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+            RecordMetric(m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex], m_recordMetricIndex, totalBytes);
         }
         else
         {
@@ -93,10 +115,7 @@ namespace Multiplayer
 
         if (m_componentStats[netComponentIndex].m_rpcsSent.size() > rpcIndex)
         {
-            m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_totalCalls++;
-            m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_totalBytes += totalBytes;
-            m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_callHistory[m_recordMetricIndex]++;
-            m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+            RecordMetric(m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex], m_recordMetricIndex, totalBytes);
         }
         else
         {
@@ -113,10 +132,7 @@ namespace Multiplayer
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         if (m_componentStats[netComponentIndex].m_rpcsRecv.size() > rpcIndex)
         {
-            m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_totalCalls++;
-            m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_totalBytes += totalBytes;
-            m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_callHistory[m_recordMetricIndex]++;
-            m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+            RecordMetric(m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex], m_recordMetricIndex, totalBytes);
         }
         else
         {
@@ -161,12 +177,12 @@ namespace Multiplayer
 
     static void CombineMetrics(MultiplayerStats::Metric& outArg1, const MultiplayerStats::Metric& arg2)
     {
-        outArg1.m_totalCalls += arg2.m_totalCalls;
-        outArg1.m_totalBytes += arg2.m_totalBytes;
+        outArg1.m_totalCalls.fetch_add(arg2.m_totalCalls.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        outArg1.m_totalBytes.fetch_add(arg2.m_totalBytes.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
         for (uint32_t index = 0; index < MultiplayerStats::RingbufferSamples; ++index)
         {
-            outArg1.m_callHistory[index] += arg2.m_callHistory[index];
-            outArg1.m_byteHistory[index] += arg2.m_byteHistory[index];
+            outArg1.m_callHistory[index].fetch_add(arg2.m_callHistory[index].load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+            outArg1.m_byteHistory[index].fetch_add(arg2.m_byteHistory[index].load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
         }
     }
 
@@ -259,6 +275,17 @@ namespace Multiplayer
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
 
+    bool MultiplayerStats::HasConnectedHandlers() const
+    {
+        return m_events.m_entitySerializeStart.HasHandlerConnected()
+            || m_events.m_componentSerializeEnd.HasHandlerConnected()
+            || m_events.m_entitySerializeStop.HasHandlerConnected()
+            || m_events.m_propertySent.HasHandlerConnected()
+            || m_events.m_propertyReceived.HasHandlerConnected()
+            || m_events.m_rpcSent.HasHandlerConnected()
+            || m_events.m_rpcReceived.HasHandlerConnected();
+    }
+
     void MultiplayerStats::RecordFrameTime(AZ::TimeUs networkFrameTime)
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
@@ -43,6 +43,8 @@
 #include <cmath>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <System/PhysXSystem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
@@ -130,6 +132,8 @@ namespace Multiplayer
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+    AZ_CVAR(bool, sv_parallelConnectionSerialization, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server serializes the entity updates of all connections concurrently on the task graph, then sends them from the main thread in a single batch");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
     
@@ -590,7 +594,11 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+            m_networkTime.RecordRewindHistory();
             m_networkTime.IncrementHostFrameId();
+
+            // Gather the replication candidates of every client connection in one shared pass ahead of their window updates
+            m_interestManager.Update(serverRateMs);
         }
 
         // Handle deferred local rpc messages that were generated during the updates
@@ -616,6 +624,9 @@ namespace Multiplayer
         // Send out the game state update to all connections
         UpdateConnections();
 
+        // Every connection has serialized this tick's entity updates, so the deltas they shared are no longer needed
+        m_networkEntityManager.ClearSharedStateDeltas();
+
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
         m_cvarCommands.Swap(cvarUpdates);
@@ -673,8 +684,68 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
-        if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
-                                                  GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        const bool isServer = (GetAgentType() == MultiplayerAgentType::ClientServer) || (GetAgentType() == MultiplayerAgentType::DedicatedServer);
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool isTaskGraphActive = (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+
+        if (sv_parallelConnectionSerialization && isServer && isTaskGraphActive)
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections - Parallel serialization");
+
+            // Entities are activated before their updates are generated, as in the serial update, and activation isn't thread safe
+            m_networkInterface->GetConnectionSet().VisitConnections([](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    static_cast<IConnectionData*>(connection.GetUserData())->GetReplicationManager().ActivatePendingEntities();
+                }
+            });
+
+            AZStd::vector<IConnectionData*> connectionDatas;
+            m_networkInterface->GetConnectionSet().VisitConnections([&connectionDatas](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    connectionDatas.push_back(static_cast<IConnectionData*>(connection.GetUserData()));
+                }
+            });
+
+            // Stats event handlers expect the stats of an entity to be recorded in sequence, so generation is serial when one is connected
+            const bool generateInParallel = (connectionDatas.size() > 1) && !GetStats().HasConnectedHandlers();
+            if (generateInParallel)
+            {
+                // Entities aren't modified while updates are generated, and the state shared between connections is thread safe,
+                // see EntityReplicationManager::GenerateUpdates
+                static const AZ::TaskDescriptor generateUpdatesDescriptor{ "MultiplayerSystemComponent: GenerateUpdates", "Multiplayer" };
+                AZ::TaskGraph generateGraph{ "Multiplayer GenerateUpdates" };
+                for (IConnectionData* connectionData : connectionDatas)
+                {
+                    generateGraph.AddTask(generateUpdatesDescriptor, [connectionData]()
+                    {
+                        connectionData->GenerateUpdates();
+                    });
+                }
+
+                AZ::TaskGraphEvent generateFinished{ "Multiplayer GenerateUpdates Wait" };
+                generateGraph.SubmitOnExecutor(AZ::TaskExecutor::Instance(), &generateFinished);
+                generateFinished.Wait();
+            }
+
+            // Sending goes through the network interface, which is not thread safe, so the serialized updates are sent from this
+            // thread and handed to the transport as a single batch
+            m_networkInterface->BeginSendBatch();
+            auto sendNetworkUpdates = [](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
+                    connectionData->SendUpdates();
+                }
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_networkInterface->EndSendBatch();
+        }
+        else if (sv_multithreadedConnectionUpdates && isServer)
         {
             // Threaded update calls.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
@@ -1567,14 +1638,14 @@ namespace Multiplayer
         const MultiplayerStats::Metric rpcsSent = stats.CalculateTotalRpcsSentMetrics();
         const MultiplayerStats::Metric rpcsRecv = stats.CalculateTotalRpcsRecvMetrics();
 
-        AZLOG_INFO("Total property updates sent: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesSent.m_totalCalls));
-        AZLOG_INFO("Total property updates sent bytes: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesSent.m_totalBytes));
-        AZLOG_INFO("Total property updates received: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesRecv.m_totalCalls));
-        AZLOG_INFO("Total property updates received bytes: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesRecv.m_totalBytes));
-        AZLOG_INFO("Total RPCs sent: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalCalls));
-        AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
-        AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
-        AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Total property updates sent: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesSent.m_totalCalls.load()));
+        AZLOG_INFO("Total property updates sent bytes: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesSent.m_totalBytes.load()));
+        AZLOG_INFO("Total property updates received: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesRecv.m_totalCalls.load()));
+        AZLOG_INFO("Total property updates received bytes: %llu", aznumeric_cast<AZ::u64>(propertyUpdatesRecv.m_totalBytes.load()));
+        AZLOG_INFO("Total RPCs sent: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalCalls.load()));
+        AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes.load()));
+        AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls.load()));
+        AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes.load()));
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -23,6 +23,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/FrameAllocator.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -84,7 +85,7 @@ namespace Multiplayer
     {
         AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: ActivatePendingEntities");
 
-        AZStd::vector<NetEntityId> notReadyEntities;
+        AZStd::vector<NetEntityId, AZ::FrameStdAllocator> notReadyEntities;
 
         const AZ::TimeMs endTimeMs = AZ::GetElapsedTimeMs() + m_entityActivationTimeSliceMs;
         while (!m_entitiesPendingActivation.empty())
@@ -116,42 +117,71 @@ namespace Multiplayer
         }
     }
 
-    // Get the list of entities to update/delete, create and send update/delete messages, send RPCs, and send entity resets.
-    void EntityReplicationManager::SendUpdates()
+    // Get the list of entities to update/delete and serialize their update/delete messages.
+    void EntityReplicationManager::GenerateUpdates()
     {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: GenerateUpdates");
+
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+        m_generatedUpdates.clear();
+        m_generatedUpdateReplicators.clear();
 
-        {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        EntityReplicatorList toSendList = GenerateEntityUpdateList();
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Sending %zd updates from %s to %s",
+            toSendList.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: GenerateUpdates - PrepareToGenerateUpdatePacket");
+            // Prep a replication record for send, at this point, everything needs to be sent
+            for (EntityReplicator* replicator : toSendList)
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareToGenerateUpdatePacket");
-                // Prep a replication record for send, at this point, everything needs to be sent
-                for (EntityReplicator* replicator : toSendList)
-                {
-                    replicator->PrepareToGenerateUpdatePacket();
-                }
+                replicator->PrepareToGenerateUpdatePacket();
             }
+        }
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: GenerateUpdates - GenerateUpdatePacket");
+            m_generatedUpdates.reserve(toSendList.size());
+            m_generatedUpdateReplicators.reserve(toSendList.size());
+            for (EntityReplicator* replicator : toSendList)
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
-                // While our to send list is not empty, build up another packet to send
-                do
-                {
-                    SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
+                m_generatedUpdates.push_back(replicator->GenerateUpdatePacket());
+                m_generatedUpdateReplicators.push_back(replicator);
             }
         }
 
+        m_hasGeneratedUpdates = true;
+    }
+
+    // Send the generated update/delete messages, send RPCs, and send entity resets.
+    void EntityReplicationManager::SendUpdates()
+    {
+        if (!m_hasGeneratedUpdates)
+        {
+            GenerateUpdates();
+        }
+
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            // While our generated updates are not all sent, build up another packet to send
+            uint32_t nextUpdateIndex = 0;
+            do
+            {
+                SendEntityUpdateMessages(nextUpdateIndex);
+            } while (nextUpdateIndex < m_generatedUpdates.size());
+
+            m_generatedUpdates.clear();
+            m_generatedUpdateReplicators.clear();
+            m_hasGeneratedUpdates = false;
+        }
+
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
 
@@ -245,39 +275,37 @@ namespace Multiplayer
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::SendEntityUpdateMessages(uint32_t& nextUpdateIndex)
     {
+        const uint32_t firstUpdateIndex = nextUpdateIndex;
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
         NetworkEntityUpdateVector entityUpdates;
-        // Serialize everything
-        while (!replicatorList.empty())
+        // Gather as many generated updates as fit into a single packet
+        while (nextUpdateIndex < m_generatedUpdates.size())
         {
-            EntityReplicator* replicator = replicatorList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            NetworkEntityUpdateMessage& updateMessage = m_generatedUpdates[nextUpdateIndex];
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > m_maxPayloadSize);
             const bool capacityReached = (entityUpdates.size() >= entityUpdates.capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
+            const bool largeEntityDetected = (payloadFull && entityUpdates.empty());
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
                 break;
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
-            replicatorList.pop_front();
+            entityUpdates.push_back(AZStd::move(updateMessage));
+            ++nextUpdateIndex;
 
             if (largeEntityDetected)
             {
                 AZLOG_WARN
                 (
                     "Serializing extremely large entity (%llu) - MaxPayload: %d NeededSize %d",
-                    aznumeric_cast<AZ::u64>(replicator->GetEntityHandle().GetNetEntityId()),
+                    aznumeric_cast<AZ::u64>(m_generatedUpdateReplicators[firstUpdateIndex]->GetEntityHandle().GetNetEntityId()),
                     m_maxPayloadSize,
                     nextMessageSize
                 );
@@ -290,9 +318,9 @@ namespace Multiplayer
             const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
 
             // Update the sent things with the packet id
-            for (EntityReplicator* replicator : replicatorUpdatedList)
+            for (uint32_t updateIndex = firstUpdateIndex; updateIndex < nextUpdateIndex; ++updateIndex)
             {
-                replicator->RecordSentPacketId(sentId);
+                m_generatedUpdateReplicators[updateIndex]->RecordSentPacketId(sentId);
             }
         }
         else
@@ -376,6 +404,9 @@ namespace Multiplayer
             m_replicatorsPendingReset.clear();
         }
 
+        m_generatedUpdates.clear();
+        m_generatedUpdateReplicators.clear();
+        m_hasGeneratedUpdates = false;
         m_entityReplicatorMap.clear();
     }
 
@@ -372,10 +372,18 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        // Connections sending the same set of changes for this entity share a single serialized copy of the delta
+        AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> data = netBindComponent->GetSharedStateDelta(m_pendingRecord);
+        if (data == nullptr)
+        {
+            AZLOG_ERROR("EntityReplicator: Serialization failed");
+            AZ_Assert(false, "EntityReplicator: Serialization failed");
+            updateMessage.ModifyData();
+        }
+        else
+        {
+            updateMessage.SetSharedData(AZStd::move(data));
+        }
 
         return updateMessage;
     }
@@ -218,6 +218,31 @@ namespace Multiplayer
         m_onEntityMarkedDirty.Signal();
     }
 
+    void NetworkEntityManager::AddEntityWithSharedStateDeltas(NetEntityId netEntityId)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaEntitiesMutex);
+        m_sharedStateDeltaEntities.push_back(netEntityId);
+    }
+
+    void NetworkEntityManager::ClearSharedStateDeltas()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "NetworkEntityManager: ClearSharedStateDeltas");
+
+        AZStd::vector<NetEntityId> sharedStateDeltaEntities;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaEntitiesMutex);
+            sharedStateDeltaEntities.swap(m_sharedStateDeltaEntities);
+        }
+
+        for (NetEntityId netEntityId : sharedStateDeltaEntities)
+        {
+            if (NetBindComponent* netBindComponent = GetEntity(netEntityId).GetNetBindComponent())
+            {
+                netBindComponent->ClearSharedStateDeltas();
+            }
+        }
+    }
+
     void NetworkEntityManager::NotifyEntitiesChanged()
     {
         AZ_PROFILE_SCOPE(MULTIPLAYER, "NetworkEntityManager: NotifyEntitiesChanged");
@@ -10,6 +10,7 @@
 
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Spawnable/RootSpawnableInterface.h>
 #include <AzFramework/Spawnable/SpawnableAssetBus.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
@@ -86,6 +87,7 @@ namespace Multiplayer
         void AddControllersActivatedHandler(ControllersActivatedEvent::Handler& controllersActivatedHandler) override;
         void AddControllersDeactivatedHandler(ControllersDeactivatedEvent::Handler& controllersDeactivatedHandler) override;
         void NotifyEntitiesDirtied() override;
+        void AddEntityWithSharedStateDeltas(NetEntityId netEntityId) override;
         void NotifyEntitiesChanged() override;
         void NotifyControllersActivated(const ConstNetworkEntityHandle& entityHandle, EntityIsMigrating entityIsMigrating) override;
         void NotifyControllersDeactivated(const ConstNetworkEntityHandle& entityHandle, EntityIsMigrating entityIsMigrating) override;
@@ -102,6 +104,9 @@ namespace Multiplayer
 
         void DispatchLocalDeferredRpcMessages();
 
+        //! Releases the state deltas the entities shared between connections, once the entity updates of a tick have been sent.
+        void ClearSharedStateDeltas();
+
         //! RootSpawnableNotificationBus
         //! @{
         void OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
@@ -137,6 +142,9 @@ namespace Multiplayer
 
         EntityExitDomainEvent m_entityExitDomainEvent;
         AZ::Event<> m_onEntityMarkedDirty;
+        // Entities holding shared state deltas, registered by the threads serializing entity updates
+        AZStd::vector<NetEntityId> m_sharedStateDeltaEntities;
+        AZStd::mutex m_sharedStateDeltaEntitiesMutex;
         AZ::Event<> m_onEntityNotifyChanges;
         ControllersActivatedEvent m_controllersActivatedEvent;
         ControllersDeactivatedEvent m_controllersDeactivatedEvent;
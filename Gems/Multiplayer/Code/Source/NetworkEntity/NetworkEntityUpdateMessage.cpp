@@ -8,6 +8,7 @@
 
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace Multiplayer
 {
@@ -30,12 +31,9 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_data(rhs.m_data) // Shallow-copy, the buffer is copied on modification
     {
-        if (rhs.m_data != nullptr)
-        {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
-            (*m_data) = (*rhs.m_data); // Deep-copy
-        }
+        ;
     }
 
     NetworkEntityUpdateMessage::NetworkEntityUpdateMessage(NetEntityRole networkRole, NetEntityId entityId, bool isDeleted, bool wasMigrated)
@@ -67,11 +65,7 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
         m_prefabEntityId = rhs.m_prefabEntityId;
-        if (rhs.m_data != nullptr)
-        {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
-            *m_data = (*rhs.m_data);
-        }
+        m_data = rhs.m_data;
         return *this;
     }
 
@@ -150,13 +144,19 @@ namespace Multiplayer
 
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
-        if (m_data == nullptr)
+        if ((m_data == nullptr) || !m_data.unique())
         {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+            m_data = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>(value);
+            return;
         }
         (*m_data) = value;
     }
 
+    void NetworkEntityUpdateMessage::SetSharedData(AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> value)
+    {
+        m_data = AZStd::move(value);
+    }
+
     const AzNetworking::PacketEncodingBuffer* NetworkEntityUpdateMessage::GetData() const
     {
         return m_data.get();
@@ -164,11 +164,7 @@ namespace Multiplayer
 
     AzNetworking::PacketEncodingBuffer& NetworkEntityUpdateMessage::ModifyData()
     {
-        if (m_data == nullptr)
-        {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
-        }
-        return *m_data;
+        return GetUniqueData();
     }
 
     bool NetworkEntityUpdateMessage::Serialize(AzNetworking::ISerializer& serializer)
@@ -201,14 +197,27 @@ namespace Multiplayer
             serializer.Serialize(m_prefabEntityId, "PrefabEntityId");
         }
 
-        // m_data should never be nullptr
-        if (m_data == nullptr)
+        // m_data should never be nullptr, and must not be shared if it is about to be written to
+        if ((m_data == nullptr) || (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
         {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+            GetUniqueData();
         }
 
         serializer.Serialize(*m_data, "Data");;
 
         return serializer.IsValid();
     }
+
+    AzNetworking::PacketEncodingBuffer& NetworkEntityUpdateMessage::GetUniqueData()
+    {
+        if (m_data == nullptr)
+        {
+            m_data = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+        }
+        else if (!m_data.unique())
+        {
+            m_data = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>(*m_data);
+        }
+        return *m_data;
+    }
 }
@@ -18,6 +18,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
+    AZ_CVAR(bool, sv_RewindHistory, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true the server records entity hit volumes every host frame for lag compensated queries against the rewind history");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
 
     void NetworkTime::Reflect(AZ::ReflectContext* context)
@@ -195,4 +196,41 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    const RewindHistory* NetworkTime::GetRewindHistory() const
+    {
+        return sv_RewindHistory ? &m_rewindHistory : nullptr;
+    }
+
+    void NetworkTime::RecordRewindHistory()
+    {
+        if (!sv_RewindHistory)
+        {
+            return;
+        }
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (networkEntityTracker == nullptr || entityBoundsUnion == nullptr)
+        {
+            return;
+        }
+
+        m_rewindHistory.BeginFrame(m_unalteredFrameId);
+        for (const auto& [netEntityId, entity] : *networkEntityTracker)
+        {
+            // Only entities with a network transform can be rewound, matching SyncEntitiesToRewindState
+            if (entity == nullptr || entity->FindComponent<NetworkTransformComponent>() == nullptr)
+            {
+                continue;
+            }
+
+            const AZ::Aabb bounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
+            if (bounds.IsValid())
+            {
+                m_rewindHistory.AddHitVolume(netEntityId, bounds);
+            }
+        }
+        m_rewindHistory.EndFrame();
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/NetworkTime/RewindHistory.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
@@ -38,11 +39,16 @@ namespace Multiplayer
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
         void ClearRewoundEntities() override;
+        const RewindHistory* GetRewindHistory() const override;
         //! @}
 
+        //! Records the hit volumes of all rewindable entities for the current host frame into the rewind history.
+        void RecordRewindHistory();
+
     private:
 
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        RewindHistory m_rewindHistory;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/RewindHistory.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    void RewindHistory::FrameSnapshot::Clear()
+    {
+        m_frameId = InvalidHostFrameId;
+        Resize(0);
+        m_maxSweptWidth = 0.0f;
+    }
+
+    void RewindHistory::FrameSnapshot::Resize(AZStd::size_t count)
+    {
+        m_netEntityIds.resize_no_construct(count);
+        m_minX.resize_no_construct(count);
+        m_minY.resize_no_construct(count);
+        m_minZ.resize_no_construct(count);
+        m_maxX.resize_no_construct(count);
+        m_maxY.resize_no_construct(count);
+        m_maxZ.resize_no_construct(count);
+        m_prevMinX.resize_no_construct(count);
+        m_prevMinY.resize_no_construct(count);
+        m_prevMinZ.resize_no_construct(count);
+        m_prevMaxX.resize_no_construct(count);
+        m_prevMaxY.resize_no_construct(count);
+        m_prevMaxZ.resize_no_construct(count);
+        m_sweptMinX.resize_no_construct(count);
+        m_netEntityIdOrder.resize_no_construct(count);
+    }
+
+    AZStd::size_t RewindHistory::FrameSnapshot::GetSize() const
+    {
+        return m_netEntityIds.size();
+    }
+
+    AZStd::size_t RewindHistory::FrameSnapshot::Find(NetEntityId netEntityId) const
+    {
+        auto iter = AZStd::lower_bound(m_netEntityIdOrder.begin(), m_netEntityIdOrder.end(), netEntityId,
+            [this](uint32_t index, NetEntityId value)
+        {
+            return m_netEntityIds[index] < value;
+        });
+
+        if ((iter != m_netEntityIdOrder.end()) && (m_netEntityIds[*iter] == netEntityId))
+        {
+            return *iter;
+        }
+        return GetSize();
+    }
+
+    RewindHistory::RewindHistory(uint32_t frameCount)
+    {
+        // At least two frames are required so that the previous frame is available to blend against
+        m_frames.resize(AZStd::max(frameCount, 2u));
+    }
+
+    void RewindHistory::BeginFrame(HostFrameId frameId)
+    {
+        AZ_Assert(m_recordingFrameId == InvalidHostFrameId, "BeginFrame called while already recording a frame");
+        m_recordingFrameId = frameId;
+        m_pendingHitVolumes.clear();
+    }
+
+    void RewindHistory::AddHitVolume(NetEntityId netEntityId, const AZ::Aabb& bounds)
+    {
+        AZ_Assert(m_recordingFrameId != InvalidHostFrameId, "AddHitVolume called outside of BeginFrame and EndFrame");
+        m_pendingHitVolumes.push_back({ netEntityId, bounds });
+    }
+
+    void RewindHistory::EndFrame()
+    {
+        AZ_Assert(m_recordingFrameId != InvalidHostFrameId, "EndFrame called without a matching BeginFrame");
+
+        const FrameSnapshot* previousFrame = FindFrame(m_recordingFrameId - HostFrameId{ 1 });
+        FrameSnapshot& frame = m_frames[static_cast<uint32_t>(m_recordingFrameId) % m_frames.size()];
+        AZ_Assert(&frame != previousFrame, "Recording a frame must not overwrite the frame preceding it");
+
+        // Resolve the bounds each entity had on the previous frame, entities that didn't exist yet haven't moved
+        const AZStd::size_t count = m_pendingHitVolumes.size();
+        AZStd::vector<AZ::Aabb> previousBounds;
+        previousBounds.reserve(count);
+        for (const PendingHitVolume& hitVolume : m_pendingHitVolumes)
+        {
+            const AZStd::size_t previousIndex = (previousFrame != nullptr) ? previousFrame->Find(hitVolume.m_netEntityId) : 0;
+            if ((previousFrame != nullptr) && (previousIndex < previousFrame->GetSize()))
+            {
+                previousBounds.push_back(AZ::Aabb::CreateFromMinMax(
+                    AZ::Vector3(previousFrame->m_minX[previousIndex], previousFrame->m_minY[previousIndex], previousFrame->m_minZ[previousIndex]),
+                    AZ::Vector3(previousFrame->m_maxX[previousIndex], previousFrame->m_maxY[previousIndex], previousFrame->m_maxZ[previousIndex])));
+            }
+            else
+            {
+                previousBounds.push_back(hitVolume.m_bounds);
+            }
+        }
+
+        // Sort entries along the x axis by the bounds swept from the previous frame, so every blended volume is covered
+        AZStd::vector<uint32_t> sweptOrder(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            sweptOrder[i] = i;
+        }
+        auto getSweptMinX = [this, &previousBounds](uint32_t index)
+        {
+            return AZStd::min(m_pendingHitVolumes[index].m_bounds.GetMin().GetX(), previousBounds[index].GetMin().GetX());
+        };
+        AZStd::sort(sweptOrder.begin(), sweptOrder.end(), [&getSweptMinX](uint32_t lhs, uint32_t rhs)
+        {
+            return getSweptMinX(lhs) < getSweptMinX(rhs);
+        });
+
+        frame.Clear();
+        frame.m_frameId = m_recordingFrameId;
+        frame.Resize(count);
+        for (AZStd::size_t i = 0; i < count; ++i)
+        {
+            const uint32_t source = sweptOrder[i];
+            const AZ::Aabb& bounds = m_pendingHitVolumes[source].m_bounds;
+            const AZ::Aabb& previous = previousBounds[source];
+            frame.m_netEntityIds[i] = m_pendingHitVolumes[source].m_netEntityId;
+            frame.m_minX[i] = bounds.GetMin().GetX();
+            frame.m_minY[i] = bounds.GetMin().GetY();
+            frame.m_minZ[i] = bounds.GetMin().GetZ();
+            frame.m_maxX[i] = bounds.GetMax().GetX();
+            frame.m_maxY[i] = bounds.GetMax().GetY();
+            frame.m_maxZ[i] = bounds.GetMax().GetZ();
+            frame.m_prevMinX[i] = previous.GetMin().GetX();
+            frame.m_prevMinY[i] = previous.GetMin().GetY();
+            frame.m_prevMinZ[i] = previous.GetMin().GetZ();
+            frame.m_prevMaxX[i] = previous.GetMax().GetX();
+            frame.m_prevMaxY[i] = previous.GetMax().GetY();
+            frame.m_prevMaxZ[i] = previous.GetMax().GetZ();
+            frame.m_sweptMinX[i] = AZStd::min(frame.m_minX[i], frame.m_prevMinX[i]);
+            const float sweptMaxX = AZStd::max(frame.m_maxX[i], frame.m_prevMaxX[i]);
+            frame.m_maxSweptWidth = AZStd::max(frame.m_maxSweptWidth, sweptMaxX - frame.m_sweptMinX[i]);
+            frame.m_netEntityIdOrder[i] = aznumeric_cast<uint32_t>(i);
+        }
+        AZStd::sort(frame.m_netEntityIdOrder.begin(), frame.m_netEntityIdOrder.end(), [&frame](uint32_t lhs, uint32_t rhs)
+        {
+            return frame.m_netEntityIds[lhs] < frame.m_netEntityIds[rhs];
+        });
+
+        m_recordingFrameId = InvalidHostFrameId;
+        m_pendingHitVolumes.clear();
+    }
+
+    void RewindHistory::Clear()
+    {
+        for (FrameSnapshot& frame : m_frames)
+        {
+            frame.Clear();
+        }
+        m_pendingHitVolumes.clear();
+        m_recordingFrameId = InvalidHostFrameId;
+    }
+
+    bool RewindHistory::HasFrame(HostFrameId frameId) const
+    {
+        return FindFrame(frameId) != nullptr;
+    }
+
+    bool RewindHistory::Overlap(HostFrameId frameId, float blendFactor, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outEntities) const
+    {
+        const FrameSnapshot* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        AZStd::size_t begin = 0;
+        AZStd::size_t end = 0;
+        GetCandidateRange(*frame, volume.GetMin().GetX(), volume.GetMax().GetX(), begin, end);
+        for (AZStd::size_t i = begin; i < end; ++i)
+        {
+            if (GetBlendedBounds(*frame, i, blendFactor).Overlaps(volume))
+            {
+                outEntities.push_back(frame->m_netEntityIds[i]);
+            }
+        }
+        return true;
+    }
+
+    bool RewindHistory::Raycast(HostFrameId frameId, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float distance, AZStd::vector<RaycastHit>& outHits) const
+    {
+        const FrameSnapshot* frame = FindFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        const AZ::Vector3 end = start + direction * distance;
+        AZStd::size_t candidateBegin = 0;
+        AZStd::size_t candidateEnd = 0;
+        GetCandidateRange(*frame, AZStd::min(start.GetX(), end.GetX()), AZStd::max(start.GetX(), end.GetX()), candidateBegin, candidateEnd);
+
+        const AZStd::size_t firstHit = outHits.size();
+        for (AZStd::size_t i = candidateBegin; i < candidateEnd; ++i)
+        {
+            const AZ::Aabb bounds = GetBlendedBounds(*frame, i, blendFactor);
+
+            // Slab test of the ray segment against the blended bounds
+            float nearDistance = 0.0f;
+            float farDistance = distance;
+            bool hit = true;
+            for (int32_t axis = 0; (axis < 3) && hit; ++axis)
+            {
+                const float origin = start.GetElement(axis);
+                const float delta = direction.GetElement(axis);
+                const float slabMin = bounds.GetMin().GetElement(axis);
+                const float slabMax = bounds.GetMax().GetElement(axis);
+                if (delta == 0.0f)
+                {
+                    hit = (origin >= slabMin) && (origin <= slabMax);
+                    continue;
+                }
+
+                const float inverseDelta = 1.0f / delta;
+                float slabNear = (slabMin - origin) * inverseDelta;
+                float slabFar = (slabMax - origin) * inverseDelta;
+                if (slabNear > slabFar)
+                {
+                    AZStd::swap(slabNear, slabFar);
+                }
+                nearDistance = AZStd::max(nearDistance, slabNear);
+                farDistance = AZStd::min(farDistance, slabFar);
+                hit = nearDistance <= farDistance;
+            }
+
+            if (hit)
+            {
+                outHits.push_back({ frame->m_netEntityIds[i], nearDistance });
+            }
+        }
+
+        AZStd::sort(outHits.begin() + firstHit, outHits.end(), [](const RaycastHit& lhs, const RaycastHit& rhs)
+        {
+            return lhs.m_distance < rhs.m_distance;
+        });
+        return true;
+    }
+
+    const RewindHistory::FrameSnapshot* RewindHistory::FindFrame(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+
+        const FrameSnapshot& frame = m_frames[static_cast<uint32_t>(frameId) % m_frames.size()];
+        return (frame.m_frameId == frameId) ? &frame : nullptr;
+    }
+
+    void RewindHistory::GetCandidateRange(const FrameSnapshot& frame, float minX, float maxX, AZStd::size_t& outBegin, AZStd::size_t& outEnd)
+    {
+        // Any entry starting further left than the widest entry can't reach minX
+        auto begin = AZStd::lower_bound(frame.m_sweptMinX.begin(), frame.m_sweptMinX.end(), minX - frame.m_maxSweptWidth);
+        auto end = AZStd::upper_bound(begin, frame.m_sweptMinX.end(), maxX);
+        outBegin = aznumeric_cast<AZStd::size_t>(begin - frame.m_sweptMinX.begin());
+        outEnd = aznumeric_cast<AZStd::size_t>(end - frame.m_sweptMinX.begin());
+    }
+
+    AZ::Aabb RewindHistory::GetBlendedBounds(const FrameSnapshot& frame, AZStd::size_t index, float blendFactor)
+    {
+        const AZ::Vector3 previousMin(frame.m_prevMinX[index], frame.m_prevMinY[index], frame.m_prevMinZ[index]);
+        const AZ::Vector3 previousMax(frame.m_prevMaxX[index], frame.m_prevMaxY[index], frame.m_prevMaxZ[index]);
+        const AZ::Vector3 currentMin(frame.m_minX[index], frame.m_minY[index], frame.m_minZ[index]);
+        const AZ::Vector3 currentMax(frame.m_maxX[index], frame.m_maxY[index], frame.m_maxZ[index]);
+        return AZ::Aabb::CreateFromMinMax(previousMin.Lerp(currentMin, blendFactor), previousMax.Lerp(currentMax, blendFactor));
+    }
+}
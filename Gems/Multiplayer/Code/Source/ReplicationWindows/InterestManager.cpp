@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestManager.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(bool, sv_ReplicateServerProxies);
+    AZ_CVAR_EXTERNED(float, sv_ClientAwarenessRadius);
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_ReplicationWindowUpdateMs);
+
+    AZ_CVAR(bool, sv_SharedInterestManagement, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Gather the replication candidates of all client connections in a single shared pass instead of one visibility query per connection");
+    AZ_CVAR(bool, sv_InterestManagementParallel, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Gather the replication candidates of client connections in parallel on the task graph during the shared interest pass");
+
+    InterestManager::InterestManager()
+    {
+        if (AZ::Interface<InterestManager>::Get() == nullptr)
+        {
+            AZ::Interface<InterestManager>::Register(this);
+        }
+    }
+
+    InterestManager::~InterestManager()
+    {
+        if (AZ::Interface<InterestManager>::Get() == this)
+        {
+            AZ::Interface<InterestManager>::Unregister(this);
+        }
+    }
+
+    void InterestManager::RegisterWindow(ServerToClientReplicationWindow* window)
+    {
+        AZ_Assert(AZStd::find(m_windows.begin(), m_windows.end(), window) == m_windows.end(), "Replication window registered twice");
+        m_windows.push_back(window);
+    }
+
+    void InterestManager::UnregisterWindow(ServerToClientReplicationWindow* window)
+    {
+        auto windowIter = AZStd::find(m_windows.begin(), m_windows.end(), window);
+        if (windowIter != m_windows.end())
+        {
+            // Order doesn't matter, swap and pop
+            *windowIter = m_windows.back();
+            m_windows.pop_back();
+        }
+    }
+
+    void InterestManager::Update(AZ::TimeMs deltaTimeMs)
+    {
+        if (!sv_SharedInterestManagement)
+        {
+            // Release the last shared pass, the windows gather their own candidates while it's turned off
+            if (m_hasGrid)
+            {
+                m_entries.clear();
+                m_cells.clear();
+                m_largeEntries.clear();
+                m_hasGrid = false;
+            }
+            m_timeSinceUpdateMs = AZ::Time::ZeroTimeMs;
+            return;
+        }
+
+        m_timeSinceUpdateMs += deltaTimeMs;
+        if (m_timeSinceUpdateMs < sv_ReplicationWindowUpdateMs)
+        {
+            return;
+        }
+        m_timeSinceUpdateMs = AZ::Time::ZeroTimeMs;
+
+        UpdateInterest();
+    }
+
+    void InterestManager::UpdateInterest()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: UpdateInterest");
+
+        if (m_windows.empty())
+        {
+            return;
+        }
+
+        // Query the visibility scene once for the combined awareness volume of every connection
+        AZ::Aabb queryVolume = AZ::Aabb::CreateNull();
+        for (ServerToClientReplicationWindow* window : m_windows)
+        {
+            AZ::Vector3 observerPosition;
+            if (window->GetObserverPosition(observerPosition))
+            {
+                queryVolume.AddAabb(AZ::Aabb::CreateCenterRadius(observerPosition, sv_ClientAwarenessRadius));
+            }
+        }
+
+        AZStd::vector<Entry> entries;
+        if (queryVolume.IsValid())
+        {
+            AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+            if (visibilitySystem)
+            {
+                AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: Enumerate");
+
+                NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+                entries.reserve(m_entries.size());
+                visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+                    queryVolume,
+                    [&entries, networkEntityTracker](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                        {
+                            if ((visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity) == 0)
+                            {
+                                continue;
+                            }
+
+                            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                            ConstNetworkEntityHandle entityHandle(entity, networkEntityTracker);
+                            // Resolving the NetBindComponent here also caches it on the handle, the handles are only copied
+                            // when windows are gathered on the task graph
+                            NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+                            if (netBindComponent == nullptr)
+                            {
+                                // Entity does not have netbinding, skip this entity
+                                continue;
+                            }
+
+                            if (!sv_ReplicateServerProxies && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+                            {
+                                // Proxy replication disabled
+                                continue;
+                            }
+
+                            entries.push_back({ entityHandle, entity, visEntry->m_boundingVolume });
+                        }
+                    });
+            }
+        }
+
+        BuildGrid(AZStd::move(entries), sv_ClientAwarenessRadius);
+        GatherWindows();
+    }
+
+    void InterestManager::BuildGrid(AZStd::vector<Entry>&& entries, float cellSize)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: BuildGrid");
+
+        m_entries = AZStd::move(entries);
+        m_cellSize = AZStd::max(cellSize, 1.0f);
+        m_inverseCellSize = 1.0f / m_cellSize;
+        m_maxHalfExtent = 0.0f;
+        m_largeEntries.clear();
+
+        // Keep the cell allocations around between updates, most cells will be reused from one update to the next
+        for (auto& cell : m_cells)
+        {
+            cell.second.clear();
+        }
+
+        // Entries larger than half a cell would force every query to visit many more cells, test those separately
+        const float largeHalfExtent = m_cellSize * 0.5f;
+        for (uint32_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex)
+        {
+            const AZ::Aabb& bounds = m_entries[entryIndex].m_bounds;
+            const float halfExtent = bounds.GetExtents().GetMaxElement() * 0.5f;
+            if (halfExtent > largeHalfExtent)
+            {
+                m_largeEntries.push_back(entryIndex);
+                continue;
+            }
+
+            m_maxHalfExtent = AZStd::max(m_maxHalfExtent, halfExtent);
+            const AZ::Vector3 center = bounds.GetCenter();
+            m_cells[ToCellKey(ToCellCoord(center.GetX()), ToCellCoord(center.GetY()), ToCellCoord(center.GetZ()))].push_back(entryIndex);
+        }
+
+        // Drop cells that went unused, so stale cells don't accumulate as entities move through the world
+        for (auto cellIter = m_cells.begin(); cellIter != m_cells.end();)
+        {
+            cellIter = cellIter->second.empty() ? m_cells.erase(cellIter) : AZStd::next(cellIter);
+        }
+
+        m_hasGrid = true;
+    }
+
+    void InterestManager::GatherWindows()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "InterestManager: GatherWindows");
+
+        AZ::TaskExecutor* taskExecutor = m_taskExecutor;
+        if (taskExecutor == nullptr)
+        {
+            auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+            {
+                taskExecutor = &AZ::TaskExecutor::Instance();
+            }
+        }
+
+        // User filters are only called concurrently if they opted in
+        const IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const bool canFilterConcurrently = filterEntityManager == nullptr || filterEntityManager->SupportsConcurrentFiltering();
+
+        if (!sv_InterestManagementParallel || !canFilterConcurrently || taskExecutor == nullptr || m_windows.size() < 2)
+        {
+            for (ServerToClientReplicationWindow* window : m_windows)
+            {
+                window->GatherSharedInterest(*this);
+            }
+            return;
+        }
+
+        // Each window only writes to its own pending replication set and reads the shared grid, so all windows can be gathered concurrently
+        static const AZ::TaskDescriptor gatherWindowDescriptor{ "InterestManager: GatherWindow", "Multiplayer" };
+        AZ::TaskGraph gatherGraph{ "InterestManager Gather" };
+        for (ServerToClientReplicationWindow* window : m_windows)
+        {
+            gatherGraph.AddTask(gatherWindowDescriptor, [this, window]()
+            {
+                window->GatherSharedInterest(*this);
+            });
+        }
+
+        AZ::TaskGraphEvent gatherFinished{ "InterestManager Gather Wait" };
+        gatherGraph.SubmitOnExecutor(*taskExecutor, &gatherFinished);
+        gatherFinished.Wait();
+    }
+
+    void InterestManager::SetTaskExecutor(AZ::TaskExecutor* executor)
+    {
+        m_taskExecutor = executor;
+    }
+}
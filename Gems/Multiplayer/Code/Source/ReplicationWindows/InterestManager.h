@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/math.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace Multiplayer
+{
+    class ServerToClientReplicationWindow;
+
+    //! @class InterestManager
+    //! @brief Server-wide interest management shared by all ServerToClientReplicationWindows.
+    //!
+    //! Instead of every client connection enumerating the visibility scene around its controlled entity, the visibility
+    //! scene is enumerated once per update for the combined awareness volume of all connections. The network entities found
+    //! are binned into a uniform grid whose cells are the size of the client awareness radius, so gathering the candidates
+    //! for a single connection only touches a handful of cells. The candidates of every registered replication window are
+    //! then gathered from the shared grid in parallel on the task graph, and picked up by each window on its next UpdateWindow.
+    class InterestManager
+    {
+    public:
+        AZ_RTTI(InterestManager, "{5C0E4C36-7E0B-4F7A-9C83-6F1A2D7B9E41}");
+
+        //! A network entity binned into the interest grid.
+        struct Entry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Entity* m_entity = nullptr;
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        };
+
+        InterestManager();
+        virtual ~InterestManager();
+
+        //! Registers a replication window to have its candidates gathered by the shared interest pass.
+        //! @param window the replication window to register
+        void RegisterWindow(ServerToClientReplicationWindow* window);
+
+        //! Unregisters a previously registered replication window.
+        //! @param window the replication window to unregister
+        void UnregisterWindow(ServerToClientReplicationWindow* window);
+
+        //! Advances the update timer, running the shared interest pass once sv_ReplicationWindowUpdateMs has elapsed.
+        //! @param deltaTimeMs the time elapsed since the last call
+        void Update(AZ::TimeMs deltaTimeMs);
+
+        //! Runs the shared interest pass immediately.
+        //! Enumerates the default visibility scene once, rebuilds the interest grid and gathers the candidates of all registered windows.
+        void UpdateInterest();
+
+        //! Rebuilds the interest grid from the provided entries.
+        //! @param entries the network entities to bin, the grid takes ownership of the entries
+        //! @param cellSize the edge length of a grid cell, ideally the client awareness radius
+        void BuildGrid(AZStd::vector<Entry>&& entries, float cellSize);
+
+        //! Gathers the candidates of all registered windows from the current interest grid.
+        //! Windows are evaluated in parallel if a task executor is available and the IFilterEntityManager, if any, supports
+        //! concurrent filtering.
+        void GatherWindows();
+
+        //! Overrides the task executor used to gather windows in parallel, by default the global task executor is used.
+        //! @param executor the executor to use, or nullptr to restore the default
+        void SetTaskExecutor(AZ::TaskExecutor* executor);
+
+        //! Invokes the visitor for every entry whose bounds overlap the provided sphere.
+        //! This is safe to call from multiple threads concurrently as long as the grid isn't being rebuilt.
+        //! @param sphere the sphere to test against
+        //! @param visitor callable invoked with a const Entry& for every overlapping entry
+        template <typename Visitor>
+        void EnumerateSphere(const AZ::Sphere& sphere, Visitor&& visitor) const;
+
+        //! Invokes the visitor for every entity in the visibility scene whose bounds overlap the provided sphere.
+        //! This is the query a single connection runs when no shared interest result is available. Octree nodes are loose, so
+        //! entries are tested individually, which makes the result match EnumerateSphere over a grid built from the same scene.
+        //! @param scene the visibility scene to query
+        //! @param sphere the sphere to test against
+        //! @param visitor callable invoked with an AzFramework::VisibilityEntry& for every overlapping entity
+        template <typename Visitor>
+        static void EnumerateSceneSphere(const AzFramework::IVisibilityScene& scene, const AZ::Sphere& sphere, Visitor&& visitor);
+
+        //! Returns true once the interest grid has been built at least once.
+        bool HasGrid() const;
+
+        //! Returns the number of network entities in the interest grid.
+        uint32_t GetEntryCount() const;
+
+    private:
+        using CellKey = uint64_t;
+        using CellCoord = int32_t;
+
+        CellCoord ToCellCoord(float value) const;
+        static CellKey ToCellKey(CellCoord x, CellCoord y, CellCoord z);
+
+        AZStd::vector<ServerToClientReplicationWindow*> m_windows;
+
+        AZStd::vector<Entry> m_entries;
+        //! Maps a cell to the indices of the entries whose center lies within the cell
+        AZStd::unordered_map<CellKey, AZStd::vector<uint32_t>> m_cells;
+        //! Entries too large to be binned by their center, these are tested by every query
+        AZStd::vector<uint32_t> m_largeEntries;
+
+        AZ::TaskExecutor* m_taskExecutor = nullptr;
+        AZ::TimeMs m_timeSinceUpdateMs = AZ::Time::ZeroTimeMs;
+        float m_cellSize = 1.0f;
+        float m_inverseCellSize = 1.0f;
+        //! The largest half extent of any binned entry, queries are expanded by this amount
+        float m_maxHalfExtent = 0.0f;
+        bool m_hasGrid = false;
+    };
+}
+
+#include <Source/ReplicationWindows/InterestManager.inl>
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace Multiplayer
+{
+    inline InterestManager::CellCoord InterestManager::ToCellCoord(float value) const
+    {
+        return static_cast<CellCoord>(AZStd::floor(value * m_inverseCellSize));
+    }
+
+    inline InterestManager::CellKey InterestManager::ToCellKey(CellCoord x, CellCoord y, CellCoord z)
+    {
+        // 21 bits per axis, which covers +/- one million cells along each axis
+        constexpr CellKey AxisMask = (CellKey{ 1 } << 21) - 1;
+        return (static_cast<CellKey>(x) & AxisMask)
+            | ((static_cast<CellKey>(y) & AxisMask) << 21)
+            | ((static_cast<CellKey>(z) & AxisMask) << 42);
+    }
+
+    template <typename Visitor>
+    inline void InterestManager::EnumerateSphere(const AZ::Sphere& sphere, Visitor&& visitor) const
+    {
+        for (const uint32_t entryIndex : m_largeEntries)
+        {
+            const Entry& entry = m_entries[entryIndex];
+            if (AZ::ShapeIntersection::Overlaps(sphere, entry.m_bounds))
+            {
+                visitor(entry);
+            }
+        }
+
+        if (m_cells.empty())
+        {
+            return;
+        }
+
+        // Entries are binned by their center, so expand the query by the largest half extent to catch every overlapping entry
+        const AZ::Vector3& center = sphere.GetCenter();
+        const float queryRadius = sphere.GetRadius() + m_maxHalfExtent;
+        const CellCoord minX = ToCellCoord(center.GetX() - queryRadius);
+        const CellCoord minY = ToCellCoord(center.GetY() - queryRadius);
+        const CellCoord minZ = ToCellCoord(center.GetZ() - queryRadius);
+        const CellCoord maxX = ToCellCoord(center.GetX() + queryRadius);
+        const CellCoord maxY = ToCellCoord(center.GetY() + queryRadius);
+        const CellCoord maxZ = ToCellCoord(center.GetZ() + queryRadius);
+
+        for (CellCoord z = minZ; z <= maxZ; ++z)
+        {
+            for (CellCoord y = minY; y <= maxY; ++y)
+            {
+                for (CellCoord x = minX; x <= maxX; ++x)
+                {
+                    auto cellIter = m_cells.find(ToCellKey(x, y, z));
+                    if (cellIter == m_cells.end())
+                    {
+                        continue;
+                    }
+
+                    for (const uint32_t entryIndex : cellIter->second)
+                    {
+                        const Entry& entry = m_entries[entryIndex];
+                        if (AZ::ShapeIntersection::Overlaps(sphere, entry.m_bounds))
+                        {
+                            visitor(entry);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename Visitor>
+    inline void InterestManager::EnumerateSceneSphere(const AzFramework::IVisibilityScene& scene, const AZ::Sphere& sphere, Visitor&& visitor)
+    {
+        scene.Enumerate(
+            sphere,
+            [&sphere, &visitor](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if ((visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity) &&
+                        AZ::ShapeIntersection::Overlaps(sphere, visEntry->m_boundingVolume))
+                    {
+                        visitor(*visEntry);
+                    }
+                }
+            });
+    }
+
+    inline bool InterestManager::HasGrid() const
+    {
+        return m_hasGrid;
+    }
+
+    inline uint32_t InterestManager::GetEntryCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+}
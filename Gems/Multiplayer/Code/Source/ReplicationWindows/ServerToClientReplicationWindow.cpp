@@ -7,12 +7,14 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestManager.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/std/sort.h>
 
 namespace Multiplayer
@@ -25,11 +27,32 @@ namespace Multiplayer
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
 
+    AZ_CVAR_EXTERNED(bool, sv_SharedInterestManagement);
+
     const char* GetConnectionStateString(bool isPoor)
     {
         return isPoor ? "poor" : "ideal";
     }
 
+    // We want to find the closest extent to the player and prioritize using that distance
+    static float GetReplicationPriority(const AZ::Vector3& observerPosition, const AZ::Aabb& boundingVolume, float& outDistanceSquared)
+    {
+        const AZ::Vector3 supportNormal = observerPosition - boundingVolume.GetCenter();
+        const AZ::Vector3 closestPosition = boundingVolume.GetSupport(supportNormal);
+        outDistanceSquared = observerPosition.GetDistanceSq(closestPosition);
+        return (outDistanceSquared > 0.0f) ? 1.0f / outDistanceSquared : 0.0f;
+    }
+
+    static void ResetCandidateQueue(ServerToClientReplicationWindow::ReplicationCandidateQueue& candidateQueue)
+    {
+        using ReplicationCandidateQueue = ServerToClientReplicationWindow::ReplicationCandidateQueue;
+        ReplicationCandidateQueue::container_type clearQueueContainer;
+        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
+        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
+        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
+        candidateQueue.swap(clearQueue);
+    }
+
     ServerToClientReplicationWindow::PrioritizedReplicationCandidate::PrioritizedReplicationCandidate
     (
         const ConstNetworkEntityHandle& entityHandle,
@@ -61,6 +84,19 @@ namespace Multiplayer
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
+
+        if (InterestManager* interestManager = AZ::Interface<InterestManager>::Get())
+        {
+            interestManager->RegisterWindow(this);
+        }
+    }
+
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        if (InterestManager* interestManager = AZ::Interface<InterestManager>::Get())
+        {
+            interestManager->UnregisterWindow(this);
+        }
     }
 
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
@@ -93,13 +129,14 @@ namespace Multiplayer
     void ServerToClientReplicationWindow::UpdateWindow()
     {
         // Clear the candidate queue, we're going to rebuild it
-        ReplicationCandidateQueue::container_type clearQueueContainer;
-        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
-        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
-        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
-        m_candidateQueue.swap(clearQueue);
+        ResetCandidateQueue(m_candidateQueue);
         m_replicationSet.clear();
 
+        // Shared interest results are only valid for the update they were gathered for, and are ignored once the shared pass
+        // is turned off so the window goes back to its own visibility query right away
+        const bool hasSharedInterest = m_hasSharedInterest && sv_SharedInterestManagement;
+        m_hasSharedInterest = false;
+
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
         {
@@ -109,30 +146,103 @@ namespace Multiplayer
 
         EvaluateConnection();
 
-        AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
-        const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
+        if (hasSharedInterest)
+        {
+            // The neighbours were already gathered by the shared interest pass, take ownership of them
+            m_candidateQueue.swap(m_sharedCandidateQueue);
+            m_replicationSet.swap(m_sharedReplicationSet);
+        }
+        else
+        {
+            AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
+            GatherFromVisibilityScene(transformInterface->GetWorldTranslation());
+        }
+
+        // Add in all entities that have forced relevancy
+        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
+        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+        {
+            if (entityHandle.Exists())
+            {
+                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+        }
+    }
+
+    bool ServerToClientReplicationWindow::GetObserverPosition(AZ::Vector3& outPosition) const
+    {
+        const NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+        if (!netBindComponent || !netBindComponent->HasController())
+        {
+            return false;
+        }
+
+        outPosition = m_controlledEntity.GetEntity()->GetTransform()->GetWorldTranslation();
+        return true;
+    }
+
+    void ServerToClientReplicationWindow::GatherSharedInterest(const InterestManager& interestManager)
+    {
+        ResetCandidateQueue(m_sharedCandidateQueue);
+        m_sharedReplicationSet.clear();
+
+        AZ::Vector3 controlledEntityPosition;
+        if (!GetObserverPosition(controlledEntityPosition))
+        {
+            m_hasSharedInterest = false;
+            return;
+        }
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const AzNetworking::ConnectionId connectionId = m_connection->GetConnectionId();
+
+        // Add all the neighbours, server proxies and entities without netbinding were already rejected by the interest manager
+        const AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+        interestManager.EnumerateSphere(awarenessSphere, [this, filterEntityManager, connectionId, &controlledEntityPosition](const InterestManager::Entry& entry)
+        {
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entry.m_entity, m_controlledEntity, connectionId))
+            {
+                return;
+            }
+
+            float gatherDistanceSquared = 0.0f;
+            const float priority = GetReplicationPriority(controlledEntityPosition, entry.m_bounds, gatherDistanceSquared);
+            AddCandidateToReplicationSet(m_sharedCandidateQueue, m_sharedReplicationSet, entry.m_entityHandle, priority);
+        });
+
+        m_hasSharedInterest = true;
+    }
+
+    void ServerToClientReplicationWindow::GatherFromVisibilityScene(const AZ::Vector3& controlledEntityPosition)
+    {
+        // Scratch list for this tick only, growth is left to the vector since frame memory is only reclaimed at the end of the tick
+        AZStd::vector<AzFramework::VisibilityEntry*, AZ::FrameStdAllocator> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
         if (visibilitySystem)
         {
-            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+            // Uses the same overlap test as the shared interest pass, so both paths gather the same candidates
+            InterestManager::EnumerateSceneSphere(
+                *visibilitySystem->GetDefaultVisibilityScene(),
                 awarenessSphere,
-                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                [&gatheredEntries](AzFramework::VisibilityEntry& visEntry)
                 {
-                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                    {
-                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                        {
-                            gatheredEntries.push_back(visEntry);
-                        }
-                    }
+                    gatheredEntries.push_back(&visEntry);
                 });
         }
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
 
         // Add all the neighbours
@@ -151,35 +261,10 @@ namespace Multiplayer
                 continue;
             }
 
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
+            float gatherDistanceSquared = 0.0f;
+            const float priority = GetReplicationPriority(controlledEntityPosition, visEntry->m_boundingVolume, gatherDistanceSquared);
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
-
-        // Add in all entities that have forced relevancy
-        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
-        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
-        {
-            if (entityHandle.Exists())
-            {
-                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
-                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
-            }
-        }
-
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
-
-        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
-        if (hierarchyComponent != nullptr)
-        {
-            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
-        }
     }
 
     AzNetworking::PacketId ServerToClientReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
@@ -327,18 +412,29 @@ namespace Multiplayer
             }
         }
 
-        const bool isQueueFull = (m_candidateQueue.size() >= sv_MaxEntitiesToTrackReplication); // See if have the maximum number of entities in our set
-        const bool isInReplicationSet = m_replicationSet.find(entityHandle) != m_replicationSet.end();
+        AddCandidateToReplicationSet(m_candidateQueue, m_replicationSet, entityHandle, priority);
+    }
+
+    void ServerToClientReplicationWindow::AddCandidateToReplicationSet
+    (
+        ReplicationCandidateQueue& candidateQueue,
+        ReplicationSet& replicationSet,
+        const ConstNetworkEntityHandle& entityHandle,
+        float priority
+    )
+    {
+        const bool isQueueFull = (candidateQueue.size() >= sv_MaxEntitiesToTrackReplication); // See if have the maximum number of entities in our set
+        const bool isInReplicationSet = replicationSet.find(entityHandle) != replicationSet.end();
         if (!isInReplicationSet)
         {
             if (isQueueFull) // If our set is full, then we need to remove the worst priority in our set
             {
-                ConstNetworkEntityHandle removeEnt = m_candidateQueue.top().m_entityHandle;
-                m_candidateQueue.pop();
-                m_replicationSet.erase(removeEnt);
+                ConstNetworkEntityHandle removeEnt = candidateQueue.top().m_entityHandle;
+                candidateQueue.pop();
+                replicationSet.erase(removeEnt);
             }
-            m_candidateQueue.push(PrioritizedReplicationCandidate(entityHandle, priority));
-            m_replicationSet[entityHandle] = { NetEntityRole::Client, priority };
+            candidateQueue.push(PrioritizedReplicationCandidate(entityHandle, priority));
+            replicationSet[entityHandle] = { NetEntityRole::Client, priority };
         }
     }
 
@@ -19,6 +19,7 @@
 
 namespace Multiplayer
 {
+    class InterestManager;
     class NetSystemComponent;
     class NetworkHierarchyRootComponent;
 
@@ -40,6 +41,7 @@ namespace Multiplayer
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
         ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -56,12 +58,31 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! Retrieves the position relevancy is evaluated from for this connection.
+        //! @param outPosition the world position of the controlled entity
+        //! @return false if the controlled entity is no longer controlled and the window will not be updated
+        bool GetObserverPosition(AZ::Vector3& outPosition) const;
+
+        //! Gathers the replication candidates for this connection from the shared interest grid.
+        //! The result is applied on the next call to UpdateWindow. This may run on a task graph worker concurrently with the
+        //! gather of other windows, so it must only touch state owned by this window.
+        //! @param interestManager the interest manager holding the shared interest grid
+        void GatherSharedInterest(const InterestManager& interestManager);
+
     private:
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
+        void GatherFromVisibilityScene(const AZ::Vector3& controlledEntityPosition);
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
+        static void AddCandidateToReplicationSet
+        (
+            ReplicationCandidateQueue& candidateQueue,
+            ReplicationSet& replicationSet,
+            const ConstNetworkEntityHandle& entityHandle,
+            float priority
+        );
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
@@ -69,6 +90,11 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
+        // Candidates gathered by the shared interest pass, swapped in on the next UpdateWindow
+        ReplicationCandidateQueue m_sharedCandidateQueue;
+        ReplicationSet m_sharedReplicationSet;
+        bool m_hasSharedInterest = false;
+
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
 
@@ -142,6 +142,11 @@ namespace Multiplayer
         {
         }
 
+        const RewindHistory* GetRewindHistory() const override
+        {
+            return nullptr;
+        }
+
         void AlterTime([[maybe_unused]] HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, [[maybe_unused]] float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
         {
         }
@@ -279,6 +284,7 @@ namespace Multiplayer
         void AddControllersActivatedHandler([[maybe_unused]] ControllersActivatedEvent::Handler& controllersActivatedHandler) override {}
         void AddControllersDeactivatedHandler([[maybe_unused]] ControllersDeactivatedEvent::Handler& controllersDeactivatedHandler) override {}
         void NotifyEntitiesDirtied() override {}
+        void AddEntityWithSharedStateDeltas([[maybe_unused]] NetEntityId netEntityId) override {}
         void NotifyEntitiesChanged() override {}
         void NotifyControllersActivated([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, [[maybe_unused]] EntityIsMigrating entityIsMigrating) override {}
         void NotifyControllersDeactivated([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, [[maybe_unused]] EntityIsMigrating entityIsMigrating) override {}
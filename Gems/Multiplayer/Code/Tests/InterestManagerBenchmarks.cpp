@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Source/ReplicationWindows/InterestManager.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    /*
+     * Compares gathering the entities around every client connection with one octree query per connection against the shared
+     * interest grid, scaling the number of connections while keeping the world population fixed.
+     * The entities live in an octree visibility scene, the same as the entities of the default visibility scene of a server.
+     */
+    class InterestManagerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 10000;
+        static constexpr float WorldExtent = 4000.0f;
+        static constexpr float AwarenessRadius = 500.0f;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::NameDictionary::Create();
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("InterestManagerBenchmarkScene"));
+
+            AZ::SimpleLcgRandom random(1234);
+            auto randomPosition = [&random]()
+            {
+                return AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() * 0.1f) * WorldExtent;
+            };
+
+            m_visEntries.resize(EntityCount);
+            for (AzFramework::VisibilityEntry& visEntry : m_visEntries)
+            {
+                const AZ::Vector3 halfExtents = AZ::Vector3(0.5f + random.GetRandomFloat() * 4.0f);
+                const AZ::Vector3 position = randomPosition();
+                visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(position - halfExtents, position + halfExtents);
+                visEntry.m_typeFlags = AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity;
+                m_visScene->InsertOrUpdateEntry(visEntry);
+            }
+
+            const uint32_t connectionCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_observers.reserve(connectionCount);
+            for (uint32_t i = 0; i < connectionCount; ++i)
+            {
+                m_observers.push_back(randomPosition());
+            }
+            m_gatheredCounts.resize(connectionCount, 0);
+
+            m_interestManager = AZStd::make_unique<InterestManager>();
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+        }
+
+        void internalTearDown()
+        {
+            m_taskExecutor.reset();
+            m_interestManager.reset();
+            m_gatheredCounts = {};
+            m_observers = {};
+            for (AzFramework::VisibilityEntry& visEntry : m_visEntries)
+            {
+                m_visScene->RemoveEntry(visEntry);
+            }
+            m_visEntries = {};
+            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            m_octreeSystemComponent.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        // Enumerates the scene once for the combined awareness volume of all connections and bins the result, as
+        // InterestManager::UpdateInterest does
+        void BuildSharedGrid()
+        {
+            AZ::Aabb queryVolume = AZ::Aabb::CreateNull();
+            for (const AZ::Vector3& observer : m_observers)
+            {
+                queryVolume.AddAabb(AZ::Aabb::CreateCenterRadius(observer, AwarenessRadius));
+            }
+
+            AZStd::vector<InterestManager::Entry> entries;
+            entries.reserve(EntityCount);
+            m_visScene->Enumerate(queryVolume, [&entries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    entries.push_back({ ConstNetworkEntityHandle(), nullptr, visEntry->m_boundingVolume });
+                }
+            });
+            m_interestManager->BuildGrid(AZStd::move(entries), AwarenessRadius);
+        }
+
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        AzFramework::IVisibilityScene* m_visScene = nullptr;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visEntries;
+        AZStd::vector<AZ::Vector3> m_observers;
+        AZStd::vector<uint32_t> m_gatheredCounts;
+        AZStd::unique_ptr<InterestManager> m_interestManager;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+    };
+
+    // Baseline, every connection runs its own octree query, as ServerToClientReplicationWindow does without the shared pass
+    BENCHMARK_DEFINE_F(InterestManagerBenchmark, PerConnectionQuery)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (uint32_t observerIndex = 0; observerIndex < m_observers.size(); ++observerIndex)
+            {
+                uint32_t gatheredCount = 0;
+                InterestManager::EnumerateSceneSphere(*m_visScene, AZ::Sphere(m_observers[observerIndex], AwarenessRadius),
+                    [&gatheredCount](AzFramework::VisibilityEntry&) { ++gatheredCount; });
+                m_gatheredCounts[observerIndex] = gatheredCount;
+            }
+            benchmark::DoNotOptimize(m_gatheredCounts.data());
+        }
+    }
+
+    // The scene is enumerated and binned once per update, every connection then only visits the cells around it
+    BENCHMARK_DEFINE_F(InterestManagerBenchmark, SharedGrid)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            BuildSharedGrid();
+
+            for (uint32_t observerIndex = 0; observerIndex < m_observers.size(); ++observerIndex)
+            {
+                uint32_t gatheredCount = 0;
+                m_interestManager->EnumerateSphere(AZ::Sphere(m_observers[observerIndex], AwarenessRadius),
+                    [&gatheredCount](const InterestManager::Entry&) { ++gatheredCount; });
+                m_gatheredCounts[observerIndex] = gatheredCount;
+            }
+            benchmark::DoNotOptimize(m_gatheredCounts.data());
+        }
+    }
+
+    // Same as SharedGrid, with the connections gathered concurrently on the task graph
+    BENCHMARK_DEFINE_F(InterestManagerBenchmark, SharedGridParallel)(benchmark::State& state)
+    {
+        static const AZ::TaskDescriptor gatherDescriptor{ "GatherConnection", "InterestManagerBenchmark" };
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            BuildSharedGrid();
+
+            AZ::TaskGraph gatherGraph{ "InterestManagerBenchmark" };
+            for (uint32_t observerIndex = 0; observerIndex < m_observers.size(); ++observerIndex)
+            {
+                gatherGraph.AddTask(gatherDescriptor, [this, observerIndex]()
+                {
+                    uint32_t gatheredCount = 0;
+                    m_interestManager->EnumerateSphere(AZ::Sphere(m_observers[observerIndex], AwarenessRadius),
+                        [&gatheredCount](const InterestManager::Entry&) { ++gatheredCount; });
+                    m_gatheredCounts[observerIndex] = gatheredCount;
+                });
+            }
+
+            AZ::TaskGraphEvent gatherFinished{ "InterestManagerBenchmark Wait" };
+            gatherGraph.SubmitOnExecutor(*m_taskExecutor, &gatherFinished);
+            gatherFinished.Wait();
+            benchmark::DoNotOptimize(m_gatheredCounts.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(InterestManagerBenchmark, PerConnectionQuery)
+        ->RangeMultiplier(4)->Range(4, 256)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(InterestManagerBenchmark, SharedGrid)
+        ->RangeMultiplier(4)->Range(4, 256)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(InterestManagerBenchmark, SharedGridParallel)
+        ->RangeMultiplier(4)->Range(4, 256)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
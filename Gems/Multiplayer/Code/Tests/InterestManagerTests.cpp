@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestManager.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(bool, sv_SharedInterestManagement);
+}
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class InterestManagerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 2000;
+        static constexpr float WorldExtent = 1000.0f;
+        static constexpr float AwarenessRadius = 100.0f;
+
+        using RelevanceSet = AZStd::unordered_set<const AZ::Entity*>;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::NameDictionary::Create();
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("InterestManagerTestScene"));
+        }
+
+        void TearDown() override
+        {
+            for (AzFramework::VisibilityEntry& visEntry : m_visEntries)
+            {
+                m_visScene->RemoveEntry(visEntry);
+            }
+            m_visEntries = {};
+            m_entities = {};
+            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            m_octreeSystemComponent.reset();
+            AZ::NameDictionary::Destroy();
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Scatters entities of various sizes through the scene, a few of them larger than a grid cell
+        void PopulateScene()
+        {
+            AZ::SimpleLcgRandom random(1234);
+            m_entities.reserve(EntityCount);
+            m_visEntries.resize(EntityCount);
+            for (uint32_t i = 0; i < EntityCount; ++i)
+            {
+                const float halfExtent = (i % 100 == 0) ? AwarenessRadius * 1.5f : 0.5f + random.GetRandomFloat() * 10.0f;
+                const AZ::Vector3 position = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * WorldExtent;
+
+                m_entities.push_back(AZStd::make_unique<AZ::Entity>(AZ::EntityId(i + 1)));
+                AzFramework::VisibilityEntry& visEntry = m_visEntries[i];
+                visEntry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(halfExtent));
+                visEntry.m_userData = m_entities.back().get();
+                visEntry.m_typeFlags = AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity;
+                m_visScene->InsertOrUpdateEntry(visEntry);
+            }
+        }
+
+        // The query of a connection without the shared interest pass
+        RelevanceSet GatherPerConnection(const AZ::Vector3& observer) const
+        {
+            RelevanceSet relevanceSet;
+            InterestManager::EnumerateSceneSphere(*m_visScene, AZ::Sphere(observer, AwarenessRadius),
+                [&relevanceSet](AzFramework::VisibilityEntry& visEntry)
+                {
+                    relevanceSet.insert(static_cast<AZ::Entity*>(visEntry.m_userData));
+                });
+            return relevanceSet;
+        }
+
+        // Builds the shared grid from a single query for the combined awareness volume, as InterestManager::UpdateInterest does
+        void BuildSharedGrid(InterestManager& interestManager, const AZStd::vector<AZ::Vector3>& observers) const
+        {
+            AZ::Aabb queryVolume = AZ::Aabb::CreateNull();
+            for (const AZ::Vector3& observer : observers)
+            {
+                queryVolume.AddAabb(AZ::Aabb::CreateCenterRadius(observer, AwarenessRadius));
+            }
+
+            AZStd::vector<InterestManager::Entry> entries;
+            m_visScene->Enumerate(queryVolume, [&entries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    entries.push_back({ ConstNetworkEntityHandle(), static_cast<AZ::Entity*>(visEntry->m_userData), visEntry->m_boundingVolume });
+                }
+            });
+            interestManager.BuildGrid(AZStd::move(entries), AwarenessRadius);
+        }
+
+        RelevanceSet GatherShared(const InterestManager& interestManager, const AZ::Vector3& observer) const
+        {
+            RelevanceSet relevanceSet;
+            interestManager.EnumerateSphere(AZ::Sphere(observer, AwarenessRadius),
+                [&relevanceSet](const InterestManager::Entry& entry)
+                {
+                    // The grid must not report an entity twice
+                    EXPECT_TRUE(relevanceSet.insert(entry.m_entity).second);
+                });
+            return relevanceSet;
+        }
+
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        AzFramework::IVisibilityScene* m_visScene = nullptr;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visEntries;
+    };
+
+    TEST_F(InterestManagerTests, SharedGridMatchesPerConnectionQueries)
+    {
+        PopulateScene();
+
+        AZ::SimpleLcgRandom random(5678);
+        AZStd::vector<AZ::Vector3> observers;
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            observers.push_back(AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * WorldExtent);
+        }
+        // Observers on cell boundaries and outside of the populated area
+        observers.push_back(AZ::Vector3(AwarenessRadius * 3.0f));
+        observers.push_back(AZ::Vector3(-AwarenessRadius * 0.5f));
+        observers.push_back(AZ::Vector3(WorldExtent + AwarenessRadius * 0.5f));
+
+        InterestManager interestManager;
+        BuildSharedGrid(interestManager, observers);
+
+        for (const AZ::Vector3& observer : observers)
+        {
+            const RelevanceSet perConnection = GatherPerConnection(observer);
+            const RelevanceSet shared = GatherShared(interestManager, observer);
+            EXPECT_EQ(perConnection.size(), shared.size());
+            for (const AZ::Entity* entity : perConnection)
+            {
+                EXPECT_TRUE(shared.contains(entity));
+            }
+        }
+    }
+
+    TEST_F(InterestManagerTests, SharedGridTracksMovedEntities)
+    {
+        PopulateScene();
+
+        const AZStd::vector<AZ::Vector3> observers = { AZ::Vector3(WorldExtent * 0.25f), AZ::Vector3(WorldExtent * 0.75f) };
+
+        // Move every entity near the first observer next to the second one
+        for (AzFramework::VisibilityEntry& visEntry : m_visEntries)
+        {
+            if (AZ::ShapeIntersection::Overlaps(AZ::Sphere(observers[0], AwarenessRadius), visEntry.m_boundingVolume))
+            {
+                visEntry.m_boundingVolume.Translate(observers[1] - observers[0]);
+                m_visScene->InsertOrUpdateEntry(visEntry);
+            }
+        }
+
+        InterestManager interestManager;
+        BuildSharedGrid(interestManager, observers);
+
+        for (const AZ::Vector3& observer : observers)
+        {
+            EXPECT_EQ(GatherPerConnection(observer), GatherShared(interestManager, observer));
+        }
+    }
+
+    TEST_F(InterestManagerTests, SharedInterestManagementDisabled_ReleasesTheSharedGrid)
+    {
+        PopulateScene();
+
+        InterestManager interestManager;
+        BuildSharedGrid(interestManager, { AZ::Vector3(WorldExtent * 0.5f) });
+        ASSERT_TRUE(interestManager.HasGrid());
+        EXPECT_GT(interestManager.GetEntryCount(), 0);
+
+        // Windows stop using the shared results as soon as the shared pass is turned off, so its grid isn't kept around
+        sv_SharedInterestManagement = false;
+        interestManager.Update(AZ::TimeMs{ 1000 });
+        EXPECT_FALSE(interestManager.HasGrid());
+        EXPECT_EQ(interestManager.GetEntryCount(), 0);
+        sv_SharedInterestManagement = true;
+    }
+}
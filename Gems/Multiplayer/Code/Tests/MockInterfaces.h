@@ -87,6 +87,7 @@ namespace UnitTest
         MOCK_METHOD1(AddControllersDeactivatedHandler, void(AZ::Event<const Multiplayer::ConstNetworkEntityHandle&, Multiplayer::
             EntityIsMigrating>::Handler&));
         MOCK_METHOD0(NotifyEntitiesDirtied, void());
+        MOCK_METHOD1(AddEntityWithSharedStateDeltas, void(Multiplayer::NetEntityId));
         MOCK_METHOD0(NotifyEntitiesChanged, void());
         MOCK_METHOD2(NotifyControllersActivated, void(const Multiplayer::ConstNetworkEntityHandle&, Multiplayer::EntityIsMigrating));
         MOCK_METHOD2(NotifyControllersDeactivated, void(const Multiplayer::ConstNetworkEntityHandle&, Multiplayer::EntityIsMigrating));
@@ -127,6 +128,7 @@ namespace UnitTest
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
         MOCK_METHOD0(ClearRewoundEntities, void());
+        MOCK_CONST_METHOD0(GetRewindHistory, const Multiplayer::RewindHistory*());
     };
 
     class MockComponentApplicationRequests : public AZ::ComponentApplicationRequests
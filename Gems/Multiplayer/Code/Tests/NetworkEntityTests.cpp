@@ -365,6 +365,134 @@ namespace Multiplayer
         EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, constMessage));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityUpdateMessageSharedData)
+    {
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage message = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 1 });
+        ASSERT_NE(message.GetData(), nullptr);
+
+        // Copies share the serialized data until one of them is modified
+        NetworkEntityUpdateMessage copy = message;
+        EXPECT_EQ(copy.GetData(), message.GetData());
+        copy.ModifyData().Resize(0);
+        EXPECT_NE(copy.GetData(), message.GetData());
+        EXPECT_NE(message.GetData()->GetSize(), 0);
+
+        // The same set of changes within a frame reuses the already serialized delta
+        NetBindComponent* netBindComponent = m_root->m_entity->FindComponent<NetBindComponent>();
+        ReplicationRecord record(NetEntityRole::Client);
+        netBindComponent->FillTotalReplicationRecord(record);
+        const auto sharedData = netBindComponent->GetSharedStateDelta(record);
+        EXPECT_EQ(sharedData, netBindComponent->GetSharedStateDelta(record));
+
+        // Another connection sending the same changes shares the buffer of the first one
+        NiceMock<IMultiplayerConnectionMock> otherConnection(ConnectionId{ 2 }, IpAddress("localhost", 2, ProtocolType::Udp), ConnectionRole::Connector);
+        EntityReplicationManager otherReplicationManager(otherConnection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalClientToRemoteServer);
+        const NetworkEntityHandle rootHandle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        EntityReplicator otherReplicator(otherReplicationManager, &otherConnection, NetEntityRole::Client, rootHandle);
+        otherReplicator.Initialize(rootHandle);
+        EXPECT_TRUE(otherReplicator.PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage otherMessage = otherReplicator.GenerateUpdatePacket();
+        otherReplicator.RecordSentPacketId(AzNetworking::PacketId{ 1 });
+        EXPECT_EQ(otherMessage.GetData(), message.GetData());
+
+        // Marking the entity dirty invalidates the shared deltas
+        netBindComponent->MarkDirty();
+        const auto dirtiedData = netBindComponent->GetSharedStateDelta(record);
+        EXPECT_NE(dirtiedData, sharedData);
+
+        // Once the updates of the tick have been sent, the entity no longer holds on to its deltas
+        const AZStd::weak_ptr<AzNetworking::PacketEncodingBuffer> releasedData = dirtiedData;
+        m_networkEntityManager->ClearSharedStateDeltas();
+        EXPECT_EQ(releasedData.use_count(), 1);
+        EXPECT_NE(netBindComponent->GetSharedStateDelta(record), dirtiedData);
+    }
+
+    //! Replication window that replicates a fixed set of entities and records the entity updates it's asked to send.
+    class RecordingReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        explicit RecordingReplicationWindow(ReplicationSet replicationSet)
+            : m_replicationSet(AZStd::move(replicationSet))
+        {
+        }
+
+        bool ReplicationSetUpdateReady() override { return true; }
+        const ReplicationSet& GetReplicationSet() const override { return m_replicationSet; }
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override { return AZStd::numeric_limits<uint32_t>::max(); }
+        bool IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityPtr, [[maybe_unused]] NetEntityRole& outNetworkRole) const override { return false; }
+        bool AddEntity([[maybe_unused]] AZ::Entity* entity) override { return false; }
+        void RemoveEntity([[maybe_unused]] AZ::Entity* entity) override {}
+        void UpdateWindow() override {}
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override
+        {
+            m_sentUpdates.push_back(entityUpdateVector);
+            return AzNetworking::PacketId{ aznumeric_cast<uint32_t>(m_sentUpdates.size()) };
+        }
+        void SendEntityRpcs([[maybe_unused]] NetworkEntityRpcVector& entityRpcVector, [[maybe_unused]] bool reliable) override {}
+        void SendEntityResets([[maybe_unused]] const NetEntityIdSet& resetIds) override {}
+        void DebugDraw() const override {}
+
+        ReplicationSet m_replicationSet;
+        AZStd::vector<NetworkEntityUpdateVector> m_sentUpdates;
+    };
+
+    TEST_F(MultiplayerNetworkEntityTests, TestGeneratedUpdatesMatchSerialSendUpdates)
+    {
+        // Two connections replicate the same entity, one generates its updates ahead of sending them as with
+        // sv_parallelConnectionSerialization, the other generates them while sending. Both have to send the same packets.
+        ReplicationSet replicationSet;
+        const ConstNetworkEntityHandle rootHandle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        replicationSet[rootHandle].m_netEntityRole = NetEntityRole::Client;
+
+        NiceMock<IMultiplayerConnectionMock> serialConnection(ConnectionId{ 2 }, IpAddress("localhost", 2, ProtocolType::Udp), ConnectionRole::Acceptor);
+        NiceMock<IMultiplayerConnectionMock> generatedConnection(ConnectionId{ 3 }, IpAddress("localhost", 3, ProtocolType::Udp), ConnectionRole::Acceptor);
+        ON_CALL(serialConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+        ON_CALL(generatedConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+        EntityReplicationManager serialManager(serialConnection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+        EntityReplicationManager generatedManager(generatedConnection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+        auto serialWindow = AZStd::make_unique<RecordingReplicationWindow>(replicationSet);
+        auto generatedWindow = AZStd::make_unique<RecordingReplicationWindow>(replicationSet);
+        const RecordingReplicationWindow& serialSent = *serialWindow;
+        const RecordingReplicationWindow& generatedSent = *generatedWindow;
+        serialManager.SetReplicationWindow(AZStd::move(serialWindow));
+        generatedManager.SetReplicationWindow(AZStd::move(generatedWindow));
+
+        // The first tick sends the entity creation, the second one the changed translation
+        for (uint32_t tick = 0; tick < 2; ++tick)
+        {
+            if (tick > 0)
+            {
+                AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+                m_networkEntityManager->NotifyEntitiesDirtied();
+            }
+
+            serialManager.SendUpdates();
+            generatedManager.GenerateUpdates();
+            generatedManager.SendUpdates();
+
+            ASSERT_EQ(serialSent.m_sentUpdates.size(), tick + 1);
+            ASSERT_EQ(generatedSent.m_sentUpdates.size(), tick + 1);
+            const NetworkEntityUpdateVector& serialUpdates = serialSent.m_sentUpdates.back();
+            const NetworkEntityUpdateVector& generatedUpdates = generatedSent.m_sentUpdates.back();
+            ASSERT_EQ(serialUpdates.size(), 1);
+            ASSERT_EQ(generatedUpdates.size(), 1);
+
+            const NetworkEntityUpdateMessage& serialUpdate = serialUpdates.front();
+            const NetworkEntityUpdateMessage& generatedUpdate = generatedUpdates.front();
+            EXPECT_EQ(serialUpdate.GetEntityId(), generatedUpdate.GetEntityId());
+            EXPECT_EQ(serialUpdate.GetNetworkRole(), generatedUpdate.GetNetworkRole());
+            EXPECT_EQ(serialUpdate.GetIsDelete(), generatedUpdate.GetIsDelete());
+            ASSERT_NE(serialUpdate.GetData(), nullptr);
+            ASSERT_NE(generatedUpdate.GetData(), nullptr);
+            ASSERT_EQ(serialUpdate.GetData()->GetSize(), generatedUpdate.GetData()->GetSize());
+            EXPECT_EQ(memcmp(serialUpdate.GetData()->GetBuffer(), generatedUpdate.GetData()->GetBuffer(), serialUpdate.GetData()->GetSize()), 0);
+        }
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorNoDeleteSentIfCreateWasNotSent)
     {
         // Don't send an entity delete message if no create messages have been sent yet either.
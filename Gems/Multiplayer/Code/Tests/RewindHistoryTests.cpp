@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/RewindHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class RewindHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint32_t HistoryFrames = 8;
+
+        // Records a frame with one unit sized entity per position along the x axis
+        void RecordFrame(RewindHistory& history, HostFrameId frameId, float offsetX, uint32_t entityCount)
+        {
+            history.BeginFrame(frameId);
+            for (uint32_t i = 0; i < entityCount; ++i)
+            {
+                const AZ::Vector3 min(aznumeric_cast<float>(i) * 4.0f + offsetX, 0.0f, 0.0f);
+                history.AddHitVolume(static_cast<NetEntityId>(i), AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3::CreateOne()));
+            }
+            history.EndFrame();
+        }
+    };
+
+    TEST_F(RewindHistoryTests, FramesAreReplacedByNewerFrames)
+    {
+        RewindHistory history(HistoryFrames);
+        for (uint32_t frame = 0; frame < HistoryFrames * 2; ++frame)
+        {
+            RecordFrame(history, static_cast<HostFrameId>(frame), 0.0f, 4);
+        }
+
+        EXPECT_FALSE(history.HasFrame(static_cast<HostFrameId>(HistoryFrames - 1)));
+        EXPECT_TRUE(history.HasFrame(static_cast<HostFrameId>(HistoryFrames)));
+        EXPECT_TRUE(history.HasFrame(static_cast<HostFrameId>(HistoryFrames * 2 - 1)));
+        EXPECT_FALSE(history.HasFrame(static_cast<HostFrameId>(HistoryFrames * 2)));
+
+        AZStd::vector<NetEntityId> overlaps;
+        EXPECT_FALSE(history.Overlap(static_cast<HostFrameId>(0), 1.0f, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(1000.0f)), overlaps));
+        EXPECT_TRUE(overlaps.empty());
+
+        history.Clear();
+        EXPECT_FALSE(history.HasFrame(static_cast<HostFrameId>(HistoryFrames * 2 - 1)));
+    }
+
+    TEST_F(RewindHistoryTests, OverlapUsesRewoundBounds)
+    {
+        RewindHistory history(HistoryFrames);
+        // Every entity moves 1 unit along x per frame
+        for (uint32_t frame = 0; frame < 4; ++frame)
+        {
+            RecordFrame(history, static_cast<HostFrameId>(frame), aznumeric_cast<float>(frame), 16);
+        }
+
+        // On frame 1 entity 2 spans [9, 10] along x
+        const AZ::Aabb volume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(9.25f, 0.25f, 0.25f), AZ::Vector3(9.75f, 0.75f, 0.75f));
+        AZStd::vector<NetEntityId> overlaps;
+        EXPECT_TRUE(history.Overlap(static_cast<HostFrameId>(1), 1.0f, volume, overlaps));
+        ASSERT_EQ(overlaps.size(), 1);
+        EXPECT_EQ(overlaps[0], static_cast<NetEntityId>(2));
+
+        // On frame 3 entity 2 has moved on to [11, 12], nothing should overlap
+        overlaps.clear();
+        EXPECT_TRUE(history.Overlap(static_cast<HostFrameId>(3), 1.0f, volume, overlaps));
+        EXPECT_TRUE(overlaps.empty());
+
+        // Halfway between frames 2 and 3 entity 2 spans [10.5, 11.5]
+        overlaps.clear();
+        const AZ::Aabb blendVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(10.1f, 0.25f, 0.25f), AZ::Vector3(10.4f, 0.75f, 0.75f));
+        EXPECT_TRUE(history.Overlap(static_cast<HostFrameId>(3), 0.5f, blendVolume, overlaps));
+        EXPECT_TRUE(overlaps.empty());
+        EXPECT_TRUE(history.Overlap(static_cast<HostFrameId>(3), 0.0f, blendVolume, overlaps));
+        ASSERT_EQ(overlaps.size(), 1);
+        EXPECT_EQ(overlaps[0], static_cast<NetEntityId>(2));
+    }
+
+    TEST_F(RewindHistoryTests, RaycastHitsAreSortedByDistance)
+    {
+        RewindHistory history(HistoryFrames);
+        RecordFrame(history, static_cast<HostFrameId>(0), 0.0f, 16);
+        RecordFrame(history, static_cast<HostFrameId>(1), 0.0f, 16);
+
+        // Cast backwards along x so the hits are found in the reverse order they're stored in
+        const AZ::Vector3 start(62.0f, 0.5f, 0.5f);
+        AZStd::vector<RewindHistory::RaycastHit> hits;
+        EXPECT_TRUE(history.Raycast(static_cast<HostFrameId>(1), 1.0f, start, -AZ::Vector3::CreateAxisX(), 10.0f, hits));
+        ASSERT_EQ(hits.size(), 3);
+        EXPECT_EQ(hits[0].m_netEntityId, static_cast<NetEntityId>(15));
+        EXPECT_NEAR(hits[0].m_distance, 1.0f, 0.001f);
+        EXPECT_EQ(hits[1].m_netEntityId, static_cast<NetEntityId>(14));
+        EXPECT_NEAR(hits[1].m_distance, 5.0f, 0.001f);
+        EXPECT_EQ(hits[2].m_netEntityId, static_cast<NetEntityId>(13));
+        EXPECT_NEAR(hits[2].m_distance, 9.0f, 0.001f);
+
+        // A ray passing above every hit volume shouldn't hit anything
+        hits.clear();
+        EXPECT_TRUE(history.Raycast(static_cast<HostFrameId>(1), 1.0f, start + AZ::Vector3::CreateAxisZ(2.0f), -AZ::Vector3::CreateAxisX(), 100.0f, hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(RewindHistoryTests, RaycastWithShallowComponentIsNotTreatedAsParallel)
+    {
+        RewindHistory history(HistoryFrames);
+        RecordFrame(history, static_cast<HostFrameId>(0), 0.0f, 16);
+
+        // The ray starts just above the hit volumes and descends slowly enough that a tolerance based parallel test would
+        // treat it as never entering the z slab. It drops below the top of the hit volumes after 12.5 units.
+        const AZ::Vector3 start(62.0f, 0.5f, 1.01f);
+        const AZ::Vector3 direction(-1.0f, 0.0f, -0.0008f);
+        AZStd::vector<RewindHistory::RaycastHit> hits;
+        EXPECT_TRUE(history.Raycast(static_cast<HostFrameId>(0), 1.0f, start, direction, 20.0f, hits));
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_EQ(hits[0].m_netEntityId, static_cast<NetEntityId>(12));
+        EXPECT_NEAR(hits[0].m_distance, 13.0f, 0.001f);
+        EXPECT_EQ(hits[1].m_netEntityId, static_cast<NetEntityId>(11));
+        EXPECT_NEAR(hits[1].m_distance, 17.0f, 0.001f);
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+
+namespace Multiplayer
+{
+    //! Replication window that holds every benchmark entity and drops the packets it's asked to send.
+    class BenchmarkReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        explicit BenchmarkReplicationWindow(ReplicationSet replicationSet)
+            : m_replicationSet(AZStd::move(replicationSet))
+        {
+        }
+
+        bool ReplicationSetUpdateReady() override { return true; }
+        const ReplicationSet& GetReplicationSet() const override { return m_replicationSet; }
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override { return AZStd::numeric_limits<uint32_t>::max(); }
+        bool IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityPtr, [[maybe_unused]] NetEntityRole& outNetworkRole) const override { return false; }
+        bool AddEntity([[maybe_unused]] AZ::Entity* entity) override { return false; }
+        void RemoveEntity([[maybe_unused]] AZ::Entity* entity) override {}
+        void UpdateWindow() override {}
+        AzNetworking::PacketId SendEntityUpdateMessages([[maybe_unused]] NetworkEntityUpdateVector& entityUpdateVector) override
+        {
+            m_sentPacketId = m_sentPacketId + AzNetworking::PacketId{ 1 };
+            return m_sentPacketId;
+        }
+        void SendEntityRpcs([[maybe_unused]] NetworkEntityRpcVector& entityRpcVector, [[maybe_unused]] bool reliable) override {}
+        void SendEntityResets([[maybe_unused]] const NetEntityIdSet& resetIds) override {}
+        void DebugDraw() const override {}
+
+    private:
+        ReplicationSet m_replicationSet;
+        AzNetworking::PacketId m_sentPacketId = AzNetworking::PacketId{ 0 };
+    };
+
+    /*
+     * Runs the entity update of a server tick for every client connection through EntityReplicationManager, where each connection
+     * replicates the same set of entities. Remote replicators never acknowledge the entity creation, so every tick serializes and
+     * sends the full state of every entity.
+     * The first argument is the number of client connections, the second the number of replicated entities.
+     */
+    class ServerTickBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        struct ClientConnection
+        {
+            AZStd::unique_ptr<BenchmarkMultiplayerConnection> m_connection;
+            AZStd::unique_ptr<EntityReplicationManager> m_replicationManager;
+        };
+
+        void SetUp(const benchmark::State& state) override
+        {
+            m_connectionCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_entityCount = aznumeric_cast<uint32_t>(state.range(1));
+            HierarchyBenchmarkBase::SetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            m_connectionCount = aznumeric_cast<uint32_t>(state.range(0));
+            m_entityCount = aznumeric_cast<uint32_t>(state.range(1));
+            HierarchyBenchmarkBase::SetUp(state);
+        }
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            ReplicationSet replicationSet;
+            m_entities.reserve(m_entityCount);
+            for (uint32_t entityIndex = 0; entityIndex < m_entityCount; ++entityIndex)
+            {
+                const NetEntityId netEntityId = NetEntityId{ entityIndex + 1 };
+                m_entities.push_back(AZStd::make_unique<EntityInfo>(entityIndex + 1, "entity", netEntityId, EntityInfo::Role::None));
+                EntityInfo& entityInfo = *m_entities.back();
+                PopulateHierarchicalEntity(entityInfo);
+                SetupEntity(entityInfo.m_entity, entityInfo.m_netId, NetEntityRole::Authority);
+                entityInfo.m_entity->Activate();
+
+                const ConstNetworkEntityHandle entityHandle(entityInfo.m_entity.get(), m_NetworkEntityManager->GetNetworkEntityTracker());
+                replicationSet[entityHandle].m_netEntityRole = NetEntityRole::Client;
+            }
+
+            m_clients.resize(m_connectionCount);
+            for (uint32_t connectionIndex = 0; connectionIndex < m_connectionCount; ++connectionIndex)
+            {
+                ClientConnection& client = m_clients[connectionIndex];
+                const uint16_t port = aznumeric_cast<uint16_t>(connectionIndex + 2);
+                client.m_connection = AZStd::make_unique<BenchmarkMultiplayerConnection>(
+                    ConnectionId{ port }, IpAddress("localhost", port, ProtocolType::Udp), ConnectionRole::Acceptor);
+                client.m_replicationManager = AZStd::make_unique<EntityReplicationManager>(
+                    *client.m_connection, *m_ConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+                // Creations are never acknowledged, so all entities have to be allowed to be pending creation
+                client.m_replicationManager->SetMaxRemoteEntitiesPendingCreationCount(m_entityCount);
+                client.m_replicationManager->SetReplicationWindow(AZStd::make_unique<BenchmarkReplicationWindow>(replicationSet));
+            }
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+        }
+
+        void internalTearDown() override
+        {
+            m_taskExecutor.reset();
+            m_clients = {};
+            m_entities = {};
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        void SetCounters(benchmark::State& state) const
+        {
+            state.SetItemsProcessed(aznumeric_cast<int64_t>(state.iterations() * m_connectionCount * m_entityCount));
+        }
+
+        uint32_t m_connectionCount = 0;
+        uint32_t m_entityCount = 0;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entities;
+        AZStd::vector<ClientConnection> m_clients;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+    };
+
+    // Baseline, each connection generates and sends its updates on the calling thread, as without sv_parallelConnectionSerialization
+    BENCHMARK_DEFINE_F(ServerTickBenchmark, SerialConnectionSerialization)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (ClientConnection& client : m_clients)
+            {
+                client.m_replicationManager->SendUpdates();
+            }
+        }
+        SetCounters(state);
+    }
+
+    // Updates are generated concurrently on the task graph and sent from the calling thread, as with sv_parallelConnectionSerialization
+    BENCHMARK_DEFINE_F(ServerTickBenchmark, ParallelConnectionSerialization)(benchmark::State& state)
+    {
+        static const AZ::TaskDescriptor generateDescriptor{ "GenerateUpdates", "ServerTickBenchmark" };
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            AZ::TaskGraph generateGraph{ "ServerTickBenchmark" };
+            for (ClientConnection& client : m_clients)
+            {
+                EntityReplicationManager* replicationManager = client.m_replicationManager.get();
+                generateGraph.AddTask(generateDescriptor, [replicationManager]()
+                {
+                    replicationManager->GenerateUpdates();
+                });
+            }
+
+            AZ::TaskGraphEvent generateFinished{ "ServerTickBenchmark Wait" };
+            generateGraph.SubmitOnExecutor(*m_taskExecutor, &generateFinished);
+            generateFinished.Wait();
+
+            for (ClientConnection& client : m_clients)
+            {
+                client.m_replicationManager->SendUpdates();
+            }
+        }
+        SetCounters(state);
+    }
+
+    BENCHMARK_REGISTER_F(ServerTickBenchmark, SerialConnectionSerialization)
+        ->ArgNames({ "Players", "Entities" })
+        ->Args({ 4, 16 })->Args({ 16, 16 })->Args({ 64, 16 })
+        ->Args({ 4, 128 })->Args({ 16, 128 })->Args({ 64, 128 })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ServerTickBenchmark, ParallelConnectionSerialization)
+        ->ArgNames({ "Players", "Entities" })
+        ->Args({ 4, 16 })->Args({ 16, 16 })->Args({ 64, 16 })
+        ->Args({ 4, 128 })->Args({ 16, 128 })->Args({ 64, 128 })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
@@ -64,6 +64,10 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/RewindHistory.cpp
+    Source/ReplicationWindows/InterestManager.cpp
+    Source/ReplicationWindows/InterestManager.h
+    Source/ReplicationWindows/InterestManager.inl
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
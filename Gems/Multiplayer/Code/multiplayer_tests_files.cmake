@@ -14,7 +14,10 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
+    Tests/InterestManagerBenchmarks.cpp
+    Tests/InterestManagerTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
+    Tests/ServerTickBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
@@ -30,6 +33,7 @@ set(FILES
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
     Tests/NetworkTransformTests.cpp
+    Tests/RewindHistoryTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
@@ -8,13 +8,25 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "RangeCoderCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_MultiplayerCompressionAlgorithm, CompressorName, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Compression algorithm created by the MultiplayerCompressor, either LZ4 or RangeCoder. Must match on both ends of a connection."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
+        const AZ::CVarFixedString algorithm = static_cast<AZ::CVarFixedString>(net_MultiplayerCompressionAlgorithm);
+        if (algorithm == RangeCoderCompressorName)
+        {
+            return AZStd::make_unique<RangeCoderCompressor>();
+        }
+
+        AZ_Warning("Multiplayer Compressor", algorithm == CompressorName, "Unknown compression algorithm %s, falling back to %s", algorithm.c_str(), CompressorName);
         return AZStd::make_unique<LZ4Compressor>();
     }
 
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RangeCoderCompressor.h"
+
+#include <AzCore/std/algorithm.h>
+
+namespace MultiplayerCompression
+{
+    // First byte of every compressed packet, selects how the remainder of the packet is encoded
+    enum class RangeCoderBlockType : uint8_t
+    {
+        Stored, // Raw bytes follow
+        Coded   // Varint uncompressed size followed by the range coded bytes
+    };
+
+    static constexpr uint32_t ProbabilityBits = 11;
+    static constexpr uint16_t ProbabilityOne = 1 << ProbabilityBits;
+    // Packets are coded independently so models start from scratch every packet, adapt quickly rather than precisely
+    static constexpr uint32_t AdaptationShift = 4;
+    static constexpr uint32_t RangeTopValue = 1 << 24;
+    // Number of bytes the encoder emits when flushing, the decoder zero-pads at most this many bytes past the end of the input
+    static constexpr size_t FlushByteCount = 5;
+    static constexpr size_t MaxVarintSize = 5;
+
+    // The previous byte selects the probability model: zero and a bucket per three high bits
+    static constexpr uint32_t ContextCount = 9;
+
+    static uint32_t GetContext(uint8_t previousByte)
+    {
+        return (previousByte == 0) ? 0 : 1 + (previousByte >> 5);
+    }
+
+    struct ByteModels
+    {
+        ByteModels()
+        {
+            AZStd::fill(&m_probabilities[0][0], &m_probabilities[0][0] + ContextCount * 256, static_cast<uint16_t>(ProbabilityOne / 2));
+        }
+
+        // Bit tree per context, node 1 is the root, nodes 2 to 255 are selected by the bits coded so far
+        uint16_t m_probabilities[ContextCount][256];
+    };
+
+    class RangeEncoder
+    {
+    public:
+        RangeEncoder(uint8_t* output, size_t capacity)
+            : m_output(output)
+            , m_capacity(capacity)
+        {
+            ;
+        }
+
+        void EncodeBit(uint16_t& probability, uint32_t bit)
+        {
+            const uint32_t bound = (m_range >> ProbabilityBits) * probability;
+            if (bit == 0)
+            {
+                m_range = bound;
+                probability += (ProbabilityOne - probability) >> AdaptationShift;
+            }
+            else
+            {
+                m_low += bound;
+                m_range -= bound;
+                probability -= probability >> AdaptationShift;
+            }
+
+            while (m_range < RangeTopValue)
+            {
+                m_range <<= 8;
+                ShiftLow();
+            }
+        }
+
+        void Flush()
+        {
+            const size_t flushStart = m_size;
+            for (size_t i = 0; i < FlushByteCount; ++i)
+            {
+                ShiftLow();
+            }
+
+            // The decoder pads missing input with zeros, so trailing zeros written by the flush don't need to be sent
+            while ((m_size > flushStart) && (m_size <= m_capacity) && (m_output[m_size - 1] == 0))
+            {
+                --m_size;
+            }
+        }
+
+        bool HasOverflowed() const
+        {
+            return m_size > m_capacity;
+        }
+
+        size_t GetSize() const
+        {
+            return m_size;
+        }
+
+    private:
+
+        void ShiftLow()
+        {
+            if ((static_cast<uint32_t>(m_low) < 0xFF000000u) || ((m_low >> 32) != 0))
+            {
+                const uint8_t carry = static_cast<uint8_t>(m_low >> 32);
+                uint8_t pending = m_cache;
+                do
+                {
+                    WriteByte(static_cast<uint8_t>(pending + carry));
+                    pending = 0xFF;
+                } while (--m_cacheSize != 0);
+                m_cache = static_cast<uint8_t>(static_cast<uint32_t>(m_low) >> 24);
+            }
+            ++m_cacheSize;
+            m_low = static_cast<uint32_t>(static_cast<uint32_t>(m_low) << 8);
+        }
+
+        void WriteByte(uint8_t value)
+        {
+            // The first byte is always zero, the decoder accounts for it without it being sent
+            if (m_skipFirstByte)
+            {
+                m_skipFirstByte = false;
+                return;
+            }
+            if (m_size < m_capacity)
+            {
+                m_output[m_size] = value;
+            }
+            ++m_size;
+        }
+
+        uint8_t* m_output = nullptr;
+        size_t m_capacity = 0;
+        size_t m_size = 0;
+        uint64_t m_low = 0;
+        uint32_t m_range = 0xFFFFFFFF;
+        uint64_t m_cacheSize = 1;
+        uint8_t m_cache = 0;
+        bool m_skipFirstByte = true;
+    };
+
+    class RangeDecoder
+    {
+    public:
+        RangeDecoder(const uint8_t* input, size_t size)
+            : m_input(input)
+            , m_size(size)
+        {
+            // The leading zero byte was never sent, so only the remaining four bytes of the initial code are read
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                m_code = (m_code << 8) | ReadByte();
+            }
+        }
+
+        uint32_t DecodeBit(uint16_t& probability)
+        {
+            const uint32_t bound = (m_range >> ProbabilityBits) * probability;
+            uint32_t bit;
+            if (m_code < bound)
+            {
+                m_range = bound;
+                probability += (ProbabilityOne - probability) >> AdaptationShift;
+                bit = 0;
+            }
+            else
+            {
+                m_code -= bound;
+                m_range -= bound;
+                probability -= probability >> AdaptationShift;
+                bit = 1;
+            }
+
+            while (m_range < RangeTopValue)
+            {
+                m_range <<= 8;
+                m_code = (m_code << 8) | ReadByte();
+            }
+            return bit;
+        }
+
+        bool IsCorrupt() const
+        {
+            // Reading further past the end of the input than a trimmed flush accounts for means the input was truncated or tampered
+            return m_position > m_size + FlushByteCount;
+        }
+
+    private:
+
+        uint8_t ReadByte()
+        {
+            const uint8_t value = (m_position < m_size) ? m_input[m_position] : 0;
+            ++m_position;
+            return value;
+        }
+
+        const uint8_t* m_input = nullptr;
+        size_t m_size = 0;
+        size_t m_position = 0;
+        uint32_t m_range = 0xFFFFFFFF;
+        uint32_t m_code = 0;
+    };
+
+    size_t RangeCoderCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        // A block type byte is the only overhead added to data that can't be compressed
+        return (maxCompSize > 0) ? maxCompSize - 1 : 0;
+    }
+
+    size_t RangeCoderCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return uncompSize + 1;
+    }
+
+    AzNetworking::CompressorError RangeCoderCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compDataSize < GetMaxCompressedBufferSize(uncompSize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Outbuffer size (%zu B) passed to Compress() is less than worst case (%zu B)", compDataSize, GetMaxCompressedBufferSize(uncompSize));
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(uncompData);
+        uint8_t* output = reinterpret_cast<uint8_t*>(compData);
+
+        // Coding is only worthwhile if the result is smaller than storing the input, so bound the output to the input size.
+        // The header is only written once it's known to fit, small inputs would otherwise write it past the end of the output.
+        size_t headerSize = 2; // Block type and the last varint byte
+        for (size_t remaining = uncompSize >> 7; remaining > 0; remaining >>= 7)
+        {
+            ++headerSize;
+        }
+
+        if (headerSize < uncompSize)
+        {
+            output[0] = static_cast<uint8_t>(RangeCoderBlockType::Coded);
+            size_t headerOffset = 1;
+            for (size_t remaining = uncompSize; ; remaining >>= 7)
+            {
+                const uint8_t more = (remaining >= 0x80) ? 0x80 : 0x00;
+                output[headerOffset++] = static_cast<uint8_t>(remaining & 0x7F) | more;
+                if (more == 0)
+                {
+                    break;
+                }
+            }
+
+            ByteModels models;
+            RangeEncoder encoder(output + headerSize, uncompSize - headerSize);
+            uint8_t previousByte = 0;
+            for (size_t i = 0; (i < uncompSize) && !encoder.HasOverflowed(); ++i)
+            {
+                uint16_t* probabilities = models.m_probabilities[GetContext(previousByte)];
+                const uint8_t value = input[i];
+                uint32_t node = 1;
+                for (int32_t bitIndex = 7; bitIndex >= 0; --bitIndex)
+                {
+                    const uint32_t bit = (value >> bitIndex) & 1;
+                    encoder.EncodeBit(probabilities[node], bit);
+                    node = (node << 1) | bit;
+                }
+                previousByte = value;
+            }
+            encoder.Flush();
+
+            if (!encoder.HasOverflowed())
+            {
+                compSize = headerSize + encoder.GetSize();
+                return AzNetworking::CompressorError::Ok;
+            }
+        }
+
+        // The input didn't compress, store it as is
+        output[0] = static_cast<uint8_t>(RangeCoderBlockType::Stored);
+        memcpy(output + 1, input, uncompSize);
+        compSize = uncompSize + 1;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError RangeCoderCompressor::Decompress
+    (
+        const void* compData,
+        size_t compDataSize,
+        void* uncompData,
+        size_t uncompDataSize,
+        size_t& consumedSizeOut,
+        size_t& uncompSizeOut
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compDataSize == 0)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed, input is empty");
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(compData);
+        uint8_t* output = reinterpret_cast<uint8_t*>(uncompData);
+        consumedSizeOut = compDataSize;
+
+        if (input[0] == static_cast<uint8_t>(RangeCoderBlockType::Stored))
+        {
+            const size_t storedSize = compDataSize - 1;
+            if (storedSize > uncompDataSize)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B)", compDataSize, uncompDataSize);
+                return AzNetworking::CompressorError::CorruptData;
+            }
+            memcpy(output, input + 1, storedSize);
+            uncompSizeOut = storedSize;
+            return AzNetworking::CompressorError::Ok;
+        }
+
+        if (input[0] != static_cast<uint8_t>(RangeCoderBlockType::Coded))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed, unknown block type %u", static_cast<uint32_t>(input[0]));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        size_t headerSize = 1;
+        size_t uncompSize = 0;
+        for (uint32_t shift = 0; ; shift += 7)
+        {
+            if ((headerSize >= compDataSize) || (headerSize > MaxVarintSize))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Decompression failed, malformed size header");
+                return AzNetworking::CompressorError::CorruptData;
+            }
+            const uint8_t value = input[headerSize++];
+            uncompSize |= static_cast<size_t>(value & 0x7F) << shift;
+            if ((value & 0x80) == 0)
+            {
+                break;
+            }
+        }
+
+        if (uncompSize > uncompDataSize)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for uncompDataSize:(%zu B) uncompSize:(%zu B)", uncompDataSize, uncompSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
+        ByteModels models;
+        RangeDecoder decoder(input + headerSize, compDataSize - headerSize);
+        uint8_t previousByte = 0;
+        for (size_t i = 0; i < uncompSize; ++i)
+        {
+            uint16_t* probabilities = models.m_probabilities[GetContext(previousByte)];
+            uint32_t node = 1;
+            for (uint32_t bitIndex = 0; bitIndex < 8; ++bitIndex)
+            {
+                node = (node << 1) | decoder.DecodeBit(probabilities[node]);
+            }
+            previousByte = static_cast<uint8_t>(node);
+            output[i] = previousByte;
+
+            if (decoder.IsCorrupt())
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Decompression failed, input ended after %zu of %zu bytes", i, uncompSize);
+                return AzNetworking::CompressorError::CorruptData;
+            }
+        }
+
+        uncompSizeOut = uncompSize;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
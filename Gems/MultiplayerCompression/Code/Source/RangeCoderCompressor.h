@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+namespace MultiplayerCompression
+{
+    static const char* RangeCoderCompressorName = "RangeCoder";
+    static const AzNetworking::CompressorType RangeCoderCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(RangeCoderCompressorName)));
+
+    /**
+    * Implements an adaptive binary range coder against Multiplayer's Compressor interface for use with AzNetworking.
+    * Replication packets are small and already bit-packed, which leaves little for a dictionary coder such as LZ4 to match.
+    * Instead every byte is coded bit by bit with probabilities that adapt quickly to the packet being compressed, using the
+    * previous byte as context, which captures the skewed distributions of quantized values, dirty bits and zeroed deltas.
+    * Each packet is coded independently, so packets can be dropped or reordered. Packets that don't shrink are stored as is,
+    * so the compressed size never exceeds the input size by more than a single byte.
+    */
+    class RangeCoderCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(RangeCoderCompressor, AZ::SystemAllocator);
+
+        RangeCoderCompressor() = default;
+
+        const char* GetName() const { return RangeCoderCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return RangeCoderCompressorType; };
+
+        bool Init() override { return true; }
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+    };
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <LZ4Compressor.h>
+#include <RangeCoderCompressor.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compresses and decompresses a corpus of replication packets with each of the multiplayer compressors.
+    //! The corpus is generated the way entity updates are serialized: every packet carries a number of entity deltas made of an
+    //! entity id, dirty bits and the quantized transform of an entity moving along a random walk.
+    //! The first benchmark argument selects the compressor, the second the number of entity deltas per packet.
+    class MultiplayerCompressionBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t PacketCount = 256;
+        static constexpr uint32_t MaxEntityCount = 64;
+
+        enum class Compressor
+        {
+            LZ4,
+            RangeCoder
+        };
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        struct EntityState
+        {
+            uint16_t m_netEntityId = 0;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_velocity = AZ::Vector3::CreateZero();
+            float m_yaw = 0.0f;
+            uint8_t m_health = 100;
+        };
+
+        void InternalSetUp(const benchmark::State& state)
+        {
+            if (state.range(0) == aznumeric_cast<int64_t>(Compressor::RangeCoder))
+            {
+                m_compressor = AZStd::make_unique<MultiplayerCompression::RangeCoderCompressor>();
+            }
+            else
+            {
+                m_compressor = AZStd::make_unique<MultiplayerCompression::LZ4Compressor>();
+            }
+
+            GenerateCorpus(aznumeric_cast<uint32_t>(state.range(1)));
+            m_compressedPackets.resize(m_packets.size());
+        }
+
+        void InternalTearDown()
+        {
+            m_compressor.reset();
+            m_packets = {};
+            m_compressedPackets = {};
+        }
+
+        void GenerateCorpus(uint32_t entitiesPerPacket)
+        {
+            AZ::SimpleLcgRandom random(1234);
+            EntityState entities[MaxEntityCount];
+            for (uint32_t i = 0; i < MaxEntityCount; ++i)
+            {
+                entities[i].m_netEntityId = aznumeric_cast<uint16_t>(i + 1);
+                entities[i].m_position = AZ::Vector3(random.GetRandomFloat() * 512.0f, random.GetRandomFloat() * 512.0f, 32.0f);
+            }
+
+            m_packets.resize(PacketCount);
+            for (AzNetworking::UdpPacketEncodingBuffer& packet : m_packets)
+            {
+                AzNetworking::NetworkInputSerializer inputSerializer(packet.GetBuffer(), aznumeric_cast<uint32_t>(packet.GetCapacity()));
+                AzNetworking::ISerializer& serializer = inputSerializer;
+                for (uint32_t i = 0; i < entitiesPerPacket; ++i)
+                {
+                    EntityState& entity = entities[random.GetRandom() % MaxEntityCount];
+                    entity.m_velocity += AZ::Vector3(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, 0.0f);
+                    entity.m_position += entity.m_velocity * 0.033f;
+                    entity.m_yaw += (random.GetRandomFloat() - 0.5f) * 0.1f;
+                    const bool healthChanged = (random.GetRandom() % 16) == 0;
+                    if (healthChanged)
+                    {
+                        entity.m_health = aznumeric_cast<uint8_t>(random.GetRandom() % 101);
+                    }
+
+                    uint8_t dirtyBits = healthChanged ? 0x07 : 0x03;
+                    AzNetworking::QuantizedValues<3, 2, -1024, 1024> position(entity.m_position);
+                    AzNetworking::QuantizedValues<1, 1, -4, 4> yaw(entity.m_yaw);
+                    serializer.Serialize(entity.m_netEntityId, "NetEntityId");
+                    serializer.Serialize(dirtyBits, "DirtyBits");
+                    position.Serialize(serializer);
+                    yaw.Serialize(serializer);
+                    if (healthChanged)
+                    {
+                        serializer.Serialize(entity.m_health, "Health");
+                    }
+                }
+                packet.Resize(serializer.GetSize());
+            }
+        }
+
+        void SetCounters(benchmark::State& state, size_t compressedBytes) const
+        {
+            size_t uncompressedBytes = 0;
+            for (const AzNetworking::UdpPacketEncodingBuffer& packet : m_packets)
+            {
+                uncompressedBytes += packet.GetSize();
+            }
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(state.iterations() * uncompressedBytes));
+            state.counters["CompressionRatio"] = static_cast<double>(compressedBytes) / static_cast<double>(uncompressedBytes);
+            state.counters["BytesPerPacket"] = static_cast<double>(compressedBytes) / static_cast<double>(m_packets.size());
+        }
+
+        size_t CompressCorpus()
+        {
+            size_t compressedBytes = 0;
+            for (size_t i = 0; i < m_packets.size(); ++i)
+            {
+                size_t compressedSize = 0;
+                AzNetworking::UdpPacketEncodingBuffer& compressed = m_compressedPackets[i];
+                m_compressor->Compress(m_packets[i].GetBuffer(), m_packets[i].GetSize(), compressed.GetBuffer(), compressed.GetCapacity(), compressedSize);
+                compressed.Resize(compressedSize);
+                compressedBytes += compressedSize;
+            }
+            return compressedBytes;
+        }
+
+        AZStd::unique_ptr<AzNetworking::ICompressor> m_compressor;
+        AZStd::vector<AzNetworking::UdpPacketEncodingBuffer> m_packets;
+        AZStd::vector<AzNetworking::UdpPacketEncodingBuffer> m_compressedPackets;
+    };
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, Compress)(benchmark::State& state)
+    {
+        size_t compressedBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            compressedBytes = CompressCorpus();
+            benchmark::DoNotOptimize(compressedBytes);
+        }
+        SetCounters(state, compressedBytes);
+    }
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, Decompress)(benchmark::State& state)
+    {
+        const size_t compressedBytes = CompressCorpus();
+        AzNetworking::UdpPacketEncodingBuffer decompressed;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AzNetworking::UdpPacketEncodingBuffer& compressed : m_compressedPackets)
+            {
+                size_t consumedSize = 0;
+                size_t uncompressedSize = 0;
+                m_compressor->Decompress(compressed.GetBuffer(), compressed.GetSize(), decompressed.GetBuffer(), decompressed.GetCapacity(), consumedSize, uncompressedSize);
+                benchmark::DoNotOptimize(uncompressedSize);
+            }
+        }
+        SetCounters(state, compressedBytes);
+    }
+
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, Compress)
+        ->ArgNames({ "RangeCoder", "Entities" })
+        ->Args({ 0, 4 })->Args({ 1, 4 })
+        ->Args({ 0, 32 })->Args({ 1, 32 })
+        ->Args({ 0, 64 })->Args({ 1, 64 })
+        ;
+
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, Decompress)
+        ->ArgNames({ "RangeCoder", "Entities" })
+        ->Args({ 0, 4 })->Args({ 1, 4 })
+        ->Args({ 0, 32 })->Args({ 1, 32 })
+        ->Args({ 0, 64 })->Args({ 1, 64 })
+        ;
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
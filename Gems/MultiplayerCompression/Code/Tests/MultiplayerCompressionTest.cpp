@@ -10,6 +10,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <RangeCoderCompressor.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
@@ -115,4 +116,85 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, RangeCoderCompression_RoundTripTest)
+{
+    // Mostly zeroed data with a few small values, similar to a bit-packed delta
+    uint8_t input[1024] = {};
+    for (uint32_t i = 0; i < AZ_ARRAY_SIZE(input); i += 13)
+    {
+        input[i] = static_cast<uint8_t>(i & 0x0F);
+    }
+
+    MultiplayerCompression::RangeCoderCompressor compressor;
+    uint8_t compressed[AZ_ARRAY_SIZE(input) + 1];
+    size_t compressedSize = 0;
+    EXPECT_EQ(compressor.Compress(input, sizeof(input), compressed, sizeof(compressed), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, sizeof(input) / 4);
+
+    uint8_t decompressed[AZ_ARRAY_SIZE(input)];
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    EXPECT_EQ(compressor.Decompress(compressed, compressedSize, decompressed, sizeof(decompressed), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, sizeof(input));
+    EXPECT_EQ(consumedSize, compressedSize);
+    EXPECT_EQ(memcmp(input, decompressed, sizeof(input)), 0);
+
+    // Truncated input must be rejected rather than decoded into garbage
+    EXPECT_EQ(compressor.Decompress(compressed, compressedSize / 2, decompressed, sizeof(decompressed), consumedSize, uncompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, RangeCoderCompression_IncompressibleTest)
+{
+    uint8_t input[256];
+    for (uint32_t i = 0; i < AZ_ARRAY_SIZE(input); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i * 167 + 13);
+    }
+
+    // Data that doesn't compress is stored with a single byte of overhead
+    MultiplayerCompression::RangeCoderCompressor compressor;
+    uint8_t compressed[AZ_ARRAY_SIZE(input) + 1];
+    size_t compressedSize = 0;
+    EXPECT_EQ(compressor.Compress(input, sizeof(input), compressed, sizeof(compressed), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_LE(compressedSize, sizeof(input) + 1);
+
+    uint8_t decompressed[AZ_ARRAY_SIZE(input)];
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    EXPECT_EQ(compressor.Decompress(compressed, compressedSize, decompressed, sizeof(decompressed), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, sizeof(input));
+    EXPECT_EQ(memcmp(input, decompressed, sizeof(input)), 0);
+
+    // Insufficient output space is reported rather than overrun
+    EXPECT_EQ(compressor.Compress(input, sizeof(input), compressed, sizeof(input), compressedSize), AzNetworking::CompressorError::InsufficientBuffer);
+}
+
+TEST_F(MultiplayerCompressionTest, RangeCoderCompression_EmptyAndTinyInputTest)
+{
+    // The worst case buffer for inputs too small to code leaves no room for the coded header, they have to be stored
+    MultiplayerCompression::RangeCoderCompressor compressor;
+    const uint8_t input[] = { 0x5A, 0xA5 };
+    for (size_t inputSize = 0; inputSize <= sizeof(input); ++inputSize)
+    {
+        const size_t maxCompressedSize = compressor.GetMaxCompressedBufferSize(inputSize);
+        // Guard bytes past the worst case size catch writes beyond the end of the output
+        uint8_t compressed[AZ_ARRAY_SIZE(input) + 1 + 4];
+        memset(compressed, 0xCD, sizeof(compressed));
+        size_t compressedSize = 0;
+        EXPECT_EQ(compressor.Compress(input, inputSize, compressed, maxCompressedSize, compressedSize), AzNetworking::CompressorError::Ok);
+        EXPECT_LE(compressedSize, maxCompressedSize);
+        for (size_t i = maxCompressedSize; i < sizeof(compressed); ++i)
+        {
+            EXPECT_EQ(compressed[i], 0xCD);
+        }
+
+        uint8_t decompressed[AZ_ARRAY_SIZE(input)] = {};
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 1;
+        EXPECT_EQ(compressor.Decompress(compressed, compressedSize, decompressed, sizeof(decompressed), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        EXPECT_EQ(uncompressedSize, inputSize);
+        EXPECT_EQ(memcmp(input, decompressed, inputSize), 0);
+    }
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
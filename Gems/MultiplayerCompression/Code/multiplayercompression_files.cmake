@@ -13,4 +13,6 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/RangeCoderCompressor.cpp
+    Source/RangeCoderCompressor.h
 )
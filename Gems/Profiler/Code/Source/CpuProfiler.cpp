@@ -11,12 +11,26 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/time.h>
 
+AZ_DEFINE_BUDGET(Profiler);
+
 namespace Profiler
 {
     thread_local CpuTimingLocalStorage* CpuProfiler::ms_threadLocalStorage = nullptr;
+    thread_local CpuProfiler::TraceThreadBuffer CpuProfiler::ms_traceThreadBuffer;
+
+    // Capture ids are unique across profiler instances so thread local buffers of a previous instance are never reused
+    static AZStd::atomic<uint64_t> s_nextTraceCaptureId{ 1 };
+
+    // How often the consolidation thread moves events out of the per-thread buffers
+    static constexpr AZStd::chrono::milliseconds TraceConsolidationInterval{ 2 };
+
+    // Number of profile scopes that are timed to measure the overhead of a trace capture
+    static constexpr uint32_t TraceOverheadScopeCount = 1024;
+    static_assert(TraceOverheadScopeCount * 2 < CpuTraceEventBuffer::Capacity, "The measured scopes have to fit in a trace buffer.");
 
     // --- CachedTimeRegion ---
 
@@ -75,6 +89,18 @@ namespace Profiler
         // When this call is made, no more thread profiling calls can be performed anymore
         AZ::Interface<AZ::Debug::Profiler>::Unregister(this);
 
+        if (IsTraceCaptureInProgress())
+        {
+            CpuTraceCapture discardedCapture;
+            EndTraceCapture(discardedCapture);
+        }
+
+        // Trace recording doesn't take the shutdown lock, wait for the threads that are still pushing to a retired buffer instead
+        while (!FreeRetiredTraceBuffers())
+        {
+            AZStd::this_thread::yield();
+        }
+
         // Wait for the remaining threads that might still be processing its profiling calls
         AZStd::unique_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
 
@@ -91,6 +117,21 @@ namespace Profiler
 
     void CpuProfiler::BeginRegion(const AZ::Debug::Budget* budget, const char* eventName, ...)
     {
+        // Trace captures skip the shutdown lock and the time region maps, recording only touches the thread's own buffer
+        if (m_traceCaptureInProgress.load(AZStd::memory_order_acquire))
+        {
+            ++ms_traceThreadBuffer.m_openRegions;
+            if (CpuTraceEventBuffer* traceBuffer = AcquireTraceEventBuffer(true))
+            {
+                va_list args;
+                va_start(args, eventName);
+                traceBuffer->PushBegin(budget->Name(), eventName, args);
+                va_end(args);
+                ReleaseTraceEventBuffer();
+            }
+            return;
+        }
+
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
@@ -111,6 +152,18 @@ namespace Profiler
 
     void CpuProfiler::EndRegion([[maybe_unused]] const AZ::Debug::Budget* budget)
     {
+        // Regions that began before the trace capture started still end on the time region stack
+        if (ms_traceThreadBuffer.m_openRegions > 0)
+        {
+            --ms_traceThreadBuffer.m_openRegions;
+            if (CpuTraceEventBuffer* traceBuffer = AcquireTraceEventBuffer(false))
+            {
+                traceBuffer->PushEnd();
+                ReleaseTraceEventBuffer();
+            }
+            return;
+        }
+
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
@@ -171,6 +224,84 @@ namespace Profiler
         return m_continuousCaptureInProgress.load();
     }
 
+    bool CpuProfiler::BeginTraceCapture()
+    {
+        if (m_continuousCaptureInProgress.load())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to start a trace capture while a continuous capture is in progress\n");
+            return false;
+        }
+
+        if (m_traceCaptureInProgress.load() || m_traceConsolidationThread.joinable())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to start a trace capture while one already in progress\n");
+            return false;
+        }
+
+        m_traceThreadEvents.clear();
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+            m_traceCaptureId.store(s_nextTraceCaptureId.fetch_add(1));
+            m_traceCaptureInProgress.store(true, AZStd::memory_order_release);
+        }
+
+        // Measured before the consolidation thread starts, which makes this thread the only consumer of its own buffer
+        m_traceScopeOverheadNs = MeasureTraceScopeOverhead();
+        AZ_TracePrintf("Profiler", "Trace capture started, measured overhead per profile scope is %.1f ns\n", m_traceScopeOverheadNs);
+
+        m_traceConsolidationThread = AZStd::thread(
+            [this]()
+            {
+                while (m_traceCaptureInProgress.load(AZStd::memory_order_acquire))
+                {
+                    DrainTraceEventBuffers();
+                    FreeRetiredTraceBuffers();
+                    AZStd::this_thread::sleep_for(TraceConsolidationInterval);
+                }
+            });
+        return true;
+    }
+
+    bool CpuProfiler::EndTraceCapture(CpuTraceCapture& flushTarget)
+    {
+        bool expected = true;
+        if (!m_traceCaptureInProgress.compare_exchange_strong(expected, false))
+        {
+            AZ_TracePrintf("Profiler", "Attempting to end a trace capture while one not in progress\n");
+            return false;
+        }
+
+        if (m_traceConsolidationThread.joinable())
+        {
+            m_traceConsolidationThread.join();
+        }
+        DrainTraceEventBuffers();
+
+        // Retire the buffers. Changing the capture id stops threads from picking up their buffer again, but a thread can still
+        // be in the middle of a push, so the buffers are only freed once their producer has been seen inactive.
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+            m_traceCaptureId.store(s_nextTraceCaptureId.fetch_add(1));
+            for (auto& buffer : m_traceBuffers)
+            {
+                m_retiredTraceBuffers.push_back(AZStd::move(buffer));
+            }
+            m_traceBuffers.clear();
+        }
+
+        flushTarget.m_threads = AZStd::move(m_traceThreadEvents);
+        flushTarget.m_ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+        flushTarget.m_scopeOverheadNs = m_traceScopeOverheadNs;
+        m_traceThreadEvents = {};
+        AZ_TracePrintf("Profiler", "Trace capture ended\n");
+        return true;
+    }
+
+    bool CpuProfiler::IsTraceCaptureInProgress() const
+    {
+        return m_traceCaptureInProgress.load();
+    }
+
     void CpuProfiler::SetProfilerEnabled(bool enabled)
     {
         AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
@@ -253,6 +384,122 @@ namespace Profiler
         }
     }
 
+    CpuTraceEventBuffer* CpuProfiler::AcquireTraceEventBuffer(bool create)
+    {
+        uint64_t captureId = m_traceCaptureId.load(AZStd::memory_order_acquire);
+        if (ms_traceThreadBuffer.m_captureId != captureId)
+        {
+            if (!create)
+            {
+                return nullptr;
+            }
+
+            // Only happens once per thread per capture
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+            if (!m_traceCaptureInProgress.load())
+            {
+                return nullptr;
+            }
+            const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+            AZStd::unique_ptr<TraceThreadRecord>& record = m_traceThreadRecords[threadId];
+            if (!record)
+            {
+                record = AZStd::make_unique<TraceThreadRecord>();
+            }
+            captureId = m_traceCaptureId.load();
+            ms_traceThreadBuffer.m_captureId = captureId;
+            ms_traceThreadBuffer.m_buffer = m_traceBuffers.emplace_back(AZStd::make_unique<CpuTraceEventBuffer>(threadId)).get();
+            ms_traceThreadBuffer.m_record = record.get();
+        }
+
+        // Publish the buffer before checking that the capture didn't end. Both are sequentially consistent, and EndTraceCapture
+        // changes the capture id before FreeRetiredTraceBuffers reads the records. So either this thread sees the new id and
+        // doesn't touch the buffer, or FreeRetiredTraceBuffers sees the buffer in the record and keeps it.
+        // The record outlives the buffer, so nothing is written to memory that can be freed in the meantime.
+        CpuTraceEventBuffer* buffer = ms_traceThreadBuffer.m_buffer;
+        ms_traceThreadBuffer.m_record->m_activeBuffer.store(buffer);
+        if (m_traceCaptureId.load() != captureId)
+        {
+            ms_traceThreadBuffer.m_record->m_activeBuffer.store(nullptr, AZStd::memory_order_release);
+            return nullptr;
+        }
+        return buffer;
+    }
+
+    void CpuProfiler::ReleaseTraceEventBuffer()
+    {
+        ms_traceThreadBuffer.m_record->m_activeBuffer.store(nullptr, AZStd::memory_order_release);
+    }
+
+    void CpuProfiler::DrainTraceEventBuffers()
+    {
+        // Only take the lock to grab the buffers, draining happens without blocking threads that register a new buffer
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+            m_traceDrainBuffers.clear();
+            for (const auto& buffer : m_traceBuffers)
+            {
+                m_traceDrainBuffers.push_back(buffer.get());
+            }
+        }
+
+        m_traceThreadEvents.resize(AZStd::max(m_traceThreadEvents.size(), m_traceDrainBuffers.size()));
+        for (size_t index = 0; index < m_traceDrainBuffers.size(); ++index)
+        {
+            CpuTraceThreadEvents& threadEvents = m_traceThreadEvents[index];
+            threadEvents.m_threadId = m_traceDrainBuffers[index]->GetThreadId();
+            m_traceDrainBuffers[index]->Drain(threadEvents.m_events);
+            threadEvents.m_droppedEvents = m_traceDrainBuffers[index]->GetDroppedEventCount();
+        }
+    }
+
+    bool CpuProfiler::FreeRetiredTraceBuffers()
+    {
+        // Declared before the lock so the buffers are freed after it's released
+        AZStd::vector<AZStd::unique_ptr<CpuTraceEventBuffer>> freedBuffers;
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+        for (auto it = m_retiredTraceBuffers.begin(); it != m_retiredTraceBuffers.end();)
+        {
+            const bool inUse = AZStd::any_of(
+                m_traceThreadRecords.begin(), m_traceThreadRecords.end(),
+                [buffer = it->get()](const auto& record)
+                {
+                    return record.second->m_activeBuffer.load() == buffer;
+                });
+            if (inUse)
+            {
+                ++it;
+            }
+            else
+            {
+                freedBuffers.push_back(AZStd::move(*it));
+                it = m_retiredTraceBuffers.erase(it);
+            }
+        }
+        return m_retiredTraceBuffers.empty();
+    }
+
+    double CpuProfiler::MeasureTraceScopeOverhead()
+    {
+        const AZStd::sys_time_t startTick = AZStd::GetTimeNowTicks();
+        for (uint32_t i = 0; i < TraceOverheadScopeCount; ++i)
+        {
+            AZ_PROFILE_SCOPE(Profiler, "MeasureOverhead %u", i);
+        }
+        const AZStd::sys_time_t endTick = AZStd::GetTimeNowTicks();
+
+        // Remove the measured scopes from the capture again
+        if (CpuTraceEventBuffer* traceBuffer = AcquireTraceEventBuffer(false))
+        {
+            AZStd::vector<CpuTraceEvent> discardedEvents;
+            traceBuffer->Drain(discardedEvents);
+            ReleaseTraceEventBuffer();
+        }
+
+        const double ticksPerNs = aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1'000'000'000.0;
+        return aznumeric_cast<double>(endTick - startTick) / ticksPerNs / TraceOverheadScopeCount;
+    }
+
     // --- CpuTimingLocalStorage ---
 
     CpuTimingLocalStorage::CpuTimingLocalStorage()
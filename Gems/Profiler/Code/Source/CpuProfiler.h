@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <CpuTraceCapture.h>
+
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -155,6 +157,13 @@ namespace Profiler
         //! that the profiler is active if returns True.
         bool IsContinuousCaptureInProgress() const;
 
+        //! Starting/ending a trace capture. Unlike the continuous capture, a trace capture records fixed size events
+        //! into lock-free per-thread buffers, which are consolidated by a separate thread. No time region maps are
+        //! built while a trace capture is in progress.
+        bool BeginTraceCapture();
+        bool EndTraceCapture(CpuTraceCapture& flushTarget);
+        bool IsTraceCaptureInProgress() const;
+
         //! Getter/setter for the profiler active state
         void SetProfilerEnabled(bool enabled);
         bool IsProfilerEnabled() const;
@@ -171,6 +180,21 @@ namespace Profiler
         // Lazily create and register the local thread data
         void RegisterThreadStorage();
 
+        // Returns the calling thread's trace buffer for the current trace capture, published in the thread's trace record so it
+        // isn't freed while in use. Creates it if requested. Returns nullptr if the thread has no buffer or the capture ended.
+        // Must be followed by ReleaseTraceEventBuffer.
+        CpuTraceEventBuffer* AcquireTraceEventBuffer(bool create);
+        void ReleaseTraceEventBuffer();
+
+        // Moves the recorded events of all trace buffers into the consolidated trace data.
+        void DrainTraceEventBuffers();
+
+        // Frees the buffers of finished trace captures that no thread record refers to anymore. Returns true if all were freed.
+        bool FreeRetiredTraceBuffers();
+
+        // Times AZ_PROFILE_SCOPE on the calling thread while the trace capture is recording and discards the recorded events.
+        double MeasureTraceScopeOverhead();
+
         // ThreadId -> ThreadTimeRegionMap
         // On the start of each frame, this map will be updated with the last frame's profiling data.
         TimeRegionMap m_timeRegionMap;
@@ -197,6 +221,47 @@ namespace Profiler
         // Stores multiple frames of profiling data, size is controlled by MaxFramesToSave. Flushed when EndContinuousCapture is called.
         // Ring buffer so that we can have fast append of new data + removal of old profiling data with good cache locality.
         AZStd::ring_buffer<TimeRegionMap> m_continuousCaptureData;
+
+        // Buffer a thread is pushing to. Kept by the profiler instead of in the buffer, because the buffer of a finished capture
+        // can be freed while a thread is about to use it. A record is reused by the next thread with the same id, and is only
+        // freed with the profiler, after every thread stopped recording.
+        struct TraceThreadRecord
+        {
+            AZ_CLASS_ALLOCATOR(TraceThreadRecord, AZ::SystemAllocator);
+
+            AZStd::atomic<CpuTraceEventBuffer*> m_activeBuffer{ nullptr };
+        };
+
+        struct TraceThreadBuffer
+        {
+            uint64_t m_captureId = 0;
+            CpuTraceEventBuffer* m_buffer = nullptr;
+            TraceThreadRecord* m_record = nullptr;
+            // Regions of the thread that began in a trace capture and haven't ended yet. Their end goes to the trace buffer,
+            // even if the capture ended in the meantime, so they never pop a region off the time region stack.
+            uint32_t m_openRegions = 0;
+        };
+
+        // Thread local trace buffer, only valid while its capture id matches m_traceCaptureId
+        static thread_local TraceThreadBuffer ms_traceThreadBuffer;
+
+        AZStd::atomic_bool m_traceCaptureInProgress = false;
+        // Changed when a trace capture begins and again when it ends, which retires the thread local buffers of the capture.
+        AZStd::atomic<uint64_t> m_traceCaptureId = 0;
+
+        // The buffers of the trace capture in progress.
+        AZStd::vector<AZStd::unique_ptr<CpuTraceEventBuffer>> m_traceBuffers;
+        // Buffers of finished trace captures. A thread might still be in the middle of a push, so they're only freed by the
+        // consolidation thread of the next capture or on shutdown, once no thread record refers to them.
+        AZStd::vector<AZStd::unique_ptr<CpuTraceEventBuffer>> m_retiredTraceBuffers;
+        // Records of all threads that recorded into a trace capture.
+        AZStd::unordered_map<AZStd::thread_id, AZStd::unique_ptr<TraceThreadRecord>> m_traceThreadRecords;
+
+        // Only accessed by the consolidation thread while a trace capture is in progress.
+        AZStd::vector<CpuTraceThreadEvents> m_traceThreadEvents;
+        AZStd::vector<CpuTraceEventBuffer*> m_traceDrainBuffers;
+        AZStd::thread m_traceConsolidationThread;
+        double m_traceScopeOverheadNs = 0.0;
     };
 
     // Intermediate class to serialize Cpu TimedRegion data.
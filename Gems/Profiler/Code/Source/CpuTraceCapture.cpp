@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuTraceCapture.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace Profiler
+{
+    // --- CpuTraceEventBuffer ---
+
+    CpuTraceEventBuffer::CpuTraceEventBuffer(AZStd::thread_id threadId)
+        : m_events(AZStd::make_unique<CpuTraceEvent[]>(Capacity))
+        , m_threadId(threadId)
+    {
+    }
+
+    CpuTraceEvent* CpuTraceEventBuffer::AcquireSlot(uint32_t requiredSlots)
+    {
+        // Only reload the consumer's index when the cached one says the buffer is full, so in the common
+        // case the producer never touches the consumer's cache line.
+        const uint32_t head = m_head.load(AZStd::memory_order_relaxed);
+        if (Capacity - (head - m_cachedTail) < requiredSlots)
+        {
+            m_cachedTail = m_tail.load(AZStd::memory_order_acquire);
+            if (Capacity - (head - m_cachedTail) < requiredSlots)
+            {
+                return nullptr;
+            }
+        }
+        return &m_events[head & (Capacity - 1)];
+    }
+
+    void CpuTraceEventBuffer::CommitSlot()
+    {
+        m_head.store(m_head.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_release);
+    }
+
+    void CpuTraceEventBuffer::PushBegin(const char* groupName, const char* eventName, va_list args)
+    {
+        const uint32_t depth = m_stackDepth++;
+        if (m_droppedDepth != NoDroppedDepth)
+        {
+            m_droppedEvents.fetch_add(1, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        // Reserve room for the end events of all open regions, including this one, so end events can never be dropped.
+        CpuTraceEvent* event = AcquireSlot(depth + 2);
+        if (event == nullptr)
+        {
+            m_droppedDepth = depth;
+            m_droppedEvents.fetch_add(1, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        event->m_type = CpuTraceEvent::Type::Begin;
+        event->m_groupName = groupName;
+        event->m_stackDepth = aznumeric_cast<uint8_t>(AZStd::min(depth, 255u));
+        azvsnprintf(event->m_name, CpuTraceEvent::MaxNameLength, eventName, args);
+
+        // Set the starting time at the end, to avoid recording the minor overhead
+        event->m_tick = AZStd::GetTimeNowTicks();
+        CommitSlot();
+    }
+
+    void CpuTraceEventBuffer::PushEnd()
+    {
+        // Get the end timestamp first, to avoid recording the minor overhead
+        const AZStd::sys_time_t endTick = AZStd::GetTimeNowTicks();
+
+        // The region started before the capture did
+        if (m_stackDepth == 0)
+        {
+            return;
+        }
+
+        const uint32_t depth = --m_stackDepth;
+        if (m_droppedDepth != NoDroppedDepth)
+        {
+            m_droppedEvents.fetch_add(1, AZStd::memory_order_relaxed);
+            if (depth == m_droppedDepth)
+            {
+                m_droppedDepth = NoDroppedDepth;
+            }
+            return;
+        }
+
+        CpuTraceEvent* event = AcquireSlot(1);
+        AZ_Assert(event, "No slot was reserved for the end event of a recorded trace region.");
+        event->m_type = CpuTraceEvent::Type::End;
+        event->m_groupName = nullptr;
+        event->m_stackDepth = aznumeric_cast<uint8_t>(AZStd::min(depth, 255u));
+        event->m_name[0] = '\0';
+        event->m_tick = endTick;
+        CommitSlot();
+    }
+
+    size_t CpuTraceEventBuffer::Drain(AZStd::vector<CpuTraceEvent>& target)
+    {
+        const uint32_t tail = m_tail.load(AZStd::memory_order_relaxed);
+        const uint32_t head = m_head.load(AZStd::memory_order_acquire);
+        const uint32_t count = head - tail;
+        target.reserve(target.size() + count);
+        for (uint32_t index = tail; index != head; ++index)
+        {
+            target.push_back(m_events[index & (Capacity - 1)]);
+        }
+        m_tail.store(head, AZStd::memory_order_release);
+        return count;
+    }
+
+    AZStd::thread_id CpuTraceEventBuffer::GetThreadId() const
+    {
+        return m_threadId;
+    }
+
+    uint64_t CpuTraceEventBuffer::GetDroppedEventCount() const
+    {
+        return m_droppedEvents.load(AZStd::memory_order_relaxed);
+    }
+
+    // --- Export ---
+
+    namespace Internal
+    {
+        // Maps strings to indices in the order they were first encountered.
+        class StringTable
+        {
+        public:
+            uint32_t Add(AZStd::string_view value)
+            {
+                auto [it, inserted] = m_indices.try_emplace(value, aznumeric_cast<uint32_t>(m_strings.size()));
+                if (inserted)
+                {
+                    m_strings.push_back(value);
+                }
+                return it->second;
+            }
+
+            const AZStd::vector<AZStd::string_view>& GetStrings() const
+            {
+                return m_strings;
+            }
+
+        private:
+            AZStd::unordered_map<AZStd::string_view, uint32_t> m_indices;
+            AZStd::vector<AZStd::string_view> m_strings;
+        };
+
+        static void AppendJsonEscaped(AZStd::string& output, AZStd::string_view value)
+        {
+            for (char character : value)
+            {
+                switch (character)
+                {
+                case '"':
+                    output += "\\\"";
+                    break;
+                case '\\':
+                    output += "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20)
+                    {
+                        output += AZStd::string::format("\\u%04x", character);
+                    }
+                    else
+                    {
+                        output += character;
+                    }
+                    break;
+                }
+            }
+        }
+
+        static bool WriteToStream(AZ::IO::FileIOStream& stream, const void* data, size_t size)
+        {
+            return stream.Write(size, data) == size;
+        }
+    } // namespace Internal
+
+    bool SaveCpuTraceBinary(const CpuTraceCapture& capture, const char* outputFilePath)
+    {
+        Internal::StringTable stringTable;
+        AZStd::vector<CpuTraceFileEvent> fileEvents;
+
+        for (size_t threadIndex = 0; threadIndex < capture.m_threads.size(); ++threadIndex)
+        {
+            for (const CpuTraceEvent& event : capture.m_threads[threadIndex].m_events)
+            {
+                CpuTraceFileEvent& fileEvent = fileEvents.emplace_back();
+                fileEvent.m_tick = aznumeric_cast<uint64_t>(event.m_tick);
+                fileEvent.m_threadIndex = aznumeric_cast<uint16_t>(threadIndex);
+                fileEvent.m_type = static_cast<uint8_t>(event.m_type);
+                fileEvent.m_stackDepth = event.m_stackDepth;
+                if (event.m_type == CpuTraceEvent::Type::Begin)
+                {
+                    fileEvent.m_nameIndex = stringTable.Add(
+                        AZStd::string_view(event.m_name, strnlen(event.m_name, CpuTraceEvent::MaxNameLength)));
+                    fileEvent.m_groupIndex = event.m_groupName ? stringTable.Add(event.m_groupName) : CpuTraceFileEvent::NoString;
+                }
+            }
+        }
+
+        AZ::IO::FileIOStream stream(outputFilePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
+        CpuTraceFileHeader header;
+        header.m_ticksPerSecond = aznumeric_cast<uint64_t>(capture.m_ticksPerSecond);
+        header.m_eventCount = fileEvents.size();
+        header.m_stringCount = aznumeric_cast<uint32_t>(stringTable.GetStrings().size());
+        header.m_threadCount = aznumeric_cast<uint32_t>(capture.m_threads.size());
+        header.m_scopeOverheadNs = capture.m_scopeOverheadNs;
+        bool result = Internal::WriteToStream(stream, &header, sizeof(header));
+
+        for (AZStd::string_view string : stringTable.GetStrings())
+        {
+            const uint16_t length = aznumeric_cast<uint16_t>(AZStd::min<size_t>(string.size(), AZStd::numeric_limits<uint16_t>::max()));
+            result = result && Internal::WriteToStream(stream, &length, sizeof(length));
+            result = result && Internal::WriteToStream(stream, string.data(), length);
+        }
+
+        for (const CpuTraceThreadEvents& thread : capture.m_threads)
+        {
+            const uint64_t threadId = AZStd::hash<AZStd::thread_id>{}(thread.m_threadId);
+            result = result && Internal::WriteToStream(stream, &threadId, sizeof(threadId));
+            result = result && Internal::WriteToStream(stream, &thread.m_droppedEvents, sizeof(thread.m_droppedEvents));
+        }
+
+        result = result && Internal::WriteToStream(stream, fileEvents.data(), fileEvents.size() * sizeof(CpuTraceFileEvent));
+        return result;
+    }
+
+    bool SaveCpuTraceChromeJson(const CpuTraceCapture& capture, const char* outputFilePath)
+    {
+        AZ::IO::FileIOStream stream(outputFilePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
+        // Chrome trace timestamps are in microseconds.
+        const double ticksToMicroseconds = 1'000'000.0 / aznumeric_cast<double>(capture.m_ticksPerSecond);
+
+        // Write in chunks to keep the memory usage of large captures bounded.
+        constexpr size_t FlushSize = 1024 * 1024;
+        AZStd::string output;
+        output.reserve(FlushSize + 512);
+        output += "{\"traceEvents\":[";
+
+        bool result = true;
+        bool firstEvent = true;
+        for (const CpuTraceThreadEvents& thread : capture.m_threads)
+        {
+            const size_t threadId = AZStd::hash<AZStd::thread_id>{}(thread.m_threadId);
+            for (const CpuTraceEvent& event : thread.m_events)
+            {
+                output += firstEvent ? "\n" : ",\n";
+                firstEvent = false;
+
+                const double timestamp = aznumeric_cast<double>(event.m_tick) * ticksToMicroseconds;
+                if (event.m_type == CpuTraceEvent::Type::Begin)
+                {
+                    output += "{\"ph\":\"B\",\"name\":\"";
+                    Internal::AppendJsonEscaped(output, AZStd::string_view(event.m_name, strnlen(event.m_name, CpuTraceEvent::MaxNameLength)));
+                    output += "\",\"cat\":\"";
+                    Internal::AppendJsonEscaped(output, event.m_groupName ? event.m_groupName : "");
+                    output += AZStd::string::format("\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f}", threadId, timestamp);
+                }
+                else
+                {
+                    output += AZStd::string::format("{\"ph\":\"E\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f}", threadId, timestamp);
+                }
+
+                if (output.size() >= FlushSize)
+                {
+                    result = result && Internal::WriteToStream(stream, output.data(), output.size());
+                    output.clear();
+                }
+            }
+        }
+
+        output += "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{";
+        output += AZStd::string::format("\"scopeOverheadNs\":%.2f", capture.m_scopeOverheadNs);
+        for (const CpuTraceThreadEvents& thread : capture.m_threads)
+        {
+            if (thread.m_droppedEvents > 0)
+            {
+                output += AZStd::string::format(",\"droppedEvents_%zu\":%llu",
+                    AZStd::hash<AZStd::thread_id>{}(thread.m_threadId), static_cast<unsigned long long>(thread.m_droppedEvents));
+            }
+        }
+        output += "}}\n";
+        result = result && Internal::WriteToStream(stream, output.data(), output.size());
+        return result;
+    }
+} // namespace Profiler
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+#include <stdarg.h>
+
+namespace Profiler
+{
+    //! Fixed size event that is written by the trace capture mode of the CpuProfiler.
+    //! Region names are formatted directly into the event so recording never allocates or touches shared state.
+    struct alignas(64) CpuTraceEvent
+    {
+        enum class Type : uint8_t
+        {
+            Begin,
+            End
+        };
+
+        static constexpr size_t MaxNameLength = 46;
+
+        AZStd::sys_time_t m_tick = 0;
+        //! Budget name of the region, only set for Begin events. Assumed to be a global string, see CachedTimeRegion::GroupRegionName.
+        const char* m_groupName = nullptr;
+        Type m_type = Type::Begin;
+        uint8_t m_stackDepth = 0;
+        char m_name[MaxNameLength] = {};
+    };
+    static_assert(sizeof(CpuTraceEvent) == 64, "CpuTraceEvent is expected to fill exactly one cache line.");
+
+    //! Single producer, single consumer ring buffer of trace events.
+    //! The owning thread is the only producer and the consolidation thread of the CpuProfiler the only consumer,
+    //! so both sides only need atomic loads and stores on their own index. When the buffer is full new events are
+    //! dropped and counted instead of blocking the profiled thread.
+    class CpuTraceEventBuffer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CpuTraceEventBuffer, AZ::SystemAllocator);
+
+        //! Number of events per thread. Must be a power of two.
+        static constexpr uint32_t Capacity = 1u << 14;
+
+        explicit CpuTraceEventBuffer(AZStd::thread_id threadId);
+
+        //! Producer side, only to be called from the owning thread.
+        void PushBegin(const char* groupName, const char* eventName, va_list args);
+        void PushEnd();
+
+        //! Consumer side. Moves all available events into the target and returns the number of moved events.
+        size_t Drain(AZStd::vector<CpuTraceEvent>& target);
+
+        AZStd::thread_id GetThreadId() const;
+        uint64_t GetDroppedEventCount() const;
+
+    private:
+        static constexpr uint32_t NoDroppedDepth = ~0u;
+
+        CpuTraceEvent* AcquireSlot(uint32_t requiredSlots);
+        void CommitSlot();
+
+        AZStd::unique_ptr<CpuTraceEvent[]> m_events;
+        AZStd::thread_id m_threadId;
+
+        // Producer owned cache line.
+        alignas(64) AZStd::atomic<uint32_t> m_head{ 0 };
+        uint32_t m_cachedTail = 0;
+        uint32_t m_stackDepth = 0;
+        // Depth of the outermost begin event that was dropped. Everything until its end event is dropped as well
+        // so the recorded begin and end events always stay balanced.
+        uint32_t m_droppedDepth = NoDroppedDepth;
+        AZStd::atomic<uint64_t> m_droppedEvents{ 0 };
+
+        // Consumer owned cache line.
+        alignas(64) AZStd::atomic<uint32_t> m_tail{ 0 };
+    };
+
+    //! The consolidated events of a single thread in a trace capture.
+    struct CpuTraceThreadEvents
+    {
+        AZStd::thread_id m_threadId;
+        AZStd::vector<CpuTraceEvent> m_events;
+        uint64_t m_droppedEvents = 0;
+    };
+
+    //! Result of a trace capture, ready to be exported.
+    struct CpuTraceCapture
+    {
+        AZStd::vector<CpuTraceThreadEvents> m_threads;
+        AZStd::sys_time_t m_ticksPerSecond = 0;
+        //! Measured cost of recording a single AZ_PROFILE_SCOPE (one begin and one end event) in nanoseconds.
+        double m_scopeOverheadNs = 0.0;
+    };
+
+    //! Writes the capture as a compact binary file.
+    //! The layout is a CpuTraceFileHeader, followed by the string table (uint16_t length + characters per string),
+    //! the thread table (uint64_t thread id + uint64_t dropped events per thread) and finally all CpuTraceFileEvents.
+    bool SaveCpuTraceBinary(const CpuTraceCapture& capture, const char* outputFilePath);
+
+    //! Writes the capture in the Chrome trace event format, which can be loaded by chrome://tracing and Perfetto.
+    bool SaveCpuTraceChromeJson(const CpuTraceCapture& capture, const char* outputFilePath);
+
+    //! Header of the binary trace file.
+    struct CpuTraceFileHeader
+    {
+        static constexpr uint32_t CurrentVersion = 1;
+
+        char m_magic[4] = { 'O', '3', 'C', 'T' };
+        uint32_t m_version = CurrentVersion;
+        uint64_t m_ticksPerSecond = 0;
+        uint64_t m_eventCount = 0;
+        uint32_t m_stringCount = 0;
+        uint32_t m_threadCount = 0;
+        double m_scopeOverheadNs = 0.0;
+    };
+
+    //! Event as stored in the binary trace file. Names refer to entries in the string table.
+    struct CpuTraceFileEvent
+    {
+        static constexpr uint32_t NoString = ~0u;
+
+        uint64_t m_tick = 0;
+        uint32_t m_nameIndex = NoString;
+        uint32_t m_groupIndex = NoString;
+        uint16_t m_threadIndex = 0;
+        uint8_t m_type = 0;
+        uint8_t m_stackDepth = 0;
+        uint32_t m_reserved = 0;
+    };
+    static_assert(sizeof(CpuTraceFileEvent) == 24, "CpuTraceFileEvent is expected to be written without implicit padding.");
+} // namespace Profiler
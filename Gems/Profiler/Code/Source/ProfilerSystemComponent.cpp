@@ -8,6 +8,8 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -19,6 +21,10 @@ namespace Profiler
 {
     static constexpr AZ::Crc32 profilerServiceCrc = AZ_CRC_CE("ProfilerService");
 
+    AZ_CVAR(bool, profiler_traceCapture, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, captures record fixed size events into lock-free per-thread buffers instead of building time region maps. "
+        "The capture is saved in the Chrome trace format if the output file ends in .json, otherwise in the compact binary trace format.");
+
     struct DelayedFunction
     {
         using func_type = AZStd::function<void()>;
@@ -89,6 +95,40 @@ namespace Profiler
         return saveResult.IsSuccess();
     }
 
+    bool SerializeCpuTraceData(const CpuTraceCapture& capture, const AZStd::string& outputFilePath)
+    {
+        size_t eventCount = 0;
+        for (const CpuTraceThreadEvents& thread : capture.m_threads)
+        {
+            eventCount += thread.m_events.size();
+        }
+        AZ_TracePrintf("ProfilerSystemComponent", "Beginning serialization of %zu trace events from %zu threads\n",
+            eventCount, capture.m_threads.size());
+
+        const bool isChromeTrace = AZ::IO::PathView(outputFilePath).Extension() == ".json";
+        const bool saveResult = isChromeTrace
+            ? SaveCpuTraceChromeJson(capture, outputFilePath.c_str())
+            : SaveCpuTraceBinary(capture, outputFilePath.c_str());
+
+        AZStd::string captureInfo = outputFilePath;
+        if (!saveResult)
+        {
+            captureInfo = AZStd::string::format("Failed to save Cpu trace data to file '%s'.", outputFilePath.c_str());
+            AZ_Warning("ProfilerSystemComponent", false, captureInfo.c_str());
+        }
+        else
+        {
+            AZ_Printf("ProfilerSystemComponent", "Cpu trace was saved to file [%s]\n", outputFilePath.c_str());
+        }
+
+        // Notify listeners that the profiler capture has finished.
+        AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished,
+            saveResult,
+            captureInfo);
+
+        return saveResult;
+    }
+
     void ProfilerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -201,6 +241,10 @@ namespace Profiler
     bool ProfilerSystemComponent::StartCapture(AZStd::string outputFilePath)
     {
         m_captureFile = AZStd::move(outputFilePath);
+        if (profiler_traceCapture)
+        {
+            return m_cpuProfiler.BeginTraceCapture();
+        }
         return m_cpuProfiler.BeginContinuousCapture();
     }
 
@@ -215,6 +259,27 @@ namespace Profiler
             return false;
         }
 
+        if (m_cpuProfiler.IsTraceCaptureInProgress())
+        {
+            CpuTraceCapture traceResult;
+            m_cpuProfiler.EndTraceCapture(traceResult);
+
+            // Trace captures are consolidated already, but exporting them can still take a while so use the IO thread as well.
+            auto threadIoFunction =
+                [data = AZStd::move(traceResult), filePath = m_captureFile, &flag = m_cpuDataSerializationInProgress]()
+                {
+                    SerializeCpuTraceData(data, filePath);
+                    flag.store(false);
+                };
+
+            if (m_cpuDataSerializationThread.joinable())
+            {
+                m_cpuDataSerializationThread.join();
+            }
+            m_cpuDataSerializationThread = AZStd::thread(AZStd::move(threadIoFunction));
+            return true;
+        }
+
         AZStd::ring_buffer<TimeRegionMap> captureResult;
         const bool captureEnded = m_cpuProfiler.EndContinuousCapture(captureResult);
         if (!captureEnded)
@@ -247,6 +312,6 @@ namespace Profiler
 
     bool ProfilerSystemComponent::IsCaptureInProgress() const
     {
-        return m_cpuProfiler.IsContinuousCaptureInProgress();
+        return m_cpuProfiler.IsContinuousCaptureInProgress() || m_cpuProfiler.IsTraceCaptureInProgress();
     }
 } // namespace Profiler
@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuProfiler.h>
+#include <CpuTraceCapture.h>
+
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    namespace Internal
+    {
+        void PushTraceBegin(Profiler::CpuTraceEventBuffer& buffer, const char* groupName, const char* eventName, ...)
+        {
+            va_list args;
+            va_start(args, eventName);
+            buffer.PushBegin(groupName, eventName, args);
+            va_end(args);
+        }
+
+        // Checks that every end event closes a begin event at the same depth and returns the number of regions left open.
+        uint32_t ExpectBalanced(const AZStd::vector<Profiler::CpuTraceEvent>& events)
+        {
+            uint32_t depth = 0;
+            for (const Profiler::CpuTraceEvent& event : events)
+            {
+                if (event.m_type == Profiler::CpuTraceEvent::Type::Begin)
+                {
+                    EXPECT_EQ(depth, event.m_stackDepth);
+                    ++depth;
+                }
+                else
+                {
+                    EXPECT_GT(depth, 0u);
+                    if (depth == 0)
+                    {
+                        break;
+                    }
+                    --depth;
+                    EXPECT_EQ(depth, event.m_stackDepth);
+                }
+            }
+            return depth;
+        }
+    } // namespace Internal
+
+    using CpuTraceEventBufferTests = LeakDetectionFixture;
+
+    TEST_F(CpuTraceEventBufferTests, PushAndDrain_WrapsAroundCapacity_KeepsEventOrder)
+    {
+        using Profiler::CpuTraceEvent;
+        auto buffer = AZStd::make_unique<Profiler::CpuTraceEventBuffer>(AZStd::this_thread::get_id());
+
+        // Push in batches that don't divide the capacity, so the indices wrap in the middle of a batch several times.
+        constexpr uint32_t ScopesPerBatch = 1000;
+        constexpr uint32_t TotalScopes = Profiler::CpuTraceEventBuffer::Capacity * 3;
+        AZStd::vector<CpuTraceEvent> events;
+        uint32_t scopeIndex = 0;
+        while (scopeIndex < TotalScopes)
+        {
+            for (uint32_t i = 0; i < ScopesPerBatch; ++i, ++scopeIndex)
+            {
+                Internal::PushTraceBegin(*buffer, "Group", "Region %u", scopeIndex);
+                buffer->PushEnd();
+            }
+            EXPECT_EQ(ScopesPerBatch * 2, buffer->Drain(events));
+        }
+
+        EXPECT_EQ(0, buffer->GetDroppedEventCount());
+        ASSERT_EQ(scopeIndex * 2, events.size());
+        for (uint32_t i = 0; i < scopeIndex; ++i)
+        {
+            const CpuTraceEvent& begin = events[i * 2];
+            const CpuTraceEvent& end = events[i * 2 + 1];
+            ASSERT_EQ(CpuTraceEvent::Type::Begin, begin.m_type);
+            ASSERT_EQ(CpuTraceEvent::Type::End, end.m_type);
+            EXPECT_STREQ(AZStd::string::format("Region %u", i).c_str(), begin.m_name);
+            EXPECT_STREQ("Group", begin.m_groupName);
+            EXPECT_LE(begin.m_tick, end.m_tick);
+        }
+    }
+
+    TEST_F(CpuTraceEventBufferTests, PushBegin_BufferFull_DropsWholeRegionsAndKeepsEventsBalanced)
+    {
+        using Profiler::CpuTraceEvent;
+        auto buffer = AZStd::make_unique<Profiler::CpuTraceEventBuffer>(AZStd::this_thread::get_id());
+
+        // Nothing is drained while recording, so most of the nested regions have to be dropped.
+        constexpr uint32_t ChildCount = Profiler::CpuTraceEventBuffer::Capacity;
+        Internal::PushTraceBegin(*buffer, "Group", "Outer");
+        for (uint32_t i = 0; i < ChildCount; ++i)
+        {
+            Internal::PushTraceBegin(*buffer, "Group", "Child %u", i);
+            Internal::PushTraceBegin(*buffer, "Group", "Grandchild %u", i);
+            buffer->PushEnd();
+            buffer->PushEnd();
+        }
+        buffer->PushEnd();
+
+        AZStd::vector<CpuTraceEvent> events;
+        buffer->Drain(events);
+        const uint64_t pushedEvents = 2 + ChildCount * 4;
+        EXPECT_GT(buffer->GetDroppedEventCount(), 0);
+        EXPECT_EQ(pushedEvents, events.size() + buffer->GetDroppedEventCount());
+        EXPECT_LE(events.size(), Profiler::CpuTraceEventBuffer::Capacity);
+
+        // The end event of the outer region always has a slot reserved for it.
+        EXPECT_EQ(0, Internal::ExpectBalanced(events));
+        ASSERT_FALSE(events.empty());
+        EXPECT_STREQ("Outer", events.front().m_name);
+        EXPECT_EQ(CpuTraceEvent::Type::End, events.back().m_type);
+        EXPECT_EQ(0, events.back().m_stackDepth);
+
+        // Once drained, the buffer records again.
+        Internal::PushTraceBegin(*buffer, "Group", "AfterDrain");
+        buffer->PushEnd();
+        events.clear();
+        EXPECT_EQ(2, buffer->Drain(events));
+    }
+
+    TEST_F(CpuTraceEventBufferTests, PushEnd_WithoutOpenRegion_IsIgnored)
+    {
+        auto buffer = AZStd::make_unique<Profiler::CpuTraceEventBuffer>(AZStd::this_thread::get_id());
+        buffer->PushEnd();
+
+        AZStd::vector<Profiler::CpuTraceEvent> events;
+        EXPECT_EQ(0, buffer->Drain(events));
+        EXPECT_EQ(0, buffer->GetDroppedEventCount());
+    }
+
+    class CpuTraceExportTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_priorFileIO = AZ::IO::FileIOBase::GetInstance();
+            m_localFileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_localFileIO.get());
+
+            m_capture.m_ticksPerSecond = 1'000'000;
+            m_capture.m_scopeOverheadNs = 12.5;
+            Profiler::CpuTraceThreadEvents& mainThread = m_capture.m_threads.emplace_back();
+            mainThread.m_threadId = AZStd::this_thread::get_id();
+            mainThread.m_events.push_back(MakeEvent(Profiler::CpuTraceEvent::Type::Begin, 10, 0, "Frame", "Game"));
+            mainThread.m_events.push_back(MakeEvent(Profiler::CpuTraceEvent::Type::Begin, 20, 1, "Quote\" \\Slash\n", "Game"));
+            mainThread.m_events.push_back(MakeEvent(Profiler::CpuTraceEvent::Type::End, 30, 1));
+            mainThread.m_events.push_back(MakeEvent(Profiler::CpuTraceEvent::Type::End, 40, 0));
+            Profiler::CpuTraceThreadEvents& workerThread = m_capture.m_threads.emplace_back();
+            workerThread.m_droppedEvents = 7;
+            workerThread.m_events.push_back(MakeEvent(Profiler::CpuTraceEvent::Type::Begin, 15, 0, "Frame", "Worker"));
+            workerThread.m_events.push_back(MakeEvent(Profiler::CpuTraceEvent::Type::End, 25, 0));
+        }
+
+        void TearDown() override
+        {
+            m_capture = {};
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_priorFileIO);
+            m_localFileIO.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        static Profiler::CpuTraceEvent MakeEvent(
+            Profiler::CpuTraceEvent::Type type, AZStd::sys_time_t tick, uint8_t depth, const char* name = "", const char* group = nullptr)
+        {
+            Profiler::CpuTraceEvent event;
+            event.m_type = type;
+            event.m_tick = tick;
+            event.m_stackDepth = depth;
+            event.m_groupName = group;
+            azstrncpy(event.m_name, Profiler::CpuTraceEvent::MaxNameLength, name, strlen(name) + 1);
+            return event;
+        }
+
+        template<typename T>
+        static T ReadValue(const AZStd::vector<AZStd::byte>& data, size_t& offset)
+        {
+            T value{};
+            EXPECT_LE(offset + sizeof(T), data.size());
+            if (offset + sizeof(T) <= data.size())
+            {
+                memcpy(&value, data.data() + offset, sizeof(T));
+            }
+            offset += sizeof(T);
+            return value;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::FileIOBase* m_priorFileIO = nullptr;
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_localFileIO;
+        Profiler::CpuTraceCapture m_capture;
+    };
+
+    TEST_F(CpuTraceExportTests, SaveCpuTraceBinary_WritesHeaderStringsThreadsAndEvents)
+    {
+        const AZ::IO::Path filePath = m_tempDirectory.Resolve("capture.bin");
+        ASSERT_TRUE(Profiler::SaveCpuTraceBinary(m_capture, filePath.c_str()));
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZStd::byte>>(filePath.Native());
+        ASSERT_TRUE(readResult.IsSuccess());
+        const AZStd::vector<AZStd::byte>& data = readResult.GetValue();
+
+        size_t offset = 0;
+        const auto header = ReadValue<Profiler::CpuTraceFileHeader>(data, offset);
+        EXPECT_EQ(0, memcmp(header.m_magic, "O3CT", 4));
+        EXPECT_EQ(Profiler::CpuTraceFileHeader::CurrentVersion, header.m_version);
+        EXPECT_EQ(1'000'000, header.m_ticksPerSecond);
+        EXPECT_EQ(6, header.m_eventCount);
+        EXPECT_EQ(2, header.m_threadCount);
+        EXPECT_DOUBLE_EQ(12.5, header.m_scopeOverheadNs);
+
+        // Names and groups are stored once each, in the order they're first used.
+        const char* expectedStrings[] = { "Frame", "Game", "Quote\" \\Slash\n", "Worker" };
+        ASSERT_EQ(AZ_ARRAY_SIZE(expectedStrings), header.m_stringCount);
+        AZStd::vector<AZStd::string> strings;
+        for (uint32_t i = 0; i < header.m_stringCount; ++i)
+        {
+            const auto length = ReadValue<uint16_t>(data, offset);
+            ASSERT_LE(offset + length, data.size());
+            strings.emplace_back(reinterpret_cast<const char*>(data.data() + offset), length);
+            offset += length;
+            EXPECT_STREQ(expectedStrings[i], strings.back().c_str());
+        }
+
+        ReadValue<uint64_t>(data, offset); // Thread id
+        EXPECT_EQ(0, ReadValue<uint64_t>(data, offset));
+        ReadValue<uint64_t>(data, offset);
+        EXPECT_EQ(7, ReadValue<uint64_t>(data, offset));
+
+        AZStd::vector<Profiler::CpuTraceFileEvent> events;
+        for (uint64_t i = 0; i < header.m_eventCount; ++i)
+        {
+            events.push_back(ReadValue<Profiler::CpuTraceFileEvent>(data, offset));
+        }
+        EXPECT_EQ(data.size(), offset);
+
+        ASSERT_EQ(6, events.size());
+        EXPECT_EQ(20, events[1].m_tick);
+        EXPECT_EQ(1, events[1].m_stackDepth);
+        EXPECT_EQ(static_cast<uint8_t>(Profiler::CpuTraceEvent::Type::Begin), events[1].m_type);
+        EXPECT_EQ("Quote\" \\Slash\n", strings[events[1].m_nameIndex]);
+        EXPECT_EQ("Game", strings[events[1].m_groupIndex]);
+        EXPECT_EQ(static_cast<uint8_t>(Profiler::CpuTraceEvent::Type::End), events[2].m_type);
+        EXPECT_EQ(Profiler::CpuTraceFileEvent::NoString, events[2].m_nameIndex);
+        EXPECT_EQ(1, events[4].m_threadIndex);
+        EXPECT_EQ("Frame", strings[events[4].m_nameIndex]);
+        EXPECT_EQ("Worker", strings[events[4].m_groupIndex]);
+    }
+
+    TEST_F(CpuTraceExportTests, SaveCpuTraceChromeJson_WritesValidTraceEvents)
+    {
+        const AZ::IO::Path filePath = m_tempDirectory.Resolve("capture.json");
+        ASSERT_TRUE(Profiler::SaveCpuTraceChromeJson(m_capture, filePath.c_str()));
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::string>(filePath.Native());
+        ASSERT_TRUE(readResult.IsSuccess());
+
+        rapidjson::Document document;
+        document.Parse(readResult.GetValue().c_str());
+        ASSERT_FALSE(document.HasParseError());
+
+        ASSERT_TRUE(document.HasMember("traceEvents"));
+        const rapidjson::Value& traceEvents = document["traceEvents"];
+        ASSERT_TRUE(traceEvents.IsArray());
+        ASSERT_EQ(6, traceEvents.Size());
+
+        const rapidjson::Value& nested = traceEvents[1];
+        EXPECT_STREQ("B", nested["ph"].GetString());
+        EXPECT_STREQ("Quote\" \\Slash\n", nested["name"].GetString());
+        EXPECT_STREQ("Game", nested["cat"].GetString());
+        EXPECT_DOUBLE_EQ(20.0, nested["ts"].GetDouble());
+        EXPECT_STREQ("E", traceEvents[2]["ph"].GetString());
+        EXPECT_FALSE(traceEvents[2].HasMember("name"));
+        EXPECT_NE(traceEvents[0]["tid"].GetUint64(), traceEvents[4]["tid"].GetUint64());
+
+        const rapidjson::Value& otherData = document["otherData"];
+        EXPECT_DOUBLE_EQ(12.5, otherData["scopeOverheadNs"].GetDouble());
+        const AZStd::string droppedKey = AZStd::string::format("droppedEvents_%zu", AZStd::hash<AZStd::thread_id>{}(AZStd::thread_id{}));
+        ASSERT_TRUE(otherData.HasMember(droppedKey.c_str()));
+        EXPECT_EQ(7, otherData[droppedKey.c_str()].GetUint64());
+    }
+
+    class CpuProfilerTraceCaptureTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_budget = AZStd::make_unique<AZ::Debug::Budget>("CpuProfilerTraceCaptureTests");
+            m_profiler = AZStd::make_unique<Profiler::CpuProfiler>();
+            m_profiler->Init();
+        }
+
+        void TearDown() override
+        {
+            m_profiler->Shutdown();
+            m_profiler.reset();
+            m_budget.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        const AZStd::vector<Profiler::CachedTimeRegion>* FindTimeRegions(const char* regionName) const
+        {
+            const Profiler::TimeRegionMap& timeRegionMap = m_profiler->GetTimeRegionMap();
+            if (auto threadIt = timeRegionMap.find(AZStd::this_thread::get_id()); threadIt != timeRegionMap.end())
+            {
+                if (auto regionIt = threadIt->second.find(regionName); regionIt != threadIt->second.end())
+                {
+                    return &regionIt->second;
+                }
+            }
+            return nullptr;
+        }
+
+        static const Profiler::CpuTraceThreadEvents* FindThreadEvents(const Profiler::CpuTraceCapture& capture, AZStd::thread_id threadId)
+        {
+            for (const Profiler::CpuTraceThreadEvents& thread : capture.m_threads)
+            {
+                if (thread.m_threadId == threadId)
+                {
+                    return &thread;
+                }
+            }
+            return nullptr;
+        }
+
+        AZStd::unique_ptr<AZ::Debug::Budget> m_budget;
+        AZStd::unique_ptr<Profiler::CpuProfiler> m_profiler;
+    };
+
+    TEST_F(CpuProfilerTraceCaptureTests, RegionBeganBeforeCapture_EndsOnTimeRegionStack)
+    {
+        m_profiler->SetProfilerEnabled(true);
+        m_profiler->BeginRegion(m_budget.get(), "Outer");
+
+        ASSERT_TRUE(m_profiler->BeginTraceCapture());
+        m_profiler->BeginRegion(m_budget.get(), "Inner");
+        m_profiler->EndRegion(m_budget.get());
+        m_profiler->EndRegion(m_budget.get());
+
+        Profiler::CpuTraceCapture capture;
+        ASSERT_TRUE(m_profiler->EndTraceCapture(capture));
+
+        // Only the region that began during the capture is part of it
+        const Profiler::CpuTraceThreadEvents* threadEvents = FindThreadEvents(capture, AZStd::this_thread::get_id());
+        ASSERT_NE(nullptr, threadEvents);
+        ASSERT_EQ(2, threadEvents->m_events.size());
+        EXPECT_STREQ("Inner", threadEvents->m_events[0].m_name);
+        EXPECT_EQ(0, Internal::ExpectBalanced(threadEvents->m_events));
+
+        // The outer region was popped off the time region stack, which completes it
+        m_profiler->OnSystemTick();
+        const AZStd::vector<Profiler::CachedTimeRegion>* outerRegions = FindTimeRegions("Outer");
+        ASSERT_NE(nullptr, outerRegions);
+        ASSERT_EQ(1, outerRegions->size());
+        EXPECT_EQ(0, outerRegions->front().m_stackDepth);
+    }
+
+    TEST_F(CpuProfilerTraceCaptureTests, RegionBeganInCapture_EndsAfterCaptureWithoutPoppingTimeRegions)
+    {
+        m_profiler->SetProfilerEnabled(true);
+        m_profiler->BeginRegion(m_budget.get(), "Outer");
+
+        ASSERT_TRUE(m_profiler->BeginTraceCapture());
+        m_profiler->BeginRegion(m_budget.get(), "Inner");
+        Profiler::CpuTraceCapture capture;
+        ASSERT_TRUE(m_profiler->EndTraceCapture(capture));
+        m_profiler->EndRegion(m_budget.get());
+
+        // The outer region is still open, so a new region is nested in it
+        m_profiler->BeginRegion(m_budget.get(), "Sibling");
+        m_profiler->EndRegion(m_budget.get());
+        m_profiler->EndRegion(m_budget.get());
+
+        m_profiler->OnSystemTick();
+        const AZStd::vector<Profiler::CachedTimeRegion>* siblingRegions = FindTimeRegions("Sibling");
+        ASSERT_NE(nullptr, siblingRegions);
+        ASSERT_EQ(1, siblingRegions->size());
+        EXPECT_EQ(1, siblingRegions->front().m_stackDepth);
+        EXPECT_NE(nullptr, FindTimeRegions("Outer"));
+        EXPECT_EQ(nullptr, FindTimeRegions("Inner"));
+    }
+
+    TEST_F(CpuProfilerTraceCaptureTests, RestartedCaptures_WhileThreadsRecord_KeepEventsBalanced)
+    {
+        AZStd::atomic_bool stop{ false };
+        AZStd::vector<AZStd::thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back(
+                [this, &stop]()
+                {
+                    while (!stop.load())
+                    {
+                        m_profiler->BeginRegion(m_budget.get(), "Outer");
+                        m_profiler->BeginRegion(m_budget.get(), "Inner");
+                        m_profiler->EndRegion(m_budget.get());
+                        m_profiler->EndRegion(m_budget.get());
+                    }
+                });
+        }
+
+        // Every restart retires the buffers of the previous capture while the threads keep pushing to them
+        for (int captureIndex = 0; captureIndex < 20; ++captureIndex)
+        {
+            ASSERT_TRUE(m_profiler->BeginTraceCapture());
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            Profiler::CpuTraceCapture capture;
+            ASSERT_TRUE(m_profiler->EndTraceCapture(capture));
+            for (const Profiler::CpuTraceThreadEvents& thread : capture.m_threads)
+            {
+                // Regions that are still open when the capture ends don't have an end event
+                EXPECT_LE(Internal::ExpectBalanced(thread.m_events), 2u);
+            }
+        }
+
+        // Shutting down with a capture in progress frees the buffers once the threads stopped using them
+        ASSERT_TRUE(m_profiler->BeginTraceCapture());
+        m_profiler->Shutdown();
+        stop = true;
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    TEST_F(CpuProfilerTraceCaptureTests, BackToBackCaptures_WhileThreadsRecordAndExit_FreeEveryRetiredBuffer)
+    {
+        // Captures start and end without a pause, so threads are often between picking up their buffer and pushing to it
+        // when the buffer is retired, and the consolidation thread of the next capture frees retired buffers concurrently.
+        constexpr int CaptureCount = 500;
+        constexpr int RecordingThreadCount = 4;
+
+        AZStd::atomic_bool stop{ false };
+        AZStd::atomic<uint64_t> recordedRegions{ 0 };
+        auto recordRegions = [this, &recordedRegions](int regionCount)
+        {
+            for (int i = 0; i < regionCount; ++i)
+            {
+                m_profiler->BeginRegion(m_budget.get(), "Outer %d", i);
+                m_profiler->BeginRegion(m_budget.get(), "Inner");
+                m_profiler->EndRegion(m_budget.get());
+                m_profiler->EndRegion(m_budget.get());
+            }
+            recordedRegions.fetch_add(regionCount);
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int i = 0; i < RecordingThreadCount; ++i)
+        {
+            threads.emplace_back(
+                [&stop, &recordRegions]()
+                {
+                    while (!stop.load())
+                    {
+                        recordRegions(16);
+                    }
+                });
+        }
+
+        // Short lived threads leave buffers behind, and their thread ids can be reused by the next ones
+        threads.emplace_back(
+            [&stop, &recordRegions]()
+            {
+                while (!stop.load())
+                {
+                    AZStd::thread shortLivedThread(
+                        [&recordRegions]()
+                        {
+                            recordRegions(4);
+                        });
+                    shortLivedThread.join();
+                }
+            });
+
+        size_t capturedThreads = 0;
+        for (int captureIndex = 0; captureIndex < CaptureCount; ++captureIndex)
+        {
+            ASSERT_TRUE(m_profiler->BeginTraceCapture());
+            Profiler::CpuTraceCapture capture;
+            ASSERT_TRUE(m_profiler->EndTraceCapture(capture));
+            for (const Profiler::CpuTraceThreadEvents& thread : capture.m_threads)
+            {
+                EXPECT_LE(Internal::ExpectBalanced(thread.m_events), 2u);
+            }
+            capturedThreads += capture.m_threads.size();
+        }
+
+        stop = true;
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_GT(recordedRegions.load(), 0u);
+        EXPECT_GT(capturedThreads, 0u);
+
+        // Shutdown waits until every retired buffer is freed, which only finishes if no thread record still refers to one
+        m_profiler->Shutdown();
+    }
+} // namespace UnitTest
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
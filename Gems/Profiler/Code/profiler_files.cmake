@@ -10,6 +10,8 @@ set(FILES
     Include/Profiler/ProfilerImGuiBus.h
     Source/CpuProfiler.h
     Source/CpuProfiler.cpp
+    Source/CpuTraceCapture.h
+    Source/CpuTraceCapture.cpp
     Source/ProfilerSystemComponent.cpp
     Source/ProfilerSystemComponent.h
 )